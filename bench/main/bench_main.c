@@ -0,0 +1,476 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <string.h>
+    #include <math.h>                     // For the input vectors
+
+    /* --- Benchmark Harness --- */
+    #include "bench.h"
+
+    /* --- Kernels Under Test --- */
+    #include "adc.h"
+    #include "adc_frame.h"
+    #include "dsp_biquad.h"
+    #include "dsp_bandpower.h"
+    #include "dsp_decim.h"                // Oversampling front end (polyphase vs full rate)
+    #include "dsp_fixed.h"                // Q15 backend (compared against float below)
+    #include "dsp_simd.h"                 // Vector kernels (compared against their references)
+    #include "dsp_spectral.h"
+    #include "ble_stream.h"
+    #include "ble_pkt.h"                  // Versioned event packets (blink / attention)
+    #include "ble_txq.h"                  // BLE_TXQ_MAX_DATA (packet size)
+    #include "eeg_codec.h"                // Lossless block codec
+    #include "recorder.h"                 // Session log page ring (RAM storage)
+
+//
+// DSP microbenchmarks: every kernel of the filter -> detect -> stream path, timed over fixed
+// input vectors and reported as cycles/sample, ns/sample and samples/s (JSON or CSV).
+//
+//      BENCH_FORMAT   json (default) | csv
+//      BENCH_RUNS     timed passes per kernel (default BENCH_DEFAULT_RUNS)
+//      BENCH_WARMUP   untimed passes per kernel (default BENCH_DEFAULT_WARMUP)
+//
+// On the device the variables are unset and the defaults apply; the report goes to the console.
+//
+
+#ifndef BENCH_VERSION
+#define BENCH_VERSION "unknown"           // Set from git describe by main/CMakeLists.txt
+#endif
+
+#define BENCH_LEN  1024                   // Samples per pass for the per-sample kernels
+
+static int16_t bench_in[BENCH_LEN];       // 10 Hz, 100 µV sine: drives the filters
+static int16_t bench_quiet[BENCH_LEN];    // 10 Hz, 2 µV sine: below the blink threshold
+static int16_t bench_out[BENCH_LEN];
+static volatile int32_t bench_sink;       // Keeps results observable so nothing is optimized away
+
+
+// =============================
+// Input Vectors
+// =============================
+static void bench_build_inputs(void) {
+    for (int n = 0; n < BENCH_LEN; n++) {
+        float phase = 2.0f * (float)M_PI * 10.0f * n / (float)SAMPLE_RATE_HZ;
+        bench_in[n] = (int16_t)lrintf(1000.0f * sinf(phase));
+        bench_quiet[n] = (int16_t)lrintf(20.0f * sinf(phase));
+    }
+}
+
+
+// =============================
+// Kernels: Bandpass
+// =============================
+static void setup_bandpass(void *ctx) {
+    adc_pipeline_init();
+}
+
+static void run_bandpass_single(void *ctx) {
+    for (int n = 0; n < BENCH_LEN; n++) bench_out[n] = apply_bandpass_iir(bench_in[n]);
+    bench_sink = bench_out[BENCH_LEN - 1];
+}
+
+static void run_bandpass_block(void *ctx) {
+    apply_bandpass_iir_block(bench_in, bench_out, BENCH_LEN / ADC_NUM_CHANNELS);
+    bench_sink = bench_out[BENCH_LEN - 1];
+}
+
+
+// =============================
+// Kernels: Multi-Channel Biquad (1 / 4 / 8 channels)
+// =============================
+typedef struct {
+    biquad_multi_t filter;
+    uint8_t channels;
+} bench_multi_ctx_t;
+
+static void setup_biquad_multi(void *ctx) {
+    bench_multi_ctx_t *m = ctx;
+    const biquad_coeffs_t sec = { bp_b[0], bp_b[1], bp_b[2], bp_a[1], bp_a[2] };
+    biquad_multi_init(&m->filter, &sec, 1, m->channels);
+}
+
+static void run_biquad_multi(void *ctx) {
+    bench_multi_ctx_t *m = ctx;
+    biquad_multi_process(&m->filter, bench_in, bench_out, BENCH_LEN / m->channels);
+    bench_sink = bench_out[0];
+}
+
+
+// =============================
+// Kernels: Q15 Biquad (1 / 4 / 8 channels)
+// =============================
+typedef struct {
+    biquad_q15_t filter;
+    uint8_t channels;
+} bench_q15_ctx_t;
+
+static void setup_biquad_q15(void *ctx) {
+    bench_q15_ctx_t *m = ctx;
+    const biquad_coeffs_t sec = { bp_b[0], bp_b[1], bp_b[2], bp_a[1], bp_a[2] };
+    biquad_q15_init(&m->filter, &sec, 1, m->channels);
+}
+
+static void run_biquad_q15(void *ctx) {
+    bench_q15_ctx_t *m = ctx;
+    biquad_q15_process(&m->filter, bench_in, bench_out, BENCH_LEN / m->channels);
+    bench_sink = bench_out[0];
+}
+
+
+// =============================
+// Kernels: Vector vs Scalar Reference (1 / 4 / 8 channels)
+// =============================
+// One bandpass section over BENCH_LEN float samples, as biquad_multi_process runs it per chunk.
+// The input is copied in each pass so both variants filter the same data.
+typedef struct {
+    void (*kernel)(const biquad_coeffs_t *, biquad_state_t *, uint8_t, float *, size_t);
+    uint8_t channels;
+    biquad_state_t state[BIQUAD_MAX_CHANNELS];
+} bench_section_ctx_t;
+
+static float bench_f32[BENCH_LEN] DSP_SIMD_ALIGNED;
+static float bench_work[BENCH_LEN] DSP_SIMD_ALIGNED;
+
+static void setup_section(void *ctx) {
+    bench_section_ctx_t *m = ctx;
+    memset(m->state, 0, sizeof(m->state));
+    for (int n = 0; n < BENCH_LEN; n++) bench_f32[n] = (float)bench_in[n];
+}
+
+static void run_section(void *ctx) {
+    bench_section_ctx_t *m = ctx;
+    const biquad_coeffs_t sec = { bp_b[0], bp_b[1], bp_b[2], bp_a[1], bp_a[2] };
+    memcpy(bench_work, bench_f32, sizeof(bench_work));
+    m->kernel(&sec, m->state, m->channels, bench_work, BENCH_LEN / m->channels);
+    bench_sink = (int32_t)bench_work[BENCH_LEN - 1];
+}
+
+static void run_dot_f32(void *ctx) {
+    bench_sink = (int32_t)dsp_dot_f32(bench_f32, bench_f32, BENCH_LEN);
+}
+
+static void run_dot_f32_ref(void *ctx) {
+    bench_sink = (int32_t)dsp_dot_f32_ref(bench_f32, bench_f32, BENCH_LEN);
+}
+
+static void run_dot_s16(void *ctx) {
+    bench_sink = (int32_t)dsp_dot_s16(bench_in, bench_quiet, BENCH_LEN);
+}
+
+static void run_dot_s16_ref(void *ctx) {
+    bench_sink = (int32_t)dsp_dot_s16_ref(bench_in, bench_quiet, BENCH_LEN);
+}
+
+
+// =============================
+// Kernels: Decimation (1 kHz / 2 kHz -> 100 Hz)
+// =============================
+// The front end's chain two ways: polyphase, and every stage computing its FIR at its full input
+// rate before a plain downsampler (bit-identical output). Units are input samples.
+typedef struct {
+    decim_chain_t chain;
+    uint16_t factor;
+    uint8_t channels;
+    bool fullrate;
+} bench_decim_ctx_t;
+
+static void setup_decim(void *ctx) {
+    bench_decim_ctx_t *m = ctx;
+    decim_chain_init(&m->chain, m->factor, 100.0f * m->factor, m->channels, 3);
+}
+
+static void run_decim(void *ctx) {
+    bench_decim_ctx_t *m = ctx;
+    size_t frames = BENCH_LEN / m->channels;
+    size_t n = m->fullrate ? decim_chain_process_fullrate(&m->chain, bench_in, bench_out, frames)
+                           : decim_chain_process(&m->chain, bench_in, bench_out, frames);
+    bench_sink = bench_out[n - 1];
+}
+
+
+// =============================
+// Kernels: Alpha / Spectral
+// =============================
+static void run_alpha_score(void *ctx) {
+    bench_sink = compute_alpha_score(bench_in, BUFFER_SIZE);   // Batch Goertzel over one window
+}
+
+static void run_goertzel(void *ctx) {
+    static float coeff;
+    if (coeff == 0.0f) coeff = goertzel_coeff(10.0f, SAMPLE_RATE_HZ);
+    bench_sink = (int32_t)goertzel_power_coeff(bench_in, BUFFER_SIZE, coeff);
+}
+
+static void run_goertzel_q15(void *ctx) {
+    static int32_t coeff;
+    if (coeff == 0) coeff = goertzel_q15_coeff(10.0f, SAMPLE_RATE_HZ);
+    bench_sink = (int32_t)goertzel_power_q15(bench_in, BUFFER_SIZE, coeff);
+}
+
+// Local trackers with the alpha bins, so both backends are timed whichever one adc.c runs
+static const float bench_alpha_hz[ALPHA_BAND_BINS] = { 8.0f, 9.0f, 10.0f, 11.0f, 12.0f };
+static sliding_dft_t bench_sdft;
+static sliding_dft_q15_t bench_sdft_q15;
+
+static void setup_sliding_dft(void *ctx) {
+    static int16_t history[BUFFER_SIZE];
+    sliding_dft_init(&bench_sdft, history, BUFFER_SIZE, bench_alpha_hz, ALPHA_BAND_BINS, SAMPLE_RATE_HZ);
+}
+
+static void run_sliding_dft(void *ctx) {
+    for (int n = 0; n < BENCH_LEN; n++) sliding_dft_update(&bench_sdft, bench_in[n]);
+    bench_sink = (int32_t)sliding_dft_band_power(&bench_sdft);
+}
+
+static void setup_sliding_dft_q15(void *ctx) {
+    static int16_t history[BUFFER_SIZE];
+    sliding_dft_q15_init(&bench_sdft_q15, history, BUFFER_SIZE, bench_alpha_hz, ALPHA_BAND_BINS, SAMPLE_RATE_HZ);
+}
+
+static void run_sliding_dft_q15(void *ctx) {
+    for (int n = 0; n < BENCH_LEN; n++) sliding_dft_q15_update(&bench_sdft_q15, bench_in[n]);
+    bench_sink = (int32_t)sliding_dft_q15_band_power(&bench_sdft_q15);
+}
+
+static void setup_spectral(void *ctx) {
+    adc_pipeline_init();
+}
+
+static void run_spectral_push(void *ctx) {
+    // Amortized: BENCH_LEN / SPECTRAL_HOP segments per pass
+    spectral_engine_t *engine = &adc_spectral_state->engine[0];
+    for (int n = 0; n < BENCH_LEN; n++) spectral_push(engine, bench_in[n]);
+    bench_sink = engine->result.segments;
+}
+
+static void run_spectral_fft(void *ctx) {
+    static float work[SPECTRAL_FFT_SIZE];
+    static float power[SPECTRAL_NUM_BINS];
+    for (int n = 0; n < SPECTRAL_FFT_SIZE; n++) work[n] = (float)bench_in[n];
+    spectral_fft_power(work, power);
+    bench_sink = (int32_t)power[SPECTRAL_NUM_BINS / 2];
+}
+
+
+// =============================
+// Kernels: Detection + Whole Pipeline
+// =============================
+static void setup_detect(void *ctx) {
+    adc_pipeline_init();
+}
+
+static void run_detect_events(void *ctx) {
+    for (int n = 0; n < BENCH_LEN; n++) detect_events(bench_quiet[n]);
+    bench_sink = attention_level;
+}
+
+static void setup_pipeline(void *ctx) {
+    adc_pipeline_init();
+}
+
+static void run_process_block(void *ctx) {
+    // The whole stage graph (bandpass -> filtered_ring -> detect -> spectral), as the filtering task runs it
+    adc_process_block(bench_quiet, NULL, BENCH_LEN / ADC_NUM_CHANNELS);
+    bench_sink = attention_level;
+}
+
+
+// =============================
+// Kernels: Acquisition + Streaming
+// =============================
+static uint8_t bench_dma[ADC_CONV_FRAME_BYTES];
+
+static void setup_frame_decode(void *ctx) {
+    adc_frame_mock_t mock;
+    adc_frame_mock_init(&mock, 6, 20000.0f, 10.0f, 500.0f, 2048.0f);
+    adc_frame_mock_fill(&mock, bench_dma, sizeof(bench_dma));
+}
+
+static void run_frame_decode(void *ctx) {
+    static int decoded[ADC_CONV_FRAME_BYTES / ADC_FRAME_RESULT_BYTES];
+    const uint8_t channel = 6;
+    adc_frame_decoder_t dec;
+    adc_frame_decoder_init(&dec, &channel, 1, 1);
+    bench_sink = (int32_t)adc_frame_decode(&dec, bench_dma, sizeof(bench_dma), decoded,
+                                           sizeof(decoded) / sizeof(decoded[0]));
+}
+
+static void run_pack12(void *ctx) {
+    static uint8_t packed[BLE_STREAM_MAX_PAYLOAD];
+    bench_sink = (int32_t)ble_stream_pack12(bench_in, BLE_STREAM_MAX_SAMPLES, packed);
+}
+
+// Event packets: batched blink packets (header + 2 records, 19 bytes), BENCH_PKTS per pass
+#define BENCH_PKTS  64
+
+static uint8_t bench_pkt[BLE_TXQ_MAX_DATA];
+static size_t bench_pkt_len;
+
+static void run_pkt_encode(void *ctx) {
+    ble_pkt_writer_t w;
+    for (uint32_t n = 0; n < BENCH_PKTS; n++) {
+        ble_pkt_begin(&w, bench_pkt, sizeof(bench_pkt), BLE_PKT_TYPE_BLINK, (uint16_t)n, n * 1000u);
+        ble_pkt_add_blink(&w, n * 1000u, 2 * n);
+        ble_pkt_add_blink(&w, n * 1000u + 250000u, 2 * n + 1);
+    }
+    bench_pkt_len = w.len;
+    bench_sink = (int32_t)w.len;
+}
+
+static void run_pkt_decode(void *ctx) {
+    ble_pkt_record_t rec[BLE_PKT_MAX_RECORDS(BLE_TXQ_MAX_DATA)];
+    int32_t records = 0;
+    for (int n = 0; n < BENCH_PKTS; n++) {
+        records += ble_pkt_decode(bench_pkt, bench_pkt_len, NULL, rec, sizeof(rec) / sizeof(rec[0]));
+    }
+    bench_sink = records;
+}
+
+// =============================
+// Kernels: Codec + Session Recorder
+// =============================
+// The page ring runs on RAM storage, so recorder_append_samples times compression + page
+// bookkeeping + CRC (erase / write / verify become memset / AND / memcmp); real flash time adds
+// on top of it.
+#define BENCH_REC_PAGES  16
+
+static uint8_t bench_rec_mem[BENCH_REC_PAGES * RECORDER_PAGE_SIZE];
+static rec_storage_ram_t bench_rec_ram;
+static recorder_t bench_rec;
+
+typedef struct {
+    uint8_t channels;
+    size_t  len;                          // Encoded size of the block (decode input)
+} bench_codec_ctx_t;
+
+static uint8_t bench_codec_buf[EEG_CODEC_MAX_SIZE(BENCH_LEN, 1)];
+
+// bench_in as `channels` interleaved channels: BENCH_LEN samples per pass either way
+static void run_codec_encode(void *ctx) {
+    bench_codec_ctx_t *c = ctx;
+    c->len = eeg_codec_encode(bench_in, (uint16_t)(BENCH_LEN / c->channels), c->channels, 0,
+                              bench_codec_buf, sizeof(bench_codec_buf));
+    bench_sink = (int32_t)c->len;
+}
+
+static void setup_codec_decode(void *ctx) {
+    run_codec_encode(ctx);
+}
+
+static void run_codec_decode(void *ctx) {
+    bench_codec_ctx_t *c = ctx;
+    bench_sink = (int32_t)eeg_codec_decode(bench_codec_buf, c->len, bench_out, BENCH_LEN, NULL);
+}
+
+static void setup_recorder(void *ctx) {
+    recorder_mount(&bench_rec, rec_storage_ram_init(&bench_rec_ram, bench_rec_mem, sizeof(bench_rec_mem), 4096));
+}
+
+static void run_recorder_append(void *ctx) {
+    for (int b = 0; b < BENCH_LEN; b += RECORDER_BLOCK_FRAMES) {
+        recorder_append_samples(&bench_rec, &bench_in[b], RECORDER_BLOCK_FRAMES, 1, (uint32_t)b);
+    }
+    bench_sink = (int32_t)bench_rec.fill;
+}
+
+
+// =============================
+// Helper: Integer From the Environment
+// =============================
+static uint32_t env_u32(const char *name, uint32_t fallback) {
+    const char *v = getenv(name);
+    return (v && *v) ? (uint32_t)strtoul(v, NULL, 10) : fallback;
+}
+
+
+// =============================
+// Benchmark Application Entry Point
+// =============================
+void app_main(void)
+{
+    static bench_multi_ctx_t multi[3] = { {.channels = 1}, {.channels = 4}, {.channels = 8} };
+    static bench_q15_ctx_t q15[3] = { {.channels = 1}, {.channels = 4}, {.channels = 8} };
+    static bench_codec_ctx_t codec[2] = { {.channels = 1}, {.channels = 8} };
+    static bench_decim_ctx_t decim[5] = {
+        { .factor = 10, .channels = 1, .fullrate = true }, { .factor = 10, .channels = 1 },
+        { .factor = 20, .channels = 1, .fullrate = true }, { .factor = 20, .channels = 1 },
+        { .factor = 10, .channels = 8 },
+    };
+    static bench_section_ctx_t section[6] = {
+        { .kernel = dsp_biquad_section_multi, .channels = 1 }, { .kernel = dsp_biquad_section_multi_ref, .channels = 1 },
+        { .kernel = dsp_biquad_section_multi, .channels = 4 }, { .kernel = dsp_biquad_section_multi_ref, .channels = 4 },
+        { .kernel = dsp_biquad_section_multi, .channels = 8 }, { .kernel = dsp_biquad_section_multi_ref, .channels = 8 },
+    };
+
+    const bench_case_t cases[] = {
+        { "apply_bandpass_iir",          setup_bandpass,      run_bandpass_single, NULL,      BENCH_LEN },
+        { "apply_bandpass_iir_block",    setup_bandpass,      run_bandpass_block,  NULL,      BENCH_LEN },
+        { "biquad_multi_process_1ch",    setup_biquad_multi,  run_biquad_multi,    &multi[0], BENCH_LEN },
+        { "biquad_multi_process_4ch",    setup_biquad_multi,  run_biquad_multi,    &multi[1], BENCH_LEN },
+        { "biquad_multi_process_8ch",    setup_biquad_multi,  run_biquad_multi,    &multi[2], BENCH_LEN },
+        { "biquad_q15_process_1ch",      setup_biquad_q15,    run_biquad_q15,      &q15[0],   BENCH_LEN },
+        { "biquad_q15_process_4ch",      setup_biquad_q15,    run_biquad_q15,      &q15[1],   BENCH_LEN },
+        { "biquad_q15_process_8ch",      setup_biquad_q15,    run_biquad_q15,      &q15[2],   BENCH_LEN },
+        { "section_multi_1ch",           setup_section,       run_section,         &section[0], BENCH_LEN },
+        { "section_multi_ref_1ch",       setup_section,       run_section,         &section[1], BENCH_LEN },
+        { "section_multi_4ch",           setup_section,       run_section,         &section[2], BENCH_LEN },
+        { "section_multi_ref_4ch",       setup_section,       run_section,         &section[3], BENCH_LEN },
+        { "section_multi_8ch",           setup_section,       run_section,         &section[4], BENCH_LEN },
+        { "section_multi_ref_8ch",       setup_section,       run_section,         &section[5], BENCH_LEN },
+        { "dsp_dot_f32",                 setup_section,       run_dot_f32,         &section[0], BENCH_LEN },
+        { "dsp_dot_f32_ref",             setup_section,       run_dot_f32_ref,     &section[0], BENCH_LEN },
+        { "dsp_dot_s16",                 NULL,                run_dot_s16,         NULL,      BENCH_LEN },
+        { "dsp_dot_s16_ref",             NULL,                run_dot_s16_ref,     NULL,      BENCH_LEN },
+        { "decim_x10_fullrate_1ch",      setup_decim,         run_decim,           &decim[0], BENCH_LEN },
+        { "decim_x10_polyphase_1ch",     setup_decim,         run_decim,           &decim[1], BENCH_LEN },
+        { "decim_x20_fullrate_1ch",      setup_decim,         run_decim,           &decim[2], BENCH_LEN },
+        { "decim_x20_polyphase_1ch",     setup_decim,         run_decim,           &decim[3], BENCH_LEN },
+        { "decim_x10_polyphase_8ch",     setup_decim,         run_decim,           &decim[4], BENCH_LEN },
+        { "compute_alpha_score",         NULL,                run_alpha_score,     NULL,      BUFFER_SIZE },
+        { "goertzel_power",              NULL,                run_goertzel,        NULL,      BUFFER_SIZE },
+        { "goertzel_power_q15",          NULL,                run_goertzel_q15,    NULL,      BUFFER_SIZE },
+        { "sliding_dft_update",          setup_sliding_dft,   run_sliding_dft,     NULL,      BENCH_LEN },
+        { "sliding_dft_q15_update",      setup_sliding_dft_q15, run_sliding_dft_q15, NULL,    BENCH_LEN },
+        { "spectral_push",               setup_spectral,      run_spectral_push,   NULL,      BENCH_LEN },
+        { "spectral_fft_power",          NULL,                run_spectral_fft,    NULL,      SPECTRAL_FFT_SIZE },
+        { "detect_events",               setup_detect,        run_detect_events,   NULL,      BENCH_LEN },
+        { "adc_process_block",           setup_pipeline,      run_process_block,   NULL,      BENCH_LEN },
+        { "adc_frame_decode",            setup_frame_decode,  run_frame_decode,    NULL,      ADC_CONV_FRAME_BYTES / ADC_FRAME_RESULT_BYTES },
+        { "ble_stream_pack12",           NULL,                run_pack12,          NULL,      BLE_STREAM_MAX_SAMPLES },
+        { "ble_pkt_encode",              NULL,                run_pkt_encode,      NULL,      BENCH_PKTS },
+        { "ble_pkt_decode",              run_pkt_encode,      run_pkt_decode,      NULL,      BENCH_PKTS },
+        { "eeg_codec_encode_1ch",        NULL,                run_codec_encode,    &codec[0], BENCH_LEN },
+        { "eeg_codec_encode_8ch",        NULL,                run_codec_encode,    &codec[1], BENCH_LEN },
+        { "eeg_codec_decode_1ch",        setup_codec_decode,  run_codec_decode,    &codec[0], BENCH_LEN },
+        { "recorder_append_samples",     setup_recorder,      run_recorder_append, NULL,      BENCH_LEN },
+    };
+    enum { NUM_CASES = sizeof(cases) / sizeof(cases[0]) };
+    static bench_result_t results[NUM_CASES];
+
+    // --- 1. Configuration ---
+    bench_config_t cfg;
+    bench_default_config(&cfg);
+    cfg.runs = env_u32("BENCH_RUNS", cfg.runs);
+    cfg.warmup_runs = env_u32("BENCH_WARMUP", cfg.warmup_runs);
+
+    const char *fmt = getenv("BENCH_FORMAT");
+    bench_format_t format = (fmt && strcmp(fmt, "csv") == 0) ? BENCH_FORMAT_CSV : BENCH_FORMAT_JSON;
+
+    // --- 2. Run every kernel ---
+    bench_build_inputs();
+    for (size_t i = 0; i < NUM_CASES; i++) {
+        bench_run(&cases[i], &cfg, &results[i]);
+    }
+
+    // --- 3. Machine-readable report on stdout ---
+    bench_report(stdout, format, BENCH_VERSION, &cfg, results, NUM_CASES);
+    fflush(stdout);
+
+#if CONFIG_IDF_TARGET_LINUX
+    exit(0);
+#endif
+}
@@ -7,255 +7,470 @@
     #include "freertos/task.h"
     #include "esp_log.h"
     #include "esp_err.h"
+    #include "esp_timer.h"                // Spectral update timing
 
     /* --- ADC --- */
     // #include "esp_adc/adc_oneshot.h"    // For ADC HW interation
     // #include "esp_adc/adc_cali.h"       // For voltage calibration
     #include "adc.h"
+    #include "adc_source.h"               // Pluggable acquisition sources (pipeline runner)
+    #include "power.h"                    // Consumer demand + duty cycle (stage gating, standby)
     #include <math.h>  // For Goertzel (sin/cos)
+    #include <string.h>  // For memcpy / memset
+    #include <inttypes.h>  // PRIu32 for the uint32_t counters in log lines
 
 
 // =============================
 // ADC Globals Definition (Here, for Module Ownership)
 // =============================
-adc_oneshot_unit_handle_t adc_handle = NULL;  // ADC driver handle
-adc_cali_handle_t adc_cali_handle = NULL;     // ADC Calibration handle
-int16_t adc_buffer[BUFFER_SIZE];  // Circular buffer for ADC samples
-volatile size_t buffer_index = 0;   // producer (adc_sampling) writes then increments
+int16_t adc_buffer[BUFFER_SIZE * ADC_NUM_CHANNELS];  // Circular buffer of interleaved frames
+volatile size_t buffer_index = 0;   // producer (adc_sampling) mirrors its write slot here
+adc_ring_t adc_ring = ADC_RING_INIT(adc_buffer, BUFFER_SIZE, ADC_NUM_CHANNELS);  // Lock-free view over adc_buffer
+int16_t filtered_buffer[FILTERED_BUFFER_SIZE * ADC_NUM_CHANNELS];  // Filtered frames for BLE streaming
+adc_ring_t filtered_ring = ADC_RING_INIT(filtered_buffer, FILTERED_BUFFER_SIZE, ADC_NUM_CHANNELS);
+uint32_t adc_stamp_us[BUFFER_SIZE];                  // Written by the producer before it publishes the slot
+uint32_t filtered_stamp_us[FILTERED_BUFFER_SIZE];
 volatile uint32_t blink_count = 0;
 volatile uint8_t attention_level = 0;
-
-// Mutex to protect shared buffer access
-SemaphoreHandle_t adc_mutex = NULL;
+volatile int64_t blink_event_us = 0;
+volatile int64_t attention_event_us = 0;
+volatile uint32_t blink_sample_us = 0;
+adc_jitter_t adc_sample_jitter = { .min_us = UINT32_MAX };
+volatile float adc_clock_jitter_us = 0.0f;
+volatile uint32_t adc_clock_max_us = 0;
+volatile uint32_t adc_timer_missed = 0;
+static TaskHandle_t event_listener = NULL;   // Woken by detect_events (see adc_set_event_listener)
+static const adc_tap_t *volatile adc_tap = NULL;   // Recording observer (see adc_set_tap)
+
+eeg_band_powers_t eeg_bands;
+volatile uint32_t spectral_update_us = 0;
+volatile uint32_t spectral_update_max_us = 0;
+
+// Stage graph (see adc_pipeline_init): the stage states live in its static arena, not here
+dsp_graph_t adc_graph;
+static uint8_t adc_graph_arena[ADC_GRAPH_ARENA_BYTES] __attribute__((aligned(DSP_GRAPH_ALIGN)));
+adc_notch_stage_t *adc_notch_state = NULL;
+adc_bandpass_stage_t *adc_bandpass_state = NULL;
+adc_detect_stage_t *adc_detect_state = NULL;
+adc_spectral_stage_t *adc_spectral_state = NULL;
+static int adc_detect_stage = -1;            // detect_events_frame() runs the graph from here
+
+_Static_assert((BUFFER_SIZE & (BUFFER_SIZE - 1)) == 0, "BUFFER_SIZE must be a power of two for adc_ring");
+_Static_assert((FILTERED_BUFFER_SIZE & (FILTERED_BUFFER_SIZE - 1)) == 0, "FILTERED_BUFFER_SIZE must be a power of two");
 
 // =============================
-// IIR Bandpass Globals (2nd-order Butterworth, 0.5-30Hz @100Hz sample)
+// IIR Bandpass Globals (2nd-order Butterworth, 0.5-30Hz)
 // =============================
-float bp_a[3] = {1.0f, -0.2162f, 0.2174f};   // Denominator
+#if ADC_PIPELINE_RATE_HZ == 250
+float bp_a[3] = {1.0f, -1.4331f, 0.4402f};   // Denominator (@250Hz)
+float bp_b[3] = {0.2799f, 0.0f, -0.2799f};   // Numerator
+#elif ADC_PIPELINE_RATE_HZ == 500
+float bp_a[3] = {1.0f, -1.6822f, 0.6842f};   // Denominator (@500Hz)
+float bp_b[3] = {0.1579f, 0.0f, -0.1579f};   // Numerator
+#elif ADC_PIPELINE_RATE_HZ == 1000
+float bp_a[3] = {1.0f, -1.8294f, 0.8299f};   // Denominator (@1kHz)
+float bp_b[3] = {0.0850f, 0.0f, -0.0850f};   // Numerator
+#else
+float bp_a[3] = {1.0f, -0.2162f, 0.2174f};   // Denominator (@100Hz)
 float bp_b[3] = {0.3913f, 0.0f, -0.3913f};   // Numerator
+#endif
 float bp_x[2] = {0};  // Input history
 float bp_y[2] = {0};  // Output history
 
+#if DSP_BACKEND == DSP_BACKEND_FIXED
+static biquad_q15_t bp_mono; // apply_bandpass_iir(): one-channel instance of the bandpass stage's filter
+#endif
+
 
 // =============================
-// ADC Unit Initialization + Channel Configuration + Calibration
+// Helper: Push New Sample into ADC Buffer
 // =============================
-// Function to initialize the ADC unit, configure the channel, and set up calibration.
-// Returns a handle to the initialized ADC unit.
-adc_oneshot_unit_handle_t init_adc(void){
+void adc_push_frame_at(const int16_t *frame, uint32_t stamp_us) {
+    // Stamp first: the slot becomes visible to the consumer only when push_frame publishes head
+    uint32_t next = atomic_load_explicit(&adc_ring.head, memory_order_relaxed);   // Producer owns head
+    adc_stamp_us[next & adc_ring.mask] = stamp_us;
+    uint32_t seq = adc_ring_push_frame(&adc_ring, frame);   // Wait-free; never blocks the sampler
+    buffer_index = (seq + 1) % BUFFER_SIZE;
+}
 
-    esp_err_t ret;
+void adc_push_frame(const int16_t *frame) {
+    adc_push_frame_at(frame, adc_now_us());
+}
 
-    // ==============================
-    // 1. ADC Unit Configuration
-    // ==============================
+void adc_push_sample(int16_t sample) {
+    int16_t frame[ADC_NUM_CHANNELS];
+    for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) frame[ch] = sample;
+    adc_push_frame(frame);
+}
 
-    // STEP 1A : Create a Handle (Done - Alrady defined globally)
-    // A handle is like a "pointer" or reference to a software object that represents
-    // the ADC hardware inside ESP-IDF. This handle will be used for all future ADC calls.
-    // (At this point, adc_handle is just a NULL pointer.)
-    // static adc_oneshot_unit_handle_t adc_handle;    // Reference to ADC driver
 
-    // STEP 1B : Define the ADC Unit configuration structure
-    // This structure describes global settings for the ADC peripheral.
-    // - unit_id: Which ADC hardware block (ADC1 or ADC2)
-    adc_oneshot_unit_init_cfg_t init_config = {
-        .unit_id = ADC_UNIT,   // Use ADC1 block
-    };
-    // Nothing is initialized yet. This is just the **desired configuration**.
-
-    // STEP 1C : Initialize ADC Unit using the ESP-IDF API
-    // Function: adc_oneshot_new_unit(init_config, &adc_handle)
-    // What it does:
-    // 1. Allocates memory for the ADC driver object
-    // 2. Programs ADC hardware registers according to init_config
-    // 3. Updates adc_handle to point to this driver object
-    ret = adc_oneshot_new_unit(&init_config, &adc_handle);
-    if (ret == ESP_OK) {
-        ESP_LOGI(ADC_TAG, "ADC Unit initialized successfully!");
-    } else {
-        ESP_LOGE(ADC_TAG, "Failed to initialize ADC unit! Error code: %d", ret);
-        return NULL; // Stop if initialization failed
+// =============================
+// Sampling Jitter: Track + Publish Every Window
+// =============================
+void adc_jitter_track(uint32_t stamp_us) {
+
+    adc_jitter_add(&adc_sample_jitter, stamp_us);
+
+    if (adc_sample_jitter.count >= (uint32_t)(ADC_JITTER_WINDOW_S * ADC_ACQ_RATE_HZ)) {
+        adc_clock_jitter_us = adc_jitter_stddev_us(&adc_sample_jitter);
+        adc_clock_max_us = adc_sample_jitter.max_us;
+        ESP_LOGI(ADC_TAG, "Sample clock: mean %.1f us, jitter %.1f us (std dev), min %" PRIu32 " / max %" PRIu32 " us, missed %" PRIu32,
+                 adc_sample_jitter.mean_us, adc_clock_jitter_us, adc_sample_jitter.min_us,
+                 adc_sample_jitter.max_us, adc_timer_missed);
+
+        adc_jitter_reset(&adc_sample_jitter);
+        adc_jitter_add(&adc_sample_jitter, stamp_us);   // Next window starts from this stamp
     }
-    // Now adc_handle points to a fully initialized ADC driver object
-    // but the ADC channel/pin and input scaling are not set yet.
-
-    // ==============================
-    // 2. ADC Channel Configuration
-    // ==============================
-
-    // STEP 2B : Define the Channel Configuration structure
-    // This is a separate configuration structure that describes how to read from a specific ADC channel (pin).
-    // - bitwidth: Resolution of conversion (default 12-bit)
-    // - attenuation: How much input voltage the ADC can measure (~3.3V for DB_11)
-    adc_oneshot_chan_cfg_t chan_config = {
-        .bitwidth = ADC_BITWIDTH_DEFAULT,  // Default 12-bit resolution
-        .atten = ADC_ATTEN_DB_12           // ~3.3V full-scale voltage range
+}
+
+
+// =============================
+// Simple Goertzel for Alpha Power (8-12 Hz; For Focus)
+// =============================
+uint8_t alpha_power_to_score(float power) {
+    // Normalize to 0–100 (tune scale empirically)
+    return (uint8_t)fminf(100.0f, power * 0.00001f);
+}
+
+#if DSP_BACKEND == DSP_BACKEND_FIXED
+static uint8_t alpha_power_to_score_q(uint64_t power) {
+    // Same scale as alpha_power_to_score(), without leaving integers
+    uint64_t score = power / 100000u;
+    return (uint8_t)(score > 100 ? 100 : score);
+}
+#endif
+
+uint8_t compute_alpha_score(const int16_t *window, size_t len){
+    // The 10 Hz coefficient is fixed at build time: compute the cosine once, not per window
+#if DSP_BACKEND == DSP_BACKEND_FIXED
+    static int32_t coeff = 0;
+    static bool coeff_ready = false;
+    if (!coeff_ready) { coeff = goertzel_q15_coeff(10.0f, SAMPLE_RATE_HZ); coeff_ready = true; }
+    return alpha_power_to_score_q(goertzel_power_q15(window, len, coeff));
+#else
+    static float coeff = 0.0f;
+    static bool coeff_ready = false;
+    if (!coeff_ready) { coeff = goertzel_coeff(10.0f, SAMPLE_RATE_HZ); coeff_ready = true; }
+    return alpha_power_to_score(goertzel_power_coeff(window, len, coeff));
+#endif
+}
+
+
+// =============================
+// Stage States: Init
+// =============================
+#if ADC_NOTCH_ENABLED
+static void adc_notch_init(adc_notch_stage_t *st) {
+    biquad_coeffs_t sos;
+    biquad_design_notch(&sos, ADC_NOTCH_HZ, ADC_NOTCH_Q, SAMPLE_RATE_HZ);
+    biquad_multi_init(&st->filter, &sos, 1, ADC_NUM_CHANNELS);
+}
+#endif
+
+static void adc_bandpass_init(adc_bandpass_stage_t *st) {
+
+    const biquad_coeffs_t sos = {
+        .b0 = bp_b[0] / bp_a[0], .b1 = bp_b[1] / bp_a[0], .b2 = bp_b[2] / bp_a[0],
+        .a1 = bp_a[1] / bp_a[0], .a2 = bp_a[2] / bp_a[0],
     };
+#if DSP_BACKEND == DSP_BACKEND_FIXED
+    if (!biquad_q15_init(&st->filter, &sos, 1, ADC_NUM_CHANNELS)) {
+        ESP_LOGE(ADC_TAG, "Bandpass coefficients do not fit Q14: filter bypassed");
+    }
+    biquad_q15_init(&bp_mono, &sos, 1, 1);
+#else
+    biquad_multi_init(&st->filter, &sos, 1, ADC_NUM_CHANNELS);
+#endif
+}
 
-    // STEP 2C: [ BLANK]
-    ret = adc_oneshot_config_channel(adc_handle, ADC_CHANNEL, &chan_config);
-    if (ret == ESP_OK) {
-        ESP_LOGI(ADC_TAG, "ADC channel configured successfully!");
-    } else {
-        ESP_LOGE(ADC_TAG, "Failed to configure ADC channel! Error code: %d", ret);
-        return NULL;
+static void adc_detect_init(adc_detect_stage_t *st) {
+
+    static const float alpha_bins_hz[ALPHA_BAND_BINS] = {8.0f, 9.0f, 10.0f, 11.0f, 12.0f};
+
+    for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+        robust_stats_init(&st->stats[ch], BLINK_STATS_WINDOW);
+        st->threshold[ch] = BLINK_THRESHOLD_INIT;
+        st->prev[ch] = 0;
+#if DSP_BACKEND == DSP_BACKEND_FIXED
+        sliding_dft_q15_init(&st->alpha[ch], st->alpha_history[ch], BUFFER_SIZE,
+                             alpha_bins_hz, ALPHA_BAND_BINS, SAMPLE_RATE_HZ);
+#else
+        sliding_dft_init(&st->alpha[ch], st->alpha_history[ch], BUFFER_SIZE,
+                         alpha_bins_hz, ALPHA_BAND_BINS, SAMPLE_RATE_HZ);
+#endif
     }
+    st->refractory = REFRACTORY_PERIOD_SAMPLES;
+    st->attention_counter = 0;       // Attention checks restart on the first frame, like the window
+    st->attention_notified = 0;
+}
 
-    // ==============================
-    // 3. ADC Calibration Initialization
-    // ==============================
-
-    // Calibration is optional but recommended for accurate voltage readings.
-    // On ESP32, raw ADC values may vary due to temperature, voltage supply, and manufacturing.
-    // The calibration API converts raw readings to mV.
-
-    // Step 3A: Define the Calibration configuration structure
-    // This structure describes how the calibration should be performed.
-    // - unit_id: Which ADC unit (must match the one used before)
-    // - atten: Must match the attenuation used in channel config
-    // - bitwidth: Must match the bitwidth used in channel config
-    adc_cali_line_fitting_config_t cali_cfg = {
-        .unit_id = ADC_UNIT,               // Same ADC unit as before
-        .atten = ADC_ATTEN_DB_12,          // Same attenuation as channel config
-        .bitwidth = ADC_BITWIDTH_DEFAULT   // Same bitwidth as channel config
-    };
+static void adc_spectral_init(adc_spectral_stage_t *st) {
+    for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+        spectral_init(&st->engine[ch], SAMPLE_RATE_HZ);
+    }
+    memset(st->bands, 0, sizeof(st->bands));
+    memset(&eeg_bands, 0, sizeof(eeg_bands));
+    spectral_update_us = 0;
+    spectral_update_max_us = 0;
+}
 
-    // Step 3B: Initialize Calibration using ESP-IDF API
-    // Function: adc_cali_create_scheme_curve_fitting(&cali_cfg, &handle)
-    // What it does:
-    // - Allocates memory for calibration object
-    // - Prepares math to convert raw ADC → voltage (mV)
-    if (adc_cali_create_scheme_line_fitting(&cali_cfg, &adc_cali_handle) == ESP_OK) {
-        ESP_LOGI(ADC_TAG, "ADC calibration ready.");
-    } else {
-        ESP_LOGW(ADC_TAG, "ADC calibration not available. Using raw ADC values.");
-        adc_cali_handle = NULL;          // Use raw values if calibration fails
+float alpha_tracker_power(int ch) {
+#if DSP_BACKEND == DSP_BACKEND_FIXED
+    return (float)sliding_dft_q15_band_power(&adc_detect_state->alpha[ch]);
+#else
+    return sliding_dft_band_power(&adc_detect_state->alpha[ch]);
+#endif
+}
+
+
+// =============================
+// Event Listener (Wakes the BLE Task)
+// =============================
+void adc_set_event_listener(TaskHandle_t task) {
+    event_listener = task;
+}
+
+void adc_set_tap(const adc_tap_t *tap) {
+    adc_tap = tap;
+}
+
+static void adc_notify_event(uint32_t event, uint32_t stamp_us) {
+    TaskHandle_t listener = event_listener;
+    if (listener) {
+        xTaskNotify(listener, event, eSetBits);   // Never blocks; bits coalesce until the listener runs
     }
 
-    // --- End of setup ---
-    ESP_LOGI(ADC_TAG, "ADC is now initialized and ready for sampling.");
+    const adc_tap_t *tap = adc_tap;
+    if (tap && tap->event) {
+        tap->event(event, stamp_us, event == ADC_EVENT_BLINK ? blink_count : attention_level);
+    }
+}
 
-    // Return the ADC driver handle in case the caller wants it
-    return adc_handle;
 
+// =============================
+// Stage: Notch + Bandpass (In Place, All Channels)
+// =============================
+#if ADC_NOTCH_ENABLED
+static void adc_stage_notch(void *state, int16_t *frames, const uint32_t *stamps, size_t count) {
+    adc_notch_stage_t *st = state;
+    biquad_multi_process(&st->filter, frames, frames, count);
+}
+#endif
+
+static void adc_stage_bandpass(void *state, int16_t *frames, const uint32_t *stamps, size_t count) {
+    adc_bandpass_stage_t *st = state;
+#if DSP_BACKEND == DSP_BACKEND_FIXED
+    biquad_q15_process(&st->filter, frames, frames, count);
+#else
+    biquad_multi_process(&st->filter, frames, frames, count);
+#endif
 }
 
 
 // =============================
-// Helper: Push New Sample into ADC Buffer
+// Stage: Publish (Filtered Frames -> filtered_ring)
 // =============================
-void adc_push_sample(int16_t sample) {
-    adc_buffer[buffer_index] = sample;
-    buffer_index = (buffer_index + 1) % BUFFER_SIZE;
+// Republishes the filtered frames (+ their acquisition stamps) for the BLE raw stream; never blocks
+static void adc_stage_publish(void *state, int16_t *frames, const uint32_t *stamps, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        uint32_t next = atomic_load_explicit(&filtered_ring.head, memory_order_relaxed);
+        filtered_stamp_us[next & filtered_ring.mask] = stamps[i];
+        adc_ring_push_frame(&filtered_ring, &frames[i * ADC_NUM_CHANNELS]);
+    }
 }
 
 
 // =============================
-// FreeRTOS Task: ADC Sampling
+// Stage: Event Detection (Blinks & Focus)
 // =============================
-void adc_sampling(void *arg){
+// Frame by frame, every channel in the same pass. A blink on any electrode counts once (shared
+// refractory); attention is averaged over channels.
+static void adc_stage_detect(void *state, int16_t *frames, const uint32_t *stamps, size_t count) {
 
-    ESP_LOGI(ADC_TAG, "ADC sampling task started!");
+    adc_detect_stage_t *st = state;
 
-    while (1) {
+    for (size_t i = 0; i < count; i++) {
 
-        int raw = 0;
-        int voltage = 0; // Calibrated voltage in mV
+        const int16_t *filtered = &frames[i * ADC_NUM_CHANNELS];
 
-        // --- 1. Read raw ADC value ---
-        adc_oneshot_read(adc_handle, ADC_CHANNEL, &raw); // ESP-IDF API
+        // Blink: a step beyond the channel's adaptive threshold (see BLINK_MAD_K)
+        int spike = 0;
+        for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+            int16_t derivative = filtered[ch] - st->prev[ch];
+            st->prev[ch] = filtered[ch];
 
-        // --- 2. Convert raw to calibrated voltage (mV) ---
-        if (adc_cali_handle) {
-            adc_cali_raw_to_voltage(adc_cali_handle, raw, &voltage); // ESP-IDF API
-        } else {
-            // Fallback if calibration unavailable
-            voltage = raw;
+            robust_stats_t *rs = &st->stats[ch];
+            float step = (float)derivative - (rs->updates ? rs->median : 0.0f);
+            if (step < 0.0f) step = -step;
+            if (step > st->threshold[ch]) spike = 1;
+
+            // Blinks go into the statistics too: the median / MAD shrug off the few samples they cover
+            if (robust_stats_add(rs, (float)derivative)) {
+                float t = BLINK_MAD_K * rs->mad;
+                st->threshold[ch] = t > BLINK_THRESHOLD_MIN ? t : BLINK_THRESHOLD_MIN;
+            }
+        }
+        if (!st->refractory && spike) {
+            blink_count++;
+            blink_event_us = esp_timer_get_time();
+            blink_sample_us = stamps[i];
+            adc_notify_event(ADC_EVENT_BLINK, stamps[i]);   // Wake the BLE task before logging
+            ESP_LOGI(ADC_TAG, "Blink detected! Count: %" PRIu32, blink_count);
+            st->refractory = REFRACTORY_PERIOD_SAMPLES;     // skip next ~200 ms of samples
         }
 
-        // --- 3. Store calibrated voltage in circular buffer ---
-        // Note: 1 unit = 0.1 mV scaling for EEG µV interpretation (e.g., 200 threshold = 20µV actual)
-        xSemaphoreTake(adc_mutex, portMAX_DELAY);
-        adc_buffer[buffer_index] = (int16_t)(voltage * 10);
-        buffer_index = (buffer_index + 1) % BUFFER_SIZE; // Wrap around
-        xSemaphoreGive(adc_mutex);
+        if (st->refractory) st->refractory--;
 
-        // --- 4. Optional: Print to serial ---
-        size_t prev_idx = (buffer_index + BUFFER_SIZE - 1) % BUFFER_SIZE;
-        ESP_LOGD(ADC_TAG, "Raw ADC: %d mV -> Buffer[%zu]=%d", voltage, prev_idx, adc_buffer[prev_idx-1]);
+        // Focus: sliding alpha power is refreshed on every filtered sample at constant cost
+#if DSP_BACKEND == DSP_BACKEND_FIXED
+        uint64_t alpha_power = 0;
+        for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+            sliding_dft_q15_update(&st->alpha[ch], filtered[ch]);
+            alpha_power += sliding_dft_q15_band_power(&st->alpha[ch]);
+        }
+        attention_level = alpha_power_to_score_q(alpha_power / ADC_NUM_CHANNELS);
+#else
+        float alpha_power = 0.0f;
+        for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+            sliding_dft_update(&st->alpha[ch], filtered[ch]);
+            alpha_power += sliding_dft_band_power(&st->alpha[ch]);
+        }
+        attention_level = alpha_power_to_score(alpha_power / ADC_NUM_CHANNELS);
+#endif
+
+        // Log + notify every ATTENTION_UPDATE_SAMPLES (~0.5s), only if the level moved
+        if (++st->attention_counter >= ATTENTION_UPDATE_SAMPLES) {
+            st->attention_counter = 0;
+            ESP_LOGI(ADC_TAG, "Attention level: %u", attention_level);
+            if (attention_level != st->attention_notified) {
+                st->attention_notified = attention_level;
+                attention_event_us = esp_timer_get_time();
+                adc_notify_event(ADC_EVENT_ATTENTION, stamps[i]);
+            }
+        }
+    }
+}
+
+
+// =============================
+// Stage: Multi-Band Spectral Engine (delta .. gamma)
+// =============================
+// A new Welch estimate every SPECTRAL_HOP samples (~1.3 s @ 100Hz). Every channel hops on the
+// same frame, so all estimates refresh together.
+static void adc_stage_spectral(void *state, int16_t *frames, const uint32_t *stamps, size_t count) {
+
+    adc_spectral_stage_t *st = state;
+    int64_t t_start = esp_timer_get_time();
+    int refreshed = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+            if (spectral_push(&st->engine[ch], frames[i * ADC_NUM_CHANNELS + ch])) {
+                st->bands[ch] = st->engine[ch].result;
+                refreshed = 1;
+            }
+        }
+    }
+    if (!refreshed) return;
 
-        // --- 5. Delay for next sample (100 ms) ---
-        vTaskDelay(pdMS_TO_TICKS(ADC_SAMPLE_PERIOD_MS));
+    uint32_t elapsed = (uint32_t)(esp_timer_get_time() - t_start);
+    spectral_update_us = elapsed;
+    if (elapsed > spectral_update_max_us) spectral_update_max_us = elapsed;
 
+    eeg_band_powers_t mean = {0};
+    for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+        for (int b = 0; b < EEG_BAND_COUNT; b++) {
+            mean.absolute[b] += st->bands[ch].absolute[b] / ADC_NUM_CHANNELS;
+            mean.relative[b] += st->bands[ch].relative[b] / ADC_NUM_CHANNELS;
+        }
+        mean.total += st->bands[ch].total / ADC_NUM_CHANNELS;
     }
+    mean.segments = st->bands[0].segments;
+    eeg_bands = mean;
+
+    ESP_LOGD(ADC_TAG, "Bands (rel): d=%.2f t=%.2f a=%.2f b=%.2f g=%.2f | %" PRIu32 " us (max %" PRIu32 " us)",
+             eeg_bands.relative[EEG_BAND_DELTA], eeg_bands.relative[EEG_BAND_THETA],
+             eeg_bands.relative[EEG_BAND_ALPHA], eeg_bands.relative[EEG_BAND_BETA],
+             eeg_bands.relative[EEG_BAND_GAMMA], spectral_update_us, spectral_update_max_us);
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+    // Once, with the FFT path exercised: headroom left on the calling (filtering) task's stack
+    static bool stack_reported = false;
+    if (!stack_reported) {
+        stack_reported = true;
+        ESP_LOGI(ADC_TAG, "Spectral update: %u bytes of stack never used",
+                 (unsigned)uxTaskGetStackHighWaterMark(NULL));
+    }
+#endif
 }
 
 
 // =============================
-// Simple Goertzel for Alpha Power (8-12 Hz; For Focus)
+// Pipeline: Build the Stage Graph
 // =============================
-uint8_t compute_alpha_score(const int16_t *window, size_t len){
+// Every stage state comes out of one static arena sized for exactly these stages, so the
+// graph cannot run out of room and a rebuild is a fresh pipeline: nothing outlives it.
+void adc_pipeline_init(void) {
 
-    float coeff = 2.0f * cosf(2.0f * M_PI * 10.0f / SAMPLE_RATE_HZ);
+    dsp_graph_init(&adc_graph, adc_graph_arena, sizeof(adc_graph_arena));
 
-    float q0 = 0, q1 = 0, q2 = 0;
+    adc_notch_state = NULL;
+#if ADC_NOTCH_ENABLED
+    adc_notch_state = dsp_graph_alloc(&adc_graph, sizeof(adc_notch_stage_t));
+    adc_notch_init(adc_notch_state);
+    dsp_graph_add(&adc_graph, "notch", adc_stage_notch, adc_notch_state);
+#endif
 
-    for (size_t i = 0; i < len; i++) {
+    adc_bandpass_state = dsp_graph_alloc(&adc_graph, sizeof(adc_bandpass_stage_t));
+    adc_bandpass_init(adc_bandpass_state);
+    dsp_graph_add(&adc_graph, "bandpass", adc_stage_bandpass, adc_bandpass_state);
 
-        float s = (float)window[i];
-        q0 = coeff * q1 - q2 + s;
-        q2 = q1;
-        q1 = q0;
-        
-    }
+    dsp_graph_add(&adc_graph, "publish", adc_stage_publish, NULL);
 
-    // Power (no sqrt for speed)
-    float magnitude = q1 * q1 + q2 * q2 - q1 * q2 * coeff;
+    adc_detect_state = dsp_graph_alloc(&adc_graph, sizeof(adc_detect_stage_t));
+    adc_detect_init(adc_detect_state);
+    adc_detect_stage = dsp_graph_add(&adc_graph, "detect", adc_stage_detect, adc_detect_state);
 
-    // Normalize to 0–100 (tune scale empirically)
-    return (uint8_t)fminf(100.0f, magnitude * 0.00001f);
+    adc_spectral_state = dsp_graph_alloc(&adc_graph, sizeof(adc_spectral_stage_t));
+    adc_spectral_init(adc_spectral_state);
+    dsp_graph_add(&adc_graph, "spectral", adc_stage_spectral, adc_spectral_state);
 }
 
 
 // =============================
-// Event Detection (Blinks & Focus)
+// Pipeline: Gate Stages by Demand (power.h)
 // =============================
-void detect_events(int16_t filtered_current) {  // Changed: Param for filtered
-    
-    static int16_t prev_sample = 0;
-    static uint8_t refractory = REFRACTORY_PERIOD_SAMPLES;  // simple debounce counter
-
-    // Blink: Spike detection (derivative >200µV threshold)
-    int16_t derivative = filtered_current - prev_sample;
-    if (!refractory && abs(derivative) > 20) {  // µV threshold; adjust for your amp
-        blink_count++;
-        ESP_LOGI(ADC_TAG, "Blink detected! Count: %lu", blink_count);
-        refractory = 20; // e.g., skip next 20 samples (~200 ms)
-    }
-
-    if (refractory) refractory--;
-
-    prev_sample = filtered_current;
-    
-	// Focus: Every 50 samples (~0.5s @100Hz), compute alpha on window
-	static size_t sample_counter = 0;   // Keeps track of elapsed samples
-	sample_counter++;                   // Increment for each new sample processed
-
-    // When 50 samples have accumulated (~0.5s @ 100Hz)
-	if (sample_counter >= 50) {
-
-        // Step 1: Compute alpha score using full ADC buffer
-        attention_level = compute_alpha_score(adc_buffer, BUFFER_SIZE);  // Use full buffer as window
+// A stage nobody reads is switched off rather than run for nothing: spectral without a
+// POWER_DEMAND_SPECTRAL reader, publish (filtered_ring) without a raw stream subscriber. Filters and
+// detect stay on: their state must be continuous for the events. A spectral stage coming back
+// starts a fresh Welch window: the one it left off with is stale.
+void adc_pipeline_apply_demand(uint32_t demand) {
+
+    int spectral = dsp_graph_find(&adc_graph, "spectral");
+    int publish = dsp_graph_find(&adc_graph, "publish");
+
+    bool want_spectral = (demand & POWER_DEMAND_SPECTRAL) != 0;
+    if (spectral >= 0 && want_spectral && !adc_graph.stage[spectral].enabled) adc_spectral_init(adc_spectral_state);
+    if (spectral >= 0) adc_graph.stage[spectral].enabled = want_spectral;
+    if (publish >= 0) adc_graph.stage[publish].enabled = (demand & POWER_DEMAND_STREAM) != 0;
+}
 
-	  	// Step 2: Reset counter for the next window
-        sample_counter = 0;
-        
-        // Step 3: Log or transmit the computed focus metric
-	 	ESP_LOGI(ADC_TAG, "Attention level: %u", attention_level);
 
-	}
+// =============================
+// Detection Entry Points (One Filtered Frame)
+// =============================
+// The detect + spectral stages alone, on a frame that is already filtered (no stamp known)
+void detect_events_frame(const int16_t *filtered) {
+    int16_t frame[ADC_NUM_CHANNELS];
+    const uint32_t stamp = 0;
+    memcpy(frame, filtered, sizeof(frame));
+    dsp_graph_run_from(&adc_graph, adc_detect_stage, frame, &stamp, 1);
+}
 
+void detect_events(int16_t filtered_current) {  // Changed: Param for filtered
+    int16_t frame[ADC_NUM_CHANNELS];
+    for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) frame[ch] = filtered_current;
+    detect_events_frame(frame);
 }
 
 
@@ -263,7 +478,12 @@ void detect_events(int16_t filtered_current) {  // Changed: Param for filtered
 // IIR Bandpass Filter ( 0.5-30 Hz )
 // =============================
 int16_t apply_bandpass_iir(int16_t input) {
-    
+
+#if DSP_BACKEND == DSP_BACKEND_FIXED
+    int16_t y;
+    biquad_q15_process(&bp_mono, &input, &y, 1);
+    return y;
+#else
     float x = (float)input;
     
     float y = bp_b[0] * x + bp_b[1] * bp_x[0] + bp_b[2] * bp_x[1] -
@@ -272,7 +492,95 @@ int16_t apply_bandpass_iir(int16_t input) {
     bp_x[1] = bp_x[0]; bp_x[0] = x;
     bp_y[1] = bp_y[0]; bp_y[0] = y;
     
+    // Saturate like biquad_cascade_process: ringing on a full-scale edge must clip, not wrap
+    if (y > 32767.0f) y = 32767.0f;
+    if (y < -32768.0f) y = -32768.0f;
     return (int16_t)y;
+#endif
+}
+
+void apply_bandpass_iir_block(const int16_t *in, int16_t *out, size_t frames) {
+#if DSP_BACKEND == DSP_BACKEND_FIXED
+    biquad_q15_process(&adc_bandpass_state->filter, in, out, frames);
+#else
+    biquad_multi_process(&adc_bandpass_state->filter, in, out, frames);
+#endif
+}
+
+
+// =============================
+// Pipeline: Run the Graph Over One Block
+// =============================
+// Shared by the filtering task (frames from adc_ring) and adc_pipeline_run (frames from any
+// adc_source_t), so device and host runs go through exactly the same code.
+// `stamps` holds the acquisition time of every frame (adc_now_us); NULL = acquired just now.
+// Records the ACQ_QUEUE and DSP latency stages (latency_hist.h) for every frame.
+void adc_process_block(const int16_t *block, const uint32_t *stamps, size_t frames) {
+
+    static int16_t work[ADC_DRAIN_BLOCK * ADC_NUM_CHANNELS];  // Static: 8 channels would not fit the task stack
+    uint32_t now_stamps[ADC_DRAIN_BLOCK];
+
+    while (frames) {
+
+        size_t count = frames < ADC_DRAIN_BLOCK ? frames : ADC_DRAIN_BLOCK;
+        uint32_t t_start = adc_now_us();
+
+        // --- 0. Raw frames to the recording tap, if any (copies and returns)
+        const adc_tap_t *tap = adc_tap;
+        if (tap && tap->frames) tap->frames(block, stamps, count);
+
+        // --- 1. Every stage over the whole block, in place (filters first, then the detectors)
+        const uint32_t *frame_us = stamps;
+        if (frame_us == NULL) {
+            for (size_t i = 0; i < count; i++) now_stamps[i] = t_start;
+            frame_us = now_stamps;
+        }
+        memcpy(work, block, count * ADC_NUM_CHANNELS * sizeof(int16_t));
+        dsp_graph_run(&adc_graph, work, frame_us, count);
+
+        // --- 2. A frame is done when the whole graph is: one latency sample per frame
+        uint32_t t_done = adc_now_us();
+        for (size_t i = 0; i < count; i++) {
+            latency_record(LATENCY_STAGE_ACQ_QUEUE, t_start - frame_us[i]);
+            latency_record(LATENCY_STAGE_DSP, t_done - t_start);
+        }
+
+        block += count * ADC_NUM_CHANNELS;
+        if (stamps) stamps += count;
+        frames -= count;
+    }
+}
+
+
+// =============================
+// Pipeline: Run a Source to Completion
+// =============================
+size_t adc_pipeline_run(adc_source_t *src, size_t max_frames) {
+
+    static int16_t block[ADC_DRAIN_BLOCK * ADC_NUM_CHANNELS];
+    size_t total = 0;
+
+    if (src->channels != ADC_NUM_CHANNELS) {
+        ESP_LOGE(ADC_TAG, "Source '%s' has %u channels, pipeline built for %d",
+                 src->name, src->channels, ADC_NUM_CHANNELS);
+        return 0;
+    }
+
+    while (max_frames == 0 || total < max_frames) {
+
+        size_t want = ADC_DRAIN_BLOCK;
+        if (max_frames && max_frames - total < want) want = max_frames - total;
+
+        size_t count = adc_source_read(src, block, want);
+        if (count == 0) break;                       // End of stream
+
+        uint32_t t0 = power_busy_begin();
+        adc_process_block(block, NULL, count);
+        power_busy_end(TASK_ROLE_FILTERING, t0);
+        total += count;
+    }
+
+    return total;
 }
 
 
@@ -282,26 +590,55 @@ int16_t apply_bandpass_iir(int16_t input) {
 void adc_filtering(void *arg) {
 
     ESP_LOGI(ADC_TAG, "ADC filtering task started!");
-    
+
+    static int16_t block[ADC_DRAIN_BLOCK * ADC_NUM_CHANNELS];  // Static: keeps the 2 KB task stack free
+    uint32_t stamps[ADC_DRAIN_BLOCK];
+
+    adc_pipeline_init();
+    uint32_t generation = power_generation() - 1;     // Apply the boot demand on the first pass
+    bool standby = false;
+
     while (1) {
 
-        // --- 1. Apply filter & detect on latest sample
-        xSemaphoreTake(adc_mutex, portMAX_DELAY);
-        size_t latest_idx = (buffer_index - 1 + BUFFER_SIZE) % BUFFER_SIZE;
-        int16_t current_sample = adc_buffer[latest_idx];
-        xSemaphoreGive(adc_mutex);
+        uint32_t first_seq = 0;
+        uint32_t lost = 0;
+
+        // --- 0. Demand changed: gate the stages; leaving standby starts from a fresh graph
+        if (power_generation() != generation) {
+            generation = power_generation();
+            bool now_standby = power_mode() == POWER_MODE_STANDBY;
+            if (standby && !now_standby) adc_pipeline_init();
+            if (standby != now_standby) ESP_LOGI(ADC_TAG, "Pipeline %s", now_standby ? "parked (standby)" : "resumed");
+            standby = now_standby;
+            adc_pipeline_apply_demand(power_demand());
+        }
+
+        // --- 1. Drain every frame produced since the last pass (no mutex, no skipping)
+        size_t count = adc_ring_read(&adc_ring, block, ADC_DRAIN_BLOCK, &first_seq, &lost);
+        uint32_t t0 = power_busy_begin();
 
-        // --- 2. Apply the digital IIR bandpass filter
-        int16_t filtered = apply_bandpass_iir(current_sample);  // Compute once
+        if (lost && !standby) {
+            ESP_LOGW(ADC_TAG, "Filter fell behind: %" PRIu32 " frames lost before seq %" PRIu32 " (total %" PRIu32 ")",
+                     lost, first_seq, adc_ring.overruns);
+        }
 
-        // --- 3. Detect events (blinks, attention) using filtered data
-        detect_events(filtered);  // Pass to avoid double filter
+        // --- 2-3. Stage graph: filter all channels, republish for BLE, detect events (acquisition stamps ride along).
+        //          In standby nothing is sampled; frames left from before it are drained unprocessed.
+        if (!standby) {
+            for (size_t i = 0; i < count; i++) stamps[i] = adc_stamp_us[(first_seq + i) & adc_ring.mask];
+            adc_process_block(block, stamps, count);
+        }
+        power_busy_end(TASK_ROLE_FILTERING, t0);
 
         // --- 4. Optional: Print to serial ---
         // ESP_LOGI(ADC_TAG, "Filtered: %d µV, Blinks: %lu, Attention: %u", filtered, blink_count, attention_level);
-        
-        // --- 5. Delay for next sample (100 ms) ---
-        vTaskDelay(pdMS_TO_TICKS(ADC_SAMPLE_PERIOD_MS));
+
+        // --- 5. Ring drained: sleep one sample period (at least one tick) before looking again;
+        //        in standby no frames arrive, so only the demand is polled
+        if (count < ADC_DRAIN_BLOCK) {
+            TickType_t period = pdMS_TO_TICKS(standby ? POWER_IDLE_POLL_MS : ADC_SAMPLE_PERIOD_MS);
+            vTaskDelay(period ? period : 1);
+        }
 
     }
 }
@@ -313,16 +650,44 @@ void adc_filtering(void *arg) {
 void reset_filter_state(void) {
     bp_x[0] = bp_x[1] = 0.0f;
     bp_y[0] = bp_y[1] = 0.0f;
+    adc_bandpass_init(adc_bandpass_state);
+#if ADC_NOTCH_ENABLED
+    adc_notch_init(adc_notch_state);
+#endif
 }
 
 void reset_adc_state(void) {
     memset(adc_buffer, 0, sizeof(adc_buffer));
+    adc_ring_init(&adc_ring, adc_buffer, BUFFER_SIZE, ADC_NUM_CHANNELS);
+    adc_ring_init(&filtered_ring, filtered_buffer, FILTERED_BUFFER_SIZE, ADC_NUM_CHANNELS);
     buffer_index = 0;
     blink_count = 0;
     attention_level = 0;
-    reset_filter_state();
+    bp_x[0] = bp_x[1] = 0.0f;
+    bp_y[0] = bp_y[1] = 0.0f;
+    adc_pipeline_init();
+    adc_jitter_reset(&adc_sample_jitter);
+    adc_timer_missed = 0;
 }
 
 
-
-
+// =============================
+// Static Footprint (mem_budget.h)
+// =============================
+// The block buffers are function-local statics (adc_process_block, adc_pipeline_run,
+// adc_filtering): listed by the expression that sizes them.
+#define ADC_BLOCK_BYTES  (ADC_DRAIN_BLOCK * ADC_NUM_CHANNELS * sizeof(int16_t))
+
+static const mem_budget_item_t adc_mem_items[] = {
+    MEM_BUDGET_ITEM(adc_buffer),
+    MEM_BUDGET_ITEM(adc_stamp_us),
+    MEM_BUDGET_ITEM(filtered_buffer),
+    MEM_BUDGET_ITEM(filtered_stamp_us),
+    MEM_BUDGET_ITEM(adc_graph),
+    MEM_BUDGET_ITEM(adc_graph_arena),
+    MEM_BUDGET_ITEM(eeg_bands),
+    MEM_BUDGET_BYTES("process work block", ADC_BLOCK_BYTES),
+    MEM_BUDGET_BYTES("filtering block", ADC_BLOCK_BYTES),
+    MEM_BUDGET_BYTES("pipeline_run block", ADC_BLOCK_BYTES),
+};
+const mem_budget_table_t adc_mem_budget = MEM_BUDGET_TABLE("adc", adc_mem_items);
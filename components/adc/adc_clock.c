@@ -0,0 +1,105 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "adc_clock.h"
+    #include <math.h>    // For sqrtf
+    #include <string.h>  // For memset
+
+
+// =============================
+// Simulated Clock: Start / Stop
+// =============================
+static esp_err_t sim_start(adc_clock_t *clk, uint32_t period_us, adc_clock_tick_fn on_tick, void *arg) {
+
+    adc_clock_sim_t *sim = (adc_clock_sim_t *)clk;
+    if (period_us == 0 || on_tick == NULL) return ESP_ERR_INVALID_ARG;
+
+    sim->period_us = period_us;
+    sim->next_us = sim->now_us + period_us;      // First tick one period after start, like an alarm
+    sim->on_tick = on_tick;
+    sim->arg = arg;
+    sim->running = true;
+    return ESP_OK;
+}
+
+static void sim_stop(adc_clock_t *clk) {
+    ((adc_clock_sim_t *)clk)->running = false;
+}
+
+adc_clock_t *adc_clock_sim_init(adc_clock_sim_t *sim, uint32_t start_us, uint32_t jitter_us, uint32_t seed) {
+
+    memset(sim, 0, sizeof(*sim));
+    sim->now_us = start_us;
+    sim->jitter_us = jitter_us;
+    sim->rng = seed ? seed : 1;                  // xorshift state must be non-zero
+
+    sim->base.name = "simulated";
+    sim->base.start = sim_start;
+    sim->base.stop = sim_stop;
+    return &sim->base;
+}
+
+
+// =============================
+// Simulated Clock: Advance Time
+// =============================
+static int32_t sim_offset(adc_clock_sim_t *sim) {
+
+    if (sim->jitter_us == 0) return 0;
+
+    uint32_t x = sim->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    sim->rng = x;
+    return (int32_t)(x % (2 * sim->jitter_us + 1)) - (int32_t)sim->jitter_us;
+}
+
+void adc_clock_sim_advance(adc_clock_sim_t *sim, uint32_t us) {
+
+    uint32_t end = sim->now_us + us;
+
+    // Wrap-safe "next <= end": the difference is small and positive while ticks are due
+    while (sim->running && (int32_t)(end - sim->next_us) >= 0) {
+        sim->now_us = sim->next_us;
+        sim->next_us += sim->period_us;          // Grid never drifts; jitter displaces single ticks
+        sim->ticks++;
+        sim->on_tick(sim->arg, sim->now_us + (uint32_t)sim_offset(sim));
+    }
+    sim->now_us = end;
+}
+
+
+// =============================
+// Jitter: Welford Running Statistics
+// =============================
+void adc_jitter_reset(adc_jitter_t *jitter) {
+    memset(jitter, 0, sizeof(*jitter));
+    jitter->min_us = UINT32_MAX;
+}
+
+void adc_jitter_add(adc_jitter_t *jitter, uint32_t stamp_us) {
+
+    // First stamp only anchors the next interval
+    if (!jitter->anchored) {
+        jitter->last_us = stamp_us;
+        jitter->anchored = true;
+        return;
+    }
+
+    uint32_t interval = stamp_us - jitter->last_us;   // Wrap-safe
+    jitter->last_us = stamp_us;
+
+    jitter->count++;
+    float delta = (float)interval - jitter->mean_us;
+    jitter->mean_us += delta / (float)jitter->count;
+    jitter->m2 += delta * ((float)interval - jitter->mean_us);
+
+    if (interval < jitter->min_us) jitter->min_us = interval;
+    if (interval > jitter->max_us) jitter->max_us = interval;
+}
+
+float adc_jitter_stddev_us(const adc_jitter_t *jitter) {
+    return jitter->count > 1 ? sqrtf(jitter->m2 / (float)(jitter->count - 1)) : 0.0f;
+}
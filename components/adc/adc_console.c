@@ -0,0 +1,44 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include <stdio.h>
+    #include <string.h>                 // For strcmp
+    #include "esp_console.h"            // Command registration
+    #include "adc_console.h"
+    #include "adc.h"                    // adc_graph
+
+
+// =============================
+// Command Handler
+// =============================
+static int stages_cmd(int argc, char **argv) {
+
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        dsp_graph_reset_counters(&adc_graph);
+        printf("stage counters cleared\n");
+        return 0;
+    }
+    if (argc > 1) {
+        printf("usage: stages [reset]\n");
+        return 1;
+    }
+
+    dsp_graph_print(stdout, &adc_graph);
+    return 0;
+}
+
+
+// =============================
+// Registration
+// =============================
+esp_err_t adc_console_register(void) {
+
+    const esp_console_cmd_t cmd = {
+        .command = "stages",
+        .help = "DSP stage costs (calls, frames, cycles/frame, worst call, share). 'stages reset' clears them.",
+        .hint = "[reset]",
+        .func = stages_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
@@ -0,0 +1,689 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include "freertos/FreeRTOS.h"
+    #include "freertos/task.h"
+    #include "esp_log.h"
+    #include "esp_err.h"
+
+    /* --- ADC --- */
+    #include "adc.h"
+    #include "adc_source.h"               // Oneshot driver as an acquisition source
+    #include "adc_frame.h"                // DMA frame decoding (continuous mode)
+    #include "dsp_decim.h"                // Oversampling front end (polyphase decimation)
+    #include "soc/soc_caps.h"             // For SOC_ADC_SAMPLE_FREQ_THRES_LOW
+    #include "driver/gptimer.h"           // Hardware sample clock (timer mode)
+    #include "esp_attr.h"                 // For IRAM_ATTR
+    #include "power.h"                    // Standby (no consumer) + sampling duty cycle
+
+//
+// Device-only half of the adc component: driver bring-up, calibration and the sampling task.
+// Host (linux target) builds leave this file out and feed the pipeline from an adc_source_t.
+//
+
+
+// =============================
+// ADC Driver Globals Definition (Here, for Module Ownership)
+// =============================
+adc_oneshot_unit_handle_t adc_handle = NULL;  // ADC driver handle
+adc_cali_handle_t adc_cali_handle = NULL;     // ADC Calibration handle
+adc_continuous_handle_t adc_cont_handle = NULL;  // ADC continuous (DMA) driver handle
+#if ADC_DECIM_FACTOR > 1
+static decim_chain_t adc_decim;               // Oversampling front end (ADC_ACQ_RATE_HZ -> pipeline rate)
+#endif
+
+// Frame slot -> ADC1 channel. Slot 0 is the original EEG input; the rest follow the
+// ADC1 pins that are free on a DevKitC (GPIO35, 32, 33, 36, 39, 37, 38).
+const adc_channel_t adc_channel_map[ADC_NUM_CHANNELS] = {
+    ADC_CHANNEL,
+#if ADC_NUM_CHANNELS > 1
+    ADC_CHANNEL_7,
+#endif
+#if ADC_NUM_CHANNELS > 2
+    ADC_CHANNEL_4,
+#endif
+#if ADC_NUM_CHANNELS > 3
+    ADC_CHANNEL_5,
+#endif
+#if ADC_NUM_CHANNELS > 4
+    ADC_CHANNEL_0,
+#endif
+#if ADC_NUM_CHANNELS > 5
+    ADC_CHANNEL_3,
+#endif
+#if ADC_NUM_CHANNELS > 6
+    ADC_CHANNEL_1,
+#endif
+#if ADC_NUM_CHANNELS > 7
+    ADC_CHANNEL_2,
+#endif
+};
+
+// =============================
+// Continuous Mode Rates
+// =============================
+// The DMA path has a hardware floor (20 kHz on the ESP32), so the converter runs at the smallest
+// multiple of ADC_CONV_RATE_HZ * ADC_NUM_CHANNELS above that floor (the scan pattern shares the
+// converter between channels) and the frame decoder averages back down.
+#define ADC_CONV_FRAME_RATE_HZ  (ADC_CONV_RATE_HZ * ADC_NUM_CHANNELS)
+#define ADC_CONV_OVERSAMPLE  ((SOC_ADC_SAMPLE_FREQ_THRES_LOW + ADC_CONV_FRAME_RATE_HZ - 1) / ADC_CONV_FRAME_RATE_HZ)
+#define ADC_CONV_HW_RATE_HZ  (ADC_CONV_OVERSAMPLE * ADC_CONV_FRAME_RATE_HZ)
+
+
+#if ADC_ACQ_MODE != ADC_ACQ_MODE_CONTINUOUS
+// =============================
+// Oneshot Driver: ADC Unit + Channel Configuration
+// =============================
+static esp_err_t init_adc_oneshot(void){
+
+    esp_err_t ret;
+
+    // ==============================
+    // 1. ADC Unit Configuration
+    // ==============================
+
+    // STEP 1A : Create a Handle (Done - Alrady defined globally)
+    // A handle is like a "pointer" or reference to a software object that represents
+    // the ADC hardware inside ESP-IDF. This handle will be used for all future ADC calls.
+    // (At this point, adc_handle is just a NULL pointer.)
+    // static adc_oneshot_unit_handle_t adc_handle;    // Reference to ADC driver
+
+    // STEP 1B : Define the ADC Unit configuration structure
+    // This structure describes global settings for the ADC peripheral.
+    // - unit_id: Which ADC hardware block (ADC1 or ADC2)
+    adc_oneshot_unit_init_cfg_t init_config = {
+        .unit_id = ADC_UNIT,   // Use ADC1 block
+    };
+    // Nothing is initialized yet. This is just the **desired configuration**.
+
+    // STEP 1C : Initialize ADC Unit using the ESP-IDF API
+    // Function: adc_oneshot_new_unit(init_config, &adc_handle)
+    // What it does:
+    // 1. Allocates memory for the ADC driver object
+    // 2. Programs ADC hardware registers according to init_config
+    // 3. Updates adc_handle to point to this driver object
+    ret = adc_oneshot_new_unit(&init_config, &adc_handle);
+    if (ret == ESP_OK) {
+        ESP_LOGI(ADC_TAG, "ADC Unit initialized successfully!");
+    } else {
+        ESP_LOGE(ADC_TAG, "Failed to initialize ADC unit! Error code: %d", ret);
+        return ret; // Stop if initialization failed
+    }
+    // Now adc_handle points to a fully initialized ADC driver object
+    // but the ADC channel/pin and input scaling are not set yet.
+
+    // ==============================
+    // 2. ADC Channel Configuration
+    // ==============================
+
+    // STEP 2B : Define the Channel Configuration structure
+    // This is a separate configuration structure that describes how to read from a specific ADC channel (pin).
+    // - bitwidth: Resolution of conversion (default 12-bit)
+    // - attenuation: How much input voltage the ADC can measure (~3.3V for DB_11)
+    adc_oneshot_chan_cfg_t chan_config = {
+        .bitwidth = ADC_BITWIDTH_DEFAULT,  // Default 12-bit resolution
+        .atten = ADC_ATTEN_DB_12           // ~3.3V full-scale voltage range
+    };
+
+    // STEP 2C: Apply it to every channel in the frame
+    for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+        ret = adc_oneshot_config_channel(adc_handle, adc_channel_map[ch], &chan_config);
+        if (ret != ESP_OK) {
+            ESP_LOGE(ADC_TAG, "Failed to configure ADC channel %d! Error code: %d", adc_channel_map[ch], ret);
+            return ret;
+        }
+    }
+    ESP_LOGI(ADC_TAG, "ADC channel(s) configured successfully! (%d)", ADC_NUM_CHANNELS);
+
+    return ESP_OK;
+}
+#endif // ADC_ACQ_MODE_ONESHOT || ADC_ACQ_MODE_TIMER
+
+
+#if ADC_ACQ_MODE == ADC_ACQ_MODE_CONTINUOUS
+// =============================
+// Continuous Driver: DMA Frames + Scan Pattern
+// =============================
+static esp_err_t init_adc_continuous(void){
+
+    esp_err_t ret;
+
+    // STEP 1: Create the continuous driver handle
+    // - max_store_buf_size: driver-side pool that absorbs frames while the sampling task is busy
+    // - conv_frame_size: bytes delivered per adc_continuous_read() (one fixed-size DMA frame)
+    adc_continuous_handle_cfg_t handle_cfg = {
+        .max_store_buf_size = ADC_CONV_POOL_BYTES,
+        .conv_frame_size = ADC_CONV_FRAME_BYTES,
+    };
+    ret = adc_continuous_new_handle(&handle_cfg, &adc_cont_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(ADC_TAG, "Failed to create continuous ADC handle! Error code: %d", ret);
+        return ret;
+    }
+
+    // STEP 2: Describe the scan pattern (one entry per EEG channel, in frame-slot order)
+    adc_digi_pattern_config_t pattern[ADC_NUM_CHANNELS];
+    for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+        pattern[ch] = (adc_digi_pattern_config_t){
+            .atten = ADC_ATTEN_DB_12,           // Same range as the oneshot path
+            .channel = adc_channel_map[ch] & 0x7,
+            .unit = ADC_UNIT,
+            .bit_width = SOC_ADC_DIGI_MAX_BITWIDTH,
+        };
+    }
+
+    // STEP 3: Converter rate + output format (TYPE1 = 16-bit words, see adc_frame.h)
+    adc_continuous_config_t cont_cfg = {
+        .pattern_num = ADC_NUM_CHANNELS,
+        .adc_pattern = pattern,
+        .sample_freq_hz = ADC_CONV_HW_RATE_HZ,
+        .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+        .format = ADC_DIGI_OUTPUT_FORMAT_TYPE1,
+    };
+    ret = adc_continuous_config(adc_cont_handle, &cont_cfg);
+    if (ret != ESP_OK) {
+        ESP_LOGE(ADC_TAG, "Failed to configure continuous ADC! Error code: %d", ret);
+        return ret;
+    }
+
+    // STEP 4: Start DMA; frames now queue up until adc_sampling() reads them
+    ret = adc_continuous_start(adc_cont_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(ADC_TAG, "Failed to start continuous ADC! Error code: %d", ret);
+        return ret;
+    }
+
+    ESP_LOGI(ADC_TAG, "Continuous ADC running: %d Hz converter, %d ch x %d Hz output (x%d averaging).",
+             ADC_CONV_HW_RATE_HZ, ADC_NUM_CHANNELS, ADC_CONV_RATE_HZ, ADC_CONV_OVERSAMPLE);
+    return ESP_OK;
+}
+#endif // ADC_ACQ_MODE_CONTINUOUS
+
+
+// =============================
+// ADC Unit Initialization + Channel Configuration + Calibration
+// =============================
+// Function to bring up the driver selected by ADC_ACQ_MODE and set up calibration.
+// Returns ESP_OK once the ADC is ready for sampling.
+esp_err_t init_adc(void){
+
+    esp_err_t ret;
+
+    // ==============================
+    // 1-2. Driver Bring-up (oneshot or continuous)
+    // ==============================
+#if ADC_ACQ_MODE == ADC_ACQ_MODE_CONTINUOUS
+    ret = init_adc_continuous();
+#else
+    ret = init_adc_oneshot();
+#endif
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    // ==============================
+    // 3. ADC Calibration Initialization
+    // ==============================
+
+    // Calibration is optional but recommended for accurate voltage readings.
+    // On ESP32, raw ADC values may vary due to temperature, voltage supply, and manufacturing.
+    // The calibration API converts raw readings to mV.
+
+    // Step 3A: Define the Calibration configuration structure
+    // This structure describes how the calibration should be performed.
+    // - unit_id: Which ADC unit (must match the one used before)
+    // - atten: Must match the attenuation used in channel config
+    // - bitwidth: Must match the bitwidth used in channel config
+    adc_cali_line_fitting_config_t cali_cfg = {
+        .unit_id = ADC_UNIT,               // Same ADC unit as before
+        .atten = ADC_ATTEN_DB_12,          // Same attenuation as channel config
+        .bitwidth = ADC_BITWIDTH_DEFAULT   // Same bitwidth as channel config
+    };
+
+    // Step 3B: Initialize Calibration using ESP-IDF API
+    // Function: adc_cali_create_scheme_curve_fitting(&cali_cfg, &handle)
+    // What it does:
+    // - Allocates memory for calibration object
+    // - Prepares math to convert raw ADC → voltage (mV)
+    if (adc_cali_create_scheme_line_fitting(&cali_cfg, &adc_cali_handle) == ESP_OK) {
+        ESP_LOGI(ADC_TAG, "ADC calibration ready.");
+    } else {
+        ESP_LOGW(ADC_TAG, "ADC calibration not available. Using raw ADC values.");
+        adc_cali_handle = NULL;          // Use raw values if calibration fails
+    }
+
+#if ADC_DECIM_FACTOR > 1
+    // ==============================
+    // 4. Oversampling Front End
+    // ==============================
+    decim_chain_init(&adc_decim, ADC_DECIM_FACTOR, (float)ADC_ACQ_RATE_HZ, ADC_NUM_CHANNELS, ADC_DECIM_GAIN_BITS);
+    ESP_LOGI(ADC_TAG, "Decimation: %d Hz -> %d Hz, %u stage(s) (%u + %u taps), delay %.1f ms",
+             ADC_ACQ_RATE_HZ, ADC_PIPELINE_RATE_HZ, adc_decim.num_stages, adc_decim.stage[0].taps,
+             adc_decim.num_stages > 1 ? adc_decim.stage[1].taps : 0,
+             decim_chain_delay(&adc_decim) * 1000.0f / ADC_ACQ_RATE_HZ);
+#endif
+
+    // --- End of setup ---
+    ESP_LOGI(ADC_TAG, "ADC is now initialized and ready for sampling.");
+
+    return ESP_OK;
+
+}
+
+
+// =============================
+// Helper: Calibrate Raw Frame + Store in Shared Buffer
+// =============================
+static void adc_store_raw(const int *raw, uint32_t stamp_us) {
+
+    int16_t frame[ADC_NUM_CHANNELS];
+
+    for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+
+        int voltage = 0; // Calibrated voltage in mV
+
+        // --- 1. Convert raw to calibrated voltage (mV) ---
+        if (adc_cali_handle) {
+            adc_cali_raw_to_voltage(adc_cali_handle, raw[ch], &voltage); // ESP-IDF API
+        } else {
+            // Fallback if calibration unavailable
+            voltage = raw[ch];
+        }
+
+        // Note: 1 unit = 0.1 mV scaling for EEG µV interpretation (e.g., 200 threshold = 20µV actual)
+        frame[ch] = (int16_t)(voltage * 10);
+    }
+
+    // --- 2. Store the calibrated frame in the sample ring, stamped with its acquisition time ---
+    adc_push_frame_at(frame, stamp_us);
+}
+
+
+#if ADC_DECIM_FACTOR > 1
+// =============================
+// Oversampling Front End: Decimate, Then Calibrate
+// =============================
+// Conversions enter the decimation chain as raw counts, and every ADC_DECIM_FACTOR-th one
+// completes a frame in counts x 2^ADC_DECIM_GAIN_BITS. Calibration runs on those frames only,
+// interpolating between the two neighbouring counts: the line-fitting scheme is linear, so the
+// fraction the averaging gained survives it.
+
+static int16_t adc_calibrate_fraction(int32_t q) {
+
+    const int32_t one = 1 << ADC_DECIM_GAIN_BITS;
+    if (q < 0) q = 0;
+    if (q > ADC_FRAME_DATA_MASK * one) q = ADC_FRAME_DATA_MASK * one;
+
+    int raw = (int)(q >> ADC_DECIM_GAIN_BITS);
+    int frac = (int)(q & (one - 1));
+    int v0 = raw, v1 = raw + 1;                         // Uncalibrated: counts
+    if (adc_cali_handle) {
+        adc_cali_raw_to_voltage(adc_cali_handle, raw, &v0);
+        if (frac) adc_cali_raw_to_voltage(adc_cali_handle, raw + 1, &v1);
+    }
+
+    // 0.1 mV units, like adc_store_raw()
+    int32_t units = v0 * 10 + ((v1 - v0) * 10 * frac + one / 2) / one;
+    return (int16_t)(units > INT16_MAX ? INT16_MAX : units);
+}
+
+static void adc_store_decimated(const int *raw, size_t frames, uint32_t stamp_us) {
+
+    static int16_t in[ADC_DRAIN_BLOCK * ADC_NUM_CHANNELS];          // Static: sampling task only, keeps its stack free
+    static int16_t out[(ADC_DRAIN_BLOCK / ADC_DECIM_FACTOR + 1) * ADC_NUM_CHANNELS];
+
+    while (frames > 0) {
+        size_t chunk = frames < ADC_DRAIN_BLOCK ? frames : ADC_DRAIN_BLOCK;
+        for (size_t i = 0; i < chunk * ADC_NUM_CHANNELS; i++) in[i] = (int16_t)raw[i];
+
+        size_t count = decim_chain_process(&adc_decim, in, out, chunk);
+        for (size_t f = 0; f < count; f++) {
+            int16_t frame[ADC_NUM_CHANNELS];
+            for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+                frame[ch] = adc_calibrate_fraction(out[f * ADC_NUM_CHANNELS + ch]);
+            }
+            adc_push_frame_at(frame, stamp_us);
+        }
+
+        raw += chunk * ADC_NUM_CHANNELS;
+        frames -= chunk;
+    }
+}
+#endif // ADC_DECIM_FACTOR > 1
+
+
+// =============================
+// Standby: No Sampling While Nobody Consumes (power.h)
+// =============================
+// Called by every sampling loop once power_mode() says STANDBY; returns when demand is back.
+// The loops give up their own clock first (gptimer alarm, DMA), which hold an APB lock and keep
+// the chip out of light sleep. Nothing is converted here: the filtering task would only throw
+// the frames away, so the task just checks the demand every POWER_IDLE_POLL_MS.
+static void adc_sampling_standby(void) {
+
+    ESP_LOGI(ADC_TAG, "Sampling stopped (standby)");
+
+    while (power_mode() == POWER_MODE_STANDBY) {
+        vTaskDelay(pdMS_TO_TICKS(POWER_IDLE_POLL_MS));
+    }
+
+    // The stamps just before and after standby are not one period apart
+    adc_jitter_reset(&adc_sample_jitter);
+    ESP_LOGI(ADC_TAG, "Sampling resumed");
+}
+
+
+#if ADC_ACQ_MODE != ADC_ACQ_MODE_CONTINUOUS
+// =============================
+// Sampling Loop: Oneshot (polled)
+// =============================
+static void adc_sampling_oneshot(void){
+
+    while (1) {
+
+        if (power_mode() == POWER_MODE_STANDBY) adc_sampling_standby();
+
+        int raw[ADC_NUM_CHANNELS] = {0};
+        uint32_t stamp = adc_now_us();
+
+        // --- 1. Read raw ADC value of every channel (back to back, one frame) ---
+        for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+            adc_oneshot_read(adc_handle, adc_channel_map[ch], &raw[ch]); // ESP-IDF API
+        }
+
+        // --- 2. Calibrate + store ---
+        adc_store_raw(raw, stamp);
+        adc_jitter_track(stamp);
+
+        // --- 3. Optional: Print to serial ---
+        size_t prev_idx = (buffer_index + BUFFER_SIZE - 1) % BUFFER_SIZE;
+        ESP_LOGD(ADC_TAG, "Raw ADC: %d -> Buffer[%zu]=%d", raw[0], prev_idx, adc_buffer[prev_idx * ADC_NUM_CHANNELS]);
+        power_busy_end(TASK_ROLE_SAMPLING, stamp);
+
+        // --- 4. Delay for next sample ---
+        vTaskDelay(pdMS_TO_TICKS(ADC_SAMPLE_PERIOD_MS));
+
+    }
+}
+#endif // ADC_ACQ_MODE_ONESHOT || ADC_ACQ_MODE_TIMER (fallback)
+
+
+// =============================
+// Sample Clock: gptimer
+// =============================
+// The alarm callback runs in ISR context and only forwards the tick; the conversion itself
+// happens in the task it wakes (adc_oneshot_read() is not ISR-safe).
+static bool IRAM_ATTR gptimer_clock_alarm(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata,
+                                          void *user_ctx) {
+    adc_clock_gptimer_t *clk = user_ctx;
+    return clk->on_tick(clk->arg, adc_now_us());
+}
+
+static esp_err_t gptimer_clock_start(adc_clock_t *base, uint32_t period_us, adc_clock_tick_fn on_tick, void *arg) {
+
+    adc_clock_gptimer_t *clk = (adc_clock_gptimer_t *)base;
+    gptimer_handle_t timer = NULL;
+    esp_err_t ret;
+
+    if (period_us == 0 || on_tick == NULL) return ESP_ERR_INVALID_ARG;
+    clk->on_tick = on_tick;
+    clk->arg = arg;
+
+    // --- 1. 1 MHz timer: one count per microsecond ---
+    gptimer_config_t timer_cfg = {
+        .clk_src = GPTIMER_CLK_SRC_DEFAULT,
+        .direction = GPTIMER_COUNT_UP,
+        .resolution_hz = 1000000,
+    };
+    ret = gptimer_new_timer(&timer_cfg, &timer);
+    if (ret != ESP_OK) return ret;
+
+    // --- 2. Alarm every period, reloaded in hardware (no drift from callback latency) ---
+    gptimer_event_callbacks_t cbs = { .on_alarm = gptimer_clock_alarm };
+    gptimer_alarm_config_t alarm_cfg = {
+        .alarm_count = period_us,
+        .reload_count = 0,
+        .flags.auto_reload_on_alarm = true,
+    };
+    ret = gptimer_register_event_callbacks(timer, &cbs, clk);
+    if (ret == ESP_OK) ret = gptimer_set_alarm_action(timer, &alarm_cfg);
+    if (ret == ESP_OK) ret = gptimer_enable(timer);
+    if (ret == ESP_OK) ret = gptimer_start(timer);
+    if (ret != ESP_OK) {
+        gptimer_del_timer(timer);
+        return ret;
+    }
+
+    clk->timer = timer;
+    return ESP_OK;
+}
+
+static void gptimer_clock_stop(adc_clock_t *base) {
+
+    adc_clock_gptimer_t *clk = (adc_clock_gptimer_t *)base;
+    if (clk->timer == NULL) return;
+
+    gptimer_stop(clk->timer);
+    gptimer_disable(clk->timer);
+    gptimer_del_timer(clk->timer);
+    clk->timer = NULL;
+}
+
+adc_clock_t *adc_clock_gptimer_init(adc_clock_gptimer_t *clk) {
+    clk->base.name = "gptimer";
+    clk->base.start = gptimer_clock_start;
+    clk->base.stop = gptimer_clock_stop;
+    clk->timer = NULL;
+    clk->on_tick = NULL;
+    clk->arg = NULL;
+    return &clk->base;
+}
+
+
+#if ADC_ACQ_MODE == ADC_ACQ_MODE_TIMER
+// =============================
+// Sampling Loop: Timer (gptimer alarm -> task notification)
+// =============================
+// Each alarm gives the sampling task one notification; the task converts as soon as it runs.
+// The pinned task layouts (task_layout.h) run adc_sampling above every other pipeline task on its
+// core, so the wake-up latency stays in the tens of microseconds. A notification count above 1
+// means the task fell a whole period behind: those ticks are counted as missed and collapsed
+// into one conversion.
+static TaskHandle_t sampling_task = NULL;
+
+static bool IRAM_ATTR timer_sampling_tick(void *arg, uint32_t now_us) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(sampling_task, &woken);
+    return woken == pdTRUE;
+}
+
+static void adc_sampling_timer(void){
+
+    static adc_clock_gptimer_t gptimer_clock;
+    adc_clock_t *clk = adc_clock_gptimer_init(&gptimer_clock);
+
+    sampling_task = xTaskGetCurrentTaskHandle();
+    esp_err_t ret = adc_clock_start(clk, ADC_ACQ_PERIOD_US, timer_sampling_tick, NULL);
+    if (ret != ESP_OK) {
+        ESP_LOGE(ADC_TAG, "Sample clock start failed (%s), falling back to polled sampling", esp_err_to_name(ret));
+        adc_sampling_oneshot();
+    }
+
+    while (1) {
+
+        int raw[ADC_NUM_CHANNELS] = {0};
+
+        // --- 0. No consumer: stop the clock; no conversions run until demand is back ---
+        if (power_mode() == POWER_MODE_STANDBY) {
+            adc_clock_stop(clk);
+            adc_sampling_standby();
+#if ADC_DECIM_FACTOR > 1
+            decim_chain_reset(&adc_decim);          // Its history is from before the gap
+#endif
+            ret = adc_clock_start(clk, ADC_ACQ_PERIOD_US, timer_sampling_tick, NULL);
+            if (ret != ESP_OK) {
+                ESP_LOGE(ADC_TAG, "Sample clock restart failed (%s), falling back to polled sampling", esp_err_to_name(ret));
+                adc_sampling_oneshot();
+            }
+            ulTaskNotifyTake(pdTRUE, 0);            // Ticks from the old clock
+        }
+
+        // --- 1. Wait for the next tick ---
+        uint32_t pending = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (pending > 1) adc_timer_missed += pending - 1;
+        uint32_t stamp = adc_now_us();
+
+        // --- 2. Read raw ADC value of every channel (back to back, one frame) ---
+        for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+            adc_oneshot_read(adc_handle, adc_channel_map[ch], &raw[ch]); // ESP-IDF API
+        }
+
+        // --- 3. Calibrate + store (or decimate first) ---
+#if ADC_DECIM_FACTOR > 1
+        adc_store_decimated(raw, 1, stamp);
+#else
+        adc_store_raw(raw, stamp);
+#endif
+        adc_jitter_track(stamp);
+        power_busy_end(TASK_ROLE_SAMPLING, stamp);
+    }
+}
+#endif // ADC_ACQ_MODE_TIMER
+
+
+#if ADC_ACQ_MODE == ADC_ACQ_MODE_CONTINUOUS
+// =============================
+// Sampling Loop: Continuous (DMA frames)
+// =============================
+// Blocks on adc_continuous_read() until a full frame is ready, so the period is set by the
+// converter clock rather than by the RTOS tick, and there is one wake-up per frame.
+static void adc_sampling_continuous(void){
+
+    static uint8_t frame[ADC_CONV_FRAME_BYTES];                          // Static: keeps the 2 KB task stack free
+    static int samples[ADC_CONV_FRAME_BYTES / ADC_FRAME_RESULT_BYTES];  // Decoded frames, interleaved
+    adc_frame_decoder_t decoder;
+    uint8_t channels[ADC_NUM_CHANNELS];
+
+    for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) channels[ch] = (uint8_t)adc_channel_map[ch];
+    adc_frame_decoder_init(&decoder, channels, ADC_NUM_CHANNELS, ADC_CONV_OVERSAMPLE);
+
+    while (1) {
+
+        uint32_t frame_len = 0;
+
+        // --- 0. No consumer: stop DMA (its PM lock keeps the APB clock up) until demand is back ---
+        if (power_mode() == POWER_MODE_STANDBY) {
+            adc_continuous_stop(adc_cont_handle);
+            adc_sampling_standby();
+            adc_frame_decoder_init(&decoder, channels, ADC_NUM_CHANNELS, ADC_CONV_OVERSAMPLE);
+#if ADC_DECIM_FACTOR > 1
+            decim_chain_reset(&adc_decim);
+#endif
+            adc_continuous_start(adc_cont_handle);
+        }
+
+        // --- 1. Wait for the next DMA frame ---
+        esp_err_t ret = adc_continuous_read(adc_cont_handle, frame, sizeof(frame), &frame_len, ADC_MAX_DELAY);
+        if (ret != ESP_OK) {
+            ESP_LOGW(ADC_TAG, "Continuous read failed! Error code: %d", ret);
+            continue;
+        }
+        uint32_t t0 = power_busy_begin();
+
+        // --- 2. Decode + average down to ADC_CONV_RATE_HZ ---
+        size_t count = adc_frame_decode(&decoder, frame, frame_len, samples,
+                                        sizeof(samples) / sizeof(samples[0]) / ADC_NUM_CHANNELS);
+
+        // --- 3. Calibrate + store every sample frame decoded from the DMA frame (or decimate first) ---
+        uint32_t stamp = adc_now_us();
+#if ADC_DECIM_FACTOR > 1
+        adc_store_decimated(samples, count, stamp);
+#else
+        for (size_t i = 0; i < count; i++) {
+            adc_store_raw(&samples[i * ADC_NUM_CHANNELS], stamp);
+        }
+#endif
+
+        ESP_LOGD(ADC_TAG, "Frame: %lu bytes -> %u sample frames (dropped %lu)",
+                 frame_len, (unsigned)count, decoder.dropped);
+        power_busy_end(TASK_ROLE_SAMPLING, t0);
+    }
+}
+#endif // ADC_ACQ_MODE_CONTINUOUS
+
+
+// =============================
+// Acquisition Source: Oneshot Driver
+// =============================
+// Same reads + calibration as adc_sampling_oneshot(), but handed to the caller instead of the
+// sample ring, so adc_pipeline_run() can be driven by the real ADC. Paced one period per frame.
+static size_t oneshot_source_read(adc_source_t *src, int16_t *frames, size_t max_frames) {
+
+    if (adc_handle == NULL) return 0;                    // Not in oneshot mode / init_adc() failed
+
+    for (size_t f = 0; f < max_frames; f++) {
+        for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+
+            int raw = 0;
+            int voltage = 0;
+            adc_oneshot_read(adc_handle, adc_channel_map[ch], &raw);
+
+            if (adc_cali_handle) {
+                adc_cali_raw_to_voltage(adc_cali_handle, raw, &voltage);
+            } else {
+                voltage = raw;
+            }
+            frames[f * ADC_NUM_CHANNELS + ch] = (int16_t)(voltage * 10);   // 0.1 mV units
+        }
+        vTaskDelay(pdMS_TO_TICKS(ADC_SAMPLE_PERIOD_MS));
+    }
+
+    return max_frames;
+}
+
+adc_source_t *adc_source_oneshot_init(adc_source_oneshot_t *oneshot) {
+    oneshot->base.name = "adc_oneshot";
+    oneshot->base.channels = ADC_NUM_CHANNELS;
+    oneshot->base.sample_rate_hz = (float)SAMPLE_RATE_HZ;
+    oneshot->base.read = oneshot_source_read;
+    oneshot->base.close = NULL;
+    return &oneshot->base;
+}
+
+
+// =============================
+// FreeRTOS Task: ADC Sampling
+// =============================
+void adc_sampling(void *arg){
+
+    ESP_LOGI(ADC_TAG, "ADC sampling task started!");
+
+#if ADC_ACQ_MODE == ADC_ACQ_MODE_CONTINUOUS
+    adc_sampling_continuous();
+#elif ADC_ACQ_MODE == ADC_ACQ_MODE_TIMER
+    adc_sampling_timer();
+#else
+    adc_sampling_oneshot();
+#endif
+}
+
+
+// =============================
+// Static Footprint (mem_budget.h)
+// =============================
+// The DMA / decimation buffers are function-local statics: listed by the expression that sizes them.
+static const mem_budget_item_t adc_driver_mem_items[] = {
+    MEM_BUDGET_ITEM(adc_channel_map),
+#if ADC_DECIM_FACTOR > 1
+    MEM_BUDGET_ITEM(adc_decim),
+    MEM_BUDGET_BYTES("decim in block", ADC_DRAIN_BLOCK * ADC_NUM_CHANNELS * sizeof(int16_t)),
+    MEM_BUDGET_BYTES("decim out block", (ADC_DRAIN_BLOCK / ADC_DECIM_FACTOR + 1) * ADC_NUM_CHANNELS * sizeof(int16_t)),
+#endif
+#if ADC_ACQ_MODE == ADC_ACQ_MODE_CONTINUOUS
+    MEM_BUDGET_BYTES("dma frame", ADC_CONV_FRAME_BYTES),
+    MEM_BUDGET_BYTES("dma samples", ADC_CONV_FRAME_BYTES / ADC_FRAME_RESULT_BYTES * sizeof(int)),
+#endif
+};
+const mem_budget_table_t adc_driver_mem_budget = MEM_BUDGET_TABLE("adc_driver", adc_driver_mem_items);
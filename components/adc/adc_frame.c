@@ -0,0 +1,129 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "adc_frame.h"
+    #include <math.h>    // For the mock sine
+    #include <string.h>  // For memset
+
+
+// =============================
+// Frame Decoder: Init
+// =============================
+void adc_frame_decoder_init(adc_frame_decoder_t *dec, const uint8_t *channels, uint8_t num_channels,
+                            uint32_t oversample) {
+
+    if (num_channels > ADC_FRAME_MAX_SLOTS) num_channels = ADC_FRAME_MAX_SLOTS;
+
+    memset(dec, 0, sizeof(*dec));
+    memset(dec->slot_of, ADC_FRAME_NO_SLOT, sizeof(dec->slot_of));
+
+    dec->num_slots = num_channels;
+    dec->oversample = oversample ? oversample : 1;
+    for (uint8_t i = 0; i < num_channels; i++) {
+        dec->slot_of[channels[i] & (sizeof(dec->slot_of) - 1)] = i;
+    }
+}
+
+
+// =============================
+// Frame Decoder: DMA Bytes -> Averaged Interleaved Frames
+// =============================
+size_t adc_frame_decode(adc_frame_decoder_t *dec, const uint8_t *frame, size_t len,
+                        int *out, size_t max_frames) {
+
+    size_t produced = 0;
+
+    for (size_t i = 0; i + ADC_FRAME_RESULT_BYTES <= len; i += ADC_FRAME_RESULT_BYTES) {
+
+        // --- 1. Unpack one little-endian result word, route it to its slot ---
+        uint16_t word = (uint16_t)(frame[i] | (frame[i + 1] << 8));
+        uint8_t slot = dec->slot_of[word >> ADC_FRAME_CHANNEL_SHIFT];
+
+        if (slot == ADC_FRAME_NO_SLOT) {
+            dec->dropped++;
+            continue;
+        }
+
+        // --- 2. Accumulate; the last slot to complete closes the output frame ---
+        dec->acc[slot] += word & ADC_FRAME_DATA_MASK;
+        if (++dec->acc_count[slot] < dec->oversample) continue;
+
+        int complete = 1;
+        for (uint8_t s = 0; s < dec->num_slots; s++) {
+            if (dec->acc_count[s] < dec->oversample) { complete = 0; break; }
+        }
+        if (!complete) continue;
+
+        // --- 3. Emit the averaged frame (or count it if the caller has no room) ---
+        if (produced < max_frames) {
+            int *dst = &out[produced * dec->num_slots];
+            for (uint8_t s = 0; s < dec->num_slots; s++) {
+                dst[s] = (int)((dec->acc[s] + dec->acc_count[s] / 2) / dec->acc_count[s]);
+            }
+            produced++;
+        } else {
+            dec->dropped++;
+        }
+        memset(dec->acc, 0, sizeof(dec->acc));
+        memset(dec->acc_count, 0, sizeof(dec->acc_count));
+    }
+
+    return produced;
+}
+
+
+// =============================
+// Mock Frame Source: Init
+// =============================
+void adc_frame_mock_init(adc_frame_mock_t *mock, uint8_t channel, float conv_rate_hz,
+                         float freq_hz, float amplitude, float offset) {
+    mock->channel = channel;
+    mock->num_channels = 1;
+    mock->channel_step = 0.0f;
+    mock->foreign_channel = (uint8_t)((channel + 1) & 0x0F);
+    mock->foreign_every = 0;
+    mock->conv_rate_hz = conv_rate_hz;
+    mock->freq_hz = freq_hz;
+    mock->amplitude = amplitude;
+    mock->offset = offset;
+    mock->n = 0;
+    mock->emitted = 0;
+}
+
+
+// =============================
+// Mock Frame Source: Fill One Frame
+// =============================
+size_t adc_frame_mock_fill(adc_frame_mock_t *mock, uint8_t *frame, size_t len) {
+
+    size_t written = 0;
+
+    while (written + ADC_FRAME_RESULT_BYTES <= len) {
+
+        uint16_t word;
+        mock->emitted++;
+
+        if (mock->foreign_every && (mock->emitted % mock->foreign_every) == 0) {
+            // Result from another channel (e.g., a second scan-pattern entry)
+            word = (uint16_t)((mock->foreign_channel << ADC_FRAME_CHANNEL_SHIFT) | 0x0ABC);
+        } else {
+            // Scan pattern: conversion n belongs to channel (n % num_channels) of set n / num_channels
+            uint32_t k = mock->n % mock->num_channels;
+            uint32_t set = mock->n / mock->num_channels;
+            float v = mock->offset + k * mock->channel_step +
+                      mock->amplitude * sinf(2.0f * (float)M_PI * mock->freq_hz * set / mock->conv_rate_hz);
+            mock->n++;
+            if (v < 0.0f) v = 0.0f;
+            if (v > (float)ADC_FRAME_DATA_MASK) v = (float)ADC_FRAME_DATA_MASK;
+            uint8_t ch = (uint8_t)((mock->channel + k) & 0x0F);
+            word = (uint16_t)((ch << ADC_FRAME_CHANNEL_SHIFT) | ((uint16_t)lrintf(v) & ADC_FRAME_DATA_MASK));
+        }
+
+        frame[written]     = (uint8_t)(word & 0xFF);
+        frame[written + 1] = (uint8_t)(word >> 8);
+        written += ADC_FRAME_RESULT_BYTES;
+    }
+
+    return written;
+}
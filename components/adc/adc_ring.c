@@ -0,0 +1,102 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "adc_ring.h"
+    #include <string.h>  // For memmove
+    #include <assert.h>
+
+
+// =============================
+// Ring: Init
+// =============================
+void adc_ring_init(adc_ring_t *ring, int16_t *storage, uint32_t size, uint8_t width) {
+    ring->data = storage;
+    ring->mask = size - 1;
+    ring->width = width ? width : 1;
+    atomic_store_explicit(&ring->head, 0, memory_order_relaxed);
+    ring->tail = 0;
+    ring->overruns = 0;
+}
+
+
+// =============================
+// Producer: Push One Frame
+// =============================
+uint32_t adc_ring_push_frame(adc_ring_t *ring, const int16_t *frame) {
+
+    uint32_t seq = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    int16_t *slot = &ring->data[(seq & ring->mask) * ring->width];
+
+    // Write the slot first, then publish it (release pairs with the consumer's acquire)
+    for (uint8_t c = 0; c < ring->width; c++) slot[c] = frame[c];
+    atomic_store_explicit(&ring->head, seq + 1, memory_order_release);
+
+    return seq;
+}
+
+uint32_t adc_ring_push(adc_ring_t *ring, int16_t sample) {
+    assert(ring->width == 1);   // A wider ring would read past `sample`: use adc_ring_push_frame
+    return adc_ring_push_frame(ring, &sample);
+}
+
+
+// =============================
+// Consumer: Drain Unread Frames
+// =============================
+size_t adc_ring_read(adc_ring_t *ring, int16_t *out, size_t max, uint32_t *first_seq, uint32_t *lost) {
+
+    uint32_t size = ring->mask + 1;
+    uint32_t dropped = 0;
+
+    // --- 1. Snapshot what the producer has published ---
+    uint32_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+    // --- 2. Lapped? Skip straight to the oldest slot that is still safe to read ---
+    // (size - 1 of them: the slot of `head - size` is the one the producer writes next)
+    if (head - ring->tail > size - 1) {
+        dropped += head - ring->tail - (size - 1);
+        ring->tail = head - (size - 1);
+    }
+
+    // --- 3. Copy out (oldest first) ---
+    uint32_t n = head - ring->tail;
+    if (n > max) n = (uint32_t)max;
+    const uint8_t w = ring->width;
+    for (uint32_t i = 0; i < n; i++) {
+        const int16_t *slot = &ring->data[((ring->tail + i) & ring->mask) * w];
+        for (uint8_t c = 0; c < w; c++) out[i * w + c] = slot[c];
+    }
+
+    // --- 4. Re-check: the producer may have overwritten the oldest slots while we copied ---
+    // A slot holding `seq` is safe only while head <= seq + size - 1 (the producer may be
+    // mid-write of sequence `head`, which reuses the slot of `head - size`).
+    atomic_thread_fence(memory_order_acquire);
+    uint32_t head_after = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    uint32_t oldest_safe = head_after - size + 1;
+
+    if ((int32_t)(oldest_safe - ring->tail) > 0) {
+        uint32_t clobbered = oldest_safe - ring->tail;
+        if (clobbered > n) clobbered = n;
+        memmove(out, out + clobbered * w, (n - clobbered) * w * sizeof(out[0]));
+        ring->tail += clobbered;
+        dropped += clobbered;
+        n -= clobbered;
+    }
+
+    // --- 5. Report + consume ---
+    if (first_seq) *first_seq = ring->tail;
+    if (lost) *lost = dropped;
+    ring->overruns += dropped;
+    ring->tail += n;
+
+    return n;
+}
+
+
+// =============================
+// Consumer: Backlog Size
+// =============================
+uint32_t adc_ring_pending(const adc_ring_t *ring) {
+    return atomic_load_explicit(&((adc_ring_t *)ring)->head, memory_order_acquire) - ring->tail;
+}
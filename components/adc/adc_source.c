@@ -0,0 +1,396 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "adc_source.h"
+    #include <math.h>    // For sinf
+    #include <string.h>  // For memset
+    #include <stdlib.h>  // For strtof
+
+
+// =============================
+// Synthetic Source: Config Defaults
+// =============================
+void adc_synth_default_config(adc_synth_config_t *cfg, float sample_rate_hz) {
+
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->sample_rate_hz = sample_rate_hz;
+    cfg->offset = 12000.0f;                              // 1.2 V mid-rail, 0.1 mV units
+    // Background kept below the blink detector's 20-unit step so only the pulses count
+    cfg->tones[0] = (adc_synth_tone_t){10.0f, 15.0f};    // Alpha
+    cfg->tones[1] = (adc_synth_tone_t){20.0f, 4.0f};     // Beta
+    cfg->num_tones = 2;
+    cfg->noise_amplitude = 3.0f;
+    cfg->blink_amplitude = 1500.0f;
+    cfg->blink_interval_s = 3.0f;
+    cfg->blink_width_s = 0.3f;
+    cfg->seed = 1;
+}
+
+
+// =============================
+// Synthetic Source: Generator
+// =============================
+static inline float synth_noise(adc_source_synth_t *s) {
+    // xorshift32: cheap, deterministic, good enough for test noise
+    uint32_t x = s->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    s->rng = x;
+    return ((float)(x >> 8) / (float)(1u << 24)) * 2.0f - 1.0f;   // [-1, 1)
+}
+
+static size_t synth_read(adc_source_t *src, int16_t *frames, size_t max_frames) {
+
+    adc_source_synth_t *s = (adc_source_synth_t *)src;
+    const adc_synth_config_t *cfg = &s->cfg;
+
+    if (cfg->duration_frames && s->n + max_frames > cfg->duration_frames) {
+        max_frames = (size_t)(cfg->duration_frames - s->n);
+    }
+
+    const double dt = 1.0 / cfg->sample_rate_hz;
+    const uint64_t blink_period = (uint64_t)(cfg->blink_interval_s * cfg->sample_rate_hz);
+    const uint64_t blink_len = (uint64_t)(cfg->blink_width_s * cfg->sample_rate_hz);
+
+    for (size_t f = 0; f < max_frames; f++, s->n++) {
+
+        // --- 1. Shared signal: tones + blink pulse (same on every electrode) ---
+        float v = cfg->offset;
+        for (uint8_t k = 0; k < cfg->num_tones; k++) {
+            // Phase in cycles, wrapped in double so hours of signal keep float precision
+            float phase = (float)fmod((double)s->n * dt * cfg->tones[k].freq_hz, 1.0);
+            v += cfg->tones[k].amplitude * sinf(2.0f * (float)M_PI * phase);
+        }
+
+        if (cfg->blink_amplitude > 0.0f && blink_period && blink_len) {
+            uint64_t pos = s->n % blink_period;
+            if (pos == 0) s->blinks++;
+            if (pos < blink_len) {
+                v += cfg->blink_amplitude * sinf((float)M_PI * (float)pos / (float)blink_len);
+            }
+        }
+
+        // --- 2. Per-channel noise, saturate to int16_t ---
+        for (uint8_t ch = 0; ch < src->channels; ch++) {
+            float x = v + cfg->noise_amplitude * synth_noise(s);
+            if (x > 32767.0f) x = 32767.0f;
+            if (x < -32768.0f) x = -32768.0f;
+            frames[f * src->channels + ch] = (int16_t)lrintf(x);
+        }
+    }
+
+    return max_frames;
+}
+
+adc_source_t *adc_source_synth_init(adc_source_synth_t *synth, const adc_synth_config_t *cfg,
+                                    uint8_t channels) {
+
+    memset(synth, 0, sizeof(*synth));
+    synth->cfg = *cfg;
+    if (synth->cfg.num_tones > ADC_SYNTH_MAX_TONES) synth->cfg.num_tones = ADC_SYNTH_MAX_TONES;
+    synth->rng = cfg->seed ? cfg->seed : 1;              // xorshift state must be non-zero
+
+    synth->base.name = "synthetic";
+    synth->base.channels = channels ? channels : 1;
+    synth->base.sample_rate_hz = cfg->sample_rate_hz;
+    synth->base.read = synth_read;
+    synth->base.close = NULL;
+    return &synth->base;
+}
+
+
+// =============================
+// File Source: CSV
+// =============================
+static size_t file_read_csv(adc_source_file_t *f, int16_t *frames, size_t max_frames) {
+
+    char line[256];
+    size_t n = 0;
+    const uint8_t nch = f->base.channels;
+
+    while (n < max_frames && fgets(line, sizeof(line), f->fp)) {
+
+        char *p = line;
+        char *end;
+        int16_t *dst = &frames[n * nch];
+        uint8_t got = 0;
+
+        while (got < nch) {
+            while (*p == ' ' || *p == '\t' || *p == ',' || *p == ';') p++;
+            float v = strtof(p, &end);
+            if (end == p || v != v) break;               // No number here (or NaN)
+            v = v < 0.0f ? v - 0.5f : v + 0.5f;          // Round like the EDF reader
+            if (v > 32767.0f) v = 32767.0f;
+            if (v < -32768.0f) v = -32768.0f;
+            dst[got++] = (int16_t)v;
+            p = end;
+        }
+
+        if (got == 0) {                                  // Header / comment / blank line
+            f->bad_lines++;
+            continue;
+        }
+        for (uint8_t ch = got; ch < nch; ch++) dst[ch] = dst[got - 1];
+        n++;
+    }
+
+    return n;
+}
+
+
+// =============================
+// File Source: Binary (int16_t LE)
+// =============================
+static size_t file_read_binary(adc_source_file_t *f, int16_t *frames, size_t max_frames) {
+
+    const uint8_t nch = f->base.channels;
+    size_t n = fread(frames, sizeof(int16_t) * nch, max_frames, f->fp);
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    for (size_t i = 0; i < n * nch; i++) {
+        uint16_t u = (uint16_t)frames[i];
+        frames[i] = (int16_t)((u >> 8) | (u << 8));
+    }
+#endif
+    return n;
+}
+
+
+// =============================
+// File Source: Open / Attach / Close
+// =============================
+static size_t file_read(adc_source_t *src, int16_t *frames, size_t max_frames) {
+    adc_source_file_t *f = (adc_source_file_t *)src;
+    if (!f->fp) return 0;
+    return f->format == ADC_FILE_BINARY ? file_read_binary(f, frames, max_frames)
+                                        : file_read_csv(f, frames, max_frames);
+}
+
+static void file_close(adc_source_t *src) {
+    adc_source_file_t *f = (adc_source_file_t *)src;
+    if (f->fp && f->owns_fp) fclose(f->fp);
+    f->fp = NULL;
+}
+
+adc_source_t *adc_source_file_attach(adc_source_file_t *file, FILE *fp, adc_file_format_t format,
+                                     uint8_t channels, float sample_rate_hz) {
+
+    memset(file, 0, sizeof(*file));
+    file->fp = fp;
+    file->format = format;
+    file->owns_fp = false;
+
+    file->base.name = (format == ADC_FILE_BINARY) ? "binary file" : "csv file";
+    file->base.channels = channels ? channels : 1;
+    file->base.sample_rate_hz = sample_rate_hz;
+    file->base.read = file_read;
+    file->base.close = file_close;
+    return &file->base;
+}
+
+adc_source_t *adc_source_file_open(adc_source_file_t *file, const char *path, adc_file_format_t format,
+                                   uint8_t channels, float sample_rate_hz) {
+
+    FILE *fp = fopen(path, format == ADC_FILE_BINARY ? "rb" : "r");
+    if (!fp) return NULL;
+
+    adc_source_t *src = adc_source_file_attach(file, fp, format, channels, sample_rate_hz);
+    file->owns_fp = true;
+    return src;
+}
+
+
+// =============================
+// EDF Source: Header
+// =============================
+// The header is a 256-byte fixed part, then one 256-byte block per signal stored field by
+// field: all labels, then all transducers, ... Every field is space-padded ASCII.
+#define EDF_FIXED_HEADER  256
+
+static bool edf_field(FILE *fp, long offset, size_t len, char *out) {
+
+    if (fseek(fp, offset, SEEK_SET) != 0 || fread(out, 1, len, fp) != len) return false;
+    out[len] = '\0';
+    for (size_t i = len; i > 0 && out[i - 1] == ' '; i--) out[i - 1] = '\0';   // Trim padding
+    return true;
+}
+
+// Offset of field `start` (per-signal bytes before it) for signal `sig` of `ns`
+static inline long edf_signal_field(uint32_t ns, uint32_t start, uint32_t width, uint32_t sig) {
+    return EDF_FIXED_HEADER + (long)ns * start + (long)sig * width;
+}
+
+static float edf_unit_scale(const char *dim) {
+    if (strcmp(dim, "mV") == 0) return 1000.0f;
+    if (strcmp(dim, "V") == 0) return 1000000.0f;
+    if (strcmp(dim, "nV") == 0) return 0.001f;
+    return 1.0f;                                         // uV, or unlabelled: taken as µV
+}
+
+static bool edf_parse(adc_source_edf_t *edf, uint8_t channels) {
+
+    FILE *fp = edf->fp;
+    char text[81];
+
+    // --- 1. Fixed part: version "0", record count + duration, signal count ---
+    if (!edf_field(fp, 0, 8, text) || strcmp(text, "0") != 0) return false;
+    if (!edf_field(fp, 236, 8, text)) return false;
+    edf->records = strtol(text, NULL, 10);
+    if (edf->records <= 0) edf->records = -1;
+    if (!edf_field(fp, 244, 8, text)) return false;
+    float duration = strtof(text, NULL);
+    if (!edf_field(fp, 252, 4, text)) return false;
+    uint32_t ns = (uint32_t)strtoul(text, NULL, 10);
+    if (ns == 0 || duration <= 0.0f) return false;
+    edf->data_start = EDF_FIXED_HEADER * (long)(ns + 1);
+
+    // --- 2. Signals: record layout, then the first `channels` ordinary ones ---
+    uint8_t found = 0;
+    uint32_t offset = 0;
+    for (uint32_t s = 0; s < ns; s++) {
+
+        if (!edf_field(fp, edf_signal_field(ns, 216, 8, s), 8, text)) return false;
+        uint32_t spr = (uint32_t)strtoul(text, NULL, 10);
+        uint32_t at = offset;
+        offset += spr * 2;
+
+        char label[17];
+        if (!edf_field(fp, edf_signal_field(ns, 0, 16, s), 16, label)) return false;
+        if (found == channels || strncmp(label, "EDF Annotations", 15) == 0) continue;
+
+        if (found == 0) edf->per_record = spr;
+        if (spr != edf->per_record || spr == 0) return false;    // One rate for every channel
+
+        char dim[9], pmin[9], pmax[9], dmin[9], dmax[9];
+        if (!edf_field(fp, edf_signal_field(ns, 96, 8, s), 8, dim) ||
+            !edf_field(fp, edf_signal_field(ns, 104, 8, s), 8, pmin) ||
+            !edf_field(fp, edf_signal_field(ns, 112, 8, s), 8, pmax) ||
+            !edf_field(fp, edf_signal_field(ns, 120, 8, s), 8, dmin) ||
+            !edf_field(fp, edf_signal_field(ns, 128, 8, s), 8, dmax)) return false;
+
+        float p0 = strtof(pmin, NULL), p1 = strtof(pmax, NULL);
+        float d0 = strtof(dmin, NULL), d1 = strtof(dmax, NULL);
+        if (d1 == d0) return false;
+
+        float unit = edf_unit_scale(dim);
+        edf->gain[found] = (p1 - p0) / (d1 - d0) * unit;
+        edf->bias[found] = (p0 - d0 * (p1 - p0) / (d1 - d0)) * unit;
+        edf->offset[found] = at;
+        memcpy(edf->label[found], label, sizeof(label));
+        found++;
+    }
+    if (found == 0) return false;
+
+    // Fewer signals than channels: repeat the last one
+    for (uint8_t ch = found; ch < channels; ch++) {
+        edf->gain[ch] = edf->gain[found - 1];
+        edf->bias[ch] = edf->bias[found - 1];
+        edf->offset[ch] = edf->offset[found - 1];
+        memcpy(edf->label[ch], edf->label[found - 1], sizeof(edf->label[ch]));
+    }
+
+    edf->record_bytes = offset;
+    edf->base.sample_rate_hz = (float)edf->per_record / duration;
+    return (size_t)edf->per_record * channels <= ADC_EDF_MAX_RECORD;
+}
+
+
+// =============================
+// EDF Source: Data Records
+// =============================
+// Loads the next record's selected signals into buf[] as interleaved frames
+static bool edf_load_record(adc_source_edf_t *edf) {
+
+    const uint8_t nch = edf->base.channels;
+    if (edf->records >= 0 && edf->record >= edf->records) return false;
+
+    long start = edf->data_start + (long)(edf->record * edf->record_bytes);
+    for (uint8_t ch = 0; ch < nch; ch++) {
+
+        if (fseek(edf->fp, start + (long)edf->offset[ch], SEEK_SET) != 0) return false;
+
+        uint8_t raw[128];
+        for (uint32_t i = 0; i < edf->per_record; ) {
+            uint32_t n = edf->per_record - i;
+            if (n > sizeof(raw) / 2) n = sizeof(raw) / 2;
+            if (fread(raw, 2, n, edf->fp) != n) return false;   // Truncated record: end of stream
+
+            for (uint32_t k = 0; k < n; k++, i++) {
+                int16_t d = (int16_t)(raw[2 * k] | (raw[2 * k + 1] << 8));
+                float v = (float)d * edf->gain[ch] + edf->bias[ch];
+                v = v < 0.0f ? v - 0.5f : v + 0.5f;
+                if (v > 32767.0f) v = 32767.0f;
+                if (v < -32768.0f) v = -32768.0f;
+                edf->buf[i * nch + ch] = (int16_t)v;
+            }
+        }
+    }
+
+    edf->record++;
+    edf->pos = 0;
+    edf->filled = edf->per_record;
+    return true;
+}
+
+static size_t edf_read(adc_source_t *src, int16_t *frames, size_t max_frames) {
+
+    adc_source_edf_t *edf = (adc_source_edf_t *)src;
+    const uint8_t nch = src->channels;
+    size_t n = 0;
+
+    while (edf->fp && n < max_frames) {
+        if (edf->pos == edf->filled && !edf_load_record(edf)) break;
+
+        size_t take = edf->filled - edf->pos;
+        if (take > max_frames - n) take = max_frames - n;
+        memcpy(&frames[n * nch], &edf->buf[edf->pos * nch], take * nch * sizeof(int16_t));
+        edf->pos += (uint32_t)take;
+        n += take;
+    }
+    return n;
+}
+
+static void edf_close(adc_source_t *src) {
+    adc_source_edf_t *edf = (adc_source_edf_t *)src;
+    if (edf->fp && edf->owns_fp) fclose(edf->fp);
+    edf->fp = NULL;
+}
+
+
+// =============================
+// EDF Source: Open / Attach
+// =============================
+adc_source_t *adc_source_edf_attach(adc_source_edf_t *edf, FILE *fp, uint8_t channels) {
+
+    memset(edf, 0, sizeof(*edf));
+    if (channels == 0) channels = 1;
+    if (channels > ADC_EDF_MAX_CHANNELS) return NULL;
+
+    edf->fp = fp;
+    edf->base.name = "edf file";
+    edf->base.channels = channels;
+    edf->base.read = edf_read;
+    edf->base.close = edf_close;
+
+    if (!edf_parse(edf, channels)) {
+        edf->fp = NULL;
+        return NULL;
+    }
+    return &edf->base;
+}
+
+adc_source_t *adc_source_edf_open(adc_source_edf_t *edf, const char *path, uint8_t channels) {
+
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return NULL;
+
+    adc_source_t *src = adc_source_edf_attach(edf, fp, channels);
+    if (src == NULL) {
+        fclose(fp);
+        return NULL;
+    }
+    edf->owns_fp = true;
+    return src;
+}
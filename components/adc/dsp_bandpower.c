@@ -0,0 +1,142 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "dsp_bandpower.h"
+    #include <math.h>    // For cosf/sinf (init / coefficient only)
+    #include <string.h>  // For memset
+
+
+// =============================
+// Batch Goertzel (Reference)
+// =============================
+float goertzel_coeff(float freq_hz, float sample_rate_hz) {
+    return 2.0f * cosf(2.0f * (float)M_PI * freq_hz / sample_rate_hz);
+}
+
+float goertzel_power(const int16_t *window, size_t len, float freq_hz, float sample_rate_hz) {
+    return goertzel_power_coeff(window, len, goertzel_coeff(freq_hz, sample_rate_hz));
+}
+
+float goertzel_power_coeff(const int16_t *window, size_t len, float coeff) {
+
+    float q0 = 0, q1 = 0, q2 = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        q0 = coeff * q1 - q2 + (float)window[i];
+        q2 = q1;
+        q1 = q0;
+    }
+
+    // Power (no sqrt for speed)
+    return q1 * q1 + q2 * q2 - q1 * q2 * coeff;
+}
+
+
+// =============================
+// Sliding DFT: Init + Reset
+// =============================
+void sliding_dft_init(sliding_dft_t *sdft, int16_t *history, uint16_t len,
+                      const float *freqs_hz, uint8_t num_bins, float sample_rate_hz) {
+
+    if (num_bins > SLIDING_DFT_MAX_BINS) num_bins = SLIDING_DFT_MAX_BINS;
+
+    sdft->history = history;
+    sdft->len = len;
+    sdft->num_bins = num_bins;
+
+    // Trig is evaluated once here; updates only multiply
+    for (uint8_t b = 0; b < num_bins; b++) {
+        float w = 2.0f * (float)M_PI * freqs_hz[b] / sample_rate_hz;
+        sliding_bin_t *bin = &sdft->bins[b];
+        bin->rot_re = cosf(w);
+        bin->rot_im = sinf(w);
+        bin->tail_re = cosf(w * (float)(len - 1));
+        bin->tail_im = -sinf(w * (float)(len - 1));
+    }
+
+    sliding_dft_reset(sdft);
+}
+
+void sliding_dft_reset(sliding_dft_t *sdft) {
+
+    memset(sdft->history, 0, sdft->len * sizeof(int16_t));
+    sdft->pos = 0;
+    sdft->count = 0;
+
+    for (uint8_t b = 0; b < sdft->num_bins; b++) {
+        sliding_bin_t *bin = &sdft->bins[b];
+        bin->re = bin->im = 0.0f;
+        bin->shadow_re = bin->shadow_im = 0.0f;
+        bin->phase_re = 1.0f;
+        bin->phase_im = 0.0f;
+    }
+}
+
+
+// =============================
+// Sliding DFT: Push One Sample
+// =============================
+void sliding_dft_update(sliding_dft_t *sdft, int16_t sample) {
+
+    // --- 1. Swap the oldest sample out of the window ---
+    float x_new = (float)sample;
+    float x_old = (float)sdft->history[sdft->pos];
+    sdft->history[sdft->pos] = sample;
+
+    uint16_t block_pos = (uint16_t)(sdft->count % sdft->len);   // Position inside the re-sync block
+    int block_done = (block_pos == sdft->len - 1);
+
+    for (uint8_t b = 0; b < sdft->num_bins; b++) {
+
+        sliding_bin_t *bin = &sdft->bins[b];
+
+        // --- 2. Recursive update: S = e^{jw}(S - x_old) + x_new * e^{-jw(N-1)} ---
+        float d_re = bin->re - x_old;
+        float d_im = bin->im;
+        bin->re = bin->rot_re * d_re - bin->rot_im * d_im + x_new * bin->tail_re;
+        bin->im = bin->rot_re * d_im + bin->rot_im * d_re + x_new * bin->tail_im;
+
+        // --- 3. Shadow: exact sum of this block, one term per sample ---
+        bin->shadow_re += x_new * bin->phase_re;
+        bin->shadow_im += x_new * bin->phase_im;
+
+        if (block_done) {
+            // Shadow now covers exactly the last N samples: adopt it, start a new block
+            bin->re = bin->shadow_re;
+            bin->im = bin->shadow_im;
+            bin->shadow_re = bin->shadow_im = 0.0f;
+            bin->phase_re = 1.0f;
+            bin->phase_im = 0.0f;
+        } else {
+            // Advance e^{-jw p} -> e^{-jw (p+1)}
+            float p_re = bin->phase_re * bin->rot_re + bin->phase_im * bin->rot_im;
+            float p_im = bin->phase_im * bin->rot_re - bin->phase_re * bin->rot_im;
+            bin->phase_re = p_re;
+            bin->phase_im = p_im;
+        }
+    }
+
+    sdft->pos = (uint16_t)((sdft->pos + 1) % sdft->len);
+    sdft->count++;
+}
+
+
+// =============================
+// Sliding DFT: Read Power
+// =============================
+float sliding_dft_power(const sliding_dft_t *sdft, uint8_t bin) {
+    const sliding_bin_t *b = &sdft->bins[bin];
+    return b->re * b->re + b->im * b->im;
+}
+
+float sliding_dft_band_power(const sliding_dft_t *sdft) {
+
+    if (sdft->num_bins == 0) return 0.0f;
+
+    float sum = 0.0f;
+    for (uint8_t b = 0; b < sdft->num_bins; b++) {
+        sum += sliding_dft_power(sdft, b);
+    }
+    return sum / sdft->num_bins;
+}
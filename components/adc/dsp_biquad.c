@@ -0,0 +1,186 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "dsp_biquad.h"
+    #include "dsp_simd.h"    // Per-section kernel across channels (SSE / AVX2 / scalar)
+    #include <string.h>  // For memset
+    #include <math.h>    // For the notch design
+
+
+// =============================
+// Cascade: Init + Reset
+// =============================
+void biquad_cascade_init(biquad_cascade_t *filter, const biquad_coeffs_t *sos, uint8_t num_sections) {
+
+    if (num_sections > BIQUAD_MAX_SECTIONS) num_sections = BIQUAD_MAX_SECTIONS;
+
+    filter->num_sections = num_sections;
+    memcpy(filter->coeffs, sos, num_sections * sizeof(biquad_coeffs_t));
+    biquad_cascade_reset(filter);
+}
+
+void biquad_cascade_reset(biquad_cascade_t *filter) {
+    memset(filter->state, 0, sizeof(filter->state));
+}
+
+
+// =============================
+// Design: Notch
+// =============================
+// RBJ cookbook notch: zeros on the unit circle at f0, poles just inside at the same angle
+void biquad_design_notch(biquad_coeffs_t *sos, float f0_hz, float q, float sample_rate_hz) {
+
+    float w0 = 2.0f * (float)M_PI * f0_hz / sample_rate_hz;
+    float alpha = sinf(w0) / (2.0f * q);
+    float a0 = 1.0f + alpha;
+
+    sos->b0 = 1.0f / a0;
+    sos->b1 = -2.0f * cosf(w0) / a0;
+    sos->b2 = 1.0f / a0;
+    sos->a1 = -2.0f * cosf(w0) / a0;
+    sos->a2 = (1.0f - alpha) / a0;
+}
+
+
+// =============================
+// Kernel: One Section Over a Block
+// =============================
+// Section-outer ordering: coefficients and the two state words are loaded once and stay in
+// registers for the whole block; the loop body is 5 MACs with no calls or global accesses.
+static void biquad_section_run(const biquad_coeffs_t *c, biquad_state_t *st,
+                               const float *in, float *out, size_t len) {
+
+    const float b0 = c->b0, b1 = c->b1, b2 = c->b2;
+    const float a1 = c->a1, a2 = c->a2;
+    float z1 = st->z1, z2 = st->z2;
+
+    for (size_t i = 0; i < len; i++) {
+        float x = in[i];
+        float y = b0 * x + z1;
+        z1 = b1 * x - a1 * y + z2;
+        z2 = b2 * x - a2 * y;
+        out[i] = y;
+    }
+
+    st->z1 = z1;
+    st->z2 = z2;
+}
+
+
+// =============================
+// Cascade: Float Block
+// =============================
+void biquad_cascade_process_f32(biquad_cascade_t *filter, const float *in, float *out, size_t len) {
+
+    if (filter->num_sections == 0) {
+        if (out != in) memmove(out, in, len * sizeof(float));
+        return;
+    }
+
+    // First section reads the input, the rest filter in place
+    biquad_section_run(&filter->coeffs[0], &filter->state[0], in, out, len);
+    for (uint8_t s = 1; s < filter->num_sections; s++) {
+        biquad_section_run(&filter->coeffs[s], &filter->state[s], out, out, len);
+    }
+}
+
+
+// =============================
+// Cascade: int16_t Block
+// =============================
+void biquad_cascade_process(biquad_cascade_t *filter, const int16_t *in, int16_t *out, size_t len) {
+
+    float work[BIQUAD_BLOCK_CHUNK];   // 128 bytes of stack, independent of len
+
+    while (len) {
+
+        size_t chunk = len < BIQUAD_BLOCK_CHUNK ? len : BIQUAD_BLOCK_CHUNK;
+
+        // --- 1. Widen ---
+        for (size_t i = 0; i < chunk; i++) work[i] = (float)in[i];
+
+        // --- 2. Filter every section over the chunk ---
+        biquad_cascade_process_f32(filter, work, work, chunk);
+
+        // --- 3. Saturate + narrow (truncates toward zero, like apply_bandpass_iir) ---
+        for (size_t i = 0; i < chunk; i++) {
+            float y = work[i];
+            if (y > 32767.0f) y = 32767.0f;
+            if (y < -32768.0f) y = -32768.0f;
+            out[i] = (int16_t)y;
+        }
+
+        in += chunk;
+        out += chunk;
+        len -= chunk;
+    }
+}
+
+
+// =============================
+// Multi-Channel: Init + Reset
+// =============================
+void biquad_multi_init(biquad_multi_t *filter, const biquad_coeffs_t *sos, uint8_t num_sections,
+                       uint8_t num_channels) {
+
+    if (num_sections > BIQUAD_MAX_SECTIONS) num_sections = BIQUAD_MAX_SECTIONS;
+    if (num_channels > BIQUAD_MAX_CHANNELS) num_channels = BIQUAD_MAX_CHANNELS;
+    if (num_channels == 0) num_channels = 1;
+
+    filter->num_sections = num_sections;
+    filter->num_channels = num_channels;
+    memcpy(filter->coeffs, sos, num_sections * sizeof(biquad_coeffs_t));
+    biquad_multi_reset(filter);
+}
+
+void biquad_multi_reset(biquad_multi_t *filter) {
+    memset(filter->state, 0, sizeof(filter->state));
+}
+
+
+// =============================
+// Multi-Channel: int16_t Interleaved Block
+// =============================
+void biquad_multi_process(biquad_multi_t *filter, const int16_t *in, int16_t *out, size_t frames) {
+
+    // Single channel: the contiguous kernel keeps its state in registers
+    if (filter->num_channels == 1) {
+        biquad_cascade_t mono = { .num_sections = filter->num_sections };
+        memcpy(mono.coeffs, filter->coeffs, sizeof(mono.coeffs));
+        for (uint8_t s = 0; s < filter->num_sections; s++) mono.state[s] = filter->state[s][0];
+        biquad_cascade_process(&mono, in, out, frames);
+        for (uint8_t s = 0; s < filter->num_sections; s++) filter->state[s][0] = mono.state[s];
+        return;
+    }
+
+    const uint8_t nch = filter->num_channels;
+    const size_t chunk_frames = BIQUAD_BLOCK_CHUNK / nch ? BIQUAD_BLOCK_CHUNK / nch : 1;
+    float work[BIQUAD_BLOCK_CHUNK < BIQUAD_MAX_CHANNELS ? BIQUAD_MAX_CHANNELS : BIQUAD_BLOCK_CHUNK];
+
+    while (frames) {
+
+        size_t chunk = frames < chunk_frames ? frames : chunk_frames;
+        size_t n = chunk * nch;
+
+        // --- 1. Widen ---
+        for (size_t i = 0; i < n; i++) work[i] = (float)in[i];
+
+        // --- 2. Filter every section over the chunk ---
+        for (uint8_t s = 0; s < filter->num_sections; s++) {
+            dsp_biquad_section_multi(&filter->coeffs[s], filter->state[s], nch, work, chunk);
+        }
+
+        // --- 3. Saturate + narrow ---
+        for (size_t i = 0; i < n; i++) {
+            float y = work[i];
+            if (y > 32767.0f) y = 32767.0f;
+            if (y < -32768.0f) y = -32768.0f;
+            out[i] = (int16_t)y;
+        }
+
+        in += n;
+        out += n;
+        frames -= chunk;
+    }
+}
@@ -0,0 +1,216 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "dsp_decim.h"
+    #include "dsp_simd.h"    // For dsp_dot_s16
+    #include <math.h>        // For the filter design
+    #include <string.h>      // For memset
+
+
+// =============================
+// Filter Design: Kaiser-Windowed Sinc
+// =============================
+// Zeroth-order modified Bessel function (power series; converges fast for the betas used here)
+static double bessel_i0(double x) {
+    double sum = 1.0, term = 1.0;
+    for (int k = 1; k < 32; k++) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < sum * 1e-12) break;
+    }
+    return sum;
+}
+
+// Designs one stage: passband up to `pass_hz`, images of everything from out_rate - pass_hz on
+// kept DECIM_ATTEN_DB down. The cutoff lands halfway, on the stage's output Nyquist frequency.
+static void decim_stage_design(decim_stage_t *st, uint8_t factor, float in_rate_hz, float pass_hz,
+                               uint8_t gain_bits) {
+
+    memset(st, 0, sizeof(*st));
+    st->factor = factor;
+    st->shift = (uint8_t)(15 - gain_bits);
+
+    // --- 1. Length from the Kaiser formula, whole taps per phase ---
+    double out_rate = (double)in_rate_hz / factor;
+    double trans = out_rate - 2.0 * pass_hz;                         // Transition width (Hz)
+    double dw = 2.0 * M_PI * trans / in_rate_hz;
+    uint32_t taps = (uint32_t)ceil((DECIM_ATTEN_DB - 8.0) / (2.285 * dw)) + 1;
+    taps = (taps + factor - 1) / factor * factor;
+    if (taps > DECIM_MAX_TAPS) taps = DECIM_MAX_TAPS / factor * factor;
+    st->taps = (uint16_t)taps;
+
+    // --- 2. Windowed sinc, normalized to unity DC gain ---
+    double h[DECIM_MAX_TAPS];
+    double fc = 0.5 / factor;                                        // Cycles per input sample
+    double beta = 0.1102 * (DECIM_ATTEN_DB - 8.7);
+    double mid = (taps - 1) / 2.0, sum = 0.0;
+    for (uint32_t n = 0; n < taps; n++) {
+        double t = n - mid;
+        double sinc = t == 0.0 ? 2.0 * fc : sin(2.0 * M_PI * fc * t) / (M_PI * t);
+        double r = taps > 1 ? 2.0 * n / (taps - 1) - 1.0 : 0.0;
+        h[n] = sinc * bessel_i0(beta * sqrt(1.0 - r * r)) / bessel_i0(beta);
+        sum += h[n];
+    }
+
+    // --- 3. Q15, rounding error folded into the centre tap so DC passes exactly ---
+    int32_t qsum = 0;
+    for (uint32_t n = 0; n < taps; n++) {
+        st->coeff[taps - 1 - n] = (int16_t)lrint(h[n] / sum * 32768.0);
+        qsum += st->coeff[taps - 1 - n];
+    }
+    st->coeff[(taps - 1) / 2] = (int16_t)(st->coeff[(taps - 1) / 2] + (32768 - qsum));
+}
+
+bool decim_chain_design(decim_chain_t *chain, const uint8_t *factors, uint8_t num_stages, float in_rate_hz,
+                        uint8_t num_channels, uint8_t gain_bits) {
+
+    uint32_t total = 1;
+    for (uint8_t s = 0; s < num_stages; s++) {
+        if (factors[s] < 2) return false;
+        total *= factors[s];
+    }
+    if (num_stages > DECIM_MAX_STAGES || total > DECIM_MAX_FACTOR || gain_bits > 7) return false;
+
+    if (num_channels < 1) num_channels = 1;
+    if (num_channels > DECIM_MAX_CHANNELS) num_channels = DECIM_MAX_CHANNELS;
+
+    chain->num_stages = num_stages;
+    chain->num_channels = num_channels;
+    chain->factor = (uint16_t)total;
+    chain->in_rate_hz = in_rate_hz;
+    chain->out_rate_hz = in_rate_hz / (float)total;
+
+    // Every stage protects the same final passband; only the first adds the gain bits
+    float pass_hz = DECIM_PASS_FRAC * chain->out_rate_hz / 2.0f;
+    float rate = in_rate_hz;
+    for (uint8_t s = 0; s < num_stages; s++) {
+        decim_stage_design(&chain->stage[s], factors[s], rate, pass_hz, s == 0 ? gain_bits : 0);
+        rate /= factors[s];
+    }
+    if (num_stages == 0) chain->stage[0].shift = (uint8_t)(15 - gain_bits);   // Pass-through gain
+    return true;
+}
+
+bool decim_chain_init(decim_chain_t *chain, uint16_t factor, float in_rate_hz, uint8_t num_channels,
+                      uint8_t gain_bits) {
+
+    if (factor < 1 || factor > DECIM_MAX_FACTOR) return false;
+
+    uint8_t factors[DECIM_MAX_STAGES] = { (uint8_t)factor };
+    uint8_t num_stages = factor > 1 ? 1 : 0;
+    static const uint8_t last_stage[] = { 2, 3, 5 };
+    for (size_t i = 0; i < sizeof(last_stage) && factor > last_stage[i]; i++) {
+        if (factor % last_stage[i] == 0) {
+            factors[0] = (uint8_t)(factor / last_stage[i]);
+            factors[1] = last_stage[i];
+            num_stages = 2;
+            break;
+        }
+    }
+    return decim_chain_design(chain, factors, num_stages, in_rate_hz, num_channels, gain_bits);
+}
+
+void decim_chain_reset(decim_chain_t *chain) {
+    for (uint8_t s = 0; s < DECIM_MAX_STAGES; s++) {
+        decim_stage_t *st = &chain->stage[s];
+        st->phase = 0;
+        st->pos = 0;
+        memset(st->hist, 0, sizeof(st->hist));
+    }
+}
+
+float decim_chain_delay(const decim_chain_t *chain) {
+    float delay = 0.0f, scale = 1.0f;
+    for (uint8_t s = 0; s < chain->num_stages; s++) {
+        delay += scale * (chain->stage[s].taps - 1) / 2.0f;
+        scale *= chain->stage[s].factor;
+    }
+    return delay;
+}
+
+
+// =============================
+// Stage: Push One Frame
+// =============================
+static inline int16_t decim_saturate(int64_t acc, uint8_t shift) {
+    int64_t y = (acc + ((int64_t)1 << (shift - 1))) >> shift;
+    if (y > INT16_MAX) return INT16_MAX;
+    if (y < INT16_MIN) return INT16_MIN;
+    return (int16_t)y;
+}
+
+// Output of one channel: the last `taps` inputs, oldest first, are hist[pos .. pos + taps)
+static inline int16_t decim_stage_output(const decim_stage_t *st, uint8_t ch) {
+    int64_t acc = dsp_dot_s16(st->coeff, &st->hist[ch][st->pos], st->taps);
+    return decim_saturate(acc, st->shift);
+}
+
+// Returns true when the frame completed an output frame (written to `out`). With `fullrate`
+// the FIR runs on every input anyway and the extra outputs are dropped.
+static bool decim_stage_push(decim_stage_t *st, uint8_t nch, const int16_t *frame, int16_t *out, bool fullrate) {
+
+    for (uint8_t ch = 0; ch < nch; ch++) st->hist[ch][st->pos] = st->hist[ch][st->pos + st->taps] = frame[ch];
+    if (++st->pos == st->taps) st->pos = 0;
+
+    bool due = ++st->phase == st->factor;
+    if (due) st->phase = 0;
+
+    if (due || fullrate) {
+        for (uint8_t ch = 0; ch < nch; ch++) {
+            int16_t y = decim_stage_output(st, ch);
+            if (due) out[ch] = y;
+        }
+    }
+    return due;
+}
+
+
+// =============================
+// Chain: Interleaved Frames In -> Decimated Frames Out
+// =============================
+// Stage by stage over chunks of DECIM_CHUNK frames: each stage runs its whole chunk before the
+// next one starts, so the per-input work is one history write and two counter updates.
+#define DECIM_CHUNK  32
+
+static size_t decim_chain_run(decim_chain_t *chain, const int16_t *in, int16_t *out, size_t frames, bool fullrate) {
+
+    const uint8_t nch = chain->num_channels;
+    size_t produced = 0;
+
+    if (chain->num_stages == 0) {
+        for (size_t i = 0; i < frames * nch; i++) out[i] = decim_saturate((int64_t)in[i] << 15, chain->stage[0].shift);
+        return frames;
+    }
+
+    int16_t mid[(DECIM_CHUNK / 2 + 1) * DECIM_MAX_CHANNELS];     // First stage output (factor >= 2)
+
+    while (frames > 0) {
+        size_t chunk = frames < DECIM_CHUNK ? frames : DECIM_CHUNK;
+        const int16_t *x = in;
+        size_t n = chunk;
+
+        for (uint8_t s = 0; s < chain->num_stages && n > 0; s++) {
+            int16_t *y = s + 1 == chain->num_stages ? &out[produced * nch] : mid;
+            size_t made = 0;
+            for (size_t f = 0; f < n; f++) {
+                if (decim_stage_push(&chain->stage[s], nch, &x[f * nch], &y[made * nch], fullrate)) made++;
+            }
+            x = y;
+            n = made;
+        }
+
+        produced += n;
+        in += chunk * nch;
+        frames -= chunk;
+    }
+    return produced;
+}
+
+size_t decim_chain_process(decim_chain_t *chain, const int16_t *in, int16_t *out, size_t frames) {
+    return decim_chain_run(chain, in, out, frames, false);
+}
+
+size_t decim_chain_process_fullrate(decim_chain_t *chain, const int16_t *in, int16_t *out, size_t frames) {
+    return decim_chain_run(chain, in, out, frames, true);
+}
@@ -0,0 +1,261 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "dsp_fixed.h"
+    #include <math.h>    // For lrintf/cosf/sinf (init only)
+    #include <string.h>  // For memset
+
+
+// =============================
+// Helper: Float -> Fixed (Init Only)
+// =============================
+int32_t dsp_to_fixed(float v, int frac_bits, int32_t min, int32_t max) {
+    double scaled = (double)v * (double)(1LL << frac_bits);
+    if (scaled >= (double)max) return max;
+    if (scaled <= (double)min) return min;
+    return (int32_t)lrint(scaled);
+}
+
+// Round-to-nearest arithmetic shift of an int64 product
+static inline int64_t q_round_shift(int64_t v, int shift) {
+    return (v + ((int64_t)1 << (shift - 1))) >> shift;
+}
+
+
+// =============================
+// Biquad Q15: Init + Reset
+// =============================
+bool biquad_q15_init(biquad_q15_t *filter, const biquad_coeffs_t *sos, uint8_t num_sections,
+                     uint8_t num_channels) {
+
+    if (num_sections > BIQUAD_MAX_SECTIONS) num_sections = BIQUAD_MAX_SECTIONS;
+    if (num_channels > BIQUAD_MAX_CHANNELS) num_channels = BIQUAD_MAX_CHANNELS;
+    if (num_channels == 0) num_channels = 1;
+
+    filter->num_sections = 0;
+    filter->num_channels = num_channels;
+    biquad_q15_reset(filter);
+
+    for (uint8_t s = 0; s < num_sections; s++) {
+
+        const float c[5] = { sos[s].b0, sos[s].b1, sos[s].b2, sos[s].a1, sos[s].a2 };
+        int16_t q[5], lo[5];
+        int32_t sum = 0;
+
+        for (int k = 0; k < 5; k++) {
+            if (c[k] >= 2.0f || c[k] < -2.0f) return false;                     // Outside Q14
+            q[k] = (int16_t)dsp_to_fixed(c[k], BIQUAD_Q15_COEFF_FRAC, INT16_MIN, INT16_MAX);
+            sum += q[k] < 0 ? -q[k] : q[k];
+
+            // Remainder below the Q14 step, in units of 2^-28 (|lo| <= 2^13 after rounding)
+            double rest = ((double)c[k] * (1 << BIQUAD_Q15_COEFF_FRAC) - q[k]) * (1 << BIQUAD_Q15_COEFF_FRAC);
+            lo[k] = (int16_t)lrint(rest);
+        }
+
+        // |acc| <= sum * 2^15 + 2^16 (low parts) + 2^13 (carried residue) must fit in an int32
+        if (sum > (INT32_MAX - (6 << BIQUAD_Q15_COEFF_FRAC)) / 32768) return false;
+
+        filter->coeffs[s] = (biquad_q15_coeffs_t){
+            .b0 = q[0], .b1 = q[1], .b2 = q[2], .a1 = q[3], .a2 = q[4],
+            .b0_lo = lo[0], .b1_lo = lo[1], .b2_lo = lo[2], .a1_lo = lo[3], .a2_lo = lo[4],
+        };
+    }
+
+    filter->num_sections = num_sections;
+    return true;
+}
+
+void biquad_q15_reset(biquad_q15_t *filter) {
+    memset(filter->state, 0, sizeof(filter->state));
+}
+
+
+// =============================
+// Kernel: One Q15 Section Over Interleaved Frames
+// =============================
+// Section-outer like dsp_biquad_section_multi_ref(); the loop body is ten 16x16 MACs into int32s.
+static void biquad_q15_section_run(const biquad_q15_coeffs_t *c, biquad_q15_state_t *st, uint8_t nch,
+                                   const int16_t *in, int16_t *out, size_t frames) {
+
+    const int32_t b0 = c->b0, b1 = c->b1, b2 = c->b2;
+    const int32_t a1 = c->a1, a2 = c->a2;
+    const int32_t b0_lo = c->b0_lo, b1_lo = c->b1_lo, b2_lo = c->b2_lo;
+    const int32_t a1_lo = c->a1_lo, a2_lo = c->a2_lo;
+
+    for (size_t f = 0; f < frames; f++) {
+        for (uint8_t ch = 0; ch < nch; ch++) {
+
+            biquad_q15_state_t *s = &st[ch];
+            int32_t x = in[f * nch + ch];
+
+            // Low coefficient halves first: five products of |2^13 x 2^15| cannot overflow
+            int32_t fine = (b0_lo * x + b1_lo * s->x1 + b2_lo * s->x2 - a1_lo * s->y1 - a2_lo * s->y2)
+                           >> BIQUAD_Q15_COEFF_FRAC;
+            int32_t acc = s->err + b0 * x + b1 * s->x1 + b2 * s->x2 - a1 * s->y1 - a2 * s->y2 + fine;
+            int32_t y = (acc + (1 << (BIQUAD_Q15_COEFF_FRAC - 1))) >> BIQUAD_Q15_COEFF_FRAC;  // Nearest
+            int16_t y16 = q15_sat(y);
+
+            // Carry the dropped fraction; after a clip there is nothing meaningful to carry
+            s->err = (y == y16) ? acc - (y << BIQUAD_Q15_COEFF_FRAC) : 0;
+            s->x2 = s->x1;
+            s->x1 = (int16_t)x;
+            s->y2 = s->y1;
+            s->y1 = y16;
+            out[f * nch + ch] = y16;
+        }
+    }
+}
+
+
+// =============================
+// Biquad Q15: Interleaved Block
+// =============================
+void biquad_q15_process(biquad_q15_t *filter, const int16_t *in, int16_t *out, size_t frames) {
+
+    if (filter->num_sections == 0) {
+        if (out != in) memmove(out, in, frames * filter->num_channels * sizeof(int16_t));
+        return;
+    }
+
+    // First section reads the input, the rest filter in place (no scratch: data stays int16_t)
+    biquad_q15_section_run(&filter->coeffs[0], filter->state[0], filter->num_channels, in, out, frames);
+    for (uint8_t s = 1; s < filter->num_sections; s++) {
+        biquad_q15_section_run(&filter->coeffs[s], filter->state[s], filter->num_channels, out, out, frames);
+    }
+}
+
+
+// =============================
+// Goertzel Q15
+// =============================
+int32_t goertzel_q15_coeff(float freq_hz, float sample_rate_hz) {
+    return dsp_to_fixed(2.0f * cosf(2.0f * (float)M_PI * freq_hz / sample_rate_hz), 29, INT32_MIN, INT32_MAX);
+}
+
+uint64_t goertzel_power_q15(const int16_t *window, size_t len, int32_t coeff_q29) {
+
+    int32_t q1 = 0, q2 = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        int64_t q0 = q_round_shift((int64_t)coeff_q29 * q1, 29) - q2 +
+                     ((int32_t)window[i] << GOERTZEL_Q15_FRAC);
+        q2 = q1;
+        q1 = q31_sat(q0);
+    }
+
+    // q1^2 + q2^2 - coeff*q1*q2 (>= 0 in exact arithmetic; rounding can dip a hair below)
+    int64_t cq1 = q_round_shift((int64_t)coeff_q29 * q1, 29);
+    int64_t p = (int64_t)q1 * q1 + (int64_t)q2 * q2 - cq1 * q2;
+    return p > 0 ? (uint64_t)q_round_shift(p, 2 * GOERTZEL_Q15_FRAC) : 0;
+}
+
+
+// =============================
+// Sliding DFT Q15: Init + Reset
+// =============================
+void sliding_dft_q15_init(sliding_dft_q15_t *sdft, int16_t *history, uint16_t len,
+                          const float *freqs_hz, uint8_t num_bins, float sample_rate_hz) {
+
+    if (num_bins > SLIDING_DFT_MAX_BINS) num_bins = SLIDING_DFT_MAX_BINS;
+    if (len > (1u << (16 - SLIDING_Q15_FRAC))) len = (uint16_t)(1u << (16 - SLIDING_Q15_FRAC));
+
+    sdft->history = history;
+    sdft->len = len;
+    sdft->num_bins = num_bins;
+
+    for (uint8_t b = 0; b < num_bins; b++) {
+        float w = 2.0f * (float)M_PI * freqs_hz[b] / sample_rate_hz;
+        sliding_bin_q15_t *bin = &sdft->bins[b];
+        bin->rot_re = dsp_to_fixed(cosf(w), 30, INT32_MIN, INT32_MAX);
+        bin->rot_im = dsp_to_fixed(sinf(w), 30, INT32_MIN, INT32_MAX);
+        bin->tail_re = dsp_to_fixed(cosf(w * (float)(len - 1)), 30, INT32_MIN, INT32_MAX);
+        bin->tail_im = dsp_to_fixed(-sinf(w * (float)(len - 1)), 30, INT32_MIN, INT32_MAX);
+    }
+
+    sliding_dft_q15_reset(sdft);
+}
+
+void sliding_dft_q15_reset(sliding_dft_q15_t *sdft) {
+
+    memset(sdft->history, 0, sdft->len * sizeof(int16_t));
+    sdft->pos = 0;
+    sdft->count = 0;
+
+    for (uint8_t b = 0; b < sdft->num_bins; b++) {
+        sliding_bin_q15_t *bin = &sdft->bins[b];
+        bin->re = bin->im = 0;
+        bin->shadow_re = bin->shadow_im = 0;
+        bin->phase_re = 1 << 30;
+        bin->phase_im = 0;
+    }
+}
+
+
+// =============================
+// Sliding DFT Q15: Push One Sample
+// =============================
+void sliding_dft_q15_update(sliding_dft_q15_t *sdft, int16_t sample) {
+
+    // --- 1. Swap the oldest sample out of the window ---
+    int32_t x_new = sample;
+    int32_t x_old = sdft->history[sdft->pos];
+    sdft->history[sdft->pos] = sample;
+
+    uint16_t block_pos = (uint16_t)(sdft->count % sdft->len);
+    int block_done = (block_pos == sdft->len - 1);
+
+    for (uint8_t b = 0; b < sdft->num_bins; b++) {
+
+        sliding_bin_q15_t *bin = &sdft->bins[b];
+
+        // --- 2. Recursive update: S = e^{jw}(S - x_old) + x_new * e^{-jw(N-1)}, all in Q30 ---
+        int64_t d_re = (int64_t)bin->re - ((int64_t)x_old << SLIDING_Q15_FRAC);
+        int64_t d_im = bin->im;
+        int64_t xs = (int64_t)x_new << SLIDING_Q15_FRAC;
+        bin->re = q31_sat(q_round_shift(bin->rot_re * d_re - bin->rot_im * d_im + xs * bin->tail_re, 30));
+        bin->im = q31_sat(q_round_shift(bin->rot_re * d_im + bin->rot_im * d_re + xs * bin->tail_im, 30));
+
+        // --- 3. Shadow: exact sum of this block (products kept at full Q30 precision) ---
+        bin->shadow_re += xs * bin->phase_re;
+        bin->shadow_im += xs * bin->phase_im;
+
+        if (block_done) {
+            bin->re = q31_sat(q_round_shift(bin->shadow_re, 30));
+            bin->im = q31_sat(q_round_shift(bin->shadow_im, 30));
+            bin->shadow_re = bin->shadow_im = 0;
+            bin->phase_re = 1 << 30;
+            bin->phase_im = 0;
+        } else {
+            // Advance e^{-jw p} -> e^{-jw (p+1)}
+            int64_t p_re = (int64_t)bin->phase_re * bin->rot_re + (int64_t)bin->phase_im * bin->rot_im;
+            int64_t p_im = (int64_t)bin->phase_im * bin->rot_re - (int64_t)bin->phase_re * bin->rot_im;
+            bin->phase_re = (int32_t)q_round_shift(p_re, 30);
+            bin->phase_im = (int32_t)q_round_shift(p_im, 30);
+        }
+    }
+
+    sdft->pos = (uint16_t)((sdft->pos + 1) % sdft->len);
+    sdft->count++;
+}
+
+
+// =============================
+// Sliding DFT Q15: Read Power
+// =============================
+uint64_t sliding_dft_q15_power(const sliding_dft_q15_t *sdft, uint8_t bin) {
+    const sliding_bin_q15_t *b = &sdft->bins[bin];
+    int64_t p = (int64_t)b->re * b->re + (int64_t)b->im * b->im;
+    return (uint64_t)q_round_shift(p, 2 * SLIDING_Q15_FRAC);
+}
+
+uint64_t sliding_dft_q15_band_power(const sliding_dft_q15_t *sdft) {
+
+    if (sdft->num_bins == 0) return 0;
+
+    uint64_t sum = 0;
+    for (uint8_t b = 0; b < sdft->num_bins; b++) {
+        sum += sliding_dft_q15_power(sdft, b);
+    }
+    return sum / sdft->num_bins;
+}
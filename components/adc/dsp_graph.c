@@ -0,0 +1,103 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "dsp_graph.h"
+    #include "bench.h"       // For bench_cycles (same clock as the benchmarks)
+    #include <string.h>      // For memset / strcmp
+
+
+// =============================
+// Build: Arena + Stage Table
+// =============================
+void dsp_graph_init(dsp_graph_t *graph, void *arena, size_t arena_size) {
+    memset(graph, 0, sizeof(*graph));
+    graph->arena = (uint8_t *)arena;
+    graph->arena_size = arena_size;
+}
+
+void *dsp_graph_alloc(dsp_graph_t *graph, size_t size) {
+
+    size_t slot = DSP_GRAPH_SLOT(size);
+    if (slot > graph->arena_size - graph->arena_used) return NULL;
+
+    void *state = graph->arena + graph->arena_used;
+    graph->arena_used += slot;
+    memset(state, 0, size);
+    return state;
+}
+
+int dsp_graph_add(dsp_graph_t *graph, const char *name, dsp_stage_fn process, void *state) {
+
+    if (process == NULL || graph->num_stages >= DSP_GRAPH_MAX_STAGES) return -1;
+
+    graph->stage[graph->num_stages] = (dsp_stage_t){
+        .name = name,
+        .process = process,
+        .state = state,
+        .enabled = true,
+    };
+    return graph->num_stages++;
+}
+
+int dsp_graph_find(const dsp_graph_t *graph, const char *name) {
+    for (int s = 0; s < graph->num_stages; s++) {
+        if (strcmp(graph->stage[s].name, name) == 0) return s;
+    }
+    return -1;
+}
+
+
+// =============================
+// Run: Every Stage Once per Block
+// =============================
+void dsp_graph_run_from(dsp_graph_t *graph, int first, int16_t *frames, const uint32_t *stamps, size_t count) {
+
+    for (int s = first < 0 ? 0 : first; s < graph->num_stages; s++) {
+
+        dsp_stage_t *st = &graph->stage[s];
+        if (!st->enabled) continue;
+
+        uint32_t c0 = (uint32_t)bench_cycles();
+        st->process(st->state, frames, stamps, count);
+        uint32_t spent = (uint32_t)bench_cycles() - c0;     // 32-bit counter on the target: wrap-safe
+
+        st->cycles += spent;
+        st->frames += count;
+        st->calls++;
+        if (spent > st->max_cycles) st->max_cycles = spent;
+    }
+}
+
+
+// =============================
+// Counters
+// =============================
+void dsp_graph_reset_counters(dsp_graph_t *graph) {
+    for (int s = 0; s < graph->num_stages; s++) {
+        dsp_stage_t *st = &graph->stage[s];
+        st->cycles = 0;
+        st->frames = 0;
+        st->calls = 0;
+        st->max_cycles = 0;
+    }
+}
+
+void dsp_graph_print(FILE *fp, const dsp_graph_t *graph) {
+
+    uint64_t total = 0;
+    for (int s = 0; s < graph->num_stages; s++) total += graph->stage[s].cycles;
+
+    fprintf(fp, "%-10s %4s %10s %12s %12s %10s %6s\n",
+            "stage", "on", "calls", "frames", "cyc/frame", "max_call", "share");
+
+    for (int s = 0; s < graph->num_stages; s++) {
+        const dsp_stage_t *st = &graph->stage[s];
+        double per_frame = st->frames ? (double)st->cycles / (double)st->frames : 0.0;
+        double share = total ? 100.0 * (double)st->cycles / (double)total : 0.0;
+        fprintf(fp, "%-10s %4s %10lu %12llu %12.1f %10lu %5.1f%%\n", st->name, st->enabled ? "yes" : "no",
+                (unsigned long)st->calls, (unsigned long long)st->frames, per_frame,
+                (unsigned long)st->max_cycles, share);
+    }
+    fprintf(fp, "arena: %u of %u bytes\n", (unsigned)graph->arena_used, (unsigned)graph->arena_size);
+}
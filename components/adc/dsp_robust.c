@@ -0,0 +1,147 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "dsp_robust.h"
+    #include <string.h>  // For memset
+
+
+// =============================
+// P² Quantile: Init + Exact Start
+// =============================
+void p2_init(p2_quantile_t *est, float p) {
+
+    memset(est, 0, sizeof(*est));
+    est->p = p;
+
+    est->step[0] = 0.0f;
+    est->step[1] = p / 2.0f;
+    est->step[2] = p;
+    est->step[3] = (1.0f + p) / 2.0f;
+    est->step[4] = 1.0f;
+}
+
+// Insertion sort of the first samples (at most five), kept in q[]
+static void p2_insert(p2_quantile_t *est, float x) {
+    int i = (int)est->count;
+    while (i > 0 && est->q[i - 1] > x) {
+        est->q[i] = est->q[i - 1];
+        i--;
+    }
+    est->q[i] = x;
+}
+
+
+// =============================
+// P² Quantile: Marker Adjustment
+// =============================
+static inline float p2_parabolic(const p2_quantile_t *e, int i, int d) {
+    float n0 = (float)e->pos[i - 1], n1 = (float)e->pos[i], n2 = (float)e->pos[i + 1];
+    return e->q[i] + (float)d / (n2 - n0) *
+           ((n1 - n0 + (float)d) * (e->q[i + 1] - e->q[i]) / (n2 - n1) +
+            (n2 - n1 - (float)d) * (e->q[i] - e->q[i - 1]) / (n1 - n0));
+}
+
+static inline float p2_linear(const p2_quantile_t *e, int i, int d) {
+    return e->q[i] + (float)d * (e->q[i + d] - e->q[i]) / (float)(e->pos[i + d] - e->pos[i]);
+}
+
+void p2_add(p2_quantile_t *est, float x) {
+
+    // --- 1. First five samples: sorted, they become the initial markers ---
+    if (est->count < 5) {
+        p2_insert(est, x);
+        if (++est->count == 5) {
+            for (int i = 0; i < 5; i++) {
+                est->pos[i] = i + 1;
+                est->want[i] = 1.0f + 4.0f * est->step[i];
+            }
+        }
+        return;
+    }
+    est->count++;
+
+    // --- 2. Cell the sample falls in; the extremes simply move ---
+    int k;
+    if (x < est->q[0]) {
+        est->q[0] = x;
+        k = 0;
+    } else if (x >= est->q[4]) {
+        if (x > est->q[4]) est->q[4] = x;
+        k = 3;
+    } else {
+        k = 0;
+        while (k < 3 && x >= est->q[k + 1]) k++;
+    }
+
+    for (int i = k + 1; i < 5; i++) est->pos[i]++;
+    for (int i = 0; i < 5; i++) est->want[i] += est->step[i];
+
+    // --- 3. Nudge the three middle markers back towards their desired positions ---
+    for (int i = 1; i <= 3; i++) {
+        float off = est->want[i] - (float)est->pos[i];
+        if ((off >= 1.0f && est->pos[i + 1] - est->pos[i] > 1) ||
+            (off <= -1.0f && est->pos[i - 1] - est->pos[i] < -1)) {
+            int d = off > 0 ? 1 : -1;
+            float q = p2_parabolic(est, i, d);
+            if (!(est->q[i - 1] < q && q < est->q[i + 1])) q = p2_linear(est, i, d);
+            est->q[i] = q;
+            est->pos[i] += d;
+        }
+    }
+}
+
+float p2_value(const p2_quantile_t *est) {
+
+    if (est->count == 0) return 0.0f;
+    if (est->count >= 5) return est->q[2];
+
+    // Exact quantile of the sorted start (nearest rank)
+    uint32_t idx = (uint32_t)(est->p * (float)(est->count - 1) + 0.5f);
+    return est->q[idx];
+}
+
+
+// =============================
+// Running Median / MAD
+// =============================
+static void robust_window_reset(robust_window_t *w) {
+    p2_init(&w->median, 0.5f);
+    p2_init(&w->spread, 0.5f);
+    w->count = 0;
+}
+
+void robust_stats_init(robust_stats_t *rs, uint16_t window) {
+
+    memset(rs, 0, sizeof(*rs));
+    rs->len = window < 2 ? 2 : window;
+    robust_window_reset(&rs->win[0]);
+    robust_window_reset(&rs->win[1]);
+    rs->win[0].active = true;
+}
+
+bool robust_stats_add(robust_stats_t *rs, float x) {
+
+    bool published = false;
+
+    // The second window joins half a window in; from then on the two alternate
+    if (++rs->seen == rs->len / 2u) rs->win[1].active = true;
+
+    for (int w = 0; w < 2; w++) {
+        robust_window_t *win = &rs->win[w];
+        if (!win->active) continue;
+
+        p2_add(&win->median, x);
+        float dev = x - p2_value(&win->median);
+        p2_add(&win->spread, dev < 0.0f ? -dev : dev);
+
+        if (++win->count >= rs->len) {
+            rs->median = p2_value(&win->median);
+            rs->mad = p2_value(&win->spread);
+            rs->updates++;
+            published = true;
+            robust_window_reset(win);
+        }
+    }
+    return published;
+}
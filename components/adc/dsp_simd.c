@@ -0,0 +1,247 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "dsp_simd.h"
+
+#if DSP_SIMD == DSP_SIMD_SSE || DSP_SIMD == DSP_SIMD_AVX2
+    #include <immintrin.h>  // SSE2 / AVX2 intrinsics
+#endif
+
+
+// =============================
+// Backend Name
+// =============================
+const char *dsp_simd_name(void) {
+#if DSP_SIMD == DSP_SIMD_AVX2
+    return "avx2";
+#elif DSP_SIMD == DSP_SIMD_SSE
+    return "sse";
+#elif DSP_SIMD == DSP_SIMD_PIE
+    return "pie";
+#else
+    return "scalar";
+#endif
+}
+
+
+// =============================
+// Reference: One Section Over Interleaved Frames
+// =============================
+// Section-outer, frame-middle, channel-inner: the coefficients stay in registers for the
+// whole block and the channel loop touches consecutive samples and consecutive state words.
+void dsp_biquad_section_multi_ref(const biquad_coeffs_t *c, biquad_state_t *st, uint8_t nch,
+                                  float *buf, size_t frames) {
+
+    const float b0 = c->b0, b1 = c->b1, b2 = c->b2;
+    const float a1 = c->a1, a2 = c->a2;
+
+    for (size_t f = 0; f < frames; f++) {
+        float *x = &buf[f * nch];
+        for (uint8_t ch = 0; ch < nch; ch++) {
+            float y = b0 * x[ch] + st[ch].z1;
+            st[ch].z1 = b1 * x[ch] - a1 * y + st[ch].z2;
+            st[ch].z2 = b2 * x[ch] - a2 * y;
+            x[ch] = y;
+        }
+    }
+}
+
+
+// =============================
+// Kernel: 4 Channels per SSE Register
+// =============================
+#if DSP_SIMD == DSP_SIMD_SSE || DSP_SIMD == DSP_SIMD_AVX2
+static void section_group4(const biquad_coeffs_t *c, biquad_state_t *st, uint8_t nch,
+                           float *buf, size_t frames) {
+
+    const __m128 b0 = _mm_set1_ps(c->b0), b1 = _mm_set1_ps(c->b1), b2 = _mm_set1_ps(c->b2);
+    const __m128 a1 = _mm_set1_ps(c->a1), a2 = _mm_set1_ps(c->a2);
+    __m128 z1 = _mm_setr_ps(st[0].z1, st[1].z1, st[2].z1, st[3].z1);
+    __m128 z2 = _mm_setr_ps(st[0].z2, st[1].z2, st[2].z2, st[3].z2);
+
+    for (size_t f = 0; f < frames; f++) {
+        float *x = &buf[f * nch];
+        __m128 xv = _mm_loadu_ps(x);
+        __m128 y = _mm_add_ps(_mm_mul_ps(b0, xv), z1);
+        z1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b1, xv), _mm_mul_ps(a1, y)), z2);
+        z2 = _mm_sub_ps(_mm_mul_ps(b2, xv), _mm_mul_ps(a2, y));
+        _mm_storeu_ps(x, y);
+    }
+
+    float s1[4], s2[4];
+    _mm_storeu_ps(s1, z1);
+    _mm_storeu_ps(s2, z2);
+    for (int k = 0; k < 4; k++) {
+        st[k].z1 = s1[k];
+        st[k].z2 = s2[k];
+    }
+}
+#endif
+
+
+// =============================
+// Kernel: 8 Channels per AVX Register
+// =============================
+#if DSP_SIMD == DSP_SIMD_AVX2
+static void section_group8(const biquad_coeffs_t *c, biquad_state_t *st, uint8_t nch,
+                           float *buf, size_t frames) {
+
+    const __m256 b0 = _mm256_set1_ps(c->b0), b1 = _mm256_set1_ps(c->b1), b2 = _mm256_set1_ps(c->b2);
+    const __m256 a1 = _mm256_set1_ps(c->a1), a2 = _mm256_set1_ps(c->a2);
+    __m256 z1 = _mm256_setr_ps(st[0].z1, st[1].z1, st[2].z1, st[3].z1,
+                               st[4].z1, st[5].z1, st[6].z1, st[7].z1);
+    __m256 z2 = _mm256_setr_ps(st[0].z2, st[1].z2, st[2].z2, st[3].z2,
+                               st[4].z2, st[5].z2, st[6].z2, st[7].z2);
+
+    for (size_t f = 0; f < frames; f++) {
+        float *x = &buf[f * nch];
+        __m256 xv = _mm256_loadu_ps(x);
+        __m256 y = _mm256_add_ps(_mm256_mul_ps(b0, xv), z1);
+        z1 = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(b1, xv), _mm256_mul_ps(a1, y)), z2);
+        z2 = _mm256_sub_ps(_mm256_mul_ps(b2, xv), _mm256_mul_ps(a2, y));
+        _mm256_storeu_ps(x, y);
+    }
+
+    float s1[8], s2[8];
+    _mm256_storeu_ps(s1, z1);
+    _mm256_storeu_ps(s2, z2);
+    for (int k = 0; k < 8; k++) {
+        st[k].z1 = s1[k];
+        st[k].z2 = s2[k];
+    }
+}
+#endif
+
+
+// =============================
+// Biquad: Dispatch Channel Groups
+// =============================
+void dsp_biquad_section_multi(const biquad_coeffs_t *c, biquad_state_t *st, uint8_t nch,
+                              float *buf, size_t frames) {
+
+    uint8_t ch = 0;
+
+#if DSP_SIMD == DSP_SIMD_AVX2
+    for (; ch + 8 <= nch; ch += 8) section_group8(c, &st[ch], nch, &buf[ch], frames);
+#endif
+#if DSP_SIMD == DSP_SIMD_SSE || DSP_SIMD == DSP_SIMD_AVX2
+    for (; ch + 4 <= nch; ch += 4) section_group4(c, &st[ch], nch, &buf[ch], frames);
+#endif
+
+    // Leftover channels (all of them on scalar / PIE builds), still interleaved with the rest
+    const float b0 = c->b0, b1 = c->b1, b2 = c->b2;
+    const float a1 = c->a1, a2 = c->a2;
+
+    for (; ch < nch; ch++) {
+        float z1 = st[ch].z1, z2 = st[ch].z2;
+        for (size_t f = 0; f < frames; f++) {
+            float *x = &buf[f * nch + ch];
+            float y = b0 * *x + z1;
+            z1 = b1 * *x - a1 * y + z2;
+            z2 = b2 * *x - a2 * y;
+            *x = y;
+        }
+        st[ch].z1 = z1;
+        st[ch].z2 = z2;
+    }
+}
+
+
+// =============================
+// Dot Product: Float
+// =============================
+float dsp_dot_f32_ref(const float *a, const float *b, size_t len) {
+    float acc = 0.0f;
+    for (size_t i = 0; i < len; i++) acc += a[i] * b[i];
+    return acc;
+}
+
+float dsp_dot_f32(const float *a, const float *b, size_t len) {
+
+    size_t i = 0;
+    float acc = 0.0f;
+
+#if DSP_SIMD == DSP_SIMD_AVX2
+    // Two accumulators hide the add latency
+    __m256 s0 = _mm256_setzero_ps(), s1 = _mm256_setzero_ps();
+    for (; i + 16 <= len; i += 16) {
+        s0 = _mm256_add_ps(s0, _mm256_mul_ps(_mm256_loadu_ps(&a[i]), _mm256_loadu_ps(&b[i])));
+        s1 = _mm256_add_ps(s1, _mm256_mul_ps(_mm256_loadu_ps(&a[i + 8]), _mm256_loadu_ps(&b[i + 8])));
+    }
+    __m256 s = _mm256_add_ps(s0, s1);
+    __m128 h = _mm_add_ps(_mm256_castps256_ps128(s), _mm256_extractf128_ps(s, 1));
+#elif DSP_SIMD == DSP_SIMD_SSE
+    __m128 s0 = _mm_setzero_ps(), s1 = _mm_setzero_ps();
+    for (; i + 8 <= len; i += 8) {
+        s0 = _mm_add_ps(s0, _mm_mul_ps(_mm_loadu_ps(&a[i]), _mm_loadu_ps(&b[i])));
+        s1 = _mm_add_ps(s1, _mm_mul_ps(_mm_loadu_ps(&a[i + 4]), _mm_loadu_ps(&b[i + 4])));
+    }
+    __m128 h = _mm_add_ps(s0, s1);
+#endif
+
+#if DSP_SIMD == DSP_SIMD_SSE || DSP_SIMD == DSP_SIMD_AVX2
+    // Horizontal sum of the 4 lanes
+    h = _mm_add_ps(h, _mm_movehl_ps(h, h));
+    h = _mm_add_ss(h, _mm_shuffle_ps(h, h, 0x55));
+    acc = _mm_cvtss_f32(h);
+#endif
+
+    for (; i < len; i++) acc += a[i] * b[i];
+    return acc;
+}
+
+
+// =============================
+// Dot Product: int16_t
+// =============================
+int64_t dsp_dot_s16_ref(const int16_t *a, const int16_t *b, size_t len) {
+    int64_t acc = 0;
+    for (size_t i = 0; i < len; i++) acc += (int32_t)a[i] * b[i];
+    return acc;
+}
+
+int64_t dsp_dot_s16(const int16_t *a, const int16_t *b, size_t len) {
+
+    size_t i = 0;
+    int64_t acc = 0;
+
+#if DSP_SIMD == DSP_SIMD_AVX2
+    // PMADDWD -> 8 x int32 pair sums, widened to int64 before they can overflow
+    __m256i s = _mm256_setzero_si256();
+    for (; i + 16 <= len; i += 16) {
+        __m256i p = _mm256_madd_epi16(_mm256_loadu_si256((const __m256i *)&a[i]),
+                                      _mm256_loadu_si256((const __m256i *)&b[i]));
+        s = _mm256_add_epi64(s, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(p)));
+        s = _mm256_add_epi64(s, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(p, 1)));
+    }
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, s);
+    acc = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif DSP_SIMD == DSP_SIMD_SSE
+    // SSE2 has no sign-extending widen: interleave with the sign mask instead
+    __m128i s = _mm_setzero_si128();
+    for (; i + 8 <= len; i += 8) {
+        __m128i p = _mm_madd_epi16(_mm_loadu_si128((const __m128i *)&a[i]),
+                                   _mm_loadu_si128((const __m128i *)&b[i]));
+        __m128i sign = _mm_srai_epi32(p, 31);
+        s = _mm_add_epi64(s, _mm_unpacklo_epi32(p, sign));
+        s = _mm_add_epi64(s, _mm_unpackhi_epi32(p, sign));
+    }
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, s);
+    acc = lanes[0] + lanes[1];
+#elif DSP_SIMD == DSP_SIMD_PIE
+    // 8 x int16_t per step into a wide accumulator: the EE.VMULAS.S16.ACCX shape (40-bit ACCX)
+    for (; i + 8 <= len; i += 8) {
+        int64_t p = 0;
+        for (int k = 0; k < 8; k += 2) {
+            p += (int32_t)a[i + k] * b[i + k] + (int32_t)a[i + k + 1] * b[i + k + 1];
+        }
+        acc += p;
+    }
+#endif
+
+    for (; i < len; i++) acc += (int32_t)a[i] * b[i];
+    return acc;
+}
@@ -0,0 +1,212 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "dsp_spectral.h"
+    #include "dsp_spectral_tables.h"   // Generated twiddle / bit-reversal / window tables
+    #include <string.h>                // For memset
+
+#ifndef SPECTRAL_TABLES_FFT_SIZE
+#error "No tables for this SPECTRAL_FFT_SIZE in dsp_spectral_tables.h: run tools/gen_spectral_tables.py"
+#endif
+_Static_assert(SPECTRAL_TABLES_FFT_SIZE == SPECTRAL_FFT_SIZE,
+               "dsp_spectral_tables.h is stale: run tools/gen_spectral_tables.py");
+
+
+// =============================
+// Band Edges (Hz)
+// =============================
+static const float band_edges_hz[EEG_BAND_COUNT][2] = {
+    [EEG_BAND_DELTA] = { 0.5f,  4.0f},
+    [EEG_BAND_THETA] = { 4.0f,  8.0f},
+    [EEG_BAND_ALPHA] = { 8.0f, 13.0f},
+    [EEG_BAND_BETA]  = {13.0f, 30.0f},
+    [EEG_BAND_GAMMA] = {30.0f, 45.0f},
+};
+
+static const char *const band_names[EEG_BAND_COUNT] = {
+    "delta", "theta", "alpha", "beta", "gamma",
+};
+
+const char *spectral_band_name(eeg_band_t band) {
+    return band < EEG_BAND_COUNT ? band_names[band] : "?";
+}
+
+
+// =============================
+// Engine: Init + Reset
+// =============================
+void spectral_init(spectral_engine_t *engine, float sample_rate_hz) {
+
+    engine->sample_rate_hz = sample_rate_hz;
+
+    // Map every FFT bin to the band containing its centre frequency (upper edge exclusive)
+    float bin_hz = sample_rate_hz / SPECTRAL_FFT_SIZE;
+    for (int k = 0; k < SPECTRAL_NUM_BINS; k++) {
+        float f = k * bin_hz;
+        engine->bin_band[k] = EEG_BAND_COUNT;
+        for (int b = 0; b < EEG_BAND_COUNT; b++) {
+            if (f >= band_edges_hz[b][0] && f < band_edges_hz[b][1]) {
+                engine->bin_band[k] = (uint8_t)b;
+                break;
+            }
+        }
+    }
+
+    spectral_reset(engine);
+}
+
+void spectral_reset(spectral_engine_t *engine) {
+    memset(engine->history, 0, sizeof(engine->history));
+    memset(engine->seg_power, 0, sizeof(engine->seg_power));
+    memset(&engine->result, 0, sizeof(engine->result));
+    engine->pos = 0;
+    engine->since_hop = 0;
+    engine->count = 0;
+    engine->seg_next = 0;
+    engine->seg_count = 0;
+}
+
+
+// =============================
+// Kernel: N/2-Point Complex FFT (radix-2, in place)
+// =============================
+// `z` holds N/2 interleaved complex values. Twiddles come from the N-point table with stride 2.
+static void spectral_cfft(float *z) {
+
+    const int M = SPECTRAL_FFT_SIZE / 2;
+
+    // --- 1. Bit-reversal permutation ---
+    for (int i = 0; i < M; i++) {
+        int j = spectral_bitrev[i];
+        if (j > i) {
+            float tr = z[2 * i], ti = z[2 * i + 1];
+            z[2 * i] = z[2 * j];
+            z[2 * i + 1] = z[2 * j + 1];
+            z[2 * j] = tr;
+            z[2 * j + 1] = ti;
+        }
+    }
+
+    // --- 2. Butterflies ---
+    for (int size = 2; size <= M; size <<= 1) {
+
+        int half = size >> 1;
+        int tw_step = 2 * (M / size);          // W_size^k == W_N^(k * N / size)
+
+        for (int start = 0; start < M; start += size) {
+            for (int k = 0; k < half; k++) {
+
+                float wr = spectral_twiddle_re[k * tw_step];
+                float wi = spectral_twiddle_im[k * tw_step];
+                int a = 2 * (start + k);
+                int b = a + 2 * half;
+
+                float tr = wr * z[b] - wi * z[b + 1];
+                float ti = wr * z[b + 1] + wi * z[b];
+
+                z[b]     = z[a] - tr;
+                z[b + 1] = z[a + 1] - ti;
+                z[a]     += tr;
+                z[a + 1] += ti;
+            }
+        }
+    }
+}
+
+
+// =============================
+// Kernel: Real FFT Power Spectrum
+// =============================
+// Packs the N real samples as N/2 complex values (even -> re, odd -> im), runs the half-size
+// complex FFT, then splits the result into the N/2 + 1 bins of the real transform.
+void spectral_fft_power(float *work, float *power) {
+
+    const int M = SPECTRAL_FFT_SIZE / 2;
+
+    spectral_cfft(work);
+
+    for (int k = 0; k <= M; k++) {
+
+        int k1 = k % M;
+        int k2 = (M - k) % M;
+
+        float zr = work[2 * k1],  zi = work[2 * k1 + 1];
+        float cr = work[2 * k2],  ci = -work[2 * k2 + 1];      // conj(Z[M - k])
+
+        // Even / odd halves
+        float er = 0.5f * (zr + cr), ei = 0.5f * (zi + ci);
+        float or_ = 0.5f * (zi - ci), oi = -0.5f * (zr - cr);
+
+        // X[k] = E[k] + W_N^k * O[k]   (W_N^M = -1)
+        float wr = (k < M) ? spectral_twiddle_re[k] : -1.0f;
+        float wi = (k < M) ? spectral_twiddle_im[k] : 0.0f;
+        float xr = er + wr * or_ - wi * oi;
+        float xi = ei + wr * oi + wi * or_;
+
+        power[k] = xr * xr + xi * xi;
+    }
+}
+
+
+// =============================
+// Engine: One Welch Segment
+// =============================
+static void spectral_segment(spectral_engine_t *engine) {
+
+    // --- 1. Window the last N samples (oldest first) ---
+    for (int n = 0; n < SPECTRAL_FFT_SIZE; n++) {
+        int idx = (engine->pos + n) % SPECTRAL_FFT_SIZE;
+        engine->work[n] = (float)engine->history[idx] * spectral_window[n];
+    }
+
+    // --- 2. Power spectrum ---
+    spectral_fft_power(engine->work, engine->power);
+
+    // --- 3. Integrate into bands: one-sided, window-power normalized ---
+    // For a sine of amplitude A this yields ~A^2 / 2 in the band holding it (Parseval).
+    float *bands = engine->seg_power[engine->seg_next];
+    memset(bands, 0, EEG_BAND_COUNT * sizeof(float));
+
+    const float scale = 2.0f / ((float)SPECTRAL_FFT_SIZE * SPECTRAL_WINDOW_POWER);
+    for (int k = 0; k < SPECTRAL_NUM_BINS; k++) {
+        uint8_t b = engine->bin_band[k];
+        if (b < EEG_BAND_COUNT) bands[b] += engine->power[k] * scale;
+    }
+
+    engine->seg_next = (uint8_t)((engine->seg_next + 1) % SPECTRAL_WELCH_SEGMENTS);
+    if (engine->seg_count < SPECTRAL_WELCH_SEGMENTS) engine->seg_count++;
+
+    // --- 4. Welch average over the stored segments ---
+    eeg_band_powers_t *r = &engine->result;
+    r->total = 0.0f;
+    for (int b = 0; b < EEG_BAND_COUNT; b++) {
+        float sum = 0.0f;
+        for (int s = 0; s < engine->seg_count; s++) sum += engine->seg_power[s][b];
+        r->absolute[b] = sum / engine->seg_count;
+        r->total += r->absolute[b];
+    }
+    for (int b = 0; b < EEG_BAND_COUNT; b++) {
+        r->relative[b] = (r->total > 0.0f) ? r->absolute[b] / r->total : 0.0f;
+    }
+    r->segments = engine->seg_count;
+}
+
+
+// =============================
+// Engine: Push One Sample
+// =============================
+bool spectral_push(spectral_engine_t *engine, int16_t sample) {
+
+    engine->history[engine->pos] = sample;
+    engine->pos = (uint16_t)((engine->pos + 1) % SPECTRAL_FFT_SIZE);
+    engine->count++;
+
+    if (engine->count < SPECTRAL_FFT_SIZE) return false;      // First window not full yet
+
+    if (engine->count > SPECTRAL_FFT_SIZE && ++engine->since_hop < SPECTRAL_HOP) return false;
+
+    engine->since_hop = 0;
+    spectral_segment(engine);
+    return true;
+}
@@ -0,0 +1,1505 @@
+// =============================
+// Spectral Engine Tables (GENERATED - do not edit)
+// =============================
+// Produced by tools/gen_spectral_tables.py for 256 / 512 / 1024 / 2048-point real FFTs; the block matching
+// SPECTRAL_FFT_SIZE (dsp_spectral.h) is compiled in.
+// Included by dsp_spectral.c only; everything lives in flash (.rodata).
+
+#ifndef DSP_SPECTRAL_TABLES_H
+#define DSP_SPECTRAL_TABLES_H
+
+#if SPECTRAL_FFT_SIZE == 256
+
+#define SPECTRAL_TABLES_FFT_SIZE   256
+#define SPECTRAL_WINDOW_POWER      9.600000000e+01f   // sum(w[n]^2)
+
+// W_N^k = e^{-j 2 pi k / N}, k = 0 .. N/2 - 1 (the N/2 complex FFT uses every other entry)
+static const float spectral_twiddle_re[128] = {
+     1.000000000e+00f,  9.996988187e-01f,  9.987954562e-01f,  9.972904567e-01f,  9.951847267e-01f,  9.924795346e-01f,
+     9.891765100e-01f,  9.852776424e-01f,  9.807852804e-01f,  9.757021300e-01f,  9.700312532e-01f,  9.637760658e-01f,
+     9.569403357e-01f,  9.495281806e-01f,  9.415440652e-01f,  9.329927988e-01f,  9.238795325e-01f,  9.142097557e-01f,
+     9.039892931e-01f,  8.932243012e-01f,  8.819212643e-01f,  8.700869911e-01f,  8.577286100e-01f,  8.448535652e-01f,
+     8.314696123e-01f,  8.175848132e-01f,  8.032075315e-01f,  7.883464276e-01f,  7.730104534e-01f,  7.572088465e-01f,
+     7.409511254e-01f,  7.242470830e-01f,  7.071067812e-01f,  6.895405447e-01f,  6.715589548e-01f,  6.531728430e-01f,
+     6.343932842e-01f,  6.152315906e-01f,  5.956993045e-01f,  5.758081914e-01f,  5.555702330e-01f,  5.349976199e-01f,
+     5.141027442e-01f,  4.928981922e-01f,  4.713967368e-01f,  4.496113297e-01f,  4.275550934e-01f,  4.052413140e-01f,
+     3.826834324e-01f,  3.598950365e-01f,  3.368898534e-01f,  3.136817404e-01f,  2.902846773e-01f,  2.667127575e-01f,
+     2.429801799e-01f,  2.191012402e-01f,  1.950903220e-01f,  1.709618888e-01f,  1.467304745e-01f,  1.224106752e-01f,
+     9.801714033e-02f,  7.356456360e-02f,  4.906767433e-02f,  2.454122852e-02f,  6.123233996e-17f, -2.454122852e-02f,
+    -4.906767433e-02f, -7.356456360e-02f, -9.801714033e-02f, -1.224106752e-01f, -1.467304745e-01f, -1.709618888e-01f,
+    -1.950903220e-01f, -2.191012402e-01f, -2.429801799e-01f, -2.667127575e-01f, -2.902846773e-01f, -3.136817404e-01f,
+    -3.368898534e-01f, -3.598950365e-01f, -3.826834324e-01f, -4.052413140e-01f, -4.275550934e-01f, -4.496113297e-01f,
+    -4.713967368e-01f, -4.928981922e-01f, -5.141027442e-01f, -5.349976199e-01f, -5.555702330e-01f, -5.758081914e-01f,
+    -5.956993045e-01f, -6.152315906e-01f, -6.343932842e-01f, -6.531728430e-01f, -6.715589548e-01f, -6.895405447e-01f,
+    -7.071067812e-01f, -7.242470830e-01f, -7.409511254e-01f, -7.572088465e-01f, -7.730104534e-01f, -7.883464276e-01f,
+    -8.032075315e-01f, -8.175848132e-01f, -8.314696123e-01f, -8.448535652e-01f, -8.577286100e-01f, -8.700869911e-01f,
+    -8.819212643e-01f, -8.932243012e-01f, -9.039892931e-01f, -9.142097557e-01f, -9.238795325e-01f, -9.329927988e-01f,
+    -9.415440652e-01f, -9.495281806e-01f, -9.569403357e-01f, -9.637760658e-01f, -9.700312532e-01f, -9.757021300e-01f,
+    -9.807852804e-01f, -9.852776424e-01f, -9.891765100e-01f, -9.924795346e-01f, -9.951847267e-01f, -9.972904567e-01f,
+    -9.987954562e-01f, -9.996988187e-01f,
+};
+
+static const float spectral_twiddle_im[128] = {
+    -0.000000000e+00f, -2.454122852e-02f, -4.906767433e-02f, -7.356456360e-02f, -9.801714033e-02f, -1.224106752e-01f,
+    -1.467304745e-01f, -1.709618888e-01f, -1.950903220e-01f, -2.191012402e-01f, -2.429801799e-01f, -2.667127575e-01f,
+    -2.902846773e-01f, -3.136817404e-01f, -3.368898534e-01f, -3.598950365e-01f, -3.826834324e-01f, -4.052413140e-01f,
+    -4.275550934e-01f, -4.496113297e-01f, -4.713967368e-01f, -4.928981922e-01f, -5.141027442e-01f, -5.349976199e-01f,
+    -5.555702330e-01f, -5.758081914e-01f, -5.956993045e-01f, -6.152315906e-01f, -6.343932842e-01f, -6.531728430e-01f,
+    -6.715589548e-01f, -6.895405447e-01f, -7.071067812e-01f, -7.242470830e-01f, -7.409511254e-01f, -7.572088465e-01f,
+    -7.730104534e-01f, -7.883464276e-01f, -8.032075315e-01f, -8.175848132e-01f, -8.314696123e-01f, -8.448535652e-01f,
+    -8.577286100e-01f, -8.700869911e-01f, -8.819212643e-01f, -8.932243012e-01f, -9.039892931e-01f, -9.142097557e-01f,
+    -9.238795325e-01f, -9.329927988e-01f, -9.415440652e-01f, -9.495281806e-01f, -9.569403357e-01f, -9.637760658e-01f,
+    -9.700312532e-01f, -9.757021300e-01f, -9.807852804e-01f, -9.852776424e-01f, -9.891765100e-01f, -9.924795346e-01f,
+    -9.951847267e-01f, -9.972904567e-01f, -9.987954562e-01f, -9.996988187e-01f, -1.000000000e+00f, -9.996988187e-01f,
+    -9.987954562e-01f, -9.972904567e-01f, -9.951847267e-01f, -9.924795346e-01f, -9.891765100e-01f, -9.852776424e-01f,
+    -9.807852804e-01f, -9.757021300e-01f, -9.700312532e-01f, -9.637760658e-01f, -9.569403357e-01f, -9.495281806e-01f,
+    -9.415440652e-01f, -9.329927988e-01f, -9.238795325e-01f, -9.142097557e-01f, -9.039892931e-01f, -8.932243012e-01f,
+    -8.819212643e-01f, -8.700869911e-01f, -8.577286100e-01f, -8.448535652e-01f, -8.314696123e-01f, -8.175848132e-01f,
+    -8.032075315e-01f, -7.883464276e-01f, -7.730104534e-01f, -7.572088465e-01f, -7.409511254e-01f, -7.242470830e-01f,
+    -7.071067812e-01f, -6.895405447e-01f, -6.715589548e-01f, -6.531728430e-01f, -6.343932842e-01f, -6.152315906e-01f,
+    -5.956993045e-01f, -5.758081914e-01f, -5.555702330e-01f, -5.349976199e-01f, -5.141027442e-01f, -4.928981922e-01f,
+    -4.713967368e-01f, -4.496113297e-01f, -4.275550934e-01f, -4.052413140e-01f, -3.826834324e-01f, -3.598950365e-01f,
+    -3.368898534e-01f, -3.136817404e-01f, -2.902846773e-01f, -2.667127575e-01f, -2.429801799e-01f, -2.191012402e-01f,
+    -1.950903220e-01f, -1.709618888e-01f, -1.467304745e-01f, -1.224106752e-01f, -9.801714033e-02f, -7.356456360e-02f,
+    -4.906767433e-02f, -2.454122852e-02f,
+};
+
+// Bit-reversed index for the N/2-point complex FFT
+static const uint16_t spectral_bitrev[128] = {
+       0,   64,   32,   96,   16,   80,   48,  112,    8,   72,   40,  104,   24,   88,   56,  120,
+       4,   68,   36,  100,   20,   84,   52,  116,   12,   76,   44,  108,   28,   92,   60,  124,
+       2,   66,   34,   98,   18,   82,   50,  114,   10,   74,   42,  106,   26,   90,   58,  122,
+       6,   70,   38,  102,   22,   86,   54,  118,   14,   78,   46,  110,   30,   94,   62,  126,
+       1,   65,   33,   97,   17,   81,   49,  113,    9,   73,   41,  105,   25,   89,   57,  121,
+       5,   69,   37,  101,   21,   85,   53,  117,   13,   77,   45,  109,   29,   93,   61,  125,
+       3,   67,   35,   99,   19,   83,   51,  115,   11,   75,   43,  107,   27,   91,   59,  123,
+       7,   71,   39,  103,   23,   87,   55,  119,   15,   79,   47,  111,   31,   95,   63,  127,
+};
+
+// Periodic Hann window
+static const float spectral_window[256] = {
+     0.000000000e+00f,  1.505906519e-04f,  6.022718974e-04f,  1.354771661e-03f,  2.407636664e-03f,  3.760232701e-03f,
+     5.411745018e-03f,  7.361178806e-03f,  9.607359798e-03f,  1.214893498e-02f,  1.498437340e-02f,  1.811196710e-02f,
+     2.152983213e-02f,  2.523590970e-02f,  2.922796741e-02f,  3.350360058e-02f,  3.806023374e-02f,  4.289512215e-02f,
+     4.800535344e-02f,  5.338784940e-02f,  5.903936783e-02f,  6.495650445e-02f,  7.113569500e-02f,  7.757321738e-02f,
+     8.426519385e-02f,  9.120759342e-02f,  9.839623426e-02f,  1.058267862e-01f,  1.134947733e-01f,  1.213955767e-01f,
+     1.295244373e-01f,  1.378764585e-01f,  1.464466094e-01f,  1.552297276e-01f,  1.642205226e-01f,  1.734135785e-01f,
+     1.828033579e-01f,  1.923842047e-01f,  2.021503478e-01f,  2.120959043e-01f,  2.222148835e-01f,  2.325011901e-01f,
+     2.429486279e-01f,  2.535509039e-01f,  2.643016316e-01f,  2.751943352e-01f,  2.862224533e-01f,  2.973793430e-01f,
+     3.086582838e-01f,  3.200524817e-01f,  3.315550733e-01f,  3.431591298e-01f,  3.548576614e-01f,  3.666436213e-01f,
+     3.785099100e-01f,  3.904493799e-01f,  4.024548390e-01f,  4.145190556e-01f,  4.266347628e-01f,  4.387946624e-01f,
+     4.509914298e-01f,  4.632177182e-01f,  4.754661628e-01f,  4.877293857e-01f,  5.000000000e-01f,  5.122706143e-01f,
+     5.245338372e-01f,  5.367822818e-01f,  5.490085702e-01f,  5.612053376e-01f,  5.733652372e-01f,  5.854809444e-01f,
+     5.975451610e-01f,  6.095506201e-01f,  6.214900900e-01f,  6.333563787e-01f,  6.451423386e-01f,  6.568408702e-01f,
+     6.684449267e-01f,  6.799475183e-01f,  6.913417162e-01f,  7.026206570e-01f,  7.137775467e-01f,  7.248056648e-01f,
+     7.356983684e-01f,  7.464490961e-01f,  7.570513721e-01f,  7.674988099e-01f,  7.777851165e-01f,  7.879040957e-01f,
+     7.978496522e-01f,  8.076157953e-01f,  8.171966421e-01f,  8.265864215e-01f,  8.357794774e-01f,  8.447702724e-01f,
+     8.535533906e-01f,  8.621235415e-01f,  8.704755627e-01f,  8.786044233e-01f,  8.865052267e-01f,  8.941732138e-01f,
+     9.016037657e-01f,  9.087924066e-01f,  9.157348062e-01f,  9.224267826e-01f,  9.288643050e-01f,  9.350434956e-01f,
+     9.409606322e-01f,  9.466121506e-01f,  9.519946466e-01f,  9.571048779e-01f,  9.619397663e-01f,  9.664963994e-01f,
+     9.707720326e-01f,  9.747640903e-01f,  9.784701679e-01f,  9.818880329e-01f,  9.850156266e-01f,  9.878510650e-01f,
+     9.903926402e-01f,  9.926388212e-01f,  9.945882550e-01f,  9.962397673e-01f,  9.975923633e-01f,  9.986452283e-01f,
+     9.993977281e-01f,  9.998494093e-01f,  1.000000000e+00f,  9.998494093e-01f,  9.993977281e-01f,  9.986452283e-01f,
+     9.975923633e-01f,  9.962397673e-01f,  9.945882550e-01f,  9.926388212e-01f,  9.903926402e-01f,  9.878510650e-01f,
+     9.850156266e-01f,  9.818880329e-01f,  9.784701679e-01f,  9.747640903e-01f,  9.707720326e-01f,  9.664963994e-01f,
+     9.619397663e-01f,  9.571048779e-01f,  9.519946466e-01f,  9.466121506e-01f,  9.409606322e-01f,  9.350434956e-01f,
+     9.288643050e-01f,  9.224267826e-01f,  9.157348062e-01f,  9.087924066e-01f,  9.016037657e-01f,  8.941732138e-01f,
+     8.865052267e-01f,  8.786044233e-01f,  8.704755627e-01f,  8.621235415e-01f,  8.535533906e-01f,  8.447702724e-01f,
+     8.357794774e-01f,  8.265864215e-01f,  8.171966421e-01f,  8.076157953e-01f,  7.978496522e-01f,  7.879040957e-01f,
+     7.777851165e-01f,  7.674988099e-01f,  7.570513721e-01f,  7.464490961e-01f,  7.356983684e-01f,  7.248056648e-01f,
+     7.137775467e-01f,  7.026206570e-01f,  6.913417162e-01f,  6.799475183e-01f,  6.684449267e-01f,  6.568408702e-01f,
+     6.451423386e-01f,  6.333563787e-01f,  6.214900900e-01f,  6.095506201e-01f,  5.975451610e-01f,  5.854809444e-01f,
+     5.733652372e-01f,  5.612053376e-01f,  5.490085702e-01f,  5.367822818e-01f,  5.245338372e-01f,  5.122706143e-01f,
+     5.000000000e-01f,  4.877293857e-01f,  4.754661628e-01f,  4.632177182e-01f,  4.509914298e-01f,  4.387946624e-01f,
+     4.266347628e-01f,  4.145190556e-01f,  4.024548390e-01f,  3.904493799e-01f,  3.785099100e-01f,  3.666436213e-01f,
+     3.548576614e-01f,  3.431591298e-01f,  3.315550733e-01f,  3.200524817e-01f,  3.086582838e-01f,  2.973793430e-01f,
+     2.862224533e-01f,  2.751943352e-01f,  2.643016316e-01f,  2.535509039e-01f,  2.429486279e-01f,  2.325011901e-01f,
+     2.222148835e-01f,  2.120959043e-01f,  2.021503478e-01f,  1.923842047e-01f,  1.828033579e-01f,  1.734135785e-01f,
+     1.642205226e-01f,  1.552297276e-01f,  1.464466094e-01f,  1.378764585e-01f,  1.295244373e-01f,  1.213955767e-01f,
+     1.134947733e-01f,  1.058267862e-01f,  9.839623426e-02f,  9.120759342e-02f,  8.426519385e-02f,  7.757321738e-02f,
+     7.113569500e-02f,  6.495650445e-02f,  5.903936783e-02f,  5.338784940e-02f,  4.800535344e-02f,  4.289512215e-02f,
+     3.806023374e-02f,  3.350360058e-02f,  2.922796741e-02f,  2.523590970e-02f,  2.152983213e-02f,  1.811196710e-02f,
+     1.498437340e-02f,  1.214893498e-02f,  9.607359798e-03f,  7.361178806e-03f,  5.411745018e-03f,  3.760232701e-03f,
+     2.407636664e-03f,  1.354771661e-03f,  6.022718974e-04f,  1.505906519e-04f,
+};
+
+#endif // SPECTRAL_FFT_SIZE == 256
+
+#if SPECTRAL_FFT_SIZE == 512
+
+#define SPECTRAL_TABLES_FFT_SIZE   512
+#define SPECTRAL_WINDOW_POWER      1.920000000e+02f   // sum(w[n]^2)
+
+// W_N^k = e^{-j 2 pi k / N}, k = 0 .. N/2 - 1 (the N/2 complex FFT uses every other entry)
+static const float spectral_twiddle_re[256] = {
+     1.000000000e+00f,  9.999247018e-01f,  9.996988187e-01f,  9.993223846e-01f,  9.987954562e-01f,  9.981181129e-01f,
+     9.972904567e-01f,  9.963126122e-01f,  9.951847267e-01f,  9.939069700e-01f,  9.924795346e-01f,  9.909026354e-01f,
+     9.891765100e-01f,  9.873014182e-01f,  9.852776424e-01f,  9.831054874e-01f,  9.807852804e-01f,  9.783173707e-01f,
+     9.757021300e-01f,  9.729399522e-01f,  9.700312532e-01f,  9.669764710e-01f,  9.637760658e-01f,  9.604305194e-01f,
+     9.569403357e-01f,  9.533060404e-01f,  9.495281806e-01f,  9.456073254e-01f,  9.415440652e-01f,  9.373390119e-01f,
+     9.329927988e-01f,  9.285060805e-01f,  9.238795325e-01f,  9.191138517e-01f,  9.142097557e-01f,  9.091679831e-01f,
+     9.039892931e-01f,  8.986744657e-01f,  8.932243012e-01f,  8.876396204e-01f,  8.819212643e-01f,  8.760700942e-01f,
+     8.700869911e-01f,  8.639728561e-01f,  8.577286100e-01f,  8.513551931e-01f,  8.448535652e-01f,  8.382247056e-01f,
+     8.314696123e-01f,  8.245893028e-01f,  8.175848132e-01f,  8.104571983e-01f,  8.032075315e-01f,  7.958369046e-01f,
+     7.883464276e-01f,  7.807372286e-01f,  7.730104534e-01f,  7.651672656e-01f,  7.572088465e-01f,  7.491363945e-01f,
+     7.409511254e-01f,  7.326542717e-01f,  7.242470830e-01f,  7.157308253e-01f,  7.071067812e-01f,  6.983762494e-01f,
+     6.895405447e-01f,  6.806009978e-01f,  6.715589548e-01f,  6.624157776e-01f,  6.531728430e-01f,  6.438315429e-01f,
+     6.343932842e-01f,  6.248594881e-01f,  6.152315906e-01f,  6.055110414e-01f,  5.956993045e-01f,  5.857978575e-01f,
+     5.758081914e-01f,  5.657318108e-01f,  5.555702330e-01f,  5.453249884e-01f,  5.349976199e-01f,  5.245896827e-01f,
+     5.141027442e-01f,  5.035383837e-01f,  4.928981922e-01f,  4.821837721e-01f,  4.713967368e-01f,  4.605387110e-01f,
+     4.496113297e-01f,  4.386162385e-01f,  4.275550934e-01f,  4.164295601e-01f,  4.052413140e-01f,  3.939920401e-01f,
+     3.826834324e-01f,  3.713171940e-01f,  3.598950365e-01f,  3.484186802e-01f,  3.368898534e-01f,  3.253102922e-01f,
+     3.136817404e-01f,  3.020059493e-01f,  2.902846773e-01f,  2.785196894e-01f,  2.667127575e-01f,  2.548656596e-01f,
+     2.429801799e-01f,  2.310581083e-01f,  2.191012402e-01f,  2.071113762e-01f,  1.950903220e-01f,  1.830398880e-01f,
+     1.709618888e-01f,  1.588581433e-01f,  1.467304745e-01f,  1.345807085e-01f,  1.224106752e-01f,  1.102222073e-01f,
+     9.801714033e-02f,  8.579731234e-02f,  7.356456360e-02f,  6.132073630e-02f,  4.906767433e-02f,  3.680722294e-02f,
+     2.454122852e-02f,  1.227153829e-02f,  6.123233996e-17f, -1.227153829e-02f, -2.454122852e-02f, -3.680722294e-02f,
+    -4.906767433e-02f, -6.132073630e-02f, -7.356456360e-02f, -8.579731234e-02f, -9.801714033e-02f, -1.102222073e-01f,
+    -1.224106752e-01f, -1.345807085e-01f, -1.467304745e-01f, -1.588581433e-01f, -1.709618888e-01f, -1.830398880e-01f,
+    -1.950903220e-01f, -2.071113762e-01f, -2.191012402e-01f, -2.310581083e-01f, -2.429801799e-01f, -2.548656596e-01f,
+    -2.667127575e-01f, -2.785196894e-01f, -2.902846773e-01f, -3.020059493e-01f, -3.136817404e-01f, -3.253102922e-01f,
+    -3.368898534e-01f, -3.484186802e-01f, -3.598950365e-01f, -3.713171940e-01f, -3.826834324e-01f, -3.939920401e-01f,
+    -4.052413140e-01f, -4.164295601e-01f, -4.275550934e-01f, -4.386162385e-01f, -4.496113297e-01f, -4.605387110e-01f,
+    -4.713967368e-01f, -4.821837721e-01f, -4.928981922e-01f, -5.035383837e-01f, -5.141027442e-01f, -5.245896827e-01f,
+    -5.349976199e-01f, -5.453249884e-01f, -5.555702330e-01f, -5.657318108e-01f, -5.758081914e-01f, -5.857978575e-01f,
+    -5.956993045e-01f, -6.055110414e-01f, -6.152315906e-01f, -6.248594881e-01f, -6.343932842e-01f, -6.438315429e-01f,
+    -6.531728430e-01f, -6.624157776e-01f, -6.715589548e-01f, -6.806009978e-01f, -6.895405447e-01f, -6.983762494e-01f,
+    -7.071067812e-01f, -7.157308253e-01f, -7.242470830e-01f, -7.326542717e-01f, -7.409511254e-01f, -7.491363945e-01f,
+    -7.572088465e-01f, -7.651672656e-01f, -7.730104534e-01f, -7.807372286e-01f, -7.883464276e-01f, -7.958369046e-01f,
+    -8.032075315e-01f, -8.104571983e-01f, -8.175848132e-01f, -8.245893028e-01f, -8.314696123e-01f, -8.382247056e-01f,
+    -8.448535652e-01f, -8.513551931e-01f, -8.577286100e-01f, -8.639728561e-01f, -8.700869911e-01f, -8.760700942e-01f,
+    -8.819212643e-01f, -8.876396204e-01f, -8.932243012e-01f, -8.986744657e-01f, -9.039892931e-01f, -9.091679831e-01f,
+    -9.142097557e-01f, -9.191138517e-01f, -9.238795325e-01f, -9.285060805e-01f, -9.329927988e-01f, -9.373390119e-01f,
+    -9.415440652e-01f, -9.456073254e-01f, -9.495281806e-01f, -9.533060404e-01f, -9.569403357e-01f, -9.604305194e-01f,
+    -9.637760658e-01f, -9.669764710e-01f, -9.700312532e-01f, -9.729399522e-01f, -9.757021300e-01f, -9.783173707e-01f,
+    -9.807852804e-01f, -9.831054874e-01f, -9.852776424e-01f, -9.873014182e-01f, -9.891765100e-01f, -9.909026354e-01f,
+    -9.924795346e-01f, -9.939069700e-01f, -9.951847267e-01f, -9.963126122e-01f, -9.972904567e-01f, -9.981181129e-01f,
+    -9.987954562e-01f, -9.993223846e-01f, -9.996988187e-01f, -9.999247018e-01f,
+};
+
+static const float spectral_twiddle_im[256] = {
+    -0.000000000e+00f, -1.227153829e-02f, -2.454122852e-02f, -3.680722294e-02f, -4.906767433e-02f, -6.132073630e-02f,
+    -7.356456360e-02f, -8.579731234e-02f, -9.801714033e-02f, -1.102222073e-01f, -1.224106752e-01f, -1.345807085e-01f,
+    -1.467304745e-01f, -1.588581433e-01f, -1.709618888e-01f, -1.830398880e-01f, -1.950903220e-01f, -2.071113762e-01f,
+    -2.191012402e-01f, -2.310581083e-01f, -2.429801799e-01f, -2.548656596e-01f, -2.667127575e-01f, -2.785196894e-01f,
+    -2.902846773e-01f, -3.020059493e-01f, -3.136817404e-01f, -3.253102922e-01f, -3.368898534e-01f, -3.484186802e-01f,
+    -3.598950365e-01f, -3.713171940e-01f, -3.826834324e-01f, -3.939920401e-01f, -4.052413140e-01f, -4.164295601e-01f,
+    -4.275550934e-01f, -4.386162385e-01f, -4.496113297e-01f, -4.605387110e-01f, -4.713967368e-01f, -4.821837721e-01f,
+    -4.928981922e-01f, -5.035383837e-01f, -5.141027442e-01f, -5.245896827e-01f, -5.349976199e-01f, -5.453249884e-01f,
+    -5.555702330e-01f, -5.657318108e-01f, -5.758081914e-01f, -5.857978575e-01f, -5.956993045e-01f, -6.055110414e-01f,
+    -6.152315906e-01f, -6.248594881e-01f, -6.343932842e-01f, -6.438315429e-01f, -6.531728430e-01f, -6.624157776e-01f,
+    -6.715589548e-01f, -6.806009978e-01f, -6.895405447e-01f, -6.983762494e-01f, -7.071067812e-01f, -7.157308253e-01f,
+    -7.242470830e-01f, -7.326542717e-01f, -7.409511254e-01f, -7.491363945e-01f, -7.572088465e-01f, -7.651672656e-01f,
+    -7.730104534e-01f, -7.807372286e-01f, -7.883464276e-01f, -7.958369046e-01f, -8.032075315e-01f, -8.104571983e-01f,
+    -8.175848132e-01f, -8.245893028e-01f, -8.314696123e-01f, -8.382247056e-01f, -8.448535652e-01f, -8.513551931e-01f,
+    -8.577286100e-01f, -8.639728561e-01f, -8.700869911e-01f, -8.760700942e-01f, -8.819212643e-01f, -8.876396204e-01f,
+    -8.932243012e-01f, -8.986744657e-01f, -9.039892931e-01f, -9.091679831e-01f, -9.142097557e-01f, -9.191138517e-01f,
+    -9.238795325e-01f, -9.285060805e-01f, -9.329927988e-01f, -9.373390119e-01f, -9.415440652e-01f, -9.456073254e-01f,
+    -9.495281806e-01f, -9.533060404e-01f, -9.569403357e-01f, -9.604305194e-01f, -9.637760658e-01f, -9.669764710e-01f,
+    -9.700312532e-01f, -9.729399522e-01f, -9.757021300e-01f, -9.783173707e-01f, -9.807852804e-01f, -9.831054874e-01f,
+    -9.852776424e-01f, -9.873014182e-01f, -9.891765100e-01f, -9.909026354e-01f, -9.924795346e-01f, -9.939069700e-01f,
+    -9.951847267e-01f, -9.963126122e-01f, -9.972904567e-01f, -9.981181129e-01f, -9.987954562e-01f, -9.993223846e-01f,
+    -9.996988187e-01f, -9.999247018e-01f, -1.000000000e+00f, -9.999247018e-01f, -9.996988187e-01f, -9.993223846e-01f,
+    -9.987954562e-01f, -9.981181129e-01f, -9.972904567e-01f, -9.963126122e-01f, -9.951847267e-01f, -9.939069700e-01f,
+    -9.924795346e-01f, -9.909026354e-01f, -9.891765100e-01f, -9.873014182e-01f, -9.852776424e-01f, -9.831054874e-01f,
+    -9.807852804e-01f, -9.783173707e-01f, -9.757021300e-01f, -9.729399522e-01f, -9.700312532e-01f, -9.669764710e-01f,
+    -9.637760658e-01f, -9.604305194e-01f, -9.569403357e-01f, -9.533060404e-01f, -9.495281806e-01f, -9.456073254e-01f,
+    -9.415440652e-01f, -9.373390119e-01f, -9.329927988e-01f, -9.285060805e-01f, -9.238795325e-01f, -9.191138517e-01f,
+    -9.142097557e-01f, -9.091679831e-01f, -9.039892931e-01f, -8.986744657e-01f, -8.932243012e-01f, -8.876396204e-01f,
+    -8.819212643e-01f, -8.760700942e-01f, -8.700869911e-01f, -8.639728561e-01f, -8.577286100e-01f, -8.513551931e-01f,
+    -8.448535652e-01f, -8.382247056e-01f, -8.314696123e-01f, -8.245893028e-01f, -8.175848132e-01f, -8.104571983e-01f,
+    -8.032075315e-01f, -7.958369046e-01f, -7.883464276e-01f, -7.807372286e-01f, -7.730104534e-01f, -7.651672656e-01f,
+    -7.572088465e-01f, -7.491363945e-01f, -7.409511254e-01f, -7.326542717e-01f, -7.242470830e-01f, -7.157308253e-01f,
+    -7.071067812e-01f, -6.983762494e-01f, -6.895405447e-01f, -6.806009978e-01f, -6.715589548e-01f, -6.624157776e-01f,
+    -6.531728430e-01f, -6.438315429e-01f, -6.343932842e-01f, -6.248594881e-01f, -6.152315906e-01f, -6.055110414e-01f,
+    -5.956993045e-01f, -5.857978575e-01f, -5.758081914e-01f, -5.657318108e-01f, -5.555702330e-01f, -5.453249884e-01f,
+    -5.349976199e-01f, -5.245896827e-01f, -5.141027442e-01f, -5.035383837e-01f, -4.928981922e-01f, -4.821837721e-01f,
+    -4.713967368e-01f, -4.605387110e-01f, -4.496113297e-01f, -4.386162385e-01f, -4.275550934e-01f, -4.164295601e-01f,
+    -4.052413140e-01f, -3.939920401e-01f, -3.826834324e-01f, -3.713171940e-01f, -3.598950365e-01f, -3.484186802e-01f,
+    -3.368898534e-01f, -3.253102922e-01f, -3.136817404e-01f, -3.020059493e-01f, -2.902846773e-01f, -2.785196894e-01f,
+    -2.667127575e-01f, -2.548656596e-01f, -2.429801799e-01f, -2.310581083e-01f, -2.191012402e-01f, -2.071113762e-01f,
+    -1.950903220e-01f, -1.830398880e-01f, -1.709618888e-01f, -1.588581433e-01f, -1.467304745e-01f, -1.345807085e-01f,
+    -1.224106752e-01f, -1.102222073e-01f, -9.801714033e-02f, -8.579731234e-02f, -7.356456360e-02f, -6.132073630e-02f,
+    -4.906767433e-02f, -3.680722294e-02f, -2.454122852e-02f, -1.227153829e-02f,
+};
+
+// Bit-reversed index for the N/2-point complex FFT
+static const uint16_t spectral_bitrev[256] = {
+       0,  128,   64,  192,   32,  160,   96,  224,   16,  144,   80,  208,   48,  176,  112,  240,
+       8,  136,   72,  200,   40,  168,  104,  232,   24,  152,   88,  216,   56,  184,  120,  248,
+       4,  132,   68,  196,   36,  164,  100,  228,   20,  148,   84,  212,   52,  180,  116,  244,
+      12,  140,   76,  204,   44,  172,  108,  236,   28,  156,   92,  220,   60,  188,  124,  252,
+       2,  130,   66,  194,   34,  162,   98,  226,   18,  146,   82,  210,   50,  178,  114,  242,
+      10,  138,   74,  202,   42,  170,  106,  234,   26,  154,   90,  218,   58,  186,  122,  250,
+       6,  134,   70,  198,   38,  166,  102,  230,   22,  150,   86,  214,   54,  182,  118,  246,
+      14,  142,   78,  206,   46,  174,  110,  238,   30,  158,   94,  222,   62,  190,  126,  254,
+       1,  129,   65,  193,   33,  161,   97,  225,   17,  145,   81,  209,   49,  177,  113,  241,
+       9,  137,   73,  201,   41,  169,  105,  233,   25,  153,   89,  217,   57,  185,  121,  249,
+       5,  133,   69,  197,   37,  165,  101,  229,   21,  149,   85,  213,   53,  181,  117,  245,
+      13,  141,   77,  205,   45,  173,  109,  237,   29,  157,   93,  221,   61,  189,  125,  253,
+       3,  131,   67,  195,   35,  163,   99,  227,   19,  147,   83,  211,   51,  179,  115,  243,
+      11,  139,   75,  203,   43,  171,  107,  235,   27,  155,   91,  219,   59,  187,  123,  251,
+       7,  135,   71,  199,   39,  167,  103,  231,   23,  151,   87,  215,   55,  183,  119,  247,
+      15,  143,   79,  207,   47,  175,  111,  239,   31,  159,   95,  223,   63,  191,  127,  255,
+};
+
+// Periodic Hann window
+static const float spectral_window[512] = {
+     0.000000000e+00f,  3.764908043e-05f,  1.505906519e-04f,  3.388077058e-04f,  6.022718974e-04f,  9.409435499e-04f,
+     1.354771661e-03f,  1.843693909e-03f,  2.407636664e-03f,  3.046514999e-03f,  3.760232701e-03f,  4.548682286e-03f,
+     5.411745018e-03f,  6.349290921e-03f,  7.361178806e-03f,  8.447256284e-03f,  9.607359798e-03f,  1.084131464e-02f,
+     1.214893498e-02f,  1.353002390e-02f,  1.498437340e-02f,  1.651176448e-02f,  1.811196710e-02f,  1.978474029e-02f,
+     2.152983213e-02f,  2.334697982e-02f,  2.523590970e-02f,  2.719633731e-02f,  2.922796741e-02f,  3.133049404e-02f,
+     3.350360058e-02f,  3.574695976e-02f,  3.806023374e-02f,  4.044307415e-02f,  4.289512215e-02f,  4.541600845e-02f,
+     4.800535344e-02f,  5.066276715e-02f,  5.338784940e-02f,  5.618018980e-02f,  5.903936783e-02f,  6.196495290e-02f,
+     6.495650445e-02f,  6.801357194e-02f,  7.113569500e-02f,  7.432240345e-02f,  7.757321738e-02f,  8.088764722e-02f,
+     8.426519385e-02f,  8.770534861e-02f,  9.120759342e-02f,  9.477140087e-02f,  9.839623426e-02f,  1.020815477e-01f,
+     1.058267862e-01f,  1.096313857e-01f,  1.134947733e-01f,  1.174163672e-01f,  1.213955767e-01f,  1.254318027e-01f,
+     1.295244373e-01f,  1.336728642e-01f,  1.378764585e-01f,  1.421345874e-01f,  1.464466094e-01f,  1.508118753e-01f,
+     1.552297276e-01f,  1.596995011e-01f,  1.642205226e-01f,  1.687921112e-01f,  1.734135785e-01f,  1.780842286e-01f,
+     1.828033579e-01f,  1.875702559e-01f,  1.923842047e-01f,  1.972444793e-01f,  2.021503478e-01f,  2.071010713e-01f,
+     2.120959043e-01f,  2.171340946e-01f,  2.222148835e-01f,  2.273375058e-01f,  2.325011901e-01f,  2.377051587e-01f,
+     2.429486279e-01f,  2.482308081e-01f,  2.535509039e-01f,  2.589081140e-01f,  2.643016316e-01f,  2.697306445e-01f,
+     2.751943352e-01f,  2.806918807e-01f,  2.862224533e-01f,  2.917852200e-01f,  2.973793430e-01f,  3.030039800e-01f,
+     3.086582838e-01f,  3.143414030e-01f,  3.200524817e-01f,  3.257906599e-01f,  3.315550733e-01f,  3.373448539e-01f,
+     3.431591298e-01f,  3.489970253e-01f,  3.548576614e-01f,  3.607401553e-01f,  3.666436213e-01f,  3.725671702e-01f,
+     3.785099100e-01f,  3.844709459e-01f,  3.904493799e-01f,  3.964443119e-01f,  4.024548390e-01f,  4.084800560e-01f,
+     4.145190556e-01f,  4.205709283e-01f,  4.266347628e-01f,  4.327096457e-01f,  4.387946624e-01f,  4.448888964e-01f,
+     4.509914298e-01f,  4.571013438e-01f,  4.632177182e-01f,  4.693396318e-01f,  4.754661628e-01f,  4.815963885e-01f,
+     4.877293857e-01f,  4.938642309e-01f,  5.000000000e-01f,  5.061357691e-01f,  5.122706143e-01f,  5.184036115e-01f,
+     5.245338372e-01f,  5.306603682e-01f,  5.367822818e-01f,  5.428986562e-01f,  5.490085702e-01f,  5.551111036e-01f,
+     5.612053376e-01f,  5.672903543e-01f,  5.733652372e-01f,  5.794290717e-01f,  5.854809444e-01f,  5.915199440e-01f,
+     5.975451610e-01f,  6.035556881e-01f,  6.095506201e-01f,  6.155290541e-01f,  6.214900900e-01f,  6.274328298e-01f,
+     6.333563787e-01f,  6.392598447e-01f,  6.451423386e-01f,  6.510029747e-01f,  6.568408702e-01f,  6.626551461e-01f,
+     6.684449267e-01f,  6.742093401e-01f,  6.799475183e-01f,  6.856585970e-01f,  6.913417162e-01f,  6.969960200e-01f,
+     7.026206570e-01f,  7.082147800e-01f,  7.137775467e-01f,  7.193081193e-01f,  7.248056648e-01f,  7.302693555e-01f,
+     7.356983684e-01f,  7.410918860e-01f,  7.464490961e-01f,  7.517691919e-01f,  7.570513721e-01f,  7.622948413e-01f,
+     7.674988099e-01f,  7.726624942e-01f,  7.777851165e-01f,  7.828659054e-01f,  7.879040957e-01f,  7.928989287e-01f,
+     7.978496522e-01f,  8.027555207e-01f,  8.076157953e-01f,  8.124297441e-01f,  8.171966421e-01f,  8.219157714e-01f,
+     8.265864215e-01f,  8.312078888e-01f,  8.357794774e-01f,  8.403004989e-01f,  8.447702724e-01f,  8.491881247e-01f,
+     8.535533906e-01f,  8.578654126e-01f,  8.621235415e-01f,  8.663271358e-01f,  8.704755627e-01f,  8.745681973e-01f,
+     8.786044233e-01f,  8.825836328e-01f,  8.865052267e-01f,  8.903686143e-01f,  8.941732138e-01f,  8.979184523e-01f,
+     9.016037657e-01f,  9.052285991e-01f,  9.087924066e-01f,  9.122946514e-01f,  9.157348062e-01f,  9.191123528e-01f,
+     9.224267826e-01f,  9.256775966e-01f,  9.288643050e-01f,  9.319864281e-01f,  9.350434956e-01f,  9.380350471e-01f,
+     9.409606322e-01f,  9.438198102e-01f,  9.466121506e-01f,  9.493372328e-01f,  9.519946466e-01f,  9.545839915e-01f,
+     9.571048779e-01f,  9.595569258e-01f,  9.619397663e-01f,  9.642530402e-01f,  9.664963994e-01f,  9.686695060e-01f,
+     9.707720326e-01f,  9.728036627e-01f,  9.747640903e-01f,  9.766530202e-01f,  9.784701679e-01f,  9.802152597e-01f,
+     9.818880329e-01f,  9.834882355e-01f,  9.850156266e-01f,  9.864699761e-01f,  9.878510650e-01f,  9.891586854e-01f,
+     9.903926402e-01f,  9.915527437e-01f,  9.926388212e-01f,  9.936507091e-01f,  9.945882550e-01f,  9.954513177e-01f,
+     9.962397673e-01f,  9.969534850e-01f,  9.975923633e-01f,  9.981563061e-01f,  9.986452283e-01f,  9.990590565e-01f,
+     9.993977281e-01f,  9.996611923e-01f,  9.998494093e-01f,  9.999623509e-01f,  1.000000000e+00f,  9.999623509e-01f,
+     9.998494093e-01f,  9.996611923e-01f,  9.993977281e-01f,  9.990590565e-01f,  9.986452283e-01f,  9.981563061e-01f,
+     9.975923633e-01f,  9.969534850e-01f,  9.962397673e-01f,  9.954513177e-01f,  9.945882550e-01f,  9.936507091e-01f,
+     9.926388212e-01f,  9.915527437e-01f,  9.903926402e-01f,  9.891586854e-01f,  9.878510650e-01f,  9.864699761e-01f,
+     9.850156266e-01f,  9.834882355e-01f,  9.818880329e-01f,  9.802152597e-01f,  9.784701679e-01f,  9.766530202e-01f,
+     9.747640903e-01f,  9.728036627e-01f,  9.707720326e-01f,  9.686695060e-01f,  9.664963994e-01f,  9.642530402e-01f,
+     9.619397663e-01f,  9.595569258e-01f,  9.571048779e-01f,  9.545839915e-01f,  9.519946466e-01f,  9.493372328e-01f,
+     9.466121506e-01f,  9.438198102e-01f,  9.409606322e-01f,  9.380350471e-01f,  9.350434956e-01f,  9.319864281e-01f,
+     9.288643050e-01f,  9.256775966e-01f,  9.224267826e-01f,  9.191123528e-01f,  9.157348062e-01f,  9.122946514e-01f,
+     9.087924066e-01f,  9.052285991e-01f,  9.016037657e-01f,  8.979184523e-01f,  8.941732138e-01f,  8.903686143e-01f,
+     8.865052267e-01f,  8.825836328e-01f,  8.786044233e-01f,  8.745681973e-01f,  8.704755627e-01f,  8.663271358e-01f,
+     8.621235415e-01f,  8.578654126e-01f,  8.535533906e-01f,  8.491881247e-01f,  8.447702724e-01f,  8.403004989e-01f,
+     8.357794774e-01f,  8.312078888e-01f,  8.265864215e-01f,  8.219157714e-01f,  8.171966421e-01f,  8.124297441e-01f,
+     8.076157953e-01f,  8.027555207e-01f,  7.978496522e-01f,  7.928989287e-01f,  7.879040957e-01f,  7.828659054e-01f,
+     7.777851165e-01f,  7.726624942e-01f,  7.674988099e-01f,  7.622948413e-01f,  7.570513721e-01f,  7.517691919e-01f,
+     7.464490961e-01f,  7.410918860e-01f,  7.356983684e-01f,  7.302693555e-01f,  7.248056648e-01f,  7.193081193e-01f,
+     7.137775467e-01f,  7.082147800e-01f,  7.026206570e-01f,  6.969960200e-01f,  6.913417162e-01f,  6.856585970e-01f,
+     6.799475183e-01f,  6.742093401e-01f,  6.684449267e-01f,  6.626551461e-01f,  6.568408702e-01f,  6.510029747e-01f,
+     6.451423386e-01f,  6.392598447e-01f,  6.333563787e-01f,  6.274328298e-01f,  6.214900900e-01f,  6.155290541e-01f,
+     6.095506201e-01f,  6.035556881e-01f,  5.975451610e-01f,  5.915199440e-01f,  5.854809444e-01f,  5.794290717e-01f,
+     5.733652372e-01f,  5.672903543e-01f,  5.612053376e-01f,  5.551111036e-01f,  5.490085702e-01f,  5.428986562e-01f,
+     5.367822818e-01f,  5.306603682e-01f,  5.245338372e-01f,  5.184036115e-01f,  5.122706143e-01f,  5.061357691e-01f,
+     5.000000000e-01f,  4.938642309e-01f,  4.877293857e-01f,  4.815963885e-01f,  4.754661628e-01f,  4.693396318e-01f,
+     4.632177182e-01f,  4.571013438e-01f,  4.509914298e-01f,  4.448888964e-01f,  4.387946624e-01f,  4.327096457e-01f,
+     4.266347628e-01f,  4.205709283e-01f,  4.145190556e-01f,  4.084800560e-01f,  4.024548390e-01f,  3.964443119e-01f,
+     3.904493799e-01f,  3.844709459e-01f,  3.785099100e-01f,  3.725671702e-01f,  3.666436213e-01f,  3.607401553e-01f,
+     3.548576614e-01f,  3.489970253e-01f,  3.431591298e-01f,  3.373448539e-01f,  3.315550733e-01f,  3.257906599e-01f,
+     3.200524817e-01f,  3.143414030e-01f,  3.086582838e-01f,  3.030039800e-01f,  2.973793430e-01f,  2.917852200e-01f,
+     2.862224533e-01f,  2.806918807e-01f,  2.751943352e-01f,  2.697306445e-01f,  2.643016316e-01f,  2.589081140e-01f,
+     2.535509039e-01f,  2.482308081e-01f,  2.429486279e-01f,  2.377051587e-01f,  2.325011901e-01f,  2.273375058e-01f,
+     2.222148835e-01f,  2.171340946e-01f,  2.120959043e-01f,  2.071010713e-01f,  2.021503478e-01f,  1.972444793e-01f,
+     1.923842047e-01f,  1.875702559e-01f,  1.828033579e-01f,  1.780842286e-01f,  1.734135785e-01f,  1.687921112e-01f,
+     1.642205226e-01f,  1.596995011e-01f,  1.552297276e-01f,  1.508118753e-01f,  1.464466094e-01f,  1.421345874e-01f,
+     1.378764585e-01f,  1.336728642e-01f,  1.295244373e-01f,  1.254318027e-01f,  1.213955767e-01f,  1.174163672e-01f,
+     1.134947733e-01f,  1.096313857e-01f,  1.058267862e-01f,  1.020815477e-01f,  9.839623426e-02f,  9.477140087e-02f,
+     9.120759342e-02f,  8.770534861e-02f,  8.426519385e-02f,  8.088764722e-02f,  7.757321738e-02f,  7.432240345e-02f,
+     7.113569500e-02f,  6.801357194e-02f,  6.495650445e-02f,  6.196495290e-02f,  5.903936783e-02f,  5.618018980e-02f,
+     5.338784940e-02f,  5.066276715e-02f,  4.800535344e-02f,  4.541600845e-02f,  4.289512215e-02f,  4.044307415e-02f,
+     3.806023374e-02f,  3.574695976e-02f,  3.350360058e-02f,  3.133049404e-02f,  2.922796741e-02f,  2.719633731e-02f,
+     2.523590970e-02f,  2.334697982e-02f,  2.152983213e-02f,  1.978474029e-02f,  1.811196710e-02f,  1.651176448e-02f,
+     1.498437340e-02f,  1.353002390e-02f,  1.214893498e-02f,  1.084131464e-02f,  9.607359798e-03f,  8.447256284e-03f,
+     7.361178806e-03f,  6.349290921e-03f,  5.411745018e-03f,  4.548682286e-03f,  3.760232701e-03f,  3.046514999e-03f,
+     2.407636664e-03f,  1.843693909e-03f,  1.354771661e-03f,  9.409435499e-04f,  6.022718974e-04f,  3.388077058e-04f,
+     1.505906519e-04f,  3.764908043e-05f,
+};
+
+#endif // SPECTRAL_FFT_SIZE == 512
+
+#if SPECTRAL_FFT_SIZE == 1024
+
+#define SPECTRAL_TABLES_FFT_SIZE   1024
+#define SPECTRAL_WINDOW_POWER      3.840000000e+02f   // sum(w[n]^2)
+
+// W_N^k = e^{-j 2 pi k / N}, k = 0 .. N/2 - 1 (the N/2 complex FFT uses every other entry)
+static const float spectral_twiddle_re[512] = {
+     1.000000000e+00f,  9.999811753e-01f,  9.999247018e-01f,  9.998305818e-01f,  9.996988187e-01f,  9.995294175e-01f,
+     9.993223846e-01f,  9.990777278e-01f,  9.987954562e-01f,  9.984755806e-01f,  9.981181129e-01f,  9.977230666e-01f,
+     9.972904567e-01f,  9.968202993e-01f,  9.963126122e-01f,  9.957674145e-01f,  9.951847267e-01f,  9.945645707e-01f,
+     9.939069700e-01f,  9.932119492e-01f,  9.924795346e-01f,  9.917097537e-01f,  9.909026354e-01f,  9.900582103e-01f,
+     9.891765100e-01f,  9.882575677e-01f,  9.873014182e-01f,  9.863080972e-01f,  9.852776424e-01f,  9.842100924e-01f,
+     9.831054874e-01f,  9.819638691e-01f,  9.807852804e-01f,  9.795697657e-01f,  9.783173707e-01f,  9.770281427e-01f,
+     9.757021300e-01f,  9.743393828e-01f,  9.729399522e-01f,  9.715038910e-01f,  9.700312532e-01f,  9.685220943e-01f,
+     9.669764710e-01f,  9.653944417e-01f,  9.637760658e-01f,  9.621214043e-01f,  9.604305194e-01f,  9.587034749e-01f,
+     9.569403357e-01f,  9.551411683e-01f,  9.533060404e-01f,  9.514350210e-01f,  9.495281806e-01f,  9.475855910e-01f,
+     9.456073254e-01f,  9.435934582e-01f,  9.415440652e-01f,  9.394592236e-01f,  9.373390119e-01f,  9.351835099e-01f,
+     9.329927988e-01f,  9.307669611e-01f,  9.285060805e-01f,  9.262102421e-01f,  9.238795325e-01f,  9.215140393e-01f,
+     9.191138517e-01f,  9.166790599e-01f,  9.142097557e-01f,  9.117060320e-01f,  9.091679831e-01f,  9.065957045e-01f,
+     9.039892931e-01f,  9.013488470e-01f,  8.986744657e-01f,  8.959662498e-01f,  8.932243012e-01f,  8.904487232e-01f,
+     8.876396204e-01f,  8.847970984e-01f,  8.819212643e-01f,  8.790122264e-01f,  8.760700942e-01f,  8.730949784e-01f,
+     8.700869911e-01f,  8.670462455e-01f,  8.639728561e-01f,  8.608669386e-01f,  8.577286100e-01f,  8.545579884e-01f,
+     8.513551931e-01f,  8.481203448e-01f,  8.448535652e-01f,  8.415549774e-01f,  8.382247056e-01f,  8.348628750e-01f,
+     8.314696123e-01f,  8.280450453e-01f,  8.245893028e-01f,  8.211025150e-01f,  8.175848132e-01f,  8.140363297e-01f,
+     8.104571983e-01f,  8.068475535e-01f,  8.032075315e-01f,  7.995372691e-01f,  7.958369046e-01f,  7.921065773e-01f,
+     7.883464276e-01f,  7.845565972e-01f,  7.807372286e-01f,  7.768884657e-01f,  7.730104534e-01f,  7.691033376e-01f,
+     7.651672656e-01f,  7.612023855e-01f,  7.572088465e-01f,  7.531867990e-01f,  7.491363945e-01f,  7.450577854e-01f,
+     7.409511254e-01f,  7.368165689e-01f,  7.326542717e-01f,  7.284643904e-01f,  7.242470830e-01f,  7.200025080e-01f,
+     7.157308253e-01f,  7.114321957e-01f,  7.071067812e-01f,  7.027547445e-01f,  6.983762494e-01f,  6.939714609e-01f,
+     6.895405447e-01f,  6.850836678e-01f,  6.806009978e-01f,  6.760927036e-01f,  6.715589548e-01f,  6.669999223e-01f,
+     6.624157776e-01f,  6.578066933e-01f,  6.531728430e-01f,  6.485144010e-01f,  6.438315429e-01f,  6.391244449e-01f,
+     6.343932842e-01f,  6.296382389e-01f,  6.248594881e-01f,  6.200572118e-01f,  6.152315906e-01f,  6.103828063e-01f,
+     6.055110414e-01f,  6.006164794e-01f,  5.956993045e-01f,  5.907597019e-01f,  5.857978575e-01f,  5.808139581e-01f,
+     5.758081914e-01f,  5.707807459e-01f,  5.657318108e-01f,  5.606615762e-01f,  5.555702330e-01f,  5.504579729e-01f,
+     5.453249884e-01f,  5.401714727e-01f,  5.349976199e-01f,  5.298036247e-01f,  5.245896827e-01f,  5.193559902e-01f,
+     5.141027442e-01f,  5.088301425e-01f,  5.035383837e-01f,  4.982276670e-01f,  4.928981922e-01f,  4.875501601e-01f,
+     4.821837721e-01f,  4.767992301e-01f,  4.713967368e-01f,  4.659764958e-01f,  4.605387110e-01f,  4.550835871e-01f,
+     4.496113297e-01f,  4.441221446e-01f,  4.386162385e-01f,  4.330938189e-01f,  4.275550934e-01f,  4.220002708e-01f,
+     4.164295601e-01f,  4.108431711e-01f,  4.052413140e-01f,  3.996241998e-01f,  3.939920401e-01f,  3.883450467e-01f,
+     3.826834324e-01f,  3.770074102e-01f,  3.713171940e-01f,  3.656129978e-01f,  3.598950365e-01f,  3.541635254e-01f,
+     3.484186802e-01f,  3.426607173e-01f,  3.368898534e-01f,  3.311063058e-01f,  3.253102922e-01f,  3.195020308e-01f,
+     3.136817404e-01f,  3.078496400e-01f,  3.020059493e-01f,  2.961508882e-01f,  2.902846773e-01f,  2.844075372e-01f,
+     2.785196894e-01f,  2.726213554e-01f,  2.667127575e-01f,  2.607941179e-01f,  2.548656596e-01f,  2.489276057e-01f,
+     2.429801799e-01f,  2.370236060e-01f,  2.310581083e-01f,  2.250839114e-01f,  2.191012402e-01f,  2.131103199e-01f,
+     2.071113762e-01f,  2.011046348e-01f,  1.950903220e-01f,  1.890686641e-01f,  1.830398880e-01f,  1.770042204e-01f,
+     1.709618888e-01f,  1.649131205e-01f,  1.588581433e-01f,  1.527971853e-01f,  1.467304745e-01f,  1.406582393e-01f,
+     1.345807085e-01f,  1.284981108e-01f,  1.224106752e-01f,  1.163186309e-01f,  1.102222073e-01f,  1.041216339e-01f,
+     9.801714033e-02f,  9.190895650e-02f,  8.579731234e-02f,  7.968243797e-02f,  7.356456360e-02f,  6.744391956e-02f,
+     6.132073630e-02f,  5.519524435e-02f,  4.906767433e-02f,  4.293825693e-02f,  3.680722294e-02f,  3.067480318e-02f,
+     2.454122852e-02f,  1.840672991e-02f,  1.227153829e-02f,  6.135884649e-03f,  6.123233996e-17f, -6.135884649e-03f,
+    -1.227153829e-02f, -1.840672991e-02f, -2.454122852e-02f, -3.067480318e-02f, -3.680722294e-02f, -4.293825693e-02f,
+    -4.906767433e-02f, -5.519524435e-02f, -6.132073630e-02f, -6.744391956e-02f, -7.356456360e-02f, -7.968243797e-02f,
+    -8.579731234e-02f, -9.190895650e-02f, -9.801714033e-02f, -1.041216339e-01f, -1.102222073e-01f, -1.163186309e-01f,
+    -1.224106752e-01f, -1.284981108e-01f, -1.345807085e-01f, -1.406582393e-01f, -1.467304745e-01f, -1.527971853e-01f,
+    -1.588581433e-01f, -1.649131205e-01f, -1.709618888e-01f, -1.770042204e-01f, -1.830398880e-01f, -1.890686641e-01f,
+    -1.950903220e-01f, -2.011046348e-01f, -2.071113762e-01f, -2.131103199e-01f, -2.191012402e-01f, -2.250839114e-01f,
+    -2.310581083e-01f, -2.370236060e-01f, -2.429801799e-01f, -2.489276057e-01f, -2.548656596e-01f, -2.607941179e-01f,
+    -2.667127575e-01f, -2.726213554e-01f, -2.785196894e-01f, -2.844075372e-01f, -2.902846773e-01f, -2.961508882e-01f,
+    -3.020059493e-01f, -3.078496400e-01f, -3.136817404e-01f, -3.195020308e-01f, -3.253102922e-01f, -3.311063058e-01f,
+    -3.368898534e-01f, -3.426607173e-01f, -3.484186802e-01f, -3.541635254e-01f, -3.598950365e-01f, -3.656129978e-01f,
+    -3.713171940e-01f, -3.770074102e-01f, -3.826834324e-01f, -3.883450467e-01f, -3.939920401e-01f, -3.996241998e-01f,
+    -4.052413140e-01f, -4.108431711e-01f, -4.164295601e-01f, -4.220002708e-01f, -4.275550934e-01f, -4.330938189e-01f,
+    -4.386162385e-01f, -4.441221446e-01f, -4.496113297e-01f, -4.550835871e-01f, -4.605387110e-01f, -4.659764958e-01f,
+    -4.713967368e-01f, -4.767992301e-01f, -4.821837721e-01f, -4.875501601e-01f, -4.928981922e-01f, -4.982276670e-01f,
+    -5.035383837e-01f, -5.088301425e-01f, -5.141027442e-01f, -5.193559902e-01f, -5.245896827e-01f, -5.298036247e-01f,
+    -5.349976199e-01f, -5.401714727e-01f, -5.453249884e-01f, -5.504579729e-01f, -5.555702330e-01f, -5.606615762e-01f,
+    -5.657318108e-01f, -5.707807459e-01f, -5.758081914e-01f, -5.808139581e-01f, -5.857978575e-01f, -5.907597019e-01f,
+    -5.956993045e-01f, -6.006164794e-01f, -6.055110414e-01f, -6.103828063e-01f, -6.152315906e-01f, -6.200572118e-01f,
+    -6.248594881e-01f, -6.296382389e-01f, -6.343932842e-01f, -6.391244449e-01f, -6.438315429e-01f, -6.485144010e-01f,
+    -6.531728430e-01f, -6.578066933e-01f, -6.624157776e-01f, -6.669999223e-01f, -6.715589548e-01f, -6.760927036e-01f,
+    -6.806009978e-01f, -6.850836678e-01f, -6.895405447e-01f, -6.939714609e-01f, -6.983762494e-01f, -7.027547445e-01f,
+    -7.071067812e-01f, -7.114321957e-01f, -7.157308253e-01f, -7.200025080e-01f, -7.242470830e-01f, -7.284643904e-01f,
+    -7.326542717e-01f, -7.368165689e-01f, -7.409511254e-01f, -7.450577854e-01f, -7.491363945e-01f, -7.531867990e-01f,
+    -7.572088465e-01f, -7.612023855e-01f, -7.651672656e-01f, -7.691033376e-01f, -7.730104534e-01f, -7.768884657e-01f,
+    -7.807372286e-01f, -7.845565972e-01f, -7.883464276e-01f, -7.921065773e-01f, -7.958369046e-01f, -7.995372691e-01f,
+    -8.032075315e-01f, -8.068475535e-01f, -8.104571983e-01f, -8.140363297e-01f, -8.175848132e-01f, -8.211025150e-01f,
+    -8.245893028e-01f, -8.280450453e-01f, -8.314696123e-01f, -8.348628750e-01f, -8.382247056e-01f, -8.415549774e-01f,
+    -8.448535652e-01f, -8.481203448e-01f, -8.513551931e-01f, -8.545579884e-01f, -8.577286100e-01f, -8.608669386e-01f,
+    -8.639728561e-01f, -8.670462455e-01f, -8.700869911e-01f, -8.730949784e-01f, -8.760700942e-01f, -8.790122264e-01f,
+    -8.819212643e-01f, -8.847970984e-01f, -8.876396204e-01f, -8.904487232e-01f, -8.932243012e-01f, -8.959662498e-01f,
+    -8.986744657e-01f, -9.013488470e-01f, -9.039892931e-01f, -9.065957045e-01f, -9.091679831e-01f, -9.117060320e-01f,
+    -9.142097557e-01f, -9.166790599e-01f, -9.191138517e-01f, -9.215140393e-01f, -9.238795325e-01f, -9.262102421e-01f,
+    -9.285060805e-01f, -9.307669611e-01f, -9.329927988e-01f, -9.351835099e-01f, -9.373390119e-01f, -9.394592236e-01f,
+    -9.415440652e-01f, -9.435934582e-01f, -9.456073254e-01f, -9.475855910e-01f, -9.495281806e-01f, -9.514350210e-01f,
+    -9.533060404e-01f, -9.551411683e-01f, -9.569403357e-01f, -9.587034749e-01f, -9.604305194e-01f, -9.621214043e-01f,
+    -9.637760658e-01f, -9.653944417e-01f, -9.669764710e-01f, -9.685220943e-01f, -9.700312532e-01f, -9.715038910e-01f,
+    -9.729399522e-01f, -9.743393828e-01f, -9.757021300e-01f, -9.770281427e-01f, -9.783173707e-01f, -9.795697657e-01f,
+    -9.807852804e-01f, -9.819638691e-01f, -9.831054874e-01f, -9.842100924e-01f, -9.852776424e-01f, -9.863080972e-01f,
+    -9.873014182e-01f, -9.882575677e-01f, -9.891765100e-01f, -9.900582103e-01f, -9.909026354e-01f, -9.917097537e-01f,
+    -9.924795346e-01f, -9.932119492e-01f, -9.939069700e-01f, -9.945645707e-01f, -9.951847267e-01f, -9.957674145e-01f,
+    -9.963126122e-01f, -9.968202993e-01f, -9.972904567e-01f, -9.977230666e-01f, -9.981181129e-01f, -9.984755806e-01f,
+    -9.987954562e-01f, -9.990777278e-01f, -9.993223846e-01f, -9.995294175e-01f, -9.996988187e-01f, -9.998305818e-01f,
+    -9.999247018e-01f, -9.999811753e-01f,
+};
+
+static const float spectral_twiddle_im[512] = {
+    -0.000000000e+00f, -6.135884649e-03f, -1.227153829e-02f, -1.840672991e-02f, -2.454122852e-02f, -3.067480318e-02f,
+    -3.680722294e-02f, -4.293825693e-02f, -4.906767433e-02f, -5.519524435e-02f, -6.132073630e-02f, -6.744391956e-02f,
+    -7.356456360e-02f, -7.968243797e-02f, -8.579731234e-02f, -9.190895650e-02f, -9.801714033e-02f, -1.041216339e-01f,
+    -1.102222073e-01f, -1.163186309e-01f, -1.224106752e-01f, -1.284981108e-01f, -1.345807085e-01f, -1.406582393e-01f,
+    -1.467304745e-01f, -1.527971853e-01f, -1.588581433e-01f, -1.649131205e-01f, -1.709618888e-01f, -1.770042204e-01f,
+    -1.830398880e-01f, -1.890686641e-01f, -1.950903220e-01f, -2.011046348e-01f, -2.071113762e-01f, -2.131103199e-01f,
+    -2.191012402e-01f, -2.250839114e-01f, -2.310581083e-01f, -2.370236060e-01f, -2.429801799e-01f, -2.489276057e-01f,
+    -2.548656596e-01f, -2.607941179e-01f, -2.667127575e-01f, -2.726213554e-01f, -2.785196894e-01f, -2.844075372e-01f,
+    -2.902846773e-01f, -2.961508882e-01f, -3.020059493e-01f, -3.078496400e-01f, -3.136817404e-01f, -3.195020308e-01f,
+    -3.253102922e-01f, -3.311063058e-01f, -3.368898534e-01f, -3.426607173e-01f, -3.484186802e-01f, -3.541635254e-01f,
+    -3.598950365e-01f, -3.656129978e-01f, -3.713171940e-01f, -3.770074102e-01f, -3.826834324e-01f, -3.883450467e-01f,
+    -3.939920401e-01f, -3.996241998e-01f, -4.052413140e-01f, -4.108431711e-01f, -4.164295601e-01f, -4.220002708e-01f,
+    -4.275550934e-01f, -4.330938189e-01f, -4.386162385e-01f, -4.441221446e-01f, -4.496113297e-01f, -4.550835871e-01f,
+    -4.605387110e-01f, -4.659764958e-01f, -4.713967368e-01f, -4.767992301e-01f, -4.821837721e-01f, -4.875501601e-01f,
+    -4.928981922e-01f, -4.982276670e-01f, -5.035383837e-01f, -5.088301425e-01f, -5.141027442e-01f, -5.193559902e-01f,
+    -5.245896827e-01f, -5.298036247e-01f, -5.349976199e-01f, -5.401714727e-01f, -5.453249884e-01f, -5.504579729e-01f,
+    -5.555702330e-01f, -5.606615762e-01f, -5.657318108e-01f, -5.707807459e-01f, -5.758081914e-01f, -5.808139581e-01f,
+    -5.857978575e-01f, -5.907597019e-01f, -5.956993045e-01f, -6.006164794e-01f, -6.055110414e-01f, -6.103828063e-01f,
+    -6.152315906e-01f, -6.200572118e-01f, -6.248594881e-01f, -6.296382389e-01f, -6.343932842e-01f, -6.391244449e-01f,
+    -6.438315429e-01f, -6.485144010e-01f, -6.531728430e-01f, -6.578066933e-01f, -6.624157776e-01f, -6.669999223e-01f,
+    -6.715589548e-01f, -6.760927036e-01f, -6.806009978e-01f, -6.850836678e-01f, -6.895405447e-01f, -6.939714609e-01f,
+    -6.983762494e-01f, -7.027547445e-01f, -7.071067812e-01f, -7.114321957e-01f, -7.157308253e-01f, -7.200025080e-01f,
+    -7.242470830e-01f, -7.284643904e-01f, -7.326542717e-01f, -7.368165689e-01f, -7.409511254e-01f, -7.450577854e-01f,
+    -7.491363945e-01f, -7.531867990e-01f, -7.572088465e-01f, -7.612023855e-01f, -7.651672656e-01f, -7.691033376e-01f,
+    -7.730104534e-01f, -7.768884657e-01f, -7.807372286e-01f, -7.845565972e-01f, -7.883464276e-01f, -7.921065773e-01f,
+    -7.958369046e-01f, -7.995372691e-01f, -8.032075315e-01f, -8.068475535e-01f, -8.104571983e-01f, -8.140363297e-01f,
+    -8.175848132e-01f, -8.211025150e-01f, -8.245893028e-01f, -8.280450453e-01f, -8.314696123e-01f, -8.348628750e-01f,
+    -8.382247056e-01f, -8.415549774e-01f, -8.448535652e-01f, -8.481203448e-01f, -8.513551931e-01f, -8.545579884e-01f,
+    -8.577286100e-01f, -8.608669386e-01f, -8.639728561e-01f, -8.670462455e-01f, -8.700869911e-01f, -8.730949784e-01f,
+    -8.760700942e-01f, -8.790122264e-01f, -8.819212643e-01f, -8.847970984e-01f, -8.876396204e-01f, -8.904487232e-01f,
+    -8.932243012e-01f, -8.959662498e-01f, -8.986744657e-01f, -9.013488470e-01f, -9.039892931e-01f, -9.065957045e-01f,
+    -9.091679831e-01f, -9.117060320e-01f, -9.142097557e-01f, -9.166790599e-01f, -9.191138517e-01f, -9.215140393e-01f,
+    -9.238795325e-01f, -9.262102421e-01f, -9.285060805e-01f, -9.307669611e-01f, -9.329927988e-01f, -9.351835099e-01f,
+    -9.373390119e-01f, -9.394592236e-01f, -9.415440652e-01f, -9.435934582e-01f, -9.456073254e-01f, -9.475855910e-01f,
+    -9.495281806e-01f, -9.514350210e-01f, -9.533060404e-01f, -9.551411683e-01f, -9.569403357e-01f, -9.587034749e-01f,
+    -9.604305194e-01f, -9.621214043e-01f, -9.637760658e-01f, -9.653944417e-01f, -9.669764710e-01f, -9.685220943e-01f,
+    -9.700312532e-01f, -9.715038910e-01f, -9.729399522e-01f, -9.743393828e-01f, -9.757021300e-01f, -9.770281427e-01f,
+    -9.783173707e-01f, -9.795697657e-01f, -9.807852804e-01f, -9.819638691e-01f, -9.831054874e-01f, -9.842100924e-01f,
+    -9.852776424e-01f, -9.863080972e-01f, -9.873014182e-01f, -9.882575677e-01f, -9.891765100e-01f, -9.900582103e-01f,
+    -9.909026354e-01f, -9.917097537e-01f, -9.924795346e-01f, -9.932119492e-01f, -9.939069700e-01f, -9.945645707e-01f,
+    -9.951847267e-01f, -9.957674145e-01f, -9.963126122e-01f, -9.968202993e-01f, -9.972904567e-01f, -9.977230666e-01f,
+    -9.981181129e-01f, -9.984755806e-01f, -9.987954562e-01f, -9.990777278e-01f, -9.993223846e-01f, -9.995294175e-01f,
+    -9.996988187e-01f, -9.998305818e-01f, -9.999247018e-01f, -9.999811753e-01f, -1.000000000e+00f, -9.999811753e-01f,
+    -9.999247018e-01f, -9.998305818e-01f, -9.996988187e-01f, -9.995294175e-01f, -9.993223846e-01f, -9.990777278e-01f,
+    -9.987954562e-01f, -9.984755806e-01f, -9.981181129e-01f, -9.977230666e-01f, -9.972904567e-01f, -9.968202993e-01f,
+    -9.963126122e-01f, -9.957674145e-01f, -9.951847267e-01f, -9.945645707e-01f, -9.939069700e-01f, -9.932119492e-01f,
+    -9.924795346e-01f, -9.917097537e-01f, -9.909026354e-01f, -9.900582103e-01f, -9.891765100e-01f, -9.882575677e-01f,
+    -9.873014182e-01f, -9.863080972e-01f, -9.852776424e-01f, -9.842100924e-01f, -9.831054874e-01f, -9.819638691e-01f,
+    -9.807852804e-01f, -9.795697657e-01f, -9.783173707e-01f, -9.770281427e-01f, -9.757021300e-01f, -9.743393828e-01f,
+    -9.729399522e-01f, -9.715038910e-01f, -9.700312532e-01f, -9.685220943e-01f, -9.669764710e-01f, -9.653944417e-01f,
+    -9.637760658e-01f, -9.621214043e-01f, -9.604305194e-01f, -9.587034749e-01f, -9.569403357e-01f, -9.551411683e-01f,
+    -9.533060404e-01f, -9.514350210e-01f, -9.495281806e-01f, -9.475855910e-01f, -9.456073254e-01f, -9.435934582e-01f,
+    -9.415440652e-01f, -9.394592236e-01f, -9.373390119e-01f, -9.351835099e-01f, -9.329927988e-01f, -9.307669611e-01f,
+    -9.285060805e-01f, -9.262102421e-01f, -9.238795325e-01f, -9.215140393e-01f, -9.191138517e-01f, -9.166790599e-01f,
+    -9.142097557e-01f, -9.117060320e-01f, -9.091679831e-01f, -9.065957045e-01f, -9.039892931e-01f, -9.013488470e-01f,
+    -8.986744657e-01f, -8.959662498e-01f, -8.932243012e-01f, -8.904487232e-01f, -8.876396204e-01f, -8.847970984e-01f,
+    -8.819212643e-01f, -8.790122264e-01f, -8.760700942e-01f, -8.730949784e-01f, -8.700869911e-01f, -8.670462455e-01f,
+    -8.639728561e-01f, -8.608669386e-01f, -8.577286100e-01f, -8.545579884e-01f, -8.513551931e-01f, -8.481203448e-01f,
+    -8.448535652e-01f, -8.415549774e-01f, -8.382247056e-01f, -8.348628750e-01f, -8.314696123e-01f, -8.280450453e-01f,
+    -8.245893028e-01f, -8.211025150e-01f, -8.175848132e-01f, -8.140363297e-01f, -8.104571983e-01f, -8.068475535e-01f,
+    -8.032075315e-01f, -7.995372691e-01f, -7.958369046e-01f, -7.921065773e-01f, -7.883464276e-01f, -7.845565972e-01f,
+    -7.807372286e-01f, -7.768884657e-01f, -7.730104534e-01f, -7.691033376e-01f, -7.651672656e-01f, -7.612023855e-01f,
+    -7.572088465e-01f, -7.531867990e-01f, -7.491363945e-01f, -7.450577854e-01f, -7.409511254e-01f, -7.368165689e-01f,
+    -7.326542717e-01f, -7.284643904e-01f, -7.242470830e-01f, -7.200025080e-01f, -7.157308253e-01f, -7.114321957e-01f,
+    -7.071067812e-01f, -7.027547445e-01f, -6.983762494e-01f, -6.939714609e-01f, -6.895405447e-01f, -6.850836678e-01f,
+    -6.806009978e-01f, -6.760927036e-01f, -6.715589548e-01f, -6.669999223e-01f, -6.624157776e-01f, -6.578066933e-01f,
+    -6.531728430e-01f, -6.485144010e-01f, -6.438315429e-01f, -6.391244449e-01f, -6.343932842e-01f, -6.296382389e-01f,
+    -6.248594881e-01f, -6.200572118e-01f, -6.152315906e-01f, -6.103828063e-01f, -6.055110414e-01f, -6.006164794e-01f,
+    -5.956993045e-01f, -5.907597019e-01f, -5.857978575e-01f, -5.808139581e-01f, -5.758081914e-01f, -5.707807459e-01f,
+    -5.657318108e-01f, -5.606615762e-01f, -5.555702330e-01f, -5.504579729e-01f, -5.453249884e-01f, -5.401714727e-01f,
+    -5.349976199e-01f, -5.298036247e-01f, -5.245896827e-01f, -5.193559902e-01f, -5.141027442e-01f, -5.088301425e-01f,
+    -5.035383837e-01f, -4.982276670e-01f, -4.928981922e-01f, -4.875501601e-01f, -4.821837721e-01f, -4.767992301e-01f,
+    -4.713967368e-01f, -4.659764958e-01f, -4.605387110e-01f, -4.550835871e-01f, -4.496113297e-01f, -4.441221446e-01f,
+    -4.386162385e-01f, -4.330938189e-01f, -4.275550934e-01f, -4.220002708e-01f, -4.164295601e-01f, -4.108431711e-01f,
+    -4.052413140e-01f, -3.996241998e-01f, -3.939920401e-01f, -3.883450467e-01f, -3.826834324e-01f, -3.770074102e-01f,
+    -3.713171940e-01f, -3.656129978e-01f, -3.598950365e-01f, -3.541635254e-01f, -3.484186802e-01f, -3.426607173e-01f,
+    -3.368898534e-01f, -3.311063058e-01f, -3.253102922e-01f, -3.195020308e-01f, -3.136817404e-01f, -3.078496400e-01f,
+    -3.020059493e-01f, -2.961508882e-01f, -2.902846773e-01f, -2.844075372e-01f, -2.785196894e-01f, -2.726213554e-01f,
+    -2.667127575e-01f, -2.607941179e-01f, -2.548656596e-01f, -2.489276057e-01f, -2.429801799e-01f, -2.370236060e-01f,
+    -2.310581083e-01f, -2.250839114e-01f, -2.191012402e-01f, -2.131103199e-01f, -2.071113762e-01f, -2.011046348e-01f,
+    -1.950903220e-01f, -1.890686641e-01f, -1.830398880e-01f, -1.770042204e-01f, -1.709618888e-01f, -1.649131205e-01f,
+    -1.588581433e-01f, -1.527971853e-01f, -1.467304745e-01f, -1.406582393e-01f, -1.345807085e-01f, -1.284981108e-01f,
+    -1.224106752e-01f, -1.163186309e-01f, -1.102222073e-01f, -1.041216339e-01f, -9.801714033e-02f, -9.190895650e-02f,
+    -8.579731234e-02f, -7.968243797e-02f, -7.356456360e-02f, -6.744391956e-02f, -6.132073630e-02f, -5.519524435e-02f,
+    -4.906767433e-02f, -4.293825693e-02f, -3.680722294e-02f, -3.067480318e-02f, -2.454122852e-02f, -1.840672991e-02f,
+    -1.227153829e-02f, -6.135884649e-03f,
+};
+
+// Bit-reversed index for the N/2-point complex FFT
+static const uint16_t spectral_bitrev[512] = {
+       0,  256,  128,  384,   64,  320,  192,  448,   32,  288,  160,  416,   96,  352,  224,  480,
+      16,  272,  144,  400,   80,  336,  208,  464,   48,  304,  176,  432,  112,  368,  240,  496,
+       8,  264,  136,  392,   72,  328,  200,  456,   40,  296,  168,  424,  104,  360,  232,  488,
+      24,  280,  152,  408,   88,  344,  216,  472,   56,  312,  184,  440,  120,  376,  248,  504,
+       4,  260,  132,  388,   68,  324,  196,  452,   36,  292,  164,  420,  100,  356,  228,  484,
+      20,  276,  148,  404,   84,  340,  212,  468,   52,  308,  180,  436,  116,  372,  244,  500,
+      12,  268,  140,  396,   76,  332,  204,  460,   44,  300,  172,  428,  108,  364,  236,  492,
+      28,  284,  156,  412,   92,  348,  220,  476,   60,  316,  188,  444,  124,  380,  252,  508,
+       2,  258,  130,  386,   66,  322,  194,  450,   34,  290,  162,  418,   98,  354,  226,  482,
+      18,  274,  146,  402,   82,  338,  210,  466,   50,  306,  178,  434,  114,  370,  242,  498,
+      10,  266,  138,  394,   74,  330,  202,  458,   42,  298,  170,  426,  106,  362,  234,  490,
+      26,  282,  154,  410,   90,  346,  218,  474,   58,  314,  186,  442,  122,  378,  250,  506,
+       6,  262,  134,  390,   70,  326,  198,  454,   38,  294,  166,  422,  102,  358,  230,  486,
+      22,  278,  150,  406,   86,  342,  214,  470,   54,  310,  182,  438,  118,  374,  246,  502,
+      14,  270,  142,  398,   78,  334,  206,  462,   46,  302,  174,  430,  110,  366,  238,  494,
+      30,  286,  158,  414,   94,  350,  222,  478,   62,  318,  190,  446,  126,  382,  254,  510,
+       1,  257,  129,  385,   65,  321,  193,  449,   33,  289,  161,  417,   97,  353,  225,  481,
+      17,  273,  145,  401,   81,  337,  209,  465,   49,  305,  177,  433,  113,  369,  241,  497,
+       9,  265,  137,  393,   73,  329,  201,  457,   41,  297,  169,  425,  105,  361,  233,  489,
+      25,  281,  153,  409,   89,  345,  217,  473,   57,  313,  185,  441,  121,  377,  249,  505,
+       5,  261,  133,  389,   69,  325,  197,  453,   37,  293,  165,  421,  101,  357,  229,  485,
+      21,  277,  149,  405,   85,  341,  213,  469,   53,  309,  181,  437,  117,  373,  245,  501,
+      13,  269,  141,  397,   77,  333,  205,  461,   45,  301,  173,  429,  109,  365,  237,  493,
+      29,  285,  157,  413,   93,  349,  221,  477,   61,  317,  189,  445,  125,  381,  253,  509,
+       3,  259,  131,  387,   67,  323,  195,  451,   35,  291,  163,  419,   99,  355,  227,  483,
+      19,  275,  147,  403,   83,  339,  211,  467,   51,  307,  179,  435,  115,  371,  243,  499,
+      11,  267,  139,  395,   75,  331,  203,  459,   43,  299,  171,  427,  107,  363,  235,  491,
+      27,  283,  155,  411,   91,  347,  219,  475,   59,  315,  187,  443,  123,  379,  251,  507,
+       7,  263,  135,  391,   71,  327,  199,  455,   39,  295,  167,  423,  103,  359,  231,  487,
+      23,  279,  151,  407,   87,  343,  215,  471,   55,  311,  183,  439,  119,  375,  247,  503,
+      15,  271,  143,  399,   79,  335,  207,  463,   47,  303,  175,  431,  111,  367,  239,  495,
+      31,  287,  159,  415,   95,  351,  223,  479,   63,  319,  191,  447,  127,  383,  255,  511,
+};
+
+// Periodic Hann window
+static const float spectral_window[1024] = {
+     0.000000000e+00f,  9.412358699e-06f,  3.764908043e-05f,  8.470910209e-05f,  1.505906519e-04f,  2.352912495e-04f,
+     3.388077058e-04f,  4.611361237e-04f,  6.022718974e-04f,  7.622097134e-04f,  9.409435499e-04f,  1.138466678e-03f,
+     1.354771661e-03f,  1.589850354e-03f,  1.843693909e-03f,  2.116292766e-03f,  2.407636664e-03f,  2.717714633e-03f,
+     3.046514999e-03f,  3.394025383e-03f,  3.760232701e-03f,  4.145123165e-03f,  4.548682286e-03f,  4.970894869e-03f,
+     5.411745018e-03f,  5.871216135e-03f,  6.349290921e-03f,  6.845951378e-03f,  7.361178806e-03f,  7.894953807e-03f,
+     8.447256284e-03f,  9.018065445e-03f,  9.607359798e-03f,  1.021511716e-02f,  1.084131464e-02f,  1.148592867e-02f,
+     1.214893498e-02f,  1.283030861e-02f,  1.353002390e-02f,  1.424805451e-02f,  1.498437340e-02f,  1.573895286e-02f,
+     1.651176448e-02f,  1.730277915e-02f,  1.811196710e-02f,  1.893929787e-02f,  1.978474029e-02f,  2.064826255e-02f,
+     2.152983213e-02f,  2.242941585e-02f,  2.334697982e-02f,  2.428248952e-02f,  2.523590970e-02f,  2.620720449e-02f,
+     2.719633731e-02f,  2.820327092e-02f,  2.922796741e-02f,  3.027038820e-02f,  3.133049404e-02f,  3.240824503e-02f,
+     3.350360058e-02f,  3.461651946e-02f,  3.574695976e-02f,  3.689487893e-02f,  3.806023374e-02f,  3.924298033e-02f,
+     4.044307415e-02f,  4.166047004e-02f,  4.289512215e-02f,  4.414698400e-02f,  4.541600845e-02f,  4.670214774e-02f,
+     4.800535344e-02f,  4.932557648e-02f,  5.066276715e-02f,  5.201687512e-02f,  5.338784940e-02f,  5.477563838e-02f,
+     5.618018980e-02f,  5.760145078e-02f,  5.903936783e-02f,  6.049388679e-02f,  6.196495290e-02f,  6.345251079e-02f,
+     6.495650445e-02f,  6.647687724e-02f,  6.801357194e-02f,  6.956653068e-02f,  7.113569500e-02f,  7.272100582e-02f,
+     7.432240345e-02f,  7.593982760e-02f,  7.757321738e-02f,  7.922251128e-02f,  8.088764722e-02f,  8.256856251e-02f,
+     8.426519385e-02f,  8.597747737e-02f,  8.770534861e-02f,  8.944874250e-02f,  9.120759342e-02f,  9.298183515e-02f,
+     9.477140087e-02f,  9.657622323e-02f,  9.839623426e-02f,  1.002313654e-01f,  1.020815477e-01f,  1.039467113e-01f,
+     1.058267862e-01f,  1.077217014e-01f,  1.096313857e-01f,  1.115557672e-01f,  1.134947733e-01f,  1.154483312e-01f,
+     1.174163672e-01f,  1.193988073e-01f,  1.213955767e-01f,  1.234066005e-01f,  1.254318027e-01f,  1.274711073e-01f,
+     1.295244373e-01f,  1.315917156e-01f,  1.336728642e-01f,  1.357678048e-01f,  1.378764585e-01f,  1.399987460e-01f,
+     1.421345874e-01f,  1.442839021e-01f,  1.464466094e-01f,  1.486226278e-01f,  1.508118753e-01f,  1.530142696e-01f,
+     1.552297276e-01f,  1.574581661e-01f,  1.596995011e-01f,  1.619536482e-01f,  1.642205226e-01f,  1.665000388e-01f,
+     1.687921112e-01f,  1.710966534e-01f,  1.734135785e-01f,  1.757427995e-01f,  1.780842286e-01f,  1.804377776e-01f,
+     1.828033579e-01f,  1.851808805e-01f,  1.875702559e-01f,  1.899713941e-01f,  1.923842047e-01f,  1.948085969e-01f,
+     1.972444793e-01f,  1.996917603e-01f,  2.021503478e-01f,  2.046201491e-01f,  2.071010713e-01f,  2.095930210e-01f,
+     2.120959043e-01f,  2.146096271e-01f,  2.171340946e-01f,  2.196692119e-01f,  2.222148835e-01f,  2.247710135e-01f,
+     2.273375058e-01f,  2.299142636e-01f,  2.325011901e-01f,  2.350981877e-01f,  2.377051587e-01f,  2.403220049e-01f,
+     2.429486279e-01f,  2.455849287e-01f,  2.482308081e-01f,  2.508861665e-01f,  2.535509039e-01f,  2.562249199e-01f,
+     2.589081140e-01f,  2.616003850e-01f,  2.643016316e-01f,  2.670117521e-01f,  2.697306445e-01f,  2.724582064e-01f,
+     2.751943352e-01f,  2.779389277e-01f,  2.806918807e-01f,  2.834530906e-01f,  2.862224533e-01f,  2.889998646e-01f,
+     2.917852200e-01f,  2.945784145e-01f,  2.973793430e-01f,  3.001879001e-01f,  3.030039800e-01f,  3.058274767e-01f,
+     3.086582838e-01f,  3.114962949e-01f,  3.143414030e-01f,  3.171935011e-01f,  3.200524817e-01f,  3.229182373e-01f,
+     3.257906599e-01f,  3.286696413e-01f,  3.315550733e-01f,  3.344468471e-01f,  3.373448539e-01f,  3.402489846e-01f,
+     3.431591298e-01f,  3.460751800e-01f,  3.489970253e-01f,  3.519245559e-01f,  3.548576614e-01f,  3.577962314e-01f,
+     3.607401553e-01f,  3.636893223e-01f,  3.666436213e-01f,  3.696029410e-01f,  3.725671702e-01f,  3.755361971e-01f,
+     3.785099100e-01f,  3.814881970e-01f,  3.844709459e-01f,  3.874580443e-01f,  3.904493799e-01f,  3.934448400e-01f,
+     3.964443119e-01f,  3.994476826e-01f,  4.024548390e-01f,  4.054656679e-01f,  4.084800560e-01f,  4.114978898e-01f,
+     4.145190556e-01f,  4.175434398e-01f,  4.205709283e-01f,  4.236014074e-01f,  4.266347628e-01f,  4.296708803e-01f,
+     4.327096457e-01f,  4.357509446e-01f,  4.387946624e-01f,  4.418406845e-01f,  4.448888964e-01f,  4.479391831e-01f,
+     4.509914298e-01f,  4.540455218e-01f,  4.571013438e-01f,  4.601587810e-01f,  4.632177182e-01f,  4.662780402e-01f,
+     4.693396318e-01f,  4.724023778e-01f,  4.754661628e-01f,  4.785308715e-01f,  4.815963885e-01f,  4.846625984e-01f,
+     4.877293857e-01f,  4.907966350e-01f,  4.938642309e-01f,  4.969320577e-01f,  5.000000000e-01f,  5.030679423e-01f,
+     5.061357691e-01f,  5.092033650e-01f,  5.122706143e-01f,  5.153374016e-01f,  5.184036115e-01f,  5.214691285e-01f,
+     5.245338372e-01f,  5.275976222e-01f,  5.306603682e-01f,  5.337219598e-01f,  5.367822818e-01f,  5.398412190e-01f,
+     5.428986562e-01f,  5.459544782e-01f,  5.490085702e-01f,  5.520608169e-01f,  5.551111036e-01f,  5.581593155e-01f,
+     5.612053376e-01f,  5.642490554e-01f,  5.672903543e-01f,  5.703291197e-01f,  5.733652372e-01f,  5.763985926e-01f,
+     5.794290717e-01f,  5.824565602e-01f,  5.854809444e-01f,  5.885021102e-01f,  5.915199440e-01f,  5.945343321e-01f,
+     5.975451610e-01f,  6.005523174e-01f,  6.035556881e-01f,  6.065551600e-01f,  6.095506201e-01f,  6.125419557e-01f,
+     6.155290541e-01f,  6.185118030e-01f,  6.214900900e-01f,  6.244638029e-01f,  6.274328298e-01f,  6.303970590e-01f,
+     6.333563787e-01f,  6.363106777e-01f,  6.392598447e-01f,  6.422037686e-01f,  6.451423386e-01f,  6.480754441e-01f,
+     6.510029747e-01f,  6.539248200e-01f,  6.568408702e-01f,  6.597510154e-01f,  6.626551461e-01f,  6.655531529e-01f,
+     6.684449267e-01f,  6.713303587e-01f,  6.742093401e-01f,  6.770817627e-01f,  6.799475183e-01f,  6.828064989e-01f,
+     6.856585970e-01f,  6.885037051e-01f,  6.913417162e-01f,  6.941725233e-01f,  6.969960200e-01f,  6.998120999e-01f,
+     7.026206570e-01f,  7.054215855e-01f,  7.082147800e-01f,  7.110001354e-01f,  7.137775467e-01f,  7.165469094e-01f,
+     7.193081193e-01f,  7.220610723e-01f,  7.248056648e-01f,  7.275417936e-01f,  7.302693555e-01f,  7.329882479e-01f,
+     7.356983684e-01f,  7.383996150e-01f,  7.410918860e-01f,  7.437750801e-01f,  7.464490961e-01f,  7.491138335e-01f,
+     7.517691919e-01f,  7.544150713e-01f,  7.570513721e-01f,  7.596779951e-01f,  7.622948413e-01f,  7.649018123e-01f,
+     7.674988099e-01f,  7.700857364e-01f,  7.726624942e-01f,  7.752289865e-01f,  7.777851165e-01f,  7.803307881e-01f,
+     7.828659054e-01f,  7.853903729e-01f,  7.879040957e-01f,  7.904069790e-01f,  7.928989287e-01f,  7.953798509e-01f,
+     7.978496522e-01f,  8.003082397e-01f,  8.027555207e-01f,  8.051914031e-01f,  8.076157953e-01f,  8.100286059e-01f,
+     8.124297441e-01f,  8.148191195e-01f,  8.171966421e-01f,  8.195622224e-01f,  8.219157714e-01f,  8.242572005e-01f,
+     8.265864215e-01f,  8.289033466e-01f,  8.312078888e-01f,  8.334999612e-01f,  8.357794774e-01f,  8.380463518e-01f,
+     8.403004989e-01f,  8.425418339e-01f,  8.447702724e-01f,  8.469857304e-01f,  8.491881247e-01f,  8.513773722e-01f,
+     8.535533906e-01f,  8.557160979e-01f,  8.578654126e-01f,  8.600012540e-01f,  8.621235415e-01f,  8.642321952e-01f,
+     8.663271358e-01f,  8.684082844e-01f,  8.704755627e-01f,  8.725288927e-01f,  8.745681973e-01f,  8.765933995e-01f,
+     8.786044233e-01f,  8.806011927e-01f,  8.825836328e-01f,  8.845516688e-01f,  8.865052267e-01f,  8.884442328e-01f,
+     8.903686143e-01f,  8.922782986e-01f,  8.941732138e-01f,  8.960532887e-01f,  8.979184523e-01f,  8.997686346e-01f,
+     9.016037657e-01f,  9.034237768e-01f,  9.052285991e-01f,  9.070181649e-01f,  9.087924066e-01f,  9.105512575e-01f,
+     9.122946514e-01f,  9.140225226e-01f,  9.157348062e-01f,  9.174314375e-01f,  9.191123528e-01f,  9.207774887e-01f,
+     9.224267826e-01f,  9.240601724e-01f,  9.256775966e-01f,  9.272789942e-01f,  9.288643050e-01f,  9.304334693e-01f,
+     9.319864281e-01f,  9.335231228e-01f,  9.350434956e-01f,  9.365474892e-01f,  9.380350471e-01f,  9.395061132e-01f,
+     9.409606322e-01f,  9.423985492e-01f,  9.438198102e-01f,  9.452243616e-01f,  9.466121506e-01f,  9.479831249e-01f,
+     9.493372328e-01f,  9.506744235e-01f,  9.519946466e-01f,  9.532978523e-01f,  9.545839915e-01f,  9.558530160e-01f,
+     9.571048779e-01f,  9.583395300e-01f,  9.595569258e-01f,  9.607570197e-01f,  9.619397663e-01f,  9.631051211e-01f,
+     9.642530402e-01f,  9.653834805e-01f,  9.664963994e-01f,  9.675917550e-01f,  9.686695060e-01f,  9.697296118e-01f,
+     9.707720326e-01f,  9.717967291e-01f,  9.728036627e-01f,  9.737927955e-01f,  9.747640903e-01f,  9.757175105e-01f,
+     9.766530202e-01f,  9.775705842e-01f,  9.784701679e-01f,  9.793517374e-01f,  9.802152597e-01f,  9.810607021e-01f,
+     9.818880329e-01f,  9.826972208e-01f,  9.834882355e-01f,  9.842610471e-01f,  9.850156266e-01f,  9.857519455e-01f,
+     9.864699761e-01f,  9.871696914e-01f,  9.878510650e-01f,  9.885140713e-01f,  9.891586854e-01f,  9.897848828e-01f,
+     9.903926402e-01f,  9.909819346e-01f,  9.915527437e-01f,  9.921050462e-01f,  9.926388212e-01f,  9.931540486e-01f,
+     9.936507091e-01f,  9.941287839e-01f,  9.945882550e-01f,  9.950291051e-01f,  9.954513177e-01f,  9.958548768e-01f,
+     9.962397673e-01f,  9.966059746e-01f,  9.969534850e-01f,  9.972822854e-01f,  9.975923633e-01f,  9.978837072e-01f,
+     9.981563061e-01f,  9.984101496e-01f,  9.986452283e-01f,  9.988615333e-01f,  9.990590565e-01f,  9.992377903e-01f,
+     9.993977281e-01f,  9.995388639e-01f,  9.996611923e-01f,  9.997647088e-01f,  9.998494093e-01f,  9.999152909e-01f,
+     9.999623509e-01f,  9.999905876e-01f,  1.000000000e+00f,  9.999905876e-01f,  9.999623509e-01f,  9.999152909e-01f,
+     9.998494093e-01f,  9.997647088e-01f,  9.996611923e-01f,  9.995388639e-01f,  9.993977281e-01f,  9.992377903e-01f,
+     9.990590565e-01f,  9.988615333e-01f,  9.986452283e-01f,  9.984101496e-01f,  9.981563061e-01f,  9.978837072e-01f,
+     9.975923633e-01f,  9.972822854e-01f,  9.969534850e-01f,  9.966059746e-01f,  9.962397673e-01f,  9.958548768e-01f,
+     9.954513177e-01f,  9.950291051e-01f,  9.945882550e-01f,  9.941287839e-01f,  9.936507091e-01f,  9.931540486e-01f,
+     9.926388212e-01f,  9.921050462e-01f,  9.915527437e-01f,  9.909819346e-01f,  9.903926402e-01f,  9.897848828e-01f,
+     9.891586854e-01f,  9.885140713e-01f,  9.878510650e-01f,  9.871696914e-01f,  9.864699761e-01f,  9.857519455e-01f,
+     9.850156266e-01f,  9.842610471e-01f,  9.834882355e-01f,  9.826972208e-01f,  9.818880329e-01f,  9.810607021e-01f,
+     9.802152597e-01f,  9.793517374e-01f,  9.784701679e-01f,  9.775705842e-01f,  9.766530202e-01f,  9.757175105e-01f,
+     9.747640903e-01f,  9.737927955e-01f,  9.728036627e-01f,  9.717967291e-01f,  9.707720326e-01f,  9.697296118e-01f,
+     9.686695060e-01f,  9.675917550e-01f,  9.664963994e-01f,  9.653834805e-01f,  9.642530402e-01f,  9.631051211e-01f,
+     9.619397663e-01f,  9.607570197e-01f,  9.595569258e-01f,  9.583395300e-01f,  9.571048779e-01f,  9.558530160e-01f,
+     9.545839915e-01f,  9.532978523e-01f,  9.519946466e-01f,  9.506744235e-01f,  9.493372328e-01f,  9.479831249e-01f,
+     9.466121506e-01f,  9.452243616e-01f,  9.438198102e-01f,  9.423985492e-01f,  9.409606322e-01f,  9.395061132e-01f,
+     9.380350471e-01f,  9.365474892e-01f,  9.350434956e-01f,  9.335231228e-01f,  9.319864281e-01f,  9.304334693e-01f,
+     9.288643050e-01f,  9.272789942e-01f,  9.256775966e-01f,  9.240601724e-01f,  9.224267826e-01f,  9.207774887e-01f,
+     9.191123528e-01f,  9.174314375e-01f,  9.157348062e-01f,  9.140225226e-01f,  9.122946514e-01f,  9.105512575e-01f,
+     9.087924066e-01f,  9.070181649e-01f,  9.052285991e-01f,  9.034237768e-01f,  9.016037657e-01f,  8.997686346e-01f,
+     8.979184523e-01f,  8.960532887e-01f,  8.941732138e-01f,  8.922782986e-01f,  8.903686143e-01f,  8.884442328e-01f,
+     8.865052267e-01f,  8.845516688e-01f,  8.825836328e-01f,  8.806011927e-01f,  8.786044233e-01f,  8.765933995e-01f,
+     8.745681973e-01f,  8.725288927e-01f,  8.704755627e-01f,  8.684082844e-01f,  8.663271358e-01f,  8.642321952e-01f,
+     8.621235415e-01f,  8.600012540e-01f,  8.578654126e-01f,  8.557160979e-01f,  8.535533906e-01f,  8.513773722e-01f,
+     8.491881247e-01f,  8.469857304e-01f,  8.447702724e-01f,  8.425418339e-01f,  8.403004989e-01f,  8.380463518e-01f,
+     8.357794774e-01f,  8.334999612e-01f,  8.312078888e-01f,  8.289033466e-01f,  8.265864215e-01f,  8.242572005e-01f,
+     8.219157714e-01f,  8.195622224e-01f,  8.171966421e-01f,  8.148191195e-01f,  8.124297441e-01f,  8.100286059e-01f,
+     8.076157953e-01f,  8.051914031e-01f,  8.027555207e-01f,  8.003082397e-01f,  7.978496522e-01f,  7.953798509e-01f,
+     7.928989287e-01f,  7.904069790e-01f,  7.879040957e-01f,  7.853903729e-01f,  7.828659054e-01f,  7.803307881e-01f,
+     7.777851165e-01f,  7.752289865e-01f,  7.726624942e-01f,  7.700857364e-01f,  7.674988099e-01f,  7.649018123e-01f,
+     7.622948413e-01f,  7.596779951e-01f,  7.570513721e-01f,  7.544150713e-01f,  7.517691919e-01f,  7.491138335e-01f,
+     7.464490961e-01f,  7.437750801e-01f,  7.410918860e-01f,  7.383996150e-01f,  7.356983684e-01f,  7.329882479e-01f,
+     7.302693555e-01f,  7.275417936e-01f,  7.248056648e-01f,  7.220610723e-01f,  7.193081193e-01f,  7.165469094e-01f,
+     7.137775467e-01f,  7.110001354e-01f,  7.082147800e-01f,  7.054215855e-01f,  7.026206570e-01f,  6.998120999e-01f,
+     6.969960200e-01f,  6.941725233e-01f,  6.913417162e-01f,  6.885037051e-01f,  6.856585970e-01f,  6.828064989e-01f,
+     6.799475183e-01f,  6.770817627e-01f,  6.742093401e-01f,  6.713303587e-01f,  6.684449267e-01f,  6.655531529e-01f,
+     6.626551461e-01f,  6.597510154e-01f,  6.568408702e-01f,  6.539248200e-01f,  6.510029747e-01f,  6.480754441e-01f,
+     6.451423386e-01f,  6.422037686e-01f,  6.392598447e-01f,  6.363106777e-01f,  6.333563787e-01f,  6.303970590e-01f,
+     6.274328298e-01f,  6.244638029e-01f,  6.214900900e-01f,  6.185118030e-01f,  6.155290541e-01f,  6.125419557e-01f,
+     6.095506201e-01f,  6.065551600e-01f,  6.035556881e-01f,  6.005523174e-01f,  5.975451610e-01f,  5.945343321e-01f,
+     5.915199440e-01f,  5.885021102e-01f,  5.854809444e-01f,  5.824565602e-01f,  5.794290717e-01f,  5.763985926e-01f,
+     5.733652372e-01f,  5.703291197e-01f,  5.672903543e-01f,  5.642490554e-01f,  5.612053376e-01f,  5.581593155e-01f,
+     5.551111036e-01f,  5.520608169e-01f,  5.490085702e-01f,  5.459544782e-01f,  5.428986562e-01f,  5.398412190e-01f,
+     5.367822818e-01f,  5.337219598e-01f,  5.306603682e-01f,  5.275976222e-01f,  5.245338372e-01f,  5.214691285e-01f,
+     5.184036115e-01f,  5.153374016e-01f,  5.122706143e-01f,  5.092033650e-01f,  5.061357691e-01f,  5.030679423e-01f,
+     5.000000000e-01f,  4.969320577e-01f,  4.938642309e-01f,  4.907966350e-01f,  4.877293857e-01f,  4.846625984e-01f,
+     4.815963885e-01f,  4.785308715e-01f,  4.754661628e-01f,  4.724023778e-01f,  4.693396318e-01f,  4.662780402e-01f,
+     4.632177182e-01f,  4.601587810e-01f,  4.571013438e-01f,  4.540455218e-01f,  4.509914298e-01f,  4.479391831e-01f,
+     4.448888964e-01f,  4.418406845e-01f,  4.387946624e-01f,  4.357509446e-01f,  4.327096457e-01f,  4.296708803e-01f,
+     4.266347628e-01f,  4.236014074e-01f,  4.205709283e-01f,  4.175434398e-01f,  4.145190556e-01f,  4.114978898e-01f,
+     4.084800560e-01f,  4.054656679e-01f,  4.024548390e-01f,  3.994476826e-01f,  3.964443119e-01f,  3.934448400e-01f,
+     3.904493799e-01f,  3.874580443e-01f,  3.844709459e-01f,  3.814881970e-01f,  3.785099100e-01f,  3.755361971e-01f,
+     3.725671702e-01f,  3.696029410e-01f,  3.666436213e-01f,  3.636893223e-01f,  3.607401553e-01f,  3.577962314e-01f,
+     3.548576614e-01f,  3.519245559e-01f,  3.489970253e-01f,  3.460751800e-01f,  3.431591298e-01f,  3.402489846e-01f,
+     3.373448539e-01f,  3.344468471e-01f,  3.315550733e-01f,  3.286696413e-01f,  3.257906599e-01f,  3.229182373e-01f,
+     3.200524817e-01f,  3.171935011e-01f,  3.143414030e-01f,  3.114962949e-01f,  3.086582838e-01f,  3.058274767e-01f,
+     3.030039800e-01f,  3.001879001e-01f,  2.973793430e-01f,  2.945784145e-01f,  2.917852200e-01f,  2.889998646e-01f,
+     2.862224533e-01f,  2.834530906e-01f,  2.806918807e-01f,  2.779389277e-01f,  2.751943352e-01f,  2.724582064e-01f,
+     2.697306445e-01f,  2.670117521e-01f,  2.643016316e-01f,  2.616003850e-01f,  2.589081140e-01f,  2.562249199e-01f,
+     2.535509039e-01f,  2.508861665e-01f,  2.482308081e-01f,  2.455849287e-01f,  2.429486279e-01f,  2.403220049e-01f,
+     2.377051587e-01f,  2.350981877e-01f,  2.325011901e-01f,  2.299142636e-01f,  2.273375058e-01f,  2.247710135e-01f,
+     2.222148835e-01f,  2.196692119e-01f,  2.171340946e-01f,  2.146096271e-01f,  2.120959043e-01f,  2.095930210e-01f,
+     2.071010713e-01f,  2.046201491e-01f,  2.021503478e-01f,  1.996917603e-01f,  1.972444793e-01f,  1.948085969e-01f,
+     1.923842047e-01f,  1.899713941e-01f,  1.875702559e-01f,  1.851808805e-01f,  1.828033579e-01f,  1.804377776e-01f,
+     1.780842286e-01f,  1.757427995e-01f,  1.734135785e-01f,  1.710966534e-01f,  1.687921112e-01f,  1.665000388e-01f,
+     1.642205226e-01f,  1.619536482e-01f,  1.596995011e-01f,  1.574581661e-01f,  1.552297276e-01f,  1.530142696e-01f,
+     1.508118753e-01f,  1.486226278e-01f,  1.464466094e-01f,  1.442839021e-01f,  1.421345874e-01f,  1.399987460e-01f,
+     1.378764585e-01f,  1.357678048e-01f,  1.336728642e-01f,  1.315917156e-01f,  1.295244373e-01f,  1.274711073e-01f,
+     1.254318027e-01f,  1.234066005e-01f,  1.213955767e-01f,  1.193988073e-01f,  1.174163672e-01f,  1.154483312e-01f,
+     1.134947733e-01f,  1.115557672e-01f,  1.096313857e-01f,  1.077217014e-01f,  1.058267862e-01f,  1.039467113e-01f,
+     1.020815477e-01f,  1.002313654e-01f,  9.839623426e-02f,  9.657622323e-02f,  9.477140087e-02f,  9.298183515e-02f,
+     9.120759342e-02f,  8.944874250e-02f,  8.770534861e-02f,  8.597747737e-02f,  8.426519385e-02f,  8.256856251e-02f,
+     8.088764722e-02f,  7.922251128e-02f,  7.757321738e-02f,  7.593982760e-02f,  7.432240345e-02f,  7.272100582e-02f,
+     7.113569500e-02f,  6.956653068e-02f,  6.801357194e-02f,  6.647687724e-02f,  6.495650445e-02f,  6.345251079e-02f,
+     6.196495290e-02f,  6.049388679e-02f,  5.903936783e-02f,  5.760145078e-02f,  5.618018980e-02f,  5.477563838e-02f,
+     5.338784940e-02f,  5.201687512e-02f,  5.066276715e-02f,  4.932557648e-02f,  4.800535344e-02f,  4.670214774e-02f,
+     4.541600845e-02f,  4.414698400e-02f,  4.289512215e-02f,  4.166047004e-02f,  4.044307415e-02f,  3.924298033e-02f,
+     3.806023374e-02f,  3.689487893e-02f,  3.574695976e-02f,  3.461651946e-02f,  3.350360058e-02f,  3.240824503e-02f,
+     3.133049404e-02f,  3.027038820e-02f,  2.922796741e-02f,  2.820327092e-02f,  2.719633731e-02f,  2.620720449e-02f,
+     2.523590970e-02f,  2.428248952e-02f,  2.334697982e-02f,  2.242941585e-02f,  2.152983213e-02f,  2.064826255e-02f,
+     1.978474029e-02f,  1.893929787e-02f,  1.811196710e-02f,  1.730277915e-02f,  1.651176448e-02f,  1.573895286e-02f,
+     1.498437340e-02f,  1.424805451e-02f,  1.353002390e-02f,  1.283030861e-02f,  1.214893498e-02f,  1.148592867e-02f,
+     1.084131464e-02f,  1.021511716e-02f,  9.607359798e-03f,  9.018065445e-03f,  8.447256284e-03f,  7.894953807e-03f,
+     7.361178806e-03f,  6.845951378e-03f,  6.349290921e-03f,  5.871216135e-03f,  5.411745018e-03f,  4.970894869e-03f,
+     4.548682286e-03f,  4.145123165e-03f,  3.760232701e-03f,  3.394025383e-03f,  3.046514999e-03f,  2.717714633e-03f,
+     2.407636664e-03f,  2.116292766e-03f,  1.843693909e-03f,  1.589850354e-03f,  1.354771661e-03f,  1.138466678e-03f,
+     9.409435499e-04f,  7.622097134e-04f,  6.022718974e-04f,  4.611361237e-04f,  3.388077058e-04f,  2.352912495e-04f,
+     1.505906519e-04f,  8.470910209e-05f,  3.764908043e-05f,  9.412358699e-06f,
+};
+
+#endif // SPECTRAL_FFT_SIZE == 1024
+
+#if SPECTRAL_FFT_SIZE == 2048
+
+#define SPECTRAL_TABLES_FFT_SIZE   2048
+#define SPECTRAL_WINDOW_POWER      7.680000000e+02f   // sum(w[n]^2)
+
+// W_N^k = e^{-j 2 pi k / N}, k = 0 .. N/2 - 1 (the N/2 complex FFT uses every other entry)
+static const float spectral_twiddle_re[1024] = {
+     1.000000000e+00f,  9.999952938e-01f,  9.999811753e-01f,  9.999576446e-01f,  9.999247018e-01f,  9.998823475e-01f,
+     9.998305818e-01f,  9.997694054e-01f,  9.996988187e-01f,  9.996188225e-01f,  9.995294175e-01f,  9.994306046e-01f,
+     9.993223846e-01f,  9.992047586e-01f,  9.990777278e-01f,  9.989412932e-01f,  9.987954562e-01f,  9.986402182e-01f,
+     9.984755806e-01f,  9.983015449e-01f,  9.981181129e-01f,  9.979252862e-01f,  9.977230666e-01f,  9.975114561e-01f,
+     9.972904567e-01f,  9.970600703e-01f,  9.968202993e-01f,  9.965711458e-01f,  9.963126122e-01f,  9.960447009e-01f,
+     9.957674145e-01f,  9.954807555e-01f,  9.951847267e-01f,  9.948793308e-01f,  9.945645707e-01f,  9.942404495e-01f,
+     9.939069700e-01f,  9.935641355e-01f,  9.932119492e-01f,  9.928504145e-01f,  9.924795346e-01f,  9.920993131e-01f,
+     9.917097537e-01f,  9.913108598e-01f,  9.909026354e-01f,  9.904850843e-01f,  9.900582103e-01f,  9.896220175e-01f,
+     9.891765100e-01f,  9.887216920e-01f,  9.882575677e-01f,  9.877841416e-01f,  9.873014182e-01f,  9.868094018e-01f,
+     9.863080972e-01f,  9.857975092e-01f,  9.852776424e-01f,  9.847485018e-01f,  9.842100924e-01f,  9.836624192e-01f,
+     9.831054874e-01f,  9.825393023e-01f,  9.819638691e-01f,  9.813791933e-01f,  9.807852804e-01f,  9.801821360e-01f,
+     9.795697657e-01f,  9.789481753e-01f,  9.783173707e-01f,  9.776773578e-01f,  9.770281427e-01f,  9.763697313e-01f,
+     9.757021300e-01f,  9.750253451e-01f,  9.743393828e-01f,  9.736442497e-01f,  9.729399522e-01f,  9.722264971e-01f,
+     9.715038910e-01f,  9.707721407e-01f,  9.700312532e-01f,  9.692812354e-01f,  9.685220943e-01f,  9.677538371e-01f,
+     9.669764710e-01f,  9.661900034e-01f,  9.653944417e-01f,  9.645897933e-01f,  9.637760658e-01f,  9.629532669e-01f,
+     9.621214043e-01f,  9.612804858e-01f,  9.604305194e-01f,  9.595715131e-01f,  9.587034749e-01f,  9.578264130e-01f,
+     9.569403357e-01f,  9.560452513e-01f,  9.551411683e-01f,  9.542280951e-01f,  9.533060404e-01f,  9.523750127e-01f,
+     9.514350210e-01f,  9.504860739e-01f,  9.495281806e-01f,  9.485613499e-01f,  9.475855910e-01f,  9.466009131e-01f,
+     9.456073254e-01f,  9.446048373e-01f,  9.435934582e-01f,  9.425731976e-01f,  9.415440652e-01f,  9.405060706e-01f,
+     9.394592236e-01f,  9.384035341e-01f,  9.373390119e-01f,  9.362656672e-01f,  9.351835099e-01f,  9.340925504e-01f,
+     9.329927988e-01f,  9.318842656e-01f,  9.307669611e-01f,  9.296408958e-01f,  9.285060805e-01f,  9.273625257e-01f,
+     9.262102421e-01f,  9.250492408e-01f,  9.238795325e-01f,  9.227011283e-01f,  9.215140393e-01f,  9.203182767e-01f,
+     9.191138517e-01f,  9.179007756e-01f,  9.166790599e-01f,  9.154487161e-01f,  9.142097557e-01f,  9.129621904e-01f,
+     9.117060320e-01f,  9.104412923e-01f,  9.091679831e-01f,  9.078861165e-01f,  9.065957045e-01f,  9.052967593e-01f,
+     9.039892931e-01f,  9.026733182e-01f,  9.013488470e-01f,  9.000158920e-01f,  8.986744657e-01f,  8.973245807e-01f,
+     8.959662498e-01f,  8.945994856e-01f,  8.932243012e-01f,  8.918407094e-01f,  8.904487232e-01f,  8.890483559e-01f,
+     8.876396204e-01f,  8.862225301e-01f,  8.847970984e-01f,  8.833633387e-01f,  8.819212643e-01f,  8.804708891e-01f,
+     8.790122264e-01f,  8.775452902e-01f,  8.760700942e-01f,  8.745866523e-01f,  8.730949784e-01f,  8.715950867e-01f,
+     8.700869911e-01f,  8.685707060e-01f,  8.670462455e-01f,  8.655136241e-01f,  8.639728561e-01f,  8.624239561e-01f,
+     8.608669386e-01f,  8.593018184e-01f,  8.577286100e-01f,  8.561473284e-01f,  8.545579884e-01f,  8.529606049e-01f,
+     8.513551931e-01f,  8.497417680e-01f,  8.481203448e-01f,  8.464909388e-01f,  8.448535652e-01f,  8.432082396e-01f,
+     8.415549774e-01f,  8.398937942e-01f,  8.382247056e-01f,  8.365477272e-01f,  8.348628750e-01f,  8.331701647e-01f,
+     8.314696123e-01f,  8.297612338e-01f,  8.280450453e-01f,  8.263210628e-01f,  8.245893028e-01f,  8.228497814e-01f,
+     8.211025150e-01f,  8.193475201e-01f,  8.175848132e-01f,  8.158144108e-01f,  8.140363297e-01f,  8.122505866e-01f,
+     8.104571983e-01f,  8.086561816e-01f,  8.068475535e-01f,  8.050313311e-01f,  8.032075315e-01f,  8.013761717e-01f,
+     7.995372691e-01f,  7.976908409e-01f,  7.958369046e-01f,  7.939754776e-01f,  7.921065773e-01f,  7.902302214e-01f,
+     7.883464276e-01f,  7.864552136e-01f,  7.845565972e-01f,  7.826505962e-01f,  7.807372286e-01f,  7.788165124e-01f,
+     7.768884657e-01f,  7.749531066e-01f,  7.730104534e-01f,  7.710605243e-01f,  7.691033376e-01f,  7.671389119e-01f,
+     7.651672656e-01f,  7.631884173e-01f,  7.612023855e-01f,  7.592091890e-01f,  7.572088465e-01f,  7.552013769e-01f,
+     7.531867990e-01f,  7.511651319e-01f,  7.491363945e-01f,  7.471006060e-01f,  7.450577854e-01f,  7.430079521e-01f,
+     7.409511254e-01f,  7.388873245e-01f,  7.368165689e-01f,  7.347388781e-01f,  7.326542717e-01f,  7.305627692e-01f,
+     7.284643904e-01f,  7.263591551e-01f,  7.242470830e-01f,  7.221281939e-01f,  7.200025080e-01f,  7.178700451e-01f,
+     7.157308253e-01f,  7.135848688e-01f,  7.114321957e-01f,  7.092728264e-01f,  7.071067812e-01f,  7.049340804e-01f,
+     7.027547445e-01f,  7.005687939e-01f,  6.983762494e-01f,  6.961771315e-01f,  6.939714609e-01f,  6.917592584e-01f,
+     6.895405447e-01f,  6.873153409e-01f,  6.850836678e-01f,  6.828455464e-01f,  6.806009978e-01f,  6.783500431e-01f,
+     6.760927036e-01f,  6.738290004e-01f,  6.715589548e-01f,  6.692825883e-01f,  6.669999223e-01f,  6.647109782e-01f,
+     6.624157776e-01f,  6.601143421e-01f,  6.578066933e-01f,  6.554928530e-01f,  6.531728430e-01f,  6.508466850e-01f,
+     6.485144010e-01f,  6.461760130e-01f,  6.438315429e-01f,  6.414810128e-01f,  6.391244449e-01f,  6.367618612e-01f,
+     6.343932842e-01f,  6.320187359e-01f,  6.296382389e-01f,  6.272518155e-01f,  6.248594881e-01f,  6.224612794e-01f,
+     6.200572118e-01f,  6.176473079e-01f,  6.152315906e-01f,  6.128100824e-01f,  6.103828063e-01f,  6.079497850e-01f,
+     6.055110414e-01f,  6.030665985e-01f,  6.006164794e-01f,  5.981607070e-01f,  5.956993045e-01f,  5.932322950e-01f,
+     5.907597019e-01f,  5.882815482e-01f,  5.857978575e-01f,  5.833086529e-01f,  5.808139581e-01f,  5.783137964e-01f,
+     5.758081914e-01f,  5.732971667e-01f,  5.707807459e-01f,  5.682589527e-01f,  5.657318108e-01f,  5.631993440e-01f,
+     5.606615762e-01f,  5.581185312e-01f,  5.555702330e-01f,  5.530167056e-01f,  5.504579729e-01f,  5.478940592e-01f,
+     5.453249884e-01f,  5.427507849e-01f,  5.401714727e-01f,  5.375870763e-01f,  5.349976199e-01f,  5.324031279e-01f,
+     5.298036247e-01f,  5.271991348e-01f,  5.245896827e-01f,  5.219752929e-01f,  5.193559902e-01f,  5.167317990e-01f,
+     5.141027442e-01f,  5.114688504e-01f,  5.088301425e-01f,  5.061866453e-01f,  5.035383837e-01f,  5.008853826e-01f,
+     4.982276670e-01f,  4.955652618e-01f,  4.928981922e-01f,  4.902264833e-01f,  4.875501601e-01f,  4.848692480e-01f,
+     4.821837721e-01f,  4.794937577e-01f,  4.767992301e-01f,  4.741002147e-01f,  4.713967368e-01f,  4.686888220e-01f,
+     4.659764958e-01f,  4.632597836e-01f,  4.605387110e-01f,  4.578133036e-01f,  4.550835871e-01f,  4.523495872e-01f,
+     4.496113297e-01f,  4.468688402e-01f,  4.441221446e-01f,  4.413712687e-01f,  4.386162385e-01f,  4.358570799e-01f,
+     4.330938189e-01f,  4.303264813e-01f,  4.275550934e-01f,  4.247796812e-01f,  4.220002708e-01f,  4.192168884e-01f,
+     4.164295601e-01f,  4.136383122e-01f,  4.108431711e-01f,  4.080441629e-01f,  4.052413140e-01f,  4.024346509e-01f,
+     3.996241998e-01f,  3.968099874e-01f,  3.939920401e-01f,  3.911703843e-01f,  3.883450467e-01f,  3.855160538e-01f,
+     3.826834324e-01f,  3.798472089e-01f,  3.770074102e-01f,  3.741640630e-01f,  3.713171940e-01f,  3.684668300e-01f,
+     3.656129978e-01f,  3.627557244e-01f,  3.598950365e-01f,  3.570309612e-01f,  3.541635254e-01f,  3.512927561e-01f,
+     3.484186802e-01f,  3.455413250e-01f,  3.426607173e-01f,  3.397768844e-01f,  3.368898534e-01f,  3.339996514e-01f,
+     3.311063058e-01f,  3.282098436e-01f,  3.253102922e-01f,  3.224076788e-01f,  3.195020308e-01f,  3.165933756e-01f,
+     3.136817404e-01f,  3.107671527e-01f,  3.078496400e-01f,  3.049292297e-01f,  3.020059493e-01f,  2.990798263e-01f,
+     2.961508882e-01f,  2.932191627e-01f,  2.902846773e-01f,  2.873474595e-01f,  2.844075372e-01f,  2.814649379e-01f,
+     2.785196894e-01f,  2.755718193e-01f,  2.726213554e-01f,  2.696683256e-01f,  2.667127575e-01f,  2.637546790e-01f,
+     2.607941179e-01f,  2.578311022e-01f,  2.548656596e-01f,  2.518978182e-01f,  2.489276057e-01f,  2.459550503e-01f,
+     2.429801799e-01f,  2.400030224e-01f,  2.370236060e-01f,  2.340419586e-01f,  2.310581083e-01f,  2.280720832e-01f,
+     2.250839114e-01f,  2.220936210e-01f,  2.191012402e-01f,  2.161067971e-01f,  2.131103199e-01f,  2.101118369e-01f,
+     2.071113762e-01f,  2.041089661e-01f,  2.011046348e-01f,  1.980984107e-01f,  1.950903220e-01f,  1.920803970e-01f,
+     1.890686641e-01f,  1.860551517e-01f,  1.830398880e-01f,  1.800229014e-01f,  1.770042204e-01f,  1.739838734e-01f,
+     1.709618888e-01f,  1.679382950e-01f,  1.649131205e-01f,  1.618863938e-01f,  1.588581433e-01f,  1.558283977e-01f,
+     1.527971853e-01f,  1.497645347e-01f,  1.467304745e-01f,  1.436950332e-01f,  1.406582393e-01f,  1.376201216e-01f,
+     1.345807085e-01f,  1.315400287e-01f,  1.284981108e-01f,  1.254549834e-01f,  1.224106752e-01f,  1.193652148e-01f,
+     1.163186309e-01f,  1.132709522e-01f,  1.102222073e-01f,  1.071724250e-01f,  1.041216339e-01f,  1.010698628e-01f,
+     9.801714033e-02f,  9.496349533e-02f,  9.190895650e-02f,  8.885355258e-02f,  8.579731234e-02f,  8.274026455e-02f,
+     7.968243797e-02f,  7.662386139e-02f,  7.356456360e-02f,  7.050457339e-02f,  6.744391956e-02f,  6.438263093e-02f,
+     6.132073630e-02f,  5.825826450e-02f,  5.519524435e-02f,  5.213170468e-02f,  4.906767433e-02f,  4.600318213e-02f,
+     4.293825693e-02f,  3.987292759e-02f,  3.680722294e-02f,  3.374117185e-02f,  3.067480318e-02f,  2.760814578e-02f,
+     2.454122852e-02f,  2.147408028e-02f,  1.840672991e-02f,  1.533920628e-02f,  1.227153829e-02f,  9.203754782e-03f,
+     6.135884649e-03f,  3.067956763e-03f,  6.123233996e-17f, -3.067956763e-03f, -6.135884649e-03f, -9.203754782e-03f,
+    -1.227153829e-02f, -1.533920628e-02f, -1.840672991e-02f, -2.147408028e-02f, -2.454122852e-02f, -2.760814578e-02f,
+    -3.067480318e-02f, -3.374117185e-02f, -3.680722294e-02f, -3.987292759e-02f, -4.293825693e-02f, -4.600318213e-02f,
+    -4.906767433e-02f, -5.213170468e-02f, -5.519524435e-02f, -5.825826450e-02f, -6.132073630e-02f, -6.438263093e-02f,
+    -6.744391956e-02f, -7.050457339e-02f, -7.356456360e-02f, -7.662386139e-02f, -7.968243797e-02f, -8.274026455e-02f,
+    -8.579731234e-02f, -8.885355258e-02f, -9.190895650e-02f, -9.496349533e-02f, -9.801714033e-02f, -1.010698628e-01f,
+    -1.041216339e-01f, -1.071724250e-01f, -1.102222073e-01f, -1.132709522e-01f, -1.163186309e-01f, -1.193652148e-01f,
+    -1.224106752e-01f, -1.254549834e-01f, -1.284981108e-01f, -1.315400287e-01f, -1.345807085e-01f, -1.376201216e-01f,
+    -1.406582393e-01f, -1.436950332e-01f, -1.467304745e-01f, -1.497645347e-01f, -1.527971853e-01f, -1.558283977e-01f,
+    -1.588581433e-01f, -1.618863938e-01f, -1.649131205e-01f, -1.679382950e-01f, -1.709618888e-01f, -1.739838734e-01f,
+    -1.770042204e-01f, -1.800229014e-01f, -1.830398880e-01f, -1.860551517e-01f, -1.890686641e-01f, -1.920803970e-01f,
+    -1.950903220e-01f, -1.980984107e-01f, -2.011046348e-01f, -2.041089661e-01f, -2.071113762e-01f, -2.101118369e-01f,
+    -2.131103199e-01f, -2.161067971e-01f, -2.191012402e-01f, -2.220936210e-01f, -2.250839114e-01f, -2.280720832e-01f,
+    -2.310581083e-01f, -2.340419586e-01f, -2.370236060e-01f, -2.400030224e-01f, -2.429801799e-01f, -2.459550503e-01f,
+    -2.489276057e-01f, -2.518978182e-01f, -2.548656596e-01f, -2.578311022e-01f, -2.607941179e-01f, -2.637546790e-01f,
+    -2.667127575e-01f, -2.696683256e-01f, -2.726213554e-01f, -2.755718193e-01f, -2.785196894e-01f, -2.814649379e-01f,
+    -2.844075372e-01f, -2.873474595e-01f, -2.902846773e-01f, -2.932191627e-01f, -2.961508882e-01f, -2.990798263e-01f,
+    -3.020059493e-01f, -3.049292297e-01f, -3.078496400e-01f, -3.107671527e-01f, -3.136817404e-01f, -3.165933756e-01f,
+    -3.195020308e-01f, -3.224076788e-01f, -3.253102922e-01f, -3.282098436e-01f, -3.311063058e-01f, -3.339996514e-01f,
+    -3.368898534e-01f, -3.397768844e-01f, -3.426607173e-01f, -3.455413250e-01f, -3.484186802e-01f, -3.512927561e-01f,
+    -3.541635254e-01f, -3.570309612e-01f, -3.598950365e-01f, -3.627557244e-01f, -3.656129978e-01f, -3.684668300e-01f,
+    -3.713171940e-01f, -3.741640630e-01f, -3.770074102e-01f, -3.798472089e-01f, -3.826834324e-01f, -3.855160538e-01f,
+    -3.883450467e-01f, -3.911703843e-01f, -3.939920401e-01f, -3.968099874e-01f, -3.996241998e-01f, -4.024346509e-01f,
+    -4.052413140e-01f, -4.080441629e-01f, -4.108431711e-01f, -4.136383122e-01f, -4.164295601e-01f, -4.192168884e-01f,
+    -4.220002708e-01f, -4.247796812e-01f, -4.275550934e-01f, -4.303264813e-01f, -4.330938189e-01f, -4.358570799e-01f,
+    -4.386162385e-01f, -4.413712687e-01f, -4.441221446e-01f, -4.468688402e-01f, -4.496113297e-01f, -4.523495872e-01f,
+    -4.550835871e-01f, -4.578133036e-01f, -4.605387110e-01f, -4.632597836e-01f, -4.659764958e-01f, -4.686888220e-01f,
+    -4.713967368e-01f, -4.741002147e-01f, -4.767992301e-01f, -4.794937577e-01f, -4.821837721e-01f, -4.848692480e-01f,
+    -4.875501601e-01f, -4.902264833e-01f, -4.928981922e-01f, -4.955652618e-01f, -4.982276670e-01f, -5.008853826e-01f,
+    -5.035383837e-01f, -5.061866453e-01f, -5.088301425e-01f, -5.114688504e-01f, -5.141027442e-01f, -5.167317990e-01f,
+    -5.193559902e-01f, -5.219752929e-01f, -5.245896827e-01f, -5.271991348e-01f, -5.298036247e-01f, -5.324031279e-01f,
+    -5.349976199e-01f, -5.375870763e-01f, -5.401714727e-01f, -5.427507849e-01f, -5.453249884e-01f, -5.478940592e-01f,
+    -5.504579729e-01f, -5.530167056e-01f, -5.555702330e-01f, -5.581185312e-01f, -5.606615762e-01f, -5.631993440e-01f,
+    -5.657318108e-01f, -5.682589527e-01f, -5.707807459e-01f, -5.732971667e-01f, -5.758081914e-01f, -5.783137964e-01f,
+    -5.808139581e-01f, -5.833086529e-01f, -5.857978575e-01f, -5.882815482e-01f, -5.907597019e-01f, -5.932322950e-01f,
+    -5.956993045e-01f, -5.981607070e-01f, -6.006164794e-01f, -6.030665985e-01f, -6.055110414e-01f, -6.079497850e-01f,
+    -6.103828063e-01f, -6.128100824e-01f, -6.152315906e-01f, -6.176473079e-01f, -6.200572118e-01f, -6.224612794e-01f,
+    -6.248594881e-01f, -6.272518155e-01f, -6.296382389e-01f, -6.320187359e-01f, -6.343932842e-01f, -6.367618612e-01f,
+    -6.391244449e-01f, -6.414810128e-01f, -6.438315429e-01f, -6.461760130e-01f, -6.485144010e-01f, -6.508466850e-01f,
+    -6.531728430e-01f, -6.554928530e-01f, -6.578066933e-01f, -6.601143421e-01f, -6.624157776e-01f, -6.647109782e-01f,
+    -6.669999223e-01f, -6.692825883e-01f, -6.715589548e-01f, -6.738290004e-01f, -6.760927036e-01f, -6.783500431e-01f,
+    -6.806009978e-01f, -6.828455464e-01f, -6.850836678e-01f, -6.873153409e-01f, -6.895405447e-01f, -6.917592584e-01f,
+    -6.939714609e-01f, -6.961771315e-01f, -6.983762494e-01f, -7.005687939e-01f, -7.027547445e-01f, -7.049340804e-01f,
+    -7.071067812e-01f, -7.092728264e-01f, -7.114321957e-01f, -7.135848688e-01f, -7.157308253e-01f, -7.178700451e-01f,
+    -7.200025080e-01f, -7.221281939e-01f, -7.242470830e-01f, -7.263591551e-01f, -7.284643904e-01f, -7.305627692e-01f,
+    -7.326542717e-01f, -7.347388781e-01f, -7.368165689e-01f, -7.388873245e-01f, -7.409511254e-01f, -7.430079521e-01f,
+    -7.450577854e-01f, -7.471006060e-01f, -7.491363945e-01f, -7.511651319e-01f, -7.531867990e-01f, -7.552013769e-01f,
+    -7.572088465e-01f, -7.592091890e-01f, -7.612023855e-01f, -7.631884173e-01f, -7.651672656e-01f, -7.671389119e-01f,
+    -7.691033376e-01f, -7.710605243e-01f, -7.730104534e-01f, -7.749531066e-01f, -7.768884657e-01f, -7.788165124e-01f,
+    -7.807372286e-01f, -7.826505962e-01f, -7.845565972e-01f, -7.864552136e-01f, -7.883464276e-01f, -7.902302214e-01f,
+    -7.921065773e-01f, -7.939754776e-01f, -7.958369046e-01f, -7.976908409e-01f, -7.995372691e-01f, -8.013761717e-01f,
+    -8.032075315e-01f, -8.050313311e-01f, -8.068475535e-01f, -8.086561816e-01f, -8.104571983e-01f, -8.122505866e-01f,
+    -8.140363297e-01f, -8.158144108e-01f, -8.175848132e-01f, -8.193475201e-01f, -8.211025150e-01f, -8.228497814e-01f,
+    -8.245893028e-01f, -8.263210628e-01f, -8.280450453e-01f, -8.297612338e-01f, -8.314696123e-01f, -8.331701647e-01f,
+    -8.348628750e-01f, -8.365477272e-01f, -8.382247056e-01f, -8.398937942e-01f, -8.415549774e-01f, -8.432082396e-01f,
+    -8.448535652e-01f, -8.464909388e-01f, -8.481203448e-01f, -8.497417680e-01f, -8.513551931e-01f, -8.529606049e-01f,
+    -8.545579884e-01f, -8.561473284e-01f, -8.577286100e-01f, -8.593018184e-01f, -8.608669386e-01f, -8.624239561e-01f,
+    -8.639728561e-01f, -8.655136241e-01f, -8.670462455e-01f, -8.685707060e-01f, -8.700869911e-01f, -8.715950867e-01f,
+    -8.730949784e-01f, -8.745866523e-01f, -8.760700942e-01f, -8.775452902e-01f, -8.790122264e-01f, -8.804708891e-01f,
+    -8.819212643e-01f, -8.833633387e-01f, -8.847970984e-01f, -8.862225301e-01f, -8.876396204e-01f, -8.890483559e-01f,
+    -8.904487232e-01f, -8.918407094e-01f, -8.932243012e-01f, -8.945994856e-01f, -8.959662498e-01f, -8.973245807e-01f,
+    -8.986744657e-01f, -9.000158920e-01f, -9.013488470e-01f, -9.026733182e-01f, -9.039892931e-01f, -9.052967593e-01f,
+    -9.065957045e-01f, -9.078861165e-01f, -9.091679831e-01f, -9.104412923e-01f, -9.117060320e-01f, -9.129621904e-01f,
+    -9.142097557e-01f, -9.154487161e-01f, -9.166790599e-01f, -9.179007756e-01f, -9.191138517e-01f, -9.203182767e-01f,
+    -9.215140393e-01f, -9.227011283e-01f, -9.238795325e-01f, -9.250492408e-01f, -9.262102421e-01f, -9.273625257e-01f,
+    -9.285060805e-01f, -9.296408958e-01f, -9.307669611e-01f, -9.318842656e-01f, -9.329927988e-01f, -9.340925504e-01f,
+    -9.351835099e-01f, -9.362656672e-01f, -9.373390119e-01f, -9.384035341e-01f, -9.394592236e-01f, -9.405060706e-01f,
+    -9.415440652e-01f, -9.425731976e-01f, -9.435934582e-01f, -9.446048373e-01f, -9.456073254e-01f, -9.466009131e-01f,
+    -9.475855910e-01f, -9.485613499e-01f, -9.495281806e-01f, -9.504860739e-01f, -9.514350210e-01f, -9.523750127e-01f,
+    -9.533060404e-01f, -9.542280951e-01f, -9.551411683e-01f, -9.560452513e-01f, -9.569403357e-01f, -9.578264130e-01f,
+    -9.587034749e-01f, -9.595715131e-01f, -9.604305194e-01f, -9.612804858e-01f, -9.621214043e-01f, -9.629532669e-01f,
+    -9.637760658e-01f, -9.645897933e-01f, -9.653944417e-01f, -9.661900034e-01f, -9.669764710e-01f, -9.677538371e-01f,
+    -9.685220943e-01f, -9.692812354e-01f, -9.700312532e-01f, -9.707721407e-01f, -9.715038910e-01f, -9.722264971e-01f,
+    -9.729399522e-01f, -9.736442497e-01f, -9.743393828e-01f, -9.750253451e-01f, -9.757021300e-01f, -9.763697313e-01f,
+    -9.770281427e-01f, -9.776773578e-01f, -9.783173707e-01f, -9.789481753e-01f, -9.795697657e-01f, -9.801821360e-01f,
+    -9.807852804e-01f, -9.813791933e-01f, -9.819638691e-01f, -9.825393023e-01f, -9.831054874e-01f, -9.836624192e-01f,
+    -9.842100924e-01f, -9.847485018e-01f, -9.852776424e-01f, -9.857975092e-01f, -9.863080972e-01f, -9.868094018e-01f,
+    -9.873014182e-01f, -9.877841416e-01f, -9.882575677e-01f, -9.887216920e-01f, -9.891765100e-01f, -9.896220175e-01f,
+    -9.900582103e-01f, -9.904850843e-01f, -9.909026354e-01f, -9.913108598e-01f, -9.917097537e-01f, -9.920993131e-01f,
+    -9.924795346e-01f, -9.928504145e-01f, -9.932119492e-01f, -9.935641355e-01f, -9.939069700e-01f, -9.942404495e-01f,
+    -9.945645707e-01f, -9.948793308e-01f, -9.951847267e-01f, -9.954807555e-01f, -9.957674145e-01f, -9.960447009e-01f,
+    -9.963126122e-01f, -9.965711458e-01f, -9.968202993e-01f, -9.970600703e-01f, -9.972904567e-01f, -9.975114561e-01f,
+    -9.977230666e-01f, -9.979252862e-01f, -9.981181129e-01f, -9.983015449e-01f, -9.984755806e-01f, -9.986402182e-01f,
+    -9.987954562e-01f, -9.989412932e-01f, -9.990777278e-01f, -9.992047586e-01f, -9.993223846e-01f, -9.994306046e-01f,
+    -9.995294175e-01f, -9.996188225e-01f, -9.996988187e-01f, -9.997694054e-01f, -9.998305818e-01f, -9.998823475e-01f,
+    -9.999247018e-01f, -9.999576446e-01f, -9.999811753e-01f, -9.999952938e-01f,
+};
+
+static const float spectral_twiddle_im[1024] = {
+    -0.000000000e+00f, -3.067956763e-03f, -6.135884649e-03f, -9.203754782e-03f, -1.227153829e-02f, -1.533920628e-02f,
+    -1.840672991e-02f, -2.147408028e-02f, -2.454122852e-02f, -2.760814578e-02f, -3.067480318e-02f, -3.374117185e-02f,
+    -3.680722294e-02f, -3.987292759e-02f, -4.293825693e-02f, -4.600318213e-02f, -4.906767433e-02f, -5.213170468e-02f,
+    -5.519524435e-02f, -5.825826450e-02f, -6.132073630e-02f, -6.438263093e-02f, -6.744391956e-02f, -7.050457339e-02f,
+    -7.356456360e-02f, -7.662386139e-02f, -7.968243797e-02f, -8.274026455e-02f, -8.579731234e-02f, -8.885355258e-02f,
+    -9.190895650e-02f, -9.496349533e-02f, -9.801714033e-02f, -1.010698628e-01f, -1.041216339e-01f, -1.071724250e-01f,
+    -1.102222073e-01f, -1.132709522e-01f, -1.163186309e-01f, -1.193652148e-01f, -1.224106752e-01f, -1.254549834e-01f,
+    -1.284981108e-01f, -1.315400287e-01f, -1.345807085e-01f, -1.376201216e-01f, -1.406582393e-01f, -1.436950332e-01f,
+    -1.467304745e-01f, -1.497645347e-01f, -1.527971853e-01f, -1.558283977e-01f, -1.588581433e-01f, -1.618863938e-01f,
+    -1.649131205e-01f, -1.679382950e-01f, -1.709618888e-01f, -1.739838734e-01f, -1.770042204e-01f, -1.800229014e-01f,
+    -1.830398880e-01f, -1.860551517e-01f, -1.890686641e-01f, -1.920803970e-01f, -1.950903220e-01f, -1.980984107e-01f,
+    -2.011046348e-01f, -2.041089661e-01f, -2.071113762e-01f, -2.101118369e-01f, -2.131103199e-01f, -2.161067971e-01f,
+    -2.191012402e-01f, -2.220936210e-01f, -2.250839114e-01f, -2.280720832e-01f, -2.310581083e-01f, -2.340419586e-01f,
+    -2.370236060e-01f, -2.400030224e-01f, -2.429801799e-01f, -2.459550503e-01f, -2.489276057e-01f, -2.518978182e-01f,
+    -2.548656596e-01f, -2.578311022e-01f, -2.607941179e-01f, -2.637546790e-01f, -2.667127575e-01f, -2.696683256e-01f,
+    -2.726213554e-01f, -2.755718193e-01f, -2.785196894e-01f, -2.814649379e-01f, -2.844075372e-01f, -2.873474595e-01f,
+    -2.902846773e-01f, -2.932191627e-01f, -2.961508882e-01f, -2.990798263e-01f, -3.020059493e-01f, -3.049292297e-01f,
+    -3.078496400e-01f, -3.107671527e-01f, -3.136817404e-01f, -3.165933756e-01f, -3.195020308e-01f, -3.224076788e-01f,
+    -3.253102922e-01f, -3.282098436e-01f, -3.311063058e-01f, -3.339996514e-01f, -3.368898534e-01f, -3.397768844e-01f,
+    -3.426607173e-01f, -3.455413250e-01f, -3.484186802e-01f, -3.512927561e-01f, -3.541635254e-01f, -3.570309612e-01f,
+    -3.598950365e-01f, -3.627557244e-01f, -3.656129978e-01f, -3.684668300e-01f, -3.713171940e-01f, -3.741640630e-01f,
+    -3.770074102e-01f, -3.798472089e-01f, -3.826834324e-01f, -3.855160538e-01f, -3.883450467e-01f, -3.911703843e-01f,
+    -3.939920401e-01f, -3.968099874e-01f, -3.996241998e-01f, -4.024346509e-01f, -4.052413140e-01f, -4.080441629e-01f,
+    -4.108431711e-01f, -4.136383122e-01f, -4.164295601e-01f, -4.192168884e-01f, -4.220002708e-01f, -4.247796812e-01f,
+    -4.275550934e-01f, -4.303264813e-01f, -4.330938189e-01f, -4.358570799e-01f, -4.386162385e-01f, -4.413712687e-01f,
+    -4.441221446e-01f, -4.468688402e-01f, -4.496113297e-01f, -4.523495872e-01f, -4.550835871e-01f, -4.578133036e-01f,
+    -4.605387110e-01f, -4.632597836e-01f, -4.659764958e-01f, -4.686888220e-01f, -4.713967368e-01f, -4.741002147e-01f,
+    -4.767992301e-01f, -4.794937577e-01f, -4.821837721e-01f, -4.848692480e-01f, -4.875501601e-01f, -4.902264833e-01f,
+    -4.928981922e-01f, -4.955652618e-01f, -4.982276670e-01f, -5.008853826e-01f, -5.035383837e-01f, -5.061866453e-01f,
+    -5.088301425e-01f, -5.114688504e-01f, -5.141027442e-01f, -5.167317990e-01f, -5.193559902e-01f, -5.219752929e-01f,
+    -5.245896827e-01f, -5.271991348e-01f, -5.298036247e-01f, -5.324031279e-01f, -5.349976199e-01f, -5.375870763e-01f,
+    -5.401714727e-01f, -5.427507849e-01f, -5.453249884e-01f, -5.478940592e-01f, -5.504579729e-01f, -5.530167056e-01f,
+    -5.555702330e-01f, -5.581185312e-01f, -5.606615762e-01f, -5.631993440e-01f, -5.657318108e-01f, -5.682589527e-01f,
+    -5.707807459e-01f, -5.732971667e-01f, -5.758081914e-01f, -5.783137964e-01f, -5.808139581e-01f, -5.833086529e-01f,
+    -5.857978575e-01f, -5.882815482e-01f, -5.907597019e-01f, -5.932322950e-01f, -5.956993045e-01f, -5.981607070e-01f,
+    -6.006164794e-01f, -6.030665985e-01f, -6.055110414e-01f, -6.079497850e-01f, -6.103828063e-01f, -6.128100824e-01f,
+    -6.152315906e-01f, -6.176473079e-01f, -6.200572118e-01f, -6.224612794e-01f, -6.248594881e-01f, -6.272518155e-01f,
+    -6.296382389e-01f, -6.320187359e-01f, -6.343932842e-01f, -6.367618612e-01f, -6.391244449e-01f, -6.414810128e-01f,
+    -6.438315429e-01f, -6.461760130e-01f, -6.485144010e-01f, -6.508466850e-01f, -6.531728430e-01f, -6.554928530e-01f,
+    -6.578066933e-01f, -6.601143421e-01f, -6.624157776e-01f, -6.647109782e-01f, -6.669999223e-01f, -6.692825883e-01f,
+    -6.715589548e-01f, -6.738290004e-01f, -6.760927036e-01f, -6.783500431e-01f, -6.806009978e-01f, -6.828455464e-01f,
+    -6.850836678e-01f, -6.873153409e-01f, -6.895405447e-01f, -6.917592584e-01f, -6.939714609e-01f, -6.961771315e-01f,
+    -6.983762494e-01f, -7.005687939e-01f, -7.027547445e-01f, -7.049340804e-01f, -7.071067812e-01f, -7.092728264e-01f,
+    -7.114321957e-01f, -7.135848688e-01f, -7.157308253e-01f, -7.178700451e-01f, -7.200025080e-01f, -7.221281939e-01f,
+    -7.242470830e-01f, -7.263591551e-01f, -7.284643904e-01f, -7.305627692e-01f, -7.326542717e-01f, -7.347388781e-01f,
+    -7.368165689e-01f, -7.388873245e-01f, -7.409511254e-01f, -7.430079521e-01f, -7.450577854e-01f, -7.471006060e-01f,
+    -7.491363945e-01f, -7.511651319e-01f, -7.531867990e-01f, -7.552013769e-01f, -7.572088465e-01f, -7.592091890e-01f,
+    -7.612023855e-01f, -7.631884173e-01f, -7.651672656e-01f, -7.671389119e-01f, -7.691033376e-01f, -7.710605243e-01f,
+    -7.730104534e-01f, -7.749531066e-01f, -7.768884657e-01f, -7.788165124e-01f, -7.807372286e-01f, -7.826505962e-01f,
+    -7.845565972e-01f, -7.864552136e-01f, -7.883464276e-01f, -7.902302214e-01f, -7.921065773e-01f, -7.939754776e-01f,
+    -7.958369046e-01f, -7.976908409e-01f, -7.995372691e-01f, -8.013761717e-01f, -8.032075315e-01f, -8.050313311e-01f,
+    -8.068475535e-01f, -8.086561816e-01f, -8.104571983e-01f, -8.122505866e-01f, -8.140363297e-01f, -8.158144108e-01f,
+    -8.175848132e-01f, -8.193475201e-01f, -8.211025150e-01f, -8.228497814e-01f, -8.245893028e-01f, -8.263210628e-01f,
+    -8.280450453e-01f, -8.297612338e-01f, -8.314696123e-01f, -8.331701647e-01f, -8.348628750e-01f, -8.365477272e-01f,
+    -8.382247056e-01f, -8.398937942e-01f, -8.415549774e-01f, -8.432082396e-01f, -8.448535652e-01f, -8.464909388e-01f,
+    -8.481203448e-01f, -8.497417680e-01f, -8.513551931e-01f, -8.529606049e-01f, -8.545579884e-01f, -8.561473284e-01f,
+    -8.577286100e-01f, -8.593018184e-01f, -8.608669386e-01f, -8.624239561e-01f, -8.639728561e-01f, -8.655136241e-01f,
+    -8.670462455e-01f, -8.685707060e-01f, -8.700869911e-01f, -8.715950867e-01f, -8.730949784e-01f, -8.745866523e-01f,
+    -8.760700942e-01f, -8.775452902e-01f, -8.790122264e-01f, -8.804708891e-01f, -8.819212643e-01f, -8.833633387e-01f,
+    -8.847970984e-01f, -8.862225301e-01f, -8.876396204e-01f, -8.890483559e-01f, -8.904487232e-01f, -8.918407094e-01f,
+    -8.932243012e-01f, -8.945994856e-01f, -8.959662498e-01f, -8.973245807e-01f, -8.986744657e-01f, -9.000158920e-01f,
+    -9.013488470e-01f, -9.026733182e-01f, -9.039892931e-01f, -9.052967593e-01f, -9.065957045e-01f, -9.078861165e-01f,
+    -9.091679831e-01f, -9.104412923e-01f, -9.117060320e-01f, -9.129621904e-01f, -9.142097557e-01f, -9.154487161e-01f,
+    -9.166790599e-01f, -9.179007756e-01f, -9.191138517e-01f, -9.203182767e-01f, -9.215140393e-01f, -9.227011283e-01f,
+    -9.238795325e-01f, -9.250492408e-01f, -9.262102421e-01f, -9.273625257e-01f, -9.285060805e-01f, -9.296408958e-01f,
+    -9.307669611e-01f, -9.318842656e-01f, -9.329927988e-01f, -9.340925504e-01f, -9.351835099e-01f, -9.362656672e-01f,
+    -9.373390119e-01f, -9.384035341e-01f, -9.394592236e-01f, -9.405060706e-01f, -9.415440652e-01f, -9.425731976e-01f,
+    -9.435934582e-01f, -9.446048373e-01f, -9.456073254e-01f, -9.466009131e-01f, -9.475855910e-01f, -9.485613499e-01f,
+    -9.495281806e-01f, -9.504860739e-01f, -9.514350210e-01f, -9.523750127e-01f, -9.533060404e-01f, -9.542280951e-01f,
+    -9.551411683e-01f, -9.560452513e-01f, -9.569403357e-01f, -9.578264130e-01f, -9.587034749e-01f, -9.595715131e-01f,
+    -9.604305194e-01f, -9.612804858e-01f, -9.621214043e-01f, -9.629532669e-01f, -9.637760658e-01f, -9.645897933e-01f,
+    -9.653944417e-01f, -9.661900034e-01f, -9.669764710e-01f, -9.677538371e-01f, -9.685220943e-01f, -9.692812354e-01f,
+    -9.700312532e-01f, -9.707721407e-01f, -9.715038910e-01f, -9.722264971e-01f, -9.729399522e-01f, -9.736442497e-01f,
+    -9.743393828e-01f, -9.750253451e-01f, -9.757021300e-01f, -9.763697313e-01f, -9.770281427e-01f, -9.776773578e-01f,
+    -9.783173707e-01f, -9.789481753e-01f, -9.795697657e-01f, -9.801821360e-01f, -9.807852804e-01f, -9.813791933e-01f,
+    -9.819638691e-01f, -9.825393023e-01f, -9.831054874e-01f, -9.836624192e-01f, -9.842100924e-01f, -9.847485018e-01f,
+    -9.852776424e-01f, -9.857975092e-01f, -9.863080972e-01f, -9.868094018e-01f, -9.873014182e-01f, -9.877841416e-01f,
+    -9.882575677e-01f, -9.887216920e-01f, -9.891765100e-01f, -9.896220175e-01f, -9.900582103e-01f, -9.904850843e-01f,
+    -9.909026354e-01f, -9.913108598e-01f, -9.917097537e-01f, -9.920993131e-01f, -9.924795346e-01f, -9.928504145e-01f,
+    -9.932119492e-01f, -9.935641355e-01f, -9.939069700e-01f, -9.942404495e-01f, -9.945645707e-01f, -9.948793308e-01f,
+    -9.951847267e-01f, -9.954807555e-01f, -9.957674145e-01f, -9.960447009e-01f, -9.963126122e-01f, -9.965711458e-01f,
+    -9.968202993e-01f, -9.970600703e-01f, -9.972904567e-01f, -9.975114561e-01f, -9.977230666e-01f, -9.979252862e-01f,
+    -9.981181129e-01f, -9.983015449e-01f, -9.984755806e-01f, -9.986402182e-01f, -9.987954562e-01f, -9.989412932e-01f,
+    -9.990777278e-01f, -9.992047586e-01f, -9.993223846e-01f, -9.994306046e-01f, -9.995294175e-01f, -9.996188225e-01f,
+    -9.996988187e-01f, -9.997694054e-01f, -9.998305818e-01f, -9.998823475e-01f, -9.999247018e-01f, -9.999576446e-01f,
+    -9.999811753e-01f, -9.999952938e-01f, -1.000000000e+00f, -9.999952938e-01f, -9.999811753e-01f, -9.999576446e-01f,
+    -9.999247018e-01f, -9.998823475e-01f, -9.998305818e-01f, -9.997694054e-01f, -9.996988187e-01f, -9.996188225e-01f,
+    -9.995294175e-01f, -9.994306046e-01f, -9.993223846e-01f, -9.992047586e-01f, -9.990777278e-01f, -9.989412932e-01f,
+    -9.987954562e-01f, -9.986402182e-01f, -9.984755806e-01f, -9.983015449e-01f, -9.981181129e-01f, -9.979252862e-01f,
+    -9.977230666e-01f, -9.975114561e-01f, -9.972904567e-01f, -9.970600703e-01f, -9.968202993e-01f, -9.965711458e-01f,
+    -9.963126122e-01f, -9.960447009e-01f, -9.957674145e-01f, -9.954807555e-01f, -9.951847267e-01f, -9.948793308e-01f,
+    -9.945645707e-01f, -9.942404495e-01f, -9.939069700e-01f, -9.935641355e-01f, -9.932119492e-01f, -9.928504145e-01f,
+    -9.924795346e-01f, -9.920993131e-01f, -9.917097537e-01f, -9.913108598e-01f, -9.909026354e-01f, -9.904850843e-01f,
+    -9.900582103e-01f, -9.896220175e-01f, -9.891765100e-01f, -9.887216920e-01f, -9.882575677e-01f, -9.877841416e-01f,
+    -9.873014182e-01f, -9.868094018e-01f, -9.863080972e-01f, -9.857975092e-01f, -9.852776424e-01f, -9.847485018e-01f,
+    -9.842100924e-01f, -9.836624192e-01f, -9.831054874e-01f, -9.825393023e-01f, -9.819638691e-01f, -9.813791933e-01f,
+    -9.807852804e-01f, -9.801821360e-01f, -9.795697657e-01f, -9.789481753e-01f, -9.783173707e-01f, -9.776773578e-01f,
+    -9.770281427e-01f, -9.763697313e-01f, -9.757021300e-01f, -9.750253451e-01f, -9.743393828e-01f, -9.736442497e-01f,
+    -9.729399522e-01f, -9.722264971e-01f, -9.715038910e-01f, -9.707721407e-01f, -9.700312532e-01f, -9.692812354e-01f,
+    -9.685220943e-01f, -9.677538371e-01f, -9.669764710e-01f, -9.661900034e-01f, -9.653944417e-01f, -9.645897933e-01f,
+    -9.637760658e-01f, -9.629532669e-01f, -9.621214043e-01f, -9.612804858e-01f, -9.604305194e-01f, -9.595715131e-01f,
+    -9.587034749e-01f, -9.578264130e-01f, -9.569403357e-01f, -9.560452513e-01f, -9.551411683e-01f, -9.542280951e-01f,
+    -9.533060404e-01f, -9.523750127e-01f, -9.514350210e-01f, -9.504860739e-01f, -9.495281806e-01f, -9.485613499e-01f,
+    -9.475855910e-01f, -9.466009131e-01f, -9.456073254e-01f, -9.446048373e-01f, -9.435934582e-01f, -9.425731976e-01f,
+    -9.415440652e-01f, -9.405060706e-01f, -9.394592236e-01f, -9.384035341e-01f, -9.373390119e-01f, -9.362656672e-01f,
+    -9.351835099e-01f, -9.340925504e-01f, -9.329927988e-01f, -9.318842656e-01f, -9.307669611e-01f, -9.296408958e-01f,
+    -9.285060805e-01f, -9.273625257e-01f, -9.262102421e-01f, -9.250492408e-01f, -9.238795325e-01f, -9.227011283e-01f,
+    -9.215140393e-01f, -9.203182767e-01f, -9.191138517e-01f, -9.179007756e-01f, -9.166790599e-01f, -9.154487161e-01f,
+    -9.142097557e-01f, -9.129621904e-01f, -9.117060320e-01f, -9.104412923e-01f, -9.091679831e-01f, -9.078861165e-01f,
+    -9.065957045e-01f, -9.052967593e-01f, -9.039892931e-01f, -9.026733182e-01f, -9.013488470e-01f, -9.000158920e-01f,
+    -8.986744657e-01f, -8.973245807e-01f, -8.959662498e-01f, -8.945994856e-01f, -8.932243012e-01f, -8.918407094e-01f,
+    -8.904487232e-01f, -8.890483559e-01f, -8.876396204e-01f, -8.862225301e-01f, -8.847970984e-01f, -8.833633387e-01f,
+    -8.819212643e-01f, -8.804708891e-01f, -8.790122264e-01f, -8.775452902e-01f, -8.760700942e-01f, -8.745866523e-01f,
+    -8.730949784e-01f, -8.715950867e-01f, -8.700869911e-01f, -8.685707060e-01f, -8.670462455e-01f, -8.655136241e-01f,
+    -8.639728561e-01f, -8.624239561e-01f, -8.608669386e-01f, -8.593018184e-01f, -8.577286100e-01f, -8.561473284e-01f,
+    -8.545579884e-01f, -8.529606049e-01f, -8.513551931e-01f, -8.497417680e-01f, -8.481203448e-01f, -8.464909388e-01f,
+    -8.448535652e-01f, -8.432082396e-01f, -8.415549774e-01f, -8.398937942e-01f, -8.382247056e-01f, -8.365477272e-01f,
+    -8.348628750e-01f, -8.331701647e-01f, -8.314696123e-01f, -8.297612338e-01f, -8.280450453e-01f, -8.263210628e-01f,
+    -8.245893028e-01f, -8.228497814e-01f, -8.211025150e-01f, -8.193475201e-01f, -8.175848132e-01f, -8.158144108e-01f,
+    -8.140363297e-01f, -8.122505866e-01f, -8.104571983e-01f, -8.086561816e-01f, -8.068475535e-01f, -8.050313311e-01f,
+    -8.032075315e-01f, -8.013761717e-01f, -7.995372691e-01f, -7.976908409e-01f, -7.958369046e-01f, -7.939754776e-01f,
+    -7.921065773e-01f, -7.902302214e-01f, -7.883464276e-01f, -7.864552136e-01f, -7.845565972e-01f, -7.826505962e-01f,
+    -7.807372286e-01f, -7.788165124e-01f, -7.768884657e-01f, -7.749531066e-01f, -7.730104534e-01f, -7.710605243e-01f,
+    -7.691033376e-01f, -7.671389119e-01f, -7.651672656e-01f, -7.631884173e-01f, -7.612023855e-01f, -7.592091890e-01f,
+    -7.572088465e-01f, -7.552013769e-01f, -7.531867990e-01f, -7.511651319e-01f, -7.491363945e-01f, -7.471006060e-01f,
+    -7.450577854e-01f, -7.430079521e-01f, -7.409511254e-01f, -7.388873245e-01f, -7.368165689e-01f, -7.347388781e-01f,
+    -7.326542717e-01f, -7.305627692e-01f, -7.284643904e-01f, -7.263591551e-01f, -7.242470830e-01f, -7.221281939e-01f,
+    -7.200025080e-01f, -7.178700451e-01f, -7.157308253e-01f, -7.135848688e-01f, -7.114321957e-01f, -7.092728264e-01f,
+    -7.071067812e-01f, -7.049340804e-01f, -7.027547445e-01f, -7.005687939e-01f, -6.983762494e-01f, -6.961771315e-01f,
+    -6.939714609e-01f, -6.917592584e-01f, -6.895405447e-01f, -6.873153409e-01f, -6.850836678e-01f, -6.828455464e-01f,
+    -6.806009978e-01f, -6.783500431e-01f, -6.760927036e-01f, -6.738290004e-01f, -6.715589548e-01f, -6.692825883e-01f,
+    -6.669999223e-01f, -6.647109782e-01f, -6.624157776e-01f, -6.601143421e-01f, -6.578066933e-01f, -6.554928530e-01f,
+    -6.531728430e-01f, -6.508466850e-01f, -6.485144010e-01f, -6.461760130e-01f, -6.438315429e-01f, -6.414810128e-01f,
+    -6.391244449e-01f, -6.367618612e-01f, -6.343932842e-01f, -6.320187359e-01f, -6.296382389e-01f, -6.272518155e-01f,
+    -6.248594881e-01f, -6.224612794e-01f, -6.200572118e-01f, -6.176473079e-01f, -6.152315906e-01f, -6.128100824e-01f,
+    -6.103828063e-01f, -6.079497850e-01f, -6.055110414e-01f, -6.030665985e-01f, -6.006164794e-01f, -5.981607070e-01f,
+    -5.956993045e-01f, -5.932322950e-01f, -5.907597019e-01f, -5.882815482e-01f, -5.857978575e-01f, -5.833086529e-01f,
+    -5.808139581e-01f, -5.783137964e-01f, -5.758081914e-01f, -5.732971667e-01f, -5.707807459e-01f, -5.682589527e-01f,
+    -5.657318108e-01f, -5.631993440e-01f, -5.606615762e-01f, -5.581185312e-01f, -5.555702330e-01f, -5.530167056e-01f,
+    -5.504579729e-01f, -5.478940592e-01f, -5.453249884e-01f, -5.427507849e-01f, -5.401714727e-01f, -5.375870763e-01f,
+    -5.349976199e-01f, -5.324031279e-01f, -5.298036247e-01f, -5.271991348e-01f, -5.245896827e-01f, -5.219752929e-01f,
+    -5.193559902e-01f, -5.167317990e-01f, -5.141027442e-01f, -5.114688504e-01f, -5.088301425e-01f, -5.061866453e-01f,
+    -5.035383837e-01f, -5.008853826e-01f, -4.982276670e-01f, -4.955652618e-01f, -4.928981922e-01f, -4.902264833e-01f,
+    -4.875501601e-01f, -4.848692480e-01f, -4.821837721e-01f, -4.794937577e-01f, -4.767992301e-01f, -4.741002147e-01f,
+    -4.713967368e-01f, -4.686888220e-01f, -4.659764958e-01f, -4.632597836e-01f, -4.605387110e-01f, -4.578133036e-01f,
+    -4.550835871e-01f, -4.523495872e-01f, -4.496113297e-01f, -4.468688402e-01f, -4.441221446e-01f, -4.413712687e-01f,
+    -4.386162385e-01f, -4.358570799e-01f, -4.330938189e-01f, -4.303264813e-01f, -4.275550934e-01f, -4.247796812e-01f,
+    -4.220002708e-01f, -4.192168884e-01f, -4.164295601e-01f, -4.136383122e-01f, -4.108431711e-01f, -4.080441629e-01f,
+    -4.052413140e-01f, -4.024346509e-01f, -3.996241998e-01f, -3.968099874e-01f, -3.939920401e-01f, -3.911703843e-01f,
+    -3.883450467e-01f, -3.855160538e-01f, -3.826834324e-01f, -3.798472089e-01f, -3.770074102e-01f, -3.741640630e-01f,
+    -3.713171940e-01f, -3.684668300e-01f, -3.656129978e-01f, -3.627557244e-01f, -3.598950365e-01f, -3.570309612e-01f,
+    -3.541635254e-01f, -3.512927561e-01f, -3.484186802e-01f, -3.455413250e-01f, -3.426607173e-01f, -3.397768844e-01f,
+    -3.368898534e-01f, -3.339996514e-01f, -3.311063058e-01f, -3.282098436e-01f, -3.253102922e-01f, -3.224076788e-01f,
+    -3.195020308e-01f, -3.165933756e-01f, -3.136817404e-01f, -3.107671527e-01f, -3.078496400e-01f, -3.049292297e-01f,
+    -3.020059493e-01f, -2.990798263e-01f, -2.961508882e-01f, -2.932191627e-01f, -2.902846773e-01f, -2.873474595e-01f,
+    -2.844075372e-01f, -2.814649379e-01f, -2.785196894e-01f, -2.755718193e-01f, -2.726213554e-01f, -2.696683256e-01f,
+    -2.667127575e-01f, -2.637546790e-01f, -2.607941179e-01f, -2.578311022e-01f, -2.548656596e-01f, -2.518978182e-01f,
+    -2.489276057e-01f, -2.459550503e-01f, -2.429801799e-01f, -2.400030224e-01f, -2.370236060e-01f, -2.340419586e-01f,
+    -2.310581083e-01f, -2.280720832e-01f, -2.250839114e-01f, -2.220936210e-01f, -2.191012402e-01f, -2.161067971e-01f,
+    -2.131103199e-01f, -2.101118369e-01f, -2.071113762e-01f, -2.041089661e-01f, -2.011046348e-01f, -1.980984107e-01f,
+    -1.950903220e-01f, -1.920803970e-01f, -1.890686641e-01f, -1.860551517e-01f, -1.830398880e-01f, -1.800229014e-01f,
+    -1.770042204e-01f, -1.739838734e-01f, -1.709618888e-01f, -1.679382950e-01f, -1.649131205e-01f, -1.618863938e-01f,
+    -1.588581433e-01f, -1.558283977e-01f, -1.527971853e-01f, -1.497645347e-01f, -1.467304745e-01f, -1.436950332e-01f,
+    -1.406582393e-01f, -1.376201216e-01f, -1.345807085e-01f, -1.315400287e-01f, -1.284981108e-01f, -1.254549834e-01f,
+    -1.224106752e-01f, -1.193652148e-01f, -1.163186309e-01f, -1.132709522e-01f, -1.102222073e-01f, -1.071724250e-01f,
+    -1.041216339e-01f, -1.010698628e-01f, -9.801714033e-02f, -9.496349533e-02f, -9.190895650e-02f, -8.885355258e-02f,
+    -8.579731234e-02f, -8.274026455e-02f, -7.968243797e-02f, -7.662386139e-02f, -7.356456360e-02f, -7.050457339e-02f,
+    -6.744391956e-02f, -6.438263093e-02f, -6.132073630e-02f, -5.825826450e-02f, -5.519524435e-02f, -5.213170468e-02f,
+    -4.906767433e-02f, -4.600318213e-02f, -4.293825693e-02f, -3.987292759e-02f, -3.680722294e-02f, -3.374117185e-02f,
+    -3.067480318e-02f, -2.760814578e-02f, -2.454122852e-02f, -2.147408028e-02f, -1.840672991e-02f, -1.533920628e-02f,
+    -1.227153829e-02f, -9.203754782e-03f, -6.135884649e-03f, -3.067956763e-03f,
+};
+
+// Bit-reversed index for the N/2-point complex FFT
+static const uint16_t spectral_bitrev[1024] = {
+       0,  512,  256,  768,  128,  640,  384,  896,   64,  576,  320,  832,  192,  704,  448,  960,
+      32,  544,  288,  800,  160,  672,  416,  928,   96,  608,  352,  864,  224,  736,  480,  992,
+      16,  528,  272,  784,  144,  656,  400,  912,   80,  592,  336,  848,  208,  720,  464,  976,
+      48,  560,  304,  816,  176,  688,  432,  944,  112,  624,  368,  880,  240,  752,  496, 1008,
+       8,  520,  264,  776,  136,  648,  392,  904,   72,  584,  328,  840,  200,  712,  456,  968,
+      40,  552,  296,  808,  168,  680,  424,  936,  104,  616,  360,  872,  232,  744,  488, 1000,
+      24,  536,  280,  792,  152,  664,  408,  920,   88,  600,  344,  856,  216,  728,  472,  984,
+      56,  568,  312,  824,  184,  696,  440,  952,  120,  632,  376,  888,  248,  760,  504, 1016,
+       4,  516,  260,  772,  132,  644,  388,  900,   68,  580,  324,  836,  196,  708,  452,  964,
+      36,  548,  292,  804,  164,  676,  420,  932,  100,  612,  356,  868,  228,  740,  484,  996,
+      20,  532,  276,  788,  148,  660,  404,  916,   84,  596,  340,  852,  212,  724,  468,  980,
+      52,  564,  308,  820,  180,  692,  436,  948,  116,  628,  372,  884,  244,  756,  500, 1012,
+      12,  524,  268,  780,  140,  652,  396,  908,   76,  588,  332,  844,  204,  716,  460,  972,
+      44,  556,  300,  812,  172,  684,  428,  940,  108,  620,  364,  876,  236,  748,  492, 1004,
+      28,  540,  284,  796,  156,  668,  412,  924,   92,  604,  348,  860,  220,  732,  476,  988,
+      60,  572,  316,  828,  188,  700,  444,  956,  124,  636,  380,  892,  252,  764,  508, 1020,
+       2,  514,  258,  770,  130,  642,  386,  898,   66,  578,  322,  834,  194,  706,  450,  962,
+      34,  546,  290,  802,  162,  674,  418,  930,   98,  610,  354,  866,  226,  738,  482,  994,
+      18,  530,  274,  786,  146,  658,  402,  914,   82,  594,  338,  850,  210,  722,  466,  978,
+      50,  562,  306,  818,  178,  690,  434,  946,  114,  626,  370,  882,  242,  754,  498, 1010,
+      10,  522,  266,  778,  138,  650,  394,  906,   74,  586,  330,  842,  202,  714,  458,  970,
+      42,  554,  298,  810,  170,  682,  426,  938,  106,  618,  362,  874,  234,  746,  490, 1002,
+      26,  538,  282,  794,  154,  666,  410,  922,   90,  602,  346,  858,  218,  730,  474,  986,
+      58,  570,  314,  826,  186,  698,  442,  954,  122,  634,  378,  890,  250,  762,  506, 1018,
+       6,  518,  262,  774,  134,  646,  390,  902,   70,  582,  326,  838,  198,  710,  454,  966,
+      38,  550,  294,  806,  166,  678,  422,  934,  102,  614,  358,  870,  230,  742,  486,  998,
+      22,  534,  278,  790,  150,  662,  406,  918,   86,  598,  342,  854,  214,  726,  470,  982,
+      54,  566,  310,  822,  182,  694,  438,  950,  118,  630,  374,  886,  246,  758,  502, 1014,
+      14,  526,  270,  782,  142,  654,  398,  910,   78,  590,  334,  846,  206,  718,  462,  974,
+      46,  558,  302,  814,  174,  686,  430,  942,  110,  622,  366,  878,  238,  750,  494, 1006,
+      30,  542,  286,  798,  158,  670,  414,  926,   94,  606,  350,  862,  222,  734,  478,  990,
+      62,  574,  318,  830,  190,  702,  446,  958,  126,  638,  382,  894,  254,  766,  510, 1022,
+       1,  513,  257,  769,  129,  641,  385,  897,   65,  577,  321,  833,  193,  705,  449,  961,
+      33,  545,  289,  801,  161,  673,  417,  929,   97,  609,  353,  865,  225,  737,  481,  993,
+      17,  529,  273,  785,  145,  657,  401,  913,   81,  593,  337,  849,  209,  721,  465,  977,
+      49,  561,  305,  817,  177,  689,  433,  945,  113,  625,  369,  881,  241,  753,  497, 1009,
+       9,  521,  265,  777,  137,  649,  393,  905,   73,  585,  329,  841,  201,  713,  457,  969,
+      41,  553,  297,  809,  169,  681,  425,  937,  105,  617,  361,  873,  233,  745,  489, 1001,
+      25,  537,  281,  793,  153,  665,  409,  921,   89,  601,  345,  857,  217,  729,  473,  985,
+      57,  569,  313,  825,  185,  697,  441,  953,  121,  633,  377,  889,  249,  761,  505, 1017,
+       5,  517,  261,  773,  133,  645,  389,  901,   69,  581,  325,  837,  197,  709,  453,  965,
+      37,  549,  293,  805,  165,  677,  421,  933,  101,  613,  357,  869,  229,  741,  485,  997,
+      21,  533,  277,  789,  149,  661,  405,  917,   85,  597,  341,  853,  213,  725,  469,  981,
+      53,  565,  309,  821,  181,  693,  437,  949,  117,  629,  373,  885,  245,  757,  501, 1013,
+      13,  525,  269,  781,  141,  653,  397,  909,   77,  589,  333,  845,  205,  717,  461,  973,
+      45,  557,  301,  813,  173,  685,  429,  941,  109,  621,  365,  877,  237,  749,  493, 1005,
+      29,  541,  285,  797,  157,  669,  413,  925,   93,  605,  349,  861,  221,  733,  477,  989,
+      61,  573,  317,  829,  189,  701,  445,  957,  125,  637,  381,  893,  253,  765,  509, 1021,
+       3,  515,  259,  771,  131,  643,  387,  899,   67,  579,  323,  835,  195,  707,  451,  963,
+      35,  547,  291,  803,  163,  675,  419,  931,   99,  611,  355,  867,  227,  739,  483,  995,
+      19,  531,  275,  787,  147,  659,  403,  915,   83,  595,  339,  851,  211,  723,  467,  979,
+      51,  563,  307,  819,  179,  691,  435,  947,  115,  627,  371,  883,  243,  755,  499, 1011,
+      11,  523,  267,  779,  139,  651,  395,  907,   75,  587,  331,  843,  203,  715,  459,  971,
+      43,  555,  299,  811,  171,  683,  427,  939,  107,  619,  363,  875,  235,  747,  491, 1003,
+      27,  539,  283,  795,  155,  667,  411,  923,   91,  603,  347,  859,  219,  731,  475,  987,
+      59,  571,  315,  827,  187,  699,  443,  955,  123,  635,  379,  891,  251,  763,  507, 1019,
+       7,  519,  263,  775,  135,  647,  391,  903,   71,  583,  327,  839,  199,  711,  455,  967,
+      39,  551,  295,  807,  167,  679,  423,  935,  103,  615,  359,  871,  231,  743,  487,  999,
+      23,  535,  279,  791,  151,  663,  407,  919,   87,  599,  343,  855,  215,  727,  471,  983,
+      55,  567,  311,  823,  183,  695,  439,  951,  119,  631,  375,  887,  247,  759,  503, 1015,
+      15,  527,  271,  783,  143,  655,  399,  911,   79,  591,  335,  847,  207,  719,  463,  975,
+      47,  559,  303,  815,  175,  687,  431,  943,  111,  623,  367,  879,  239,  751,  495, 1007,
+      31,  543,  287,  799,  159,  671,  415,  927,   95,  607,  351,  863,  223,  735,  479,  991,
+      63,  575,  319,  831,  191,  703,  447,  959,  127,  639,  383,  895,  255,  767,  511, 1023,
+};
+
+// Periodic Hann window
+static const float spectral_window[2048] = {
+     0.000000000e+00f,  2.353095212e-06f,  9.412358699e-06f,  2.117772402e-05f,  3.764908043e-05f,  5.882627289e-05f,
+     8.470910209e-05f,  1.152973244e-04f,  1.505906519e-04f,  1.905887524e-04f,  2.352912495e-04f,  2.846977223e-04f,
+     3.388077058e-04f,  3.976206908e-04f,  4.611361237e-04f,  5.293534066e-04f,  6.022718974e-04f,  6.798909099e-04f,
+     7.622097134e-04f,  8.492275331e-04f,  9.409435499e-04f,  1.037356901e-03f,  1.138466678e-03f,  1.244271930e-03f,
+     1.354771661e-03f,  1.469964830e-03f,  1.589850354e-03f,  1.714427105e-03f,  1.843693909e-03f,  1.977649549e-03f,
+     2.116292766e-03f,  2.259622254e-03f,  2.407636664e-03f,  2.560334603e-03f,  2.717714633e-03f,  2.879775273e-03f,
+     3.046514999e-03f,  3.217932240e-03f,  3.394025383e-03f,  3.574792770e-03f,  3.760232701e-03f,  3.950343429e-03f,
+     4.145123165e-03f,  4.344570077e-03f,  4.548682286e-03f,  4.757457872e-03f,  4.970894869e-03f,  5.188991268e-03f,
+     5.411745018e-03f,  5.639154020e-03f,  5.871216135e-03f,  6.107929178e-03f,  6.349290921e-03f,  6.595299093e-03f,
+     6.845951378e-03f,  7.101245416e-03f,  7.361178806e-03f,  7.625749099e-03f,  7.894953807e-03f,  8.168790394e-03f,
+     8.447256284e-03f,  8.730348856e-03f,  9.018065445e-03f,  9.310403343e-03f,  9.607359798e-03f,  9.908932016e-03f,
+     1.021511716e-02f,  1.052591234e-02f,  1.084131464e-02f,  1.116132109e-02f,  1.148592867e-02f,  1.181513433e-02f,
+     1.214893498e-02f,  1.248732747e-02f,  1.283030861e-02f,  1.317787517e-02f,  1.353002390e-02f,  1.388675146e-02f,
+     1.424805451e-02f,  1.461392964e-02f,  1.498437340e-02f,  1.535938232e-02f,  1.573895286e-02f,  1.612308145e-02f,
+     1.651176448e-02f,  1.690499828e-02f,  1.730277915e-02f,  1.770510336e-02f,  1.811196710e-02f,  1.852336656e-02f,
+     1.893929787e-02f,  1.935975709e-02f,  1.978474029e-02f,  2.021424346e-02f,  2.064826255e-02f,  2.108679349e-02f,
+     2.152983213e-02f,  2.197737433e-02f,  2.242941585e-02f,  2.288595245e-02f,  2.334697982e-02f,  2.381249364e-02f,
+     2.428248952e-02f,  2.475696303e-02f,  2.523590970e-02f,  2.571932504e-02f,  2.620720449e-02f,  2.669954346e-02f,
+     2.719633731e-02f,  2.769758137e-02f,  2.820327092e-02f,  2.871340120e-02f,  2.922796741e-02f,  2.974696470e-02f,
+     3.027038820e-02f,  3.079823297e-02f,  3.133049404e-02f,  3.186716641e-02f,  3.240824503e-02f,  3.295372480e-02f,
+     3.350360058e-02f,  3.405786721e-02f,  3.461651946e-02f,  3.517955208e-02f,  3.574695976e-02f,  3.631873717e-02f,
+     3.689487893e-02f,  3.747537961e-02f,  3.806023374e-02f,  3.864943583e-02f,  3.924298033e-02f,  3.984086165e-02f,
+     4.044307415e-02f,  4.104961219e-02f,  4.166047004e-02f,  4.227564196e-02f,  4.289512215e-02f,  4.351890479e-02f,
+     4.414698400e-02f,  4.477935387e-02f,  4.541600845e-02f,  4.605694176e-02f,  4.670214774e-02f,  4.735162034e-02f,
+     4.800535344e-02f,  4.866334088e-02f,  4.932557648e-02f,  4.999205399e-02f,  5.066276715e-02f,  5.133770965e-02f,
+     5.201687512e-02f,  5.270025718e-02f,  5.338784940e-02f,  5.407964530e-02f,  5.477563838e-02f,  5.547582207e-02f,
+     5.618018980e-02f,  5.688873493e-02f,  5.760145078e-02f,  5.831833067e-02f,  5.903936783e-02f,  5.976455547e-02f,
+     6.049388679e-02f,  6.122735490e-02f,  6.196495290e-02f,  6.270667386e-02f,  6.345251079e-02f,  6.420245667e-02f,
+     6.495650445e-02f,  6.571464701e-02f,  6.647687724e-02f,  6.724318795e-02f,  6.801357194e-02f,  6.878802194e-02f,
+     6.956653068e-02f,  7.034909082e-02f,  7.113569500e-02f,  7.192633581e-02f,  7.272100582e-02f,  7.351969753e-02f,
+     7.432240345e-02f,  7.512911600e-02f,  7.593982760e-02f,  7.675453061e-02f,  7.757321738e-02f,  7.839588018e-02f,
+     7.922251128e-02f,  8.005310290e-02f,  8.088764722e-02f,  8.172613639e-02f,  8.256856251e-02f,  8.341491765e-02f,
+     8.426519385e-02f,  8.511938310e-02f,  8.597747737e-02f,  8.683946858e-02f,  8.770534861e-02f,  8.857510931e-02f,
+     8.944874250e-02f,  9.032623996e-02f,  9.120759342e-02f,  9.209279460e-02f,  9.298183515e-02f,  9.387470671e-02f,
+     9.477140087e-02f,  9.567190921e-02f,  9.657622323e-02f,  9.748433443e-02f,  9.839623426e-02f,  9.931191414e-02f,
+     1.002313654e-01f,  1.011545795e-01f,  1.020815477e-01f,  1.030122612e-01f,  1.039467113e-01f,  1.048848893e-01f,
+     1.058267862e-01f,  1.067723932e-01f,  1.077217014e-01f,  1.086747019e-01f,  1.096313857e-01f,  1.105917438e-01f,
+     1.115557672e-01f,  1.125234467e-01f,  1.134947733e-01f,  1.144697379e-01f,  1.154483312e-01f,  1.164305440e-01f,
+     1.174163672e-01f,  1.184057914e-01f,  1.193988073e-01f,  1.203954055e-01f,  1.213955767e-01f,  1.223993116e-01f,
+     1.234066005e-01f,  1.244174340e-01f,  1.254318027e-01f,  1.264496970e-01f,  1.274711073e-01f,  1.284960239e-01f,
+     1.295244373e-01f,  1.305563378e-01f,  1.315917156e-01f,  1.326305610e-01f,  1.336728642e-01f,  1.347186154e-01f,
+     1.357678048e-01f,  1.368204225e-01f,  1.378764585e-01f,  1.389359030e-01f,  1.399987460e-01f,  1.410649775e-01f,
+     1.421345874e-01f,  1.432075656e-01f,  1.442839021e-01f,  1.453635868e-01f,  1.464466094e-01f,  1.475329598e-01f,
+     1.486226278e-01f,  1.497156030e-01f,  1.508118753e-01f,  1.519114343e-01f,  1.530142696e-01f,  1.541203708e-01f,
+     1.552297276e-01f,  1.563423296e-01f,  1.574581661e-01f,  1.585772268e-01f,  1.596995011e-01f,  1.608249784e-01f,
+     1.619536482e-01f,  1.630854998e-01f,  1.642205226e-01f,  1.653587058e-01f,  1.665000388e-01f,  1.676445109e-01f,
+     1.687921112e-01f,  1.699428290e-01f,  1.710966534e-01f,  1.722535735e-01f,  1.734135785e-01f,  1.745766575e-01f,
+     1.757427995e-01f,  1.769119935e-01f,  1.780842286e-01f,  1.792594936e-01f,  1.804377776e-01f,  1.816190694e-01f,
+     1.828033579e-01f,  1.839906320e-01f,  1.851808805e-01f,  1.863740923e-01f,  1.875702559e-01f,  1.887693603e-01f,
+     1.899713941e-01f,  1.911763460e-01f,  1.923842047e-01f,  1.935949588e-01f,  1.948085969e-01f,  1.960251075e-01f,
+     1.972444793e-01f,  1.984667007e-01f,  1.996917603e-01f,  2.009196465e-01f,  2.021503478e-01f,  2.033838525e-01f,
+     2.046201491e-01f,  2.058592259e-01f,  2.071010713e-01f,  2.083456735e-01f,  2.095930210e-01f,  2.108431018e-01f,
+     2.120959043e-01f,  2.133514167e-01f,  2.146096271e-01f,  2.158705237e-01f,  2.171340946e-01f,  2.184003280e-01f,
+     2.196692119e-01f,  2.209407344e-01f,  2.222148835e-01f,  2.234916472e-01f,  2.247710135e-01f,  2.260529704e-01f,
+     2.273375058e-01f,  2.286246076e-01f,  2.299142636e-01f,  2.312064619e-01f,  2.325011901e-01f,  2.337984361e-01f,
+     2.350981877e-01f,  2.364004326e-01f,  2.377051587e-01f,  2.390123535e-01f,  2.403220049e-01f,  2.416341005e-01f,
+     2.429486279e-01f,  2.442655748e-01f,  2.455849287e-01f,  2.469066773e-01f,  2.482308081e-01f,  2.495573087e-01f,
+     2.508861665e-01f,  2.522173691e-01f,  2.535509039e-01f,  2.548867584e-01f,  2.562249199e-01f,  2.575653760e-01f,
+     2.589081140e-01f,  2.602531212e-01f,  2.616003850e-01f,  2.629498927e-01f,  2.643016316e-01f,  2.656555890e-01f,
+     2.670117521e-01f,  2.683701082e-01f,  2.697306445e-01f,  2.710933482e-01f,  2.724582064e-01f,  2.738252064e-01f,
+     2.751943352e-01f,  2.765655799e-01f,  2.779389277e-01f,  2.793143656e-01f,  2.806918807e-01f,  2.820714600e-01f,
+     2.834530906e-01f,  2.848367593e-01f,  2.862224533e-01f,  2.876101594e-01f,  2.889998646e-01f,  2.903915558e-01f,
+     2.917852200e-01f,  2.931808439e-01f,  2.945784145e-01f,  2.959779186e-01f,  2.973793430e-01f,  2.987826746e-01f,
+     3.001879001e-01f,  3.015950063e-01f,  3.030039800e-01f,  3.044148078e-01f,  3.058274767e-01f,  3.072419731e-01f,
+     3.086582838e-01f,  3.100763955e-01f,  3.114962949e-01f,  3.129179685e-01f,  3.143414030e-01f,  3.157665850e-01f,
+     3.171935011e-01f,  3.186221378e-01f,  3.200524817e-01f,  3.214845194e-01f,  3.229182373e-01f,  3.243536220e-01f,
+     3.257906599e-01f,  3.272293375e-01f,  3.286696413e-01f,  3.301115578e-01f,  3.315550733e-01f,  3.330001743e-01f,
+     3.344468471e-01f,  3.358950782e-01f,  3.373448539e-01f,  3.387961606e-01f,  3.402489846e-01f,  3.417033122e-01f,
+     3.431591298e-01f,  3.446164236e-01f,  3.460751800e-01f,  3.475353851e-01f,  3.489970253e-01f,  3.504600868e-01f,
+     3.519245559e-01f,  3.533904187e-01f,  3.548576614e-01f,  3.563262702e-01f,  3.577962314e-01f,  3.592675310e-01f,
+     3.607401553e-01f,  3.622140903e-01f,  3.636893223e-01f,  3.651658372e-01f,  3.666436213e-01f,  3.681226605e-01f,
+     3.696029410e-01f,  3.710844489e-01f,  3.725671702e-01f,  3.740510909e-01f,  3.755361971e-01f,  3.770224748e-01f,
+     3.785099100e-01f,  3.799984888e-01f,  3.814881970e-01f,  3.829790207e-01f,  3.844709459e-01f,  3.859639584e-01f,
+     3.874580443e-01f,  3.889531895e-01f,  3.904493799e-01f,  3.919466015e-01f,  3.934448400e-01f,  3.949440816e-01f,
+     3.964443119e-01f,  3.979455170e-01f,  3.994476826e-01f,  4.009507946e-01f,  4.024548390e-01f,  4.039598015e-01f,
+     4.054656679e-01f,  4.069724242e-01f,  4.084800560e-01f,  4.099885493e-01f,  4.114978898e-01f,  4.130080633e-01f,
+     4.145190556e-01f,  4.160308525e-01f,  4.175434398e-01f,  4.190568031e-01f,  4.205709283e-01f,  4.220858012e-01f,
+     4.236014074e-01f,  4.251177327e-01f,  4.266347628e-01f,  4.281524834e-01f,  4.296708803e-01f,  4.311899392e-01f,
+     4.327096457e-01f,  4.342299856e-01f,  4.357509446e-01f,  4.372725083e-01f,  4.387946624e-01f,  4.403173926e-01f,
+     4.418406845e-01f,  4.433645239e-01f,  4.448888964e-01f,  4.464137875e-01f,  4.479391831e-01f,  4.494650686e-01f,
+     4.509914298e-01f,  4.525182523e-01f,  4.540455218e-01f,  4.555732237e-01f,  4.571013438e-01f,  4.586298677e-01f,
+     4.601587810e-01f,  4.616880693e-01f,  4.632177182e-01f,  4.647477133e-01f,  4.662780402e-01f,  4.678086845e-01f,
+     4.693396318e-01f,  4.708708677e-01f,  4.724023778e-01f,  4.739341477e-01f,  4.754661628e-01f,  4.769984089e-01f,
+     4.785308715e-01f,  4.800635362e-01f,  4.815963885e-01f,  4.831294141e-01f,  4.846625984e-01f,  4.861959271e-01f,
+     4.877293857e-01f,  4.892629599e-01f,  4.907966350e-01f,  4.923303969e-01f,  4.938642309e-01f,  4.953981226e-01f,
+     4.969320577e-01f,  4.984660216e-01f,  5.000000000e-01f,  5.015339784e-01f,  5.030679423e-01f,  5.046018774e-01f,
+     5.061357691e-01f,  5.076696031e-01f,  5.092033650e-01f,  5.107370401e-01f,  5.122706143e-01f,  5.138040729e-01f,
+     5.153374016e-01f,  5.168705859e-01f,  5.184036115e-01f,  5.199364638e-01f,  5.214691285e-01f,  5.230015911e-01f,
+     5.245338372e-01f,  5.260658523e-01f,  5.275976222e-01f,  5.291291323e-01f,  5.306603682e-01f,  5.321913155e-01f,
+     5.337219598e-01f,  5.352522867e-01f,  5.367822818e-01f,  5.383119307e-01f,  5.398412190e-01f,  5.413701323e-01f,
+     5.428986562e-01f,  5.444267763e-01f,  5.459544782e-01f,  5.474817477e-01f,  5.490085702e-01f,  5.505349314e-01f,
+     5.520608169e-01f,  5.535862125e-01f,  5.551111036e-01f,  5.566354761e-01f,  5.581593155e-01f,  5.596826074e-01f,
+     5.612053376e-01f,  5.627274917e-01f,  5.642490554e-01f,  5.657700144e-01f,  5.672903543e-01f,  5.688100608e-01f,
+     5.703291197e-01f,  5.718475166e-01f,  5.733652372e-01f,  5.748822673e-01f,  5.763985926e-01f,  5.779141988e-01f,
+     5.794290717e-01f,  5.809431969e-01f,  5.824565602e-01f,  5.839691475e-01f,  5.854809444e-01f,  5.869919367e-01f,
+     5.885021102e-01f,  5.900114507e-01f,  5.915199440e-01f,  5.930275758e-01f,  5.945343321e-01f,  5.960401985e-01f,
+     5.975451610e-01f,  5.990492054e-01f,  6.005523174e-01f,  6.020544830e-01f,  6.035556881e-01f,  6.050559184e-01f,
+     6.065551600e-01f,  6.080533985e-01f,  6.095506201e-01f,  6.110468105e-01f,  6.125419557e-01f,  6.140360416e-01f,
+     6.155290541e-01f,  6.170209793e-01f,  6.185118030e-01f,  6.200015112e-01f,  6.214900900e-01f,  6.229775252e-01f,
+     6.244638029e-01f,  6.259489091e-01f,  6.274328298e-01f,  6.289155511e-01f,  6.303970590e-01f,  6.318773395e-01f,
+     6.333563787e-01f,  6.348341628e-01f,  6.363106777e-01f,  6.377859097e-01f,  6.392598447e-01f,  6.407324690e-01f,
+     6.422037686e-01f,  6.436737298e-01f,  6.451423386e-01f,  6.466095813e-01f,  6.480754441e-01f,  6.495399132e-01f,
+     6.510029747e-01f,  6.524646149e-01f,  6.539248200e-01f,  6.553835764e-01f,  6.568408702e-01f,  6.582966878e-01f,
+     6.597510154e-01f,  6.612038394e-01f,  6.626551461e-01f,  6.641049218e-01f,  6.655531529e-01f,  6.669998257e-01f,
+     6.684449267e-01f,  6.698884422e-01f,  6.713303587e-01f,  6.727706625e-01f,  6.742093401e-01f,  6.756463780e-01f,
+     6.770817627e-01f,  6.785154806e-01f,  6.799475183e-01f,  6.813778622e-01f,  6.828064989e-01f,  6.842334150e-01f,
+     6.856585970e-01f,  6.870820315e-01f,  6.885037051e-01f,  6.899236045e-01f,  6.913417162e-01f,  6.927580269e-01f,
+     6.941725233e-01f,  6.955851922e-01f,  6.969960200e-01f,  6.984049937e-01f,  6.998120999e-01f,  7.012173254e-01f,
+     7.026206570e-01f,  7.040220814e-01f,  7.054215855e-01f,  7.068191561e-01f,  7.082147800e-01f,  7.096084442e-01f,
+     7.110001354e-01f,  7.123898406e-01f,  7.137775467e-01f,  7.151632407e-01f,  7.165469094e-01f,  7.179285400e-01f,
+     7.193081193e-01f,  7.206856344e-01f,  7.220610723e-01f,  7.234344201e-01f,  7.248056648e-01f,  7.261747936e-01f,
+     7.275417936e-01f,  7.289066518e-01f,  7.302693555e-01f,  7.316298918e-01f,  7.329882479e-01f,  7.343444110e-01f,
+     7.356983684e-01f,  7.370501073e-01f,  7.383996150e-01f,  7.397468788e-01f,  7.410918860e-01f,  7.424346240e-01f,
+     7.437750801e-01f,  7.451132416e-01f,  7.464490961e-01f,  7.477826309e-01f,  7.491138335e-01f,  7.504426913e-01f,
+     7.517691919e-01f,  7.530933227e-01f,  7.544150713e-01f,  7.557344252e-01f,  7.570513721e-01f,  7.583658995e-01f,
+     7.596779951e-01f,  7.609876465e-01f,  7.622948413e-01f,  7.635995674e-01f,  7.649018123e-01f,  7.662015639e-01f,
+     7.674988099e-01f,  7.687935381e-01f,  7.700857364e-01f,  7.713753924e-01f,  7.726624942e-01f,  7.739470296e-01f,
+     7.752289865e-01f,  7.765083528e-01f,  7.777851165e-01f,  7.790592656e-01f,  7.803307881e-01f,  7.815996720e-01f,
+     7.828659054e-01f,  7.841294763e-01f,  7.853903729e-01f,  7.866485833e-01f,  7.879040957e-01f,  7.891568982e-01f,
+     7.904069790e-01f,  7.916543265e-01f,  7.928989287e-01f,  7.941407741e-01f,  7.953798509e-01f,  7.966161475e-01f,
+     7.978496522e-01f,  7.990803535e-01f,  8.003082397e-01f,  8.015332993e-01f,  8.027555207e-01f,  8.039748925e-01f,
+     8.051914031e-01f,  8.064050412e-01f,  8.076157953e-01f,  8.088236540e-01f,  8.100286059e-01f,  8.112306397e-01f,
+     8.124297441e-01f,  8.136259077e-01f,  8.148191195e-01f,  8.160093680e-01f,  8.171966421e-01f,  8.183809306e-01f,
+     8.195622224e-01f,  8.207405064e-01f,  8.219157714e-01f,  8.230880065e-01f,  8.242572005e-01f,  8.254233425e-01f,
+     8.265864215e-01f,  8.277464265e-01f,  8.289033466e-01f,  8.300571710e-01f,  8.312078888e-01f,  8.323554891e-01f,
+     8.334999612e-01f,  8.346412942e-01f,  8.357794774e-01f,  8.369145002e-01f,  8.380463518e-01f,  8.391750216e-01f,
+     8.403004989e-01f,  8.414227732e-01f,  8.425418339e-01f,  8.436576704e-01f,  8.447702724e-01f,  8.458796292e-01f,
+     8.469857304e-01f,  8.480885657e-01f,  8.491881247e-01f,  8.502843970e-01f,  8.513773722e-01f,  8.524670402e-01f,
+     8.535533906e-01f,  8.546364132e-01f,  8.557160979e-01f,  8.567924344e-01f,  8.578654126e-01f,  8.589350225e-01f,
+     8.600012540e-01f,  8.610640970e-01f,  8.621235415e-01f,  8.631795775e-01f,  8.642321952e-01f,  8.652813846e-01f,
+     8.663271358e-01f,  8.673694390e-01f,  8.684082844e-01f,  8.694436622e-01f,  8.704755627e-01f,  8.715039761e-01f,
+     8.725288927e-01f,  8.735503030e-01f,  8.745681973e-01f,  8.755825660e-01f,  8.765933995e-01f,  8.776006884e-01f,
+     8.786044233e-01f,  8.796045945e-01f,  8.806011927e-01f,  8.815942086e-01f,  8.825836328e-01f,  8.835694560e-01f,
+     8.845516688e-01f,  8.855302621e-01f,  8.865052267e-01f,  8.874765533e-01f,  8.884442328e-01f,  8.894082562e-01f,
+     8.903686143e-01f,  8.913252981e-01f,  8.922782986e-01f,  8.932276068e-01f,  8.941732138e-01f,  8.951151107e-01f,
+     8.960532887e-01f,  8.969877388e-01f,  8.979184523e-01f,  8.988454205e-01f,  8.997686346e-01f,  9.006880859e-01f,
+     9.016037657e-01f,  9.025156656e-01f,  9.034237768e-01f,  9.043280908e-01f,  9.052285991e-01f,  9.061252933e-01f,
+     9.070181649e-01f,  9.079072054e-01f,  9.087924066e-01f,  9.096737600e-01f,  9.105512575e-01f,  9.114248907e-01f,
+     9.122946514e-01f,  9.131605314e-01f,  9.140225226e-01f,  9.148806169e-01f,  9.157348062e-01f,  9.165850824e-01f,
+     9.174314375e-01f,  9.182738636e-01f,  9.191123528e-01f,  9.199468971e-01f,  9.207774887e-01f,  9.216041198e-01f,
+     9.224267826e-01f,  9.232454694e-01f,  9.240601724e-01f,  9.248708840e-01f,  9.256775966e-01f,  9.264803025e-01f,
+     9.272789942e-01f,  9.280736642e-01f,  9.288643050e-01f,  9.296509092e-01f,  9.304334693e-01f,  9.312119781e-01f,
+     9.319864281e-01f,  9.327568120e-01f,  9.335231228e-01f,  9.342853530e-01f,  9.350434956e-01f,  9.357975433e-01f,
+     9.365474892e-01f,  9.372933261e-01f,  9.380350471e-01f,  9.387726451e-01f,  9.395061132e-01f,  9.402354445e-01f,
+     9.409606322e-01f,  9.416816693e-01f,  9.423985492e-01f,  9.431112651e-01f,  9.438198102e-01f,  9.445241779e-01f,
+     9.452243616e-01f,  9.459203547e-01f,  9.466121506e-01f,  9.472997428e-01f,  9.479831249e-01f,  9.486622904e-01f,
+     9.493372328e-01f,  9.500079460e-01f,  9.506744235e-01f,  9.513366591e-01f,  9.519946466e-01f,  9.526483797e-01f,
+     9.532978523e-01f,  9.539430582e-01f,  9.545839915e-01f,  9.552206461e-01f,  9.558530160e-01f,  9.564810952e-01f,
+     9.571048779e-01f,  9.577243580e-01f,  9.583395300e-01f,  9.589503878e-01f,  9.595569258e-01f,  9.601591384e-01f,
+     9.607570197e-01f,  9.613505642e-01f,  9.619397663e-01f,  9.625246204e-01f,  9.631051211e-01f,  9.636812628e-01f,
+     9.642530402e-01f,  9.648204479e-01f,  9.653834805e-01f,  9.659421328e-01f,  9.664963994e-01f,  9.670462752e-01f,
+     9.675917550e-01f,  9.681328336e-01f,  9.686695060e-01f,  9.692017670e-01f,  9.697296118e-01f,  9.702530353e-01f,
+     9.707720326e-01f,  9.712865988e-01f,  9.717967291e-01f,  9.723024186e-01f,  9.728036627e-01f,  9.733004565e-01f,
+     9.737927955e-01f,  9.742806750e-01f,  9.747640903e-01f,  9.752430370e-01f,  9.757175105e-01f,  9.761875064e-01f,
+     9.766530202e-01f,  9.771140476e-01f,  9.775705842e-01f,  9.780226257e-01f,  9.784701679e-01f,  9.789132065e-01f,
+     9.793517374e-01f,  9.797857565e-01f,  9.802152597e-01f,  9.806402429e-01f,  9.810607021e-01f,  9.814766334e-01f,
+     9.818880329e-01f,  9.822948966e-01f,  9.826972208e-01f,  9.830950017e-01f,  9.834882355e-01f,  9.838769185e-01f,
+     9.842610471e-01f,  9.846406177e-01f,  9.850156266e-01f,  9.853860704e-01f,  9.857519455e-01f,  9.861132485e-01f,
+     9.864699761e-01f,  9.868221248e-01f,  9.871696914e-01f,  9.875126725e-01f,  9.878510650e-01f,  9.881848657e-01f,
+     9.885140713e-01f,  9.888386789e-01f,  9.891586854e-01f,  9.894740877e-01f,  9.897848828e-01f,  9.900910680e-01f,
+     9.903926402e-01f,  9.906895967e-01f,  9.909819346e-01f,  9.912696511e-01f,  9.915527437e-01f,  9.918312096e-01f,
+     9.921050462e-01f,  9.923742509e-01f,  9.926388212e-01f,  9.928987546e-01f,  9.931540486e-01f,  9.934047009e-01f,
+     9.936507091e-01f,  9.938920708e-01f,  9.941287839e-01f,  9.943608460e-01f,  9.945882550e-01f,  9.948110087e-01f,
+     9.950291051e-01f,  9.952425421e-01f,  9.954513177e-01f,  9.956554299e-01f,  9.958548768e-01f,  9.960496566e-01f,
+     9.962397673e-01f,  9.964252072e-01f,  9.966059746e-01f,  9.967820678e-01f,  9.969534850e-01f,  9.971202247e-01f,
+     9.972822854e-01f,  9.974396654e-01f,  9.975923633e-01f,  9.977403777e-01f,  9.978837072e-01f,  9.980223505e-01f,
+     9.981563061e-01f,  9.982855729e-01f,  9.984101496e-01f,  9.985300352e-01f,  9.986452283e-01f,  9.987557281e-01f,
+     9.988615333e-01f,  9.989626431e-01f,  9.990590565e-01f,  9.991507725e-01f,  9.992377903e-01f,  9.993201091e-01f,
+     9.993977281e-01f,  9.994706466e-01f,  9.995388639e-01f,  9.996023793e-01f,  9.996611923e-01f,  9.997153023e-01f,
+     9.997647088e-01f,  9.998094112e-01f,  9.998494093e-01f,  9.998847027e-01f,  9.999152909e-01f,  9.999411737e-01f,
+     9.999623509e-01f,  9.999788223e-01f,  9.999905876e-01f,  9.999976469e-01f,  1.000000000e+00f,  9.999976469e-01f,
+     9.999905876e-01f,  9.999788223e-01f,  9.999623509e-01f,  9.999411737e-01f,  9.999152909e-01f,  9.998847027e-01f,
+     9.998494093e-01f,  9.998094112e-01f,  9.997647088e-01f,  9.997153023e-01f,  9.996611923e-01f,  9.996023793e-01f,
+     9.995388639e-01f,  9.994706466e-01f,  9.993977281e-01f,  9.993201091e-01f,  9.992377903e-01f,  9.991507725e-01f,
+     9.990590565e-01f,  9.989626431e-01f,  9.988615333e-01f,  9.987557281e-01f,  9.986452283e-01f,  9.985300352e-01f,
+     9.984101496e-01f,  9.982855729e-01f,  9.981563061e-01f,  9.980223505e-01f,  9.978837072e-01f,  9.977403777e-01f,
+     9.975923633e-01f,  9.974396654e-01f,  9.972822854e-01f,  9.971202247e-01f,  9.969534850e-01f,  9.967820678e-01f,
+     9.966059746e-01f,  9.964252072e-01f,  9.962397673e-01f,  9.960496566e-01f,  9.958548768e-01f,  9.956554299e-01f,
+     9.954513177e-01f,  9.952425421e-01f,  9.950291051e-01f,  9.948110087e-01f,  9.945882550e-01f,  9.943608460e-01f,
+     9.941287839e-01f,  9.938920708e-01f,  9.936507091e-01f,  9.934047009e-01f,  9.931540486e-01f,  9.928987546e-01f,
+     9.926388212e-01f,  9.923742509e-01f,  9.921050462e-01f,  9.918312096e-01f,  9.915527437e-01f,  9.912696511e-01f,
+     9.909819346e-01f,  9.906895967e-01f,  9.903926402e-01f,  9.900910680e-01f,  9.897848828e-01f,  9.894740877e-01f,
+     9.891586854e-01f,  9.888386789e-01f,  9.885140713e-01f,  9.881848657e-01f,  9.878510650e-01f,  9.875126725e-01f,
+     9.871696914e-01f,  9.868221248e-01f,  9.864699761e-01f,  9.861132485e-01f,  9.857519455e-01f,  9.853860704e-01f,
+     9.850156266e-01f,  9.846406177e-01f,  9.842610471e-01f,  9.838769185e-01f,  9.834882355e-01f,  9.830950017e-01f,
+     9.826972208e-01f,  9.822948966e-01f,  9.818880329e-01f,  9.814766334e-01f,  9.810607021e-01f,  9.806402429e-01f,
+     9.802152597e-01f,  9.797857565e-01f,  9.793517374e-01f,  9.789132065e-01f,  9.784701679e-01f,  9.780226257e-01f,
+     9.775705842e-01f,  9.771140476e-01f,  9.766530202e-01f,  9.761875064e-01f,  9.757175105e-01f,  9.752430370e-01f,
+     9.747640903e-01f,  9.742806750e-01f,  9.737927955e-01f,  9.733004565e-01f,  9.728036627e-01f,  9.723024186e-01f,
+     9.717967291e-01f,  9.712865988e-01f,  9.707720326e-01f,  9.702530353e-01f,  9.697296118e-01f,  9.692017670e-01f,
+     9.686695060e-01f,  9.681328336e-01f,  9.675917550e-01f,  9.670462752e-01f,  9.664963994e-01f,  9.659421328e-01f,
+     9.653834805e-01f,  9.648204479e-01f,  9.642530402e-01f,  9.636812628e-01f,  9.631051211e-01f,  9.625246204e-01f,
+     9.619397663e-01f,  9.613505642e-01f,  9.607570197e-01f,  9.601591384e-01f,  9.595569258e-01f,  9.589503878e-01f,
+     9.583395300e-01f,  9.577243580e-01f,  9.571048779e-01f,  9.564810952e-01f,  9.558530160e-01f,  9.552206461e-01f,
+     9.545839915e-01f,  9.539430582e-01f,  9.532978523e-01f,  9.526483797e-01f,  9.519946466e-01f,  9.513366591e-01f,
+     9.506744235e-01f,  9.500079460e-01f,  9.493372328e-01f,  9.486622904e-01f,  9.479831249e-01f,  9.472997428e-01f,
+     9.466121506e-01f,  9.459203547e-01f,  9.452243616e-01f,  9.445241779e-01f,  9.438198102e-01f,  9.431112651e-01f,
+     9.423985492e-01f,  9.416816693e-01f,  9.409606322e-01f,  9.402354445e-01f,  9.395061132e-01f,  9.387726451e-01f,
+     9.380350471e-01f,  9.372933261e-01f,  9.365474892e-01f,  9.357975433e-01f,  9.350434956e-01f,  9.342853530e-01f,
+     9.335231228e-01f,  9.327568120e-01f,  9.319864281e-01f,  9.312119781e-01f,  9.304334693e-01f,  9.296509092e-01f,
+     9.288643050e-01f,  9.280736642e-01f,  9.272789942e-01f,  9.264803025e-01f,  9.256775966e-01f,  9.248708840e-01f,
+     9.240601724e-01f,  9.232454694e-01f,  9.224267826e-01f,  9.216041198e-01f,  9.207774887e-01f,  9.199468971e-01f,
+     9.191123528e-01f,  9.182738636e-01f,  9.174314375e-01f,  9.165850824e-01f,  9.157348062e-01f,  9.148806169e-01f,
+     9.140225226e-01f,  9.131605314e-01f,  9.122946514e-01f,  9.114248907e-01f,  9.105512575e-01f,  9.096737600e-01f,
+     9.087924066e-01f,  9.079072054e-01f,  9.070181649e-01f,  9.061252933e-01f,  9.052285991e-01f,  9.043280908e-01f,
+     9.034237768e-01f,  9.025156656e-01f,  9.016037657e-01f,  9.006880859e-01f,  8.997686346e-01f,  8.988454205e-01f,
+     8.979184523e-01f,  8.969877388e-01f,  8.960532887e-01f,  8.951151107e-01f,  8.941732138e-01f,  8.932276068e-01f,
+     8.922782986e-01f,  8.913252981e-01f,  8.903686143e-01f,  8.894082562e-01f,  8.884442328e-01f,  8.874765533e-01f,
+     8.865052267e-01f,  8.855302621e-01f,  8.845516688e-01f,  8.835694560e-01f,  8.825836328e-01f,  8.815942086e-01f,
+     8.806011927e-01f,  8.796045945e-01f,  8.786044233e-01f,  8.776006884e-01f,  8.765933995e-01f,  8.755825660e-01f,
+     8.745681973e-01f,  8.735503030e-01f,  8.725288927e-01f,  8.715039761e-01f,  8.704755627e-01f,  8.694436622e-01f,
+     8.684082844e-01f,  8.673694390e-01f,  8.663271358e-01f,  8.652813846e-01f,  8.642321952e-01f,  8.631795775e-01f,
+     8.621235415e-01f,  8.610640970e-01f,  8.600012540e-01f,  8.589350225e-01f,  8.578654126e-01f,  8.567924344e-01f,
+     8.557160979e-01f,  8.546364132e-01f,  8.535533906e-01f,  8.524670402e-01f,  8.513773722e-01f,  8.502843970e-01f,
+     8.491881247e-01f,  8.480885657e-01f,  8.469857304e-01f,  8.458796292e-01f,  8.447702724e-01f,  8.436576704e-01f,
+     8.425418339e-01f,  8.414227732e-01f,  8.403004989e-01f,  8.391750216e-01f,  8.380463518e-01f,  8.369145002e-01f,
+     8.357794774e-01f,  8.346412942e-01f,  8.334999612e-01f,  8.323554891e-01f,  8.312078888e-01f,  8.300571710e-01f,
+     8.289033466e-01f,  8.277464265e-01f,  8.265864215e-01f,  8.254233425e-01f,  8.242572005e-01f,  8.230880065e-01f,
+     8.219157714e-01f,  8.207405064e-01f,  8.195622224e-01f,  8.183809306e-01f,  8.171966421e-01f,  8.160093680e-01f,
+     8.148191195e-01f,  8.136259077e-01f,  8.124297441e-01f,  8.112306397e-01f,  8.100286059e-01f,  8.088236540e-01f,
+     8.076157953e-01f,  8.064050412e-01f,  8.051914031e-01f,  8.039748925e-01f,  8.027555207e-01f,  8.015332993e-01f,
+     8.003082397e-01f,  7.990803535e-01f,  7.978496522e-01f,  7.966161475e-01f,  7.953798509e-01f,  7.941407741e-01f,
+     7.928989287e-01f,  7.916543265e-01f,  7.904069790e-01f,  7.891568982e-01f,  7.879040957e-01f,  7.866485833e-01f,
+     7.853903729e-01f,  7.841294763e-01f,  7.828659054e-01f,  7.815996720e-01f,  7.803307881e-01f,  7.790592656e-01f,
+     7.777851165e-01f,  7.765083528e-01f,  7.752289865e-01f,  7.739470296e-01f,  7.726624942e-01f,  7.713753924e-01f,
+     7.700857364e-01f,  7.687935381e-01f,  7.674988099e-01f,  7.662015639e-01f,  7.649018123e-01f,  7.635995674e-01f,
+     7.622948413e-01f,  7.609876465e-01f,  7.596779951e-01f,  7.583658995e-01f,  7.570513721e-01f,  7.557344252e-01f,
+     7.544150713e-01f,  7.530933227e-01f,  7.517691919e-01f,  7.504426913e-01f,  7.491138335e-01f,  7.477826309e-01f,
+     7.464490961e-01f,  7.451132416e-01f,  7.437750801e-01f,  7.424346240e-01f,  7.410918860e-01f,  7.397468788e-01f,
+     7.383996150e-01f,  7.370501073e-01f,  7.356983684e-01f,  7.343444110e-01f,  7.329882479e-01f,  7.316298918e-01f,
+     7.302693555e-01f,  7.289066518e-01f,  7.275417936e-01f,  7.261747936e-01f,  7.248056648e-01f,  7.234344201e-01f,
+     7.220610723e-01f,  7.206856344e-01f,  7.193081193e-01f,  7.179285400e-01f,  7.165469094e-01f,  7.151632407e-01f,
+     7.137775467e-01f,  7.123898406e-01f,  7.110001354e-01f,  7.096084442e-01f,  7.082147800e-01f,  7.068191561e-01f,
+     7.054215855e-01f,  7.040220814e-01f,  7.026206570e-01f,  7.012173254e-01f,  6.998120999e-01f,  6.984049937e-01f,
+     6.969960200e-01f,  6.955851922e-01f,  6.941725233e-01f,  6.927580269e-01f,  6.913417162e-01f,  6.899236045e-01f,
+     6.885037051e-01f,  6.870820315e-01f,  6.856585970e-01f,  6.842334150e-01f,  6.828064989e-01f,  6.813778622e-01f,
+     6.799475183e-01f,  6.785154806e-01f,  6.770817627e-01f,  6.756463780e-01f,  6.742093401e-01f,  6.727706625e-01f,
+     6.713303587e-01f,  6.698884422e-01f,  6.684449267e-01f,  6.669998257e-01f,  6.655531529e-01f,  6.641049218e-01f,
+     6.626551461e-01f,  6.612038394e-01f,  6.597510154e-01f,  6.582966878e-01f,  6.568408702e-01f,  6.553835764e-01f,
+     6.539248200e-01f,  6.524646149e-01f,  6.510029747e-01f,  6.495399132e-01f,  6.480754441e-01f,  6.466095813e-01f,
+     6.451423386e-01f,  6.436737298e-01f,  6.422037686e-01f,  6.407324690e-01f,  6.392598447e-01f,  6.377859097e-01f,
+     6.363106777e-01f,  6.348341628e-01f,  6.333563787e-01f,  6.318773395e-01f,  6.303970590e-01f,  6.289155511e-01f,
+     6.274328298e-01f,  6.259489091e-01f,  6.244638029e-01f,  6.229775252e-01f,  6.214900900e-01f,  6.200015112e-01f,
+     6.185118030e-01f,  6.170209793e-01f,  6.155290541e-01f,  6.140360416e-01f,  6.125419557e-01f,  6.110468105e-01f,
+     6.095506201e-01f,  6.080533985e-01f,  6.065551600e-01f,  6.050559184e-01f,  6.035556881e-01f,  6.020544830e-01f,
+     6.005523174e-01f,  5.990492054e-01f,  5.975451610e-01f,  5.960401985e-01f,  5.945343321e-01f,  5.930275758e-01f,
+     5.915199440e-01f,  5.900114507e-01f,  5.885021102e-01f,  5.869919367e-01f,  5.854809444e-01f,  5.839691475e-01f,
+     5.824565602e-01f,  5.809431969e-01f,  5.794290717e-01f,  5.779141988e-01f,  5.763985926e-01f,  5.748822673e-01f,
+     5.733652372e-01f,  5.718475166e-01f,  5.703291197e-01f,  5.688100608e-01f,  5.672903543e-01f,  5.657700144e-01f,
+     5.642490554e-01f,  5.627274917e-01f,  5.612053376e-01f,  5.596826074e-01f,  5.581593155e-01f,  5.566354761e-01f,
+     5.551111036e-01f,  5.535862125e-01f,  5.520608169e-01f,  5.505349314e-01f,  5.490085702e-01f,  5.474817477e-01f,
+     5.459544782e-01f,  5.444267763e-01f,  5.428986562e-01f,  5.413701323e-01f,  5.398412190e-01f,  5.383119307e-01f,
+     5.367822818e-01f,  5.352522867e-01f,  5.337219598e-01f,  5.321913155e-01f,  5.306603682e-01f,  5.291291323e-01f,
+     5.275976222e-01f,  5.260658523e-01f,  5.245338372e-01f,  5.230015911e-01f,  5.214691285e-01f,  5.199364638e-01f,
+     5.184036115e-01f,  5.168705859e-01f,  5.153374016e-01f,  5.138040729e-01f,  5.122706143e-01f,  5.107370401e-01f,
+     5.092033650e-01f,  5.076696031e-01f,  5.061357691e-01f,  5.046018774e-01f,  5.030679423e-01f,  5.015339784e-01f,
+     5.000000000e-01f,  4.984660216e-01f,  4.969320577e-01f,  4.953981226e-01f,  4.938642309e-01f,  4.923303969e-01f,
+     4.907966350e-01f,  4.892629599e-01f,  4.877293857e-01f,  4.861959271e-01f,  4.846625984e-01f,  4.831294141e-01f,
+     4.815963885e-01f,  4.800635362e-01f,  4.785308715e-01f,  4.769984089e-01f,  4.754661628e-01f,  4.739341477e-01f,
+     4.724023778e-01f,  4.708708677e-01f,  4.693396318e-01f,  4.678086845e-01f,  4.662780402e-01f,  4.647477133e-01f,
+     4.632177182e-01f,  4.616880693e-01f,  4.601587810e-01f,  4.586298677e-01f,  4.571013438e-01f,  4.555732237e-01f,
+     4.540455218e-01f,  4.525182523e-01f,  4.509914298e-01f,  4.494650686e-01f,  4.479391831e-01f,  4.464137875e-01f,
+     4.448888964e-01f,  4.433645239e-01f,  4.418406845e-01f,  4.403173926e-01f,  4.387946624e-01f,  4.372725083e-01f,
+     4.357509446e-01f,  4.342299856e-01f,  4.327096457e-01f,  4.311899392e-01f,  4.296708803e-01f,  4.281524834e-01f,
+     4.266347628e-01f,  4.251177327e-01f,  4.236014074e-01f,  4.220858012e-01f,  4.205709283e-01f,  4.190568031e-01f,
+     4.175434398e-01f,  4.160308525e-01f,  4.145190556e-01f,  4.130080633e-01f,  4.114978898e-01f,  4.099885493e-01f,
+     4.084800560e-01f,  4.069724242e-01f,  4.054656679e-01f,  4.039598015e-01f,  4.024548390e-01f,  4.009507946e-01f,
+     3.994476826e-01f,  3.979455170e-01f,  3.964443119e-01f,  3.949440816e-01f,  3.934448400e-01f,  3.919466015e-01f,
+     3.904493799e-01f,  3.889531895e-01f,  3.874580443e-01f,  3.859639584e-01f,  3.844709459e-01f,  3.829790207e-01f,
+     3.814881970e-01f,  3.799984888e-01f,  3.785099100e-01f,  3.770224748e-01f,  3.755361971e-01f,  3.740510909e-01f,
+     3.725671702e-01f,  3.710844489e-01f,  3.696029410e-01f,  3.681226605e-01f,  3.666436213e-01f,  3.651658372e-01f,
+     3.636893223e-01f,  3.622140903e-01f,  3.607401553e-01f,  3.592675310e-01f,  3.577962314e-01f,  3.563262702e-01f,
+     3.548576614e-01f,  3.533904187e-01f,  3.519245559e-01f,  3.504600868e-01f,  3.489970253e-01f,  3.475353851e-01f,
+     3.460751800e-01f,  3.446164236e-01f,  3.431591298e-01f,  3.417033122e-01f,  3.402489846e-01f,  3.387961606e-01f,
+     3.373448539e-01f,  3.358950782e-01f,  3.344468471e-01f,  3.330001743e-01f,  3.315550733e-01f,  3.301115578e-01f,
+     3.286696413e-01f,  3.272293375e-01f,  3.257906599e-01f,  3.243536220e-01f,  3.229182373e-01f,  3.214845194e-01f,
+     3.200524817e-01f,  3.186221378e-01f,  3.171935011e-01f,  3.157665850e-01f,  3.143414030e-01f,  3.129179685e-01f,
+     3.114962949e-01f,  3.100763955e-01f,  3.086582838e-01f,  3.072419731e-01f,  3.058274767e-01f,  3.044148078e-01f,
+     3.030039800e-01f,  3.015950063e-01f,  3.001879001e-01f,  2.987826746e-01f,  2.973793430e-01f,  2.959779186e-01f,
+     2.945784145e-01f,  2.931808439e-01f,  2.917852200e-01f,  2.903915558e-01f,  2.889998646e-01f,  2.876101594e-01f,
+     2.862224533e-01f,  2.848367593e-01f,  2.834530906e-01f,  2.820714600e-01f,  2.806918807e-01f,  2.793143656e-01f,
+     2.779389277e-01f,  2.765655799e-01f,  2.751943352e-01f,  2.738252064e-01f,  2.724582064e-01f,  2.710933482e-01f,
+     2.697306445e-01f,  2.683701082e-01f,  2.670117521e-01f,  2.656555890e-01f,  2.643016316e-01f,  2.629498927e-01f,
+     2.616003850e-01f,  2.602531212e-01f,  2.589081140e-01f,  2.575653760e-01f,  2.562249199e-01f,  2.548867584e-01f,
+     2.535509039e-01f,  2.522173691e-01f,  2.508861665e-01f,  2.495573087e-01f,  2.482308081e-01f,  2.469066773e-01f,
+     2.455849287e-01f,  2.442655748e-01f,  2.429486279e-01f,  2.416341005e-01f,  2.403220049e-01f,  2.390123535e-01f,
+     2.377051587e-01f,  2.364004326e-01f,  2.350981877e-01f,  2.337984361e-01f,  2.325011901e-01f,  2.312064619e-01f,
+     2.299142636e-01f,  2.286246076e-01f,  2.273375058e-01f,  2.260529704e-01f,  2.247710135e-01f,  2.234916472e-01f,
+     2.222148835e-01f,  2.209407344e-01f,  2.196692119e-01f,  2.184003280e-01f,  2.171340946e-01f,  2.158705237e-01f,
+     2.146096271e-01f,  2.133514167e-01f,  2.120959043e-01f,  2.108431018e-01f,  2.095930210e-01f,  2.083456735e-01f,
+     2.071010713e-01f,  2.058592259e-01f,  2.046201491e-01f,  2.033838525e-01f,  2.021503478e-01f,  2.009196465e-01f,
+     1.996917603e-01f,  1.984667007e-01f,  1.972444793e-01f,  1.960251075e-01f,  1.948085969e-01f,  1.935949588e-01f,
+     1.923842047e-01f,  1.911763460e-01f,  1.899713941e-01f,  1.887693603e-01f,  1.875702559e-01f,  1.863740923e-01f,
+     1.851808805e-01f,  1.839906320e-01f,  1.828033579e-01f,  1.816190694e-01f,  1.804377776e-01f,  1.792594936e-01f,
+     1.780842286e-01f,  1.769119935e-01f,  1.757427995e-01f,  1.745766575e-01f,  1.734135785e-01f,  1.722535735e-01f,
+     1.710966534e-01f,  1.699428290e-01f,  1.687921112e-01f,  1.676445109e-01f,  1.665000388e-01f,  1.653587058e-01f,
+     1.642205226e-01f,  1.630854998e-01f,  1.619536482e-01f,  1.608249784e-01f,  1.596995011e-01f,  1.585772268e-01f,
+     1.574581661e-01f,  1.563423296e-01f,  1.552297276e-01f,  1.541203708e-01f,  1.530142696e-01f,  1.519114343e-01f,
+     1.508118753e-01f,  1.497156030e-01f,  1.486226278e-01f,  1.475329598e-01f,  1.464466094e-01f,  1.453635868e-01f,
+     1.442839021e-01f,  1.432075656e-01f,  1.421345874e-01f,  1.410649775e-01f,  1.399987460e-01f,  1.389359030e-01f,
+     1.378764585e-01f,  1.368204225e-01f,  1.357678048e-01f,  1.347186154e-01f,  1.336728642e-01f,  1.326305610e-01f,
+     1.315917156e-01f,  1.305563378e-01f,  1.295244373e-01f,  1.284960239e-01f,  1.274711073e-01f,  1.264496970e-01f,
+     1.254318027e-01f,  1.244174340e-01f,  1.234066005e-01f,  1.223993116e-01f,  1.213955767e-01f,  1.203954055e-01f,
+     1.193988073e-01f,  1.184057914e-01f,  1.174163672e-01f,  1.164305440e-01f,  1.154483312e-01f,  1.144697379e-01f,
+     1.134947733e-01f,  1.125234467e-01f,  1.115557672e-01f,  1.105917438e-01f,  1.096313857e-01f,  1.086747019e-01f,
+     1.077217014e-01f,  1.067723932e-01f,  1.058267862e-01f,  1.048848893e-01f,  1.039467113e-01f,  1.030122612e-01f,
+     1.020815477e-01f,  1.011545795e-01f,  1.002313654e-01f,  9.931191414e-02f,  9.839623426e-02f,  9.748433443e-02f,
+     9.657622323e-02f,  9.567190921e-02f,  9.477140087e-02f,  9.387470671e-02f,  9.298183515e-02f,  9.209279460e-02f,
+     9.120759342e-02f,  9.032623996e-02f,  8.944874250e-02f,  8.857510931e-02f,  8.770534861e-02f,  8.683946858e-02f,
+     8.597747737e-02f,  8.511938310e-02f,  8.426519385e-02f,  8.341491765e-02f,  8.256856251e-02f,  8.172613639e-02f,
+     8.088764722e-02f,  8.005310290e-02f,  7.922251128e-02f,  7.839588018e-02f,  7.757321738e-02f,  7.675453061e-02f,
+     7.593982760e-02f,  7.512911600e-02f,  7.432240345e-02f,  7.351969753e-02f,  7.272100582e-02f,  7.192633581e-02f,
+     7.113569500e-02f,  7.034909082e-02f,  6.956653068e-02f,  6.878802194e-02f,  6.801357194e-02f,  6.724318795e-02f,
+     6.647687724e-02f,  6.571464701e-02f,  6.495650445e-02f,  6.420245667e-02f,  6.345251079e-02f,  6.270667386e-02f,
+     6.196495290e-02f,  6.122735490e-02f,  6.049388679e-02f,  5.976455547e-02f,  5.903936783e-02f,  5.831833067e-02f,
+     5.760145078e-02f,  5.688873493e-02f,  5.618018980e-02f,  5.547582207e-02f,  5.477563838e-02f,  5.407964530e-02f,
+     5.338784940e-02f,  5.270025718e-02f,  5.201687512e-02f,  5.133770965e-02f,  5.066276715e-02f,  4.999205399e-02f,
+     4.932557648e-02f,  4.866334088e-02f,  4.800535344e-02f,  4.735162034e-02f,  4.670214774e-02f,  4.605694176e-02f,
+     4.541600845e-02f,  4.477935387e-02f,  4.414698400e-02f,  4.351890479e-02f,  4.289512215e-02f,  4.227564196e-02f,
+     4.166047004e-02f,  4.104961219e-02f,  4.044307415e-02f,  3.984086165e-02f,  3.924298033e-02f,  3.864943583e-02f,
+     3.806023374e-02f,  3.747537961e-02f,  3.689487893e-02f,  3.631873717e-02f,  3.574695976e-02f,  3.517955208e-02f,
+     3.461651946e-02f,  3.405786721e-02f,  3.350360058e-02f,  3.295372480e-02f,  3.240824503e-02f,  3.186716641e-02f,
+     3.133049404e-02f,  3.079823297e-02f,  3.027038820e-02f,  2.974696470e-02f,  2.922796741e-02f,  2.871340120e-02f,
+     2.820327092e-02f,  2.769758137e-02f,  2.719633731e-02f,  2.669954346e-02f,  2.620720449e-02f,  2.571932504e-02f,
+     2.523590970e-02f,  2.475696303e-02f,  2.428248952e-02f,  2.381249364e-02f,  2.334697982e-02f,  2.288595245e-02f,
+     2.242941585e-02f,  2.197737433e-02f,  2.152983213e-02f,  2.108679349e-02f,  2.064826255e-02f,  2.021424346e-02f,
+     1.978474029e-02f,  1.935975709e-02f,  1.893929787e-02f,  1.852336656e-02f,  1.811196710e-02f,  1.770510336e-02f,
+     1.730277915e-02f,  1.690499828e-02f,  1.651176448e-02f,  1.612308145e-02f,  1.573895286e-02f,  1.535938232e-02f,
+     1.498437340e-02f,  1.461392964e-02f,  1.424805451e-02f,  1.388675146e-02f,  1.353002390e-02f,  1.317787517e-02f,
+     1.283030861e-02f,  1.248732747e-02f,  1.214893498e-02f,  1.181513433e-02f,  1.148592867e-02f,  1.116132109e-02f,
+     1.084131464e-02f,  1.052591234e-02f,  1.021511716e-02f,  9.908932016e-03f,  9.607359798e-03f,  9.310403343e-03f,
+     9.018065445e-03f,  8.730348856e-03f,  8.447256284e-03f,  8.168790394e-03f,  7.894953807e-03f,  7.625749099e-03f,
+     7.361178806e-03f,  7.101245416e-03f,  6.845951378e-03f,  6.595299093e-03f,  6.349290921e-03f,  6.107929178e-03f,
+     5.871216135e-03f,  5.639154020e-03f,  5.411745018e-03f,  5.188991268e-03f,  4.970894869e-03f,  4.757457872e-03f,
+     4.548682286e-03f,  4.344570077e-03f,  4.145123165e-03f,  3.950343429e-03f,  3.760232701e-03f,  3.574792770e-03f,
+     3.394025383e-03f,  3.217932240e-03f,  3.046514999e-03f,  2.879775273e-03f,  2.717714633e-03f,  2.560334603e-03f,
+     2.407636664e-03f,  2.259622254e-03f,  2.116292766e-03f,  1.977649549e-03f,  1.843693909e-03f,  1.714427105e-03f,
+     1.589850354e-03f,  1.469964830e-03f,  1.354771661e-03f,  1.244271930e-03f,  1.138466678e-03f,  1.037356901e-03f,
+     9.409435499e-04f,  8.492275331e-04f,  7.622097134e-04f,  6.798909099e-04f,  6.022718974e-04f,  5.293534066e-04f,
+     4.611361237e-04f,  3.976206908e-04f,  3.388077058e-04f,  2.846977223e-04f,  2.352912495e-04f,  1.905887524e-04f,
+     1.505906519e-04f,  1.152973244e-04f,  8.470910209e-05f,  5.882627289e-05f,  3.764908043e-05f,  2.117772402e-05f,
+     9.412358699e-06f,  2.353095212e-06f,
+};
+
+#endif // SPECTRAL_FFT_SIZE == 2048
+
+#endif // DSP_SPECTRAL_TABLES_H
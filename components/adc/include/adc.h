@@ -9,14 +9,29 @@
     #include "freertos/FreeRTOS.h"
     #include "freertos/task.h"
     // #include "esp_log.h"
-    // #include "esp_err.h"
+    #include "esp_err.h"
+    #include "esp_timer.h"              // Sample timestamps
+    #include "sdkconfig.h"              // CONFIG_IDF_TARGET_LINUX (host build)
 
     /* --- ADC --- */
+#if !CONFIG_IDF_TARGET_LINUX
     #include "esp_adc/adc_oneshot.h"    // For ADC HW interation
+    #include "esp_adc/adc_continuous.h" // For DMA (continuous) acquisition
     #include "esp_adc/adc_cali.h"       // For voltage calibration
+#endif
 
-    /* --- [  ] --- */
-    #include "freertos/semphr.h"
+    /* --- Shared Buffer --- */
+    #include "adc_rate.h"               // Acquisition mode + pipeline rate (plain macros)
+    #include "adc_ring.h"               // Lock-free SPSC sample ring
+    #include "dsp_biquad.h"             // Cascaded biquad (block) filters
+    #include "dsp_bandpower.h"          // Goertzel + sliding band power
+    #include "dsp_fixed.h"              // Q15 kernels + DSP_BACKEND switch
+    #include "dsp_spectral.h"           // Multi-band FFT / Welch engine
+    #include "dsp_robust.h"             // Streaming median / MAD (adaptive blink threshold)
+    #include "latency_hist.h"           // Per-stage pipeline latency histograms
+    #include "adc_clock.h"              // Sample clock (gptimer / simulated) + jitter statistics
+    #include "dsp_graph.h"              // Static stage graph (per-stage cycle counters)
+    #include "mem_budget.h"             // Static footprint tables
 
 // =============================
 // Application Log Tag
@@ -28,25 +43,75 @@
 // =============================
 // Global Declarations (For cross-file access)
 // =============================
+// Driver handles live in adc_driver.c, which the host (linux target) build leaves out:
+// there the pipeline is fed from an adc_source_t (see adc_source.h) instead.
+#if !CONFIG_IDF_TARGET_LINUX
 extern adc_oneshot_unit_handle_t adc_handle;  // ADC driver handle
 extern adc_cali_handle_t adc_cali_handle;     // ADC Calibration handle
+extern adc_continuous_handle_t adc_cont_handle;  // ADC continuous (DMA) driver handle
+#endif
 
 
 // =============================
 // ADC Configuration (Exposed for ADC.c)
 // =============================
 #define ADC_UNIT       ADC_UNIT_1
-#define ADC_CHANNEL    ADC_CHANNEL_6   // GPIO34
-#define BUFFER_SIZE    256             // Circular buffer length
-#define ADC_SAMPLE_PERIOD_MS 10.0       // Sampling period (ms)
+#define ADC_CHANNEL    ADC_CHANNEL_6   // GPIO34 (channel 0 of every frame)
+#define BUFFER_SIZE    256             // Circular buffer length (frames)
+
+// Electrode channels sampled together. Frames are interleaved: adc_buffer holds
+// ch0, ch1, ..., chN-1 for frame 0, then frame 1, ... (see adc_channel_map in adc_driver.c).
+#ifndef ADC_NUM_CHANNELS
+#define ADC_NUM_CHANNELS  1
+#endif
+#if ADC_NUM_CHANNELS < 1 || ADC_NUM_CHANNELS > 8
+#error "ADC_NUM_CHANNELS must be 1..8 (ADC1 channels)"
+#endif
+
+// Acquisition mode, converter rate, oversampling and the pipeline rate: adc_rate.h
+
+#define ADC_SAMPLE_PERIOD_MS (1000.0 / ADC_PIPELINE_RATE_HZ)  // Sampling period (ms)
 #define SAMPLE_RATE_HZ (1000 / ADC_SAMPLE_PERIOD_MS)  // Derived rate
-#define REFRACTORY_PERIOD_SAMPLES 20  // 200 ms at 100 Hz
+#define ADC_SAMPLE_PERIOD_US ((uint32_t)(ADC_SAMPLE_PERIOD_MS * 1000))  // Pipeline sample period (us)
+#define ADC_ACQ_PERIOD_US    (1000000u / ADC_ACQ_RATE_HZ)              // Timer mode alarm period
+#define REFRACTORY_PERIOD_SAMPLES ((int)(SAMPLE_RATE_HZ / 5))  // 200 ms (20 at 100 Hz)
+#define ATTENTION_UPDATE_SAMPLES  ((int)(SAMPLE_RATE_HZ / 2))  // 0.5 s (50 at 100 Hz)
 
 
 // =============================
 // Circular Buffer & Index (Exposed for ADC.c)
-extern int16_t adc_buffer[BUFFER_SIZE];
-extern volatile size_t buffer_index; // producer increments after write
+// =============================
+// adc_buffer is the storage behind adc_ring (sequence-numbered SPSC ring, see adc_ring.h).
+// buffer_index mirrors the producer's write slot (in frames) for code that still indexes
+// adc_buffer directly; with one channel a frame is a single sample.
+#if !CONFIG_IDF_TARGET_LINUX
+extern const adc_channel_t adc_channel_map[ADC_NUM_CHANNELS];  // Frame slot -> ADC1 channel
+#endif
+extern int16_t adc_buffer[BUFFER_SIZE * ADC_NUM_CHANNELS];
+extern volatile size_t buffer_index; // producer updates after each write
+extern adc_ring_t adc_ring;          // Producer: adc_sampling / Consumer: adc_filtering
+extern uint32_t adc_stamp_us[BUFFER_SIZE];  // Acquisition time of the frame in each adc_ring slot
+
+// Sampling jitter: std dev of the interval between acquisition stamps (oneshot + timer modes;
+// continuous mode is paced by the converter clock and delivers frames in DMA bursts). Tracked
+// per conversion, so at ADC_ACQ_RATE_HZ when the oversampling front end is on.
+#define ADC_JITTER_WINDOW_S  10       // Statistics window; published + logged, then restarted
+extern adc_jitter_t adc_sample_jitter;       // Current window (sampling task only)
+extern volatile float adc_clock_jitter_us;   // Last completed window
+extern volatile uint32_t adc_clock_max_us;  // Longest interval in the last completed window
+extern volatile uint32_t adc_timer_missed;   // Timer mode: ticks that fired before the previous sample was taken
+
+#define ADC_DRAIN_BLOCK 32           // Frames copied out of the ring per read
+
+// Filtered frames, republished for the raw waveform stream (same layout as adc_buffer)
+#define FILTERED_BUFFER_SIZE 512     // 0.5 s @ 1 kHz of slack for the BLE task
+extern int16_t filtered_buffer[FILTERED_BUFFER_SIZE * ADC_NUM_CHANNELS];
+extern adc_ring_t filtered_ring;     // Producer: adc_filtering / Consumer: BLE stream task
+extern uint32_t filtered_stamp_us[FILTERED_BUFFER_SIZE];  // Acquisition time, per filtered_ring slot
+
+// Sample timestamps are the low 32 bits of esp_timer_get_time() (us, wraps after ~71 min);
+// differences between two stamps are wrap-safe in uint32_t arithmetic.
+static inline uint32_t adc_now_us(void) { return (uint32_t)esp_timer_get_time(); }
 
 
 // =============================
@@ -55,11 +120,109 @@ extern volatile size_t buffer_index; // producer increments after write
 extern volatile uint32_t blink_count;
 extern volatile uint8_t attention_level;
 
+// Event notifications: detect_events() sets these bits on the listener task (xTaskNotify),
+// so a consumer can sleep in xTaskNotifyWait() instead of polling the metrics above.
+#define ADC_EVENT_BLINK      (1u << 0)   // blink_count incremented
+#define ADC_EVENT_ATTENTION  (1u << 1)   // attention_level changed (checked every ATTENTION_UPDATE_SAMPLES)
+extern volatile int64_t blink_event_us;       // esp_timer time of the last blink detection
+extern volatile int64_t attention_event_us;   // esp_timer time of the last attention notification
+extern volatile uint32_t blink_sample_us;     // Acquisition stamp of the frame that triggered the last blink
+
+// Adaptive blink threshold: a sample-to-sample step counts as a blink when it is more than
+// BLINK_MAD_K MADs away from the median step of its channel (both tracked over the last
+// BLINK_STATS_WINDOW samples), so it follows electrode impedance and amplifier gain. Until the
+// first window completes the old fixed threshold applies.
+#define BLINK_STATS_WINDOW    ((int)(SAMPLE_RATE_HZ * 2))   // 2 s; a new estimate every 1 s
+#define BLINK_MAD_K           6.0f
+#define BLINK_THRESHOLD_INIT  20      // µV step before the first estimate
+#define BLINK_THRESHOLD_MIN   3       // Floor: a flat line with ±1 LSB of jitter never triggers
+void adc_set_event_listener(TaskHandle_t task);  // NULL = no listener
+
+// Recording tap: an optional observer (e.g. the flash recorder) called from the filtering task
+// with every raw block before it is filtered, and with every event as it fires. Must not block.
+typedef struct {
+    void (*frames)(const int16_t *frames, const uint32_t *stamps, size_t count);  // stamps may be NULL
+    void (*event)(uint32_t event, uint32_t stamp_us, uint32_t value);             // value: count / level
+} adc_tap_t;
+void adc_set_tap(const adc_tap_t *tap);           // NULL = no tap
+
+#define ALPHA_BAND_BINS 5                      // 8, 9, 10, 11, 12 Hz
+
+extern eeg_band_powers_t eeg_bands;            // Latest delta..gamma estimate, averaged over channels
+extern volatile uint32_t spectral_update_us;   // CPU time of the block that produced the last estimate
+extern volatile uint32_t spectral_update_max_us;
+
 
 // =============================
-// Synchronization Primitives
+// Pipeline Stage Graph
 // =============================
-extern SemaphoreHandle_t adc_mutex;
+//
+// adc_process_block() runs one dsp_graph_t (dsp_graph.h) built by adc_pipeline_init(), every
+// stage state carved out of one static arena:
+//
+//      notch -> bandpass -> publish -> detect -> spectral
+//
+//      notch     mains notch at ADC_NOTCH_HZ (built only below the Nyquist frequency, see below)
+//      bandpass  0.5-30 Hz (bp_a / bp_b)
+//      publish   filtered frames + acquisition stamps -> filtered_ring
+//      detect    blinks (adaptive step threshold) + attention (sliding alpha power), frame by frame
+//      spectral  Welch band powers -> eeg_bands
+//
+// Blink and attention share one stage so their events still fire in frame order. The states
+// below are reachable through the adc_*_state pointers once the graph is built.
+//
+// At the default 100 Hz pipeline rate 50 Hz mains sits on the Nyquist frequency, where the
+// bandpass already has a zero (b1 = 0, b2 = -b0), so no notch stage is built there.
+#ifndef ADC_NOTCH_HZ
+#define ADC_NOTCH_HZ     50                    // Mains frequency (60 in the Americas); 0 = no notch
+#endif
+#define ADC_NOTCH_Q      30.0f                 // Centre frequency / -3 dB width (~1.7 Hz at 50 Hz)
+#define ADC_NOTCH_ENABLED  (ADC_NOTCH_HZ > 0 && 2 * ADC_NOTCH_HZ < ADC_PIPELINE_RATE_HZ)
+
+typedef struct {
+    biquad_multi_t filter;                     // Float in both backends: a narrow notch does not fit Q14
+} adc_notch_stage_t;
+
+typedef struct {
+#if DSP_BACKEND == DSP_BACKEND_FIXED
+    biquad_q15_t filter;                       // bp_a / bp_b quantized, one state per channel
+#else
+    biquad_multi_t filter;                     // bp_a / bp_b, one state per channel
+#endif
+} adc_bandpass_stage_t;
+
+typedef struct {
+    /* --- Blink --- */
+    robust_stats_t stats[ADC_NUM_CHANNELS];    // Median / MAD of the step, per channel
+    float    threshold[ADC_NUM_CHANNELS];      // Current step threshold, per channel
+    int16_t  prev[ADC_NUM_CHANNELS];           // Previous filtered sample (step input)
+    uint16_t refractory;                       // Debounce counter (shared by every channel)
+
+    /* --- Attention --- */
+#if DSP_BACKEND == DSP_BACKEND_FIXED
+    sliding_dft_q15_t alpha[ADC_NUM_CHANNELS]; // Sliding alpha power, one per channel
+#else
+    sliding_dft_t alpha[ADC_NUM_CHANNELS];
+#endif
+    int16_t  alpha_history[ADC_NUM_CHANNELS][BUFFER_SIZE];   // Same window length as the batch score
+    uint16_t attention_counter;                // Frames since the last attention check
+    uint8_t  attention_notified;               // Level last sent to the listener
+} adc_detect_stage_t;
+
+typedef struct {
+    spectral_engine_t engine[ADC_NUM_CHANNELS];  // ~2.3 KB each at 100 Hz, ~17 KB at 1 kHz
+    eeg_band_powers_t bands[ADC_NUM_CHANNELS];   // Latest estimate per channel
+} adc_spectral_stage_t;
+
+#define ADC_GRAPH_ARENA_BYTES  ((ADC_NOTCH_ENABLED ? DSP_GRAPH_SLOT(sizeof(adc_notch_stage_t)) : 0) + \
+                                DSP_GRAPH_SLOT(sizeof(adc_bandpass_stage_t)) + \
+                                DSP_GRAPH_SLOT(sizeof(adc_detect_stage_t)) + DSP_GRAPH_SLOT(sizeof(adc_spectral_stage_t)))
+
+extern dsp_graph_t adc_graph;
+extern adc_notch_stage_t    *adc_notch_state;      // NULL when no notch stage is built
+extern adc_bandpass_stage_t *adc_bandpass_state;
+extern adc_detect_stage_t   *adc_detect_state;
+extern adc_spectral_stage_t *adc_spectral_state;
 
 
 // =============================
@@ -74,32 +237,54 @@ extern float bp_y[2];   // IIR Output History (for test reset)
 // =============================
 // Helper: Push New Sample into ADC Buffer
 // =============================
-void adc_push_sample(int16_t sample);
+void adc_push_sample(int16_t sample);             // Same value on every channel
+void adc_push_frame(const int16_t *frame);        // ADC_NUM_CHANNELS interleaved values, stamped now
+void adc_push_frame_at(const int16_t *frame, uint32_t stamp_us);  // Stamped with the acquisition time
+void adc_jitter_track(uint32_t stamp_us);         // Add one stamp to adc_sample_jitter; publishes every window
 
 
 // =============================
 // Main Functions:
 // =============================
 
+#if !CONFIG_IDF_TARGET_LINUX
     // =============================
     /* ADC Unit Initialization + Channel Configuration + Calibration */
     // ============================= 
-    adc_oneshot_unit_handle_t init_adc(void);
-    // Returns a handle to the initialized ADC unit.
+    esp_err_t init_adc(void);
+    // Brings up the oneshot (also used by timer mode) or continuous driver (see ADC_ACQ_MODE).
+    // Returns ESP_OK on success.
 
     // =============================
     // FreeRTOS Task: ADC Sampling
     // =============================
     void adc_sampling(void *arg);
+#endif
 
 
     // =============================
     // FreeRTOS Task: Filtering
     // =============================
     void adc_filtering(void *arg);
-    int16_t apply_bandpass_iir(int16_t input);      // Bandpass filter
-    void detect_events(int16_t filtered_current);   // Blink & alpha detection
-    uint8_t compute_alpha_score(const int16_t* window, size_t len);  // Goertzel-based
+    void adc_pipeline_init(void);                   // (Re)build adc_graph: every stage state fresh, counters cleared
+    void adc_pipeline_apply_demand(uint32_t demand);  // Enable only the stages someone reads (POWER_DEMAND_* mask)
+    void adc_process_block(const int16_t *block, const uint32_t *stamps, size_t frames);  // Runs adc_graph (stamps: acquisition us per frame, NULL = now)
+    int16_t apply_bandpass_iir(int16_t input);      // Bandpass filter (one sample)
+    void apply_bandpass_iir_block(const int16_t *in, int16_t *out, size_t frames);  // Bandpass stage alone (interleaved frames)
+    void detect_events(int16_t filtered_current);   // Detect + spectral stages (same value on every channel)
+    void detect_events_frame(const int16_t *filtered);  // Detect + spectral stages, one filtered frame
+    uint8_t compute_alpha_score(const int16_t* window, size_t len);  // Goertzel-based (batch)
+    uint8_t alpha_power_to_score(float power);      // Shared 0–100 scaling
+    float alpha_tracker_power(int ch);              // Current alpha band power of one channel (either backend)
+
+
+// =============================
+// Static Footprint (mem_budget.h)
+// =============================
+extern const mem_budget_table_t adc_mem_budget;         // Rings, stamps, stage graph + arena, block buffers
+#if !CONFIG_IDF_TARGET_LINUX
+extern const mem_budget_table_t adc_driver_mem_budget;  // Decimation chain + DMA / decimation buffers
+#endif
 
 
 #endif // ADC_H
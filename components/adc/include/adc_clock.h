@@ -0,0 +1,106 @@
+#ifndef ADC_CLOCK_H
+#define ADC_CLOCK_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include "esp_err.h"
+
+
+// =============================
+// Sample Clock Interface
+// =============================
+//
+// A sample clock calls `on_tick` once per period with the time the tick fired (us, low 32 bits
+// of esp_timer). The timer-driven acquisition mode (ADC_ACQ_MODE_TIMER) wakes the sampling
+// task from the tick, so the sampling instants follow the timer instead of vTaskDelay() +
+// loop body + tick rounding.
+//
+//      gptimer   : hardware alarm, auto-reload, callback in ISR context          (device only)
+//      simulated : ticks fired by adc_clock_sim_advance(), optional jitter       (host tests)
+//
+// `on_tick` may run in an ISR: it must be short, IRAM-safe, and return true if it woke a
+// higher-priority task (the gptimer driver then yields on ISR exit).
+typedef bool (*adc_clock_tick_fn)(void *arg, uint32_t now_us);
+
+typedef struct adc_clock adc_clock_t;
+
+struct adc_clock {
+    const char *name;
+    esp_err_t (*start)(adc_clock_t *clk, uint32_t period_us, adc_clock_tick_fn on_tick, void *arg);
+    void      (*stop)(adc_clock_t *clk);
+};
+
+static inline esp_err_t adc_clock_start(adc_clock_t *clk, uint32_t period_us, adc_clock_tick_fn on_tick, void *arg) {
+    return clk->start(clk, period_us, on_tick, arg);
+}
+
+static inline void adc_clock_stop(adc_clock_t *clk) {
+    clk->stop(clk);
+}
+
+
+// =============================
+// Simulated Clock (Host Tests)
+// =============================
+// Ticks land on the nominal grid start_us + k * period_us, each displaced by a deterministic
+// uniform offset in [-jitter_us, +jitter_us] (0 = perfect clock). Nothing fires on its own:
+// adc_clock_sim_advance() moves time forward and fires every tick that became due.
+typedef struct {
+    adc_clock_t base;
+    uint32_t period_us;
+    uint32_t now_us;                // Simulated time
+    uint32_t next_us;               // Nominal time of the next tick
+    uint32_t jitter_us;
+    uint32_t rng;                   // xorshift32 state
+    bool     running;
+    adc_clock_tick_fn on_tick;
+    void    *arg;
+    uint32_t ticks;                 // Ticks fired
+} adc_clock_sim_t;
+
+adc_clock_t *adc_clock_sim_init(adc_clock_sim_t *sim, uint32_t start_us, uint32_t jitter_us, uint32_t seed);
+void adc_clock_sim_advance(adc_clock_sim_t *sim, uint32_t us);
+
+
+// =============================
+// Hardware Clock: gptimer (Device Only)
+// =============================
+// 1 MHz general-purpose timer with an auto-reloading alarm at the sample period. Defined in
+// adc_driver.c.
+typedef struct {
+    adc_clock_t base;
+    void *timer;                    // gptimer_handle_t (kept opaque: no driver headers here)
+    adc_clock_tick_fn on_tick;
+    void *arg;
+} adc_clock_gptimer_t;
+
+adc_clock_t *adc_clock_gptimer_init(adc_clock_gptimer_t *clk);
+
+
+// =============================
+// Sampling Jitter (Inter-Sample Interval Statistics)
+// =============================
+// Feed it the stamp of every sample; it tracks the interval between consecutive stamps with
+// Welford's running mean / variance. Jitter = standard deviation of the interval.
+typedef struct {
+    bool     anchored;              // A first stamp has been seen
+    uint32_t last_us;
+    uint32_t count;                 // Intervals seen (stamps - 1)
+    float    mean_us;
+    float    m2;                    // Sum of squared deviations from the mean
+    uint32_t min_us;
+    uint32_t max_us;
+} adc_jitter_t;
+
+void  adc_jitter_reset(adc_jitter_t *jitter);
+void  adc_jitter_add(adc_jitter_t *jitter, uint32_t stamp_us);
+float adc_jitter_stddev_us(const adc_jitter_t *jitter);
+
+
+#endif // ADC_CLOCK_H
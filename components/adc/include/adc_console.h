@@ -0,0 +1,22 @@
+#ifndef ADC_CONSOLE_H
+#define ADC_CONSOLE_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include "esp_err.h"
+
+
+// =============================
+// Console Command: stages
+// =============================
+//
+//      stages          per-stage calls / frames / cycles per frame / worst call / share of
+//                      the pipeline, from the adc_graph counters (dsp_graph.h)
+//      stages reset    clear the counters to start a fresh measurement
+esp_err_t adc_console_register(void);
+
+
+#endif // ADC_CONSOLE_H
@@ -0,0 +1,102 @@
+#ifndef ADC_FRAME_H
+#define ADC_FRAME_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+
+
+// =============================
+// DMA Frame Layout (Continuous Mode)
+// =============================
+//
+// The adc_continuous driver hands us raw DMA frames: a packed array of conversion results.
+// On the ESP32 every result is a 16-bit little-endian word (TYPE1 output format):
+//
+//      bits  0..11 : raw conversion (0–4095)
+//      bits 12..15 : ADC channel that produced it
+//
+// Decoding lives here (no driver headers) so it can be unit-tested on a Linux host
+// using the mock frame source below.
+#define ADC_FRAME_RESULT_BYTES   2        // Bytes per conversion result (TYPE1)
+#define ADC_FRAME_DATA_MASK      0x0FFF   // 12-bit conversion
+#define ADC_FRAME_CHANNEL_SHIFT  12       // Channel id lives in the upper nibble
+
+
+// =============================
+// Frame Decoder State
+// =============================
+//
+// The ADC hardware usually converts faster than we want samples (the ESP32 DMA path cannot
+// run below 20 kHz), so the decoder averages `oversample` conversions into one output sample.
+// Partial sums are carried across DMA frames, so frame boundaries never drop or bias a sample.
+//
+// With several channels in the scan pattern, results are routed by their channel id to a slot
+// and the decoder emits one interleaved sample frame (slot 0, slot 1, ...) once every slot has
+// its conversions.
+#define ADC_FRAME_MAX_SLOTS   8         // ADC1 has 8 channels
+#define ADC_FRAME_NO_SLOT     0xFF
+
+typedef struct {
+    uint8_t  num_slots;                       // Channels per output frame
+    uint8_t  slot_of[1 << (16 - ADC_FRAME_CHANNEL_SHIFT)];  // ADC channel id -> slot
+    uint32_t oversample;                      // Conversions averaged per output sample (>= 1)
+    uint32_t acc[ADC_FRAME_MAX_SLOTS];        // Running sums of the current output frame
+    uint32_t acc_count[ADC_FRAME_MAX_SLOTS];  // Conversions accumulated per slot
+    uint32_t dropped;                         // Results skipped (unknown channel / no room)
+} adc_frame_decoder_t;
+
+
+// =============================
+// Mock Frame Source (Host Tests)
+// =============================
+//
+// Generates frames in the same byte layout the DMA produces: a sine of `amplitude` counts
+// around `offset`, sampled at `conv_rate_hz`. Every `foreign_every` results (0 = never) a
+// result tagged with `foreign_channel` is inserted to exercise channel filtering.
+// With `num_channels` > 1 the scan pattern cycles through channel, channel + 1, ... and
+// channel k's sine is shifted up by k * `channel_step` counts so slots can be told apart.
+typedef struct {
+    uint8_t  channel;
+    uint8_t  num_channels;
+    float    channel_step;
+    uint8_t  foreign_channel;
+    uint32_t foreign_every;
+    float    conv_rate_hz;
+    float    freq_hz;
+    float    amplitude;
+    float    offset;
+    uint32_t n;             // Conversion counter (phase of the sine)
+    uint32_t emitted;       // Results written so far (drives foreign insertion)
+} adc_frame_mock_t;
+
+
+// =============================
+// Frame Decoder API
+// =============================
+// `channels[i]` is the ADC channel id stored in slot i of every output frame.
+void adc_frame_decoder_init(adc_frame_decoder_t *dec, const uint8_t *channels, uint8_t num_channels,
+                            uint32_t oversample);
+
+// Decodes `len` bytes of DMA data. Writes at most `max_frames` interleaved frames of averaged
+// raw samples (num_channels values each) to `out` and returns how many frames were produced.
+size_t adc_frame_decode(adc_frame_decoder_t *dec, const uint8_t *frame, size_t len,
+                        int *out, size_t max_frames);
+
+
+// =============================
+// Mock Frame Source API
+// =============================
+void adc_frame_mock_init(adc_frame_mock_t *mock, uint8_t channel, float conv_rate_hz,
+                         float freq_hz, float amplitude, float offset);
+
+// Fills `len` bytes (rounded down to whole results) and returns the bytes written.
+size_t adc_frame_mock_fill(adc_frame_mock_t *mock, uint8_t *frame, size_t len);
+
+
+#endif // ADC_FRAME_H
@@ -0,0 +1,56 @@
+#ifndef ADC_RATE_H
+#define ADC_RATE_H
+
+// =============================
+// Acquisition Mode + Pipeline Rate
+// =============================
+//
+// Plain macros, no driver types: the DSP modules that size their buffers by the pipeline rate
+// (dsp_spectral.h) include this without pulling in the ADC driver headers. Override any of
+// the #ifndef values from the build (CFLAGS / -D).
+
+// Acquisition mode: init_adc() brings up the matching driver
+#define ADC_ACQ_MODE_ONESHOT     0     // adc_oneshot_read() polled by adc_sampling()
+#define ADC_ACQ_MODE_CONTINUOUS  1     // adc_continuous DMA frames
+#define ADC_ACQ_MODE_TIMER       2     // adc_oneshot_read() triggered by a gptimer alarm (see adc_clock.h)
+#ifndef ADC_ACQ_MODE
+#define ADC_ACQ_MODE   ADC_ACQ_MODE_ONESHOT
+#endif
+
+// Continuous mode: converter output rate (250 / 500 / 1000 / 2000 Hz) and DMA frame size
+#ifndef ADC_CONV_RATE_HZ
+#define ADC_CONV_RATE_HZ      1000
+#endif
+#define ADC_CONV_FRAME_BYTES  256      // Bytes per DMA frame (128 conversions)
+#define ADC_CONV_POOL_BYTES   (4 * ADC_CONV_FRAME_BYTES)  // Driver-side frame pool
+
+// Oversampling front end: the sampling task converts ADC_DECIM_FACTOR times faster than the
+// pipeline runs and decimates with a polyphase FIR chain (dsp_decim.h), which keeps aliases out
+// of the EEG band and averages the converter noise down. 1 = off (one conversion per sample).
+// Needs a hardware clock: timer mode (e.g. 10 -> 1 kHz conversions) or continuous mode
+// (ADC_CONV_RATE_HZ / ADC_DECIM_FACTOR must be a pipeline rate below).
+#ifndef ADC_DECIM_FACTOR
+#define ADC_DECIM_FACTOR      1
+#endif
+#define ADC_DECIM_GAIN_BITS   3        // Fraction bits kept below one ADC count (12 + 3 fits int16_t)
+
+#if ADC_ACQ_MODE == ADC_ACQ_MODE_CONTINUOUS
+#if ADC_CONV_RATE_HZ != 250 && ADC_CONV_RATE_HZ != 500 && ADC_CONV_RATE_HZ != 1000 && ADC_CONV_RATE_HZ != 2000
+#error "ADC_CONV_RATE_HZ must be 250, 500, 1000 or 2000"
+#endif
+#define ADC_PIPELINE_RATE_HZ  (ADC_CONV_RATE_HZ / ADC_DECIM_FACTOR)
+#else
+#define ADC_PIPELINE_RATE_HZ  100
+#endif
+#if ADC_DECIM_FACTOR < 1 || ADC_DECIM_FACTOR > 32
+#error "ADC_DECIM_FACTOR must be 1..32"
+#elif ADC_DECIM_FACTOR > 1 && ADC_ACQ_MODE == ADC_ACQ_MODE_ONESHOT
+#error "ADC_DECIM_FACTOR > 1 needs ADC_ACQ_MODE_TIMER or ADC_ACQ_MODE_CONTINUOUS"
+#endif
+#if ADC_PIPELINE_RATE_HZ != 100 && ADC_PIPELINE_RATE_HZ != 250 && ADC_PIPELINE_RATE_HZ != 500 && ADC_PIPELINE_RATE_HZ != 1000
+#error "Pipeline rate (ADC_CONV_RATE_HZ / ADC_DECIM_FACTOR) must be 100, 250, 500 or 1000 Hz"
+#endif
+#define ADC_ACQ_RATE_HZ  (ADC_PIPELINE_RATE_HZ * ADC_DECIM_FACTOR)   // Conversions per second per channel
+
+
+#endif // ADC_RATE_H
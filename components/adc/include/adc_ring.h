@@ -0,0 +1,66 @@
+#ifndef ADC_RING_H
+#define ADC_RING_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdatomic.h>   // Producer/consumer ordering without a mutex
+
+
+// =============================
+// Lock-Free SPSC Sample Ring
+// =============================
+//
+// One producer (adc_sampling) and one consumer (adc_filtering) share a power-of-two ring.
+// Every sample gets a monotonically increasing 32-bit sequence number; the slot it lives in
+// is `seq & mask`. Neither side ever blocks:
+//
+//   - The producer always writes (a sampler must not stall) and then publishes `head`.
+//   - The consumer drains everything between its own `tail` and `head`. If the producer has
+//     lapped it, the lost samples are skipped and reported as an explicit overrun count.
+//     At most size - 1 samples can be pending: the oldest slot is always the next one written.
+//
+// Sequence arithmetic is modulo 2^32, so wrap-around of the counters is harmless.
+//
+// Each entry is a frame of `width` int16_t values (one per channel, interleaved), so a
+// multi-channel sample set is published atomically under a single sequence number.
+typedef struct {
+    int16_t *data;              // Storage (size * width values)
+    uint32_t mask;              // size - 1
+    uint8_t  width;             // Values per entry (channels per frame)
+    _Atomic uint32_t head;      // Next sequence to write   (written by producer only)
+    uint32_t tail;              // Next sequence to read    (written by consumer only)
+    uint32_t overruns;          // Total samples lost       (written by consumer only)
+} adc_ring_t;
+
+// Static initializer: `size` must be a power of two
+#define ADC_RING_INIT(storage, size, frame_width) \
+    { .data = (storage), .mask = (size) - 1, .width = (frame_width), .head = 0, .tail = 0, .overruns = 0 }
+
+
+// =============================
+// Ring API
+// =============================
+// `storage` must hold size * width values; `size` must be a power of two.
+void adc_ring_init(adc_ring_t *ring, int16_t *storage, uint32_t size, uint8_t width);
+
+// Producer: store one frame (`width` values); returns its sequence number. Wait-free.
+uint32_t adc_ring_push_frame(adc_ring_t *ring, const int16_t *frame);
+
+// Producer shorthand for width-1 rings only (asserted); wider rings take adc_ring_push_frame
+uint32_t adc_ring_push(adc_ring_t *ring, int16_t sample);
+
+// Consumer: copy up to `max` unread frames (oldest first, interleaved) into `out`.
+// `first_seq` receives the sequence number of the first frame; `lost` (optional) the number
+// of frames skipped because the producer overwrote them before they were read. Wait-free.
+size_t adc_ring_read(adc_ring_t *ring, int16_t *out, size_t max, uint32_t *first_seq, uint32_t *lost);
+
+// Number of frames published but not yet read (may exceed the ring size after an overrun)
+uint32_t adc_ring_pending(const adc_ring_t *ring);
+
+
+#endif // ADC_RING_H
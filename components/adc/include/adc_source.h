@@ -0,0 +1,172 @@
+#ifndef ADC_SOURCE_H
+#define ADC_SOURCE_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdio.h>      // FILE (file source)
+
+
+// =============================
+// Acquisition Source Interface
+// =============================
+//
+// Anything that produces interleaved sample frames (channels values per frame, 0.1 mV units,
+// the same scale adc_store_raw() writes) can drive the filter -> detect pipeline:
+//
+//      synthetic  : sines + blinks + noise, deterministic, no hardware      (host + device)
+//      file       : CSV text or raw int16 little-endian recordings          (host + device VFS)
+//      edf        : EDF / EDF+ recordings (the usual clinical EEG export)   (host + device VFS)
+//      oneshot    : the real adc_oneshot driver, paced by vTaskDelay        (device only)
+//
+// Each source embeds adc_source_t as its first member, so a pointer to it is a source.
+// `read` fills up to `max_frames` frames and returns how many; 0 means end of stream.
+typedef struct adc_source adc_source_t;
+
+struct adc_source {
+    const char *name;
+    uint8_t channels;               // Values per frame
+    float   sample_rate_hz;         // Nominal rate of the frames
+    size_t (*read)(adc_source_t *src, int16_t *frames, size_t max_frames);
+    void   (*close)(adc_source_t *src);   // Optional
+};
+
+static inline size_t adc_source_read(adc_source_t *src, int16_t *frames, size_t max_frames) {
+    return src->read(src, frames, max_frames);
+}
+
+static inline void adc_source_close(adc_source_t *src) {
+    if (src->close) src->close(src);
+}
+
+
+// =============================
+// Synthetic Source (Sines + Blinks + Noise)
+// =============================
+#define ADC_SYNTH_MAX_TONES  4
+
+typedef struct {
+    float freq_hz;
+    float amplitude;                // Peak, 0.1 mV units
+} adc_synth_tone_t;
+
+typedef struct {
+    float    sample_rate_hz;
+    float    offset;                // DC level (electrode offset)
+    adc_synth_tone_t tones[ADC_SYNTH_MAX_TONES];
+    uint8_t  num_tones;
+    float    noise_amplitude;       // Uniform noise, +/- this much, independent per channel
+    float    blink_amplitude;       // Half-sine blink pulse height (0 = no blinks)
+    float    blink_interval_s;      // Time between blink onsets
+    float    blink_width_s;         // Pulse duration (~0.3 s for a real blink)
+    uint32_t seed;                  // Noise generator seed (same seed -> same stream)
+    uint64_t duration_frames;       // Frames before end of stream (0 = endless)
+} adc_synth_config_t;
+
+typedef struct {
+    adc_source_t base;
+    adc_synth_config_t cfg;
+    uint64_t n;                     // Frames generated
+    uint32_t rng;                   // xorshift32 state
+    uint32_t blinks;                // Blink pulses started (ground truth for tuning)
+} adc_source_synth_t;
+
+// Defaults: small 10 Hz alpha + 20 Hz beta around a 1.2 V offset, light noise, one blink every 3 s
+void adc_synth_default_config(adc_synth_config_t *cfg, float sample_rate_hz);
+adc_source_t *adc_source_synth_init(adc_source_synth_t *synth, const adc_synth_config_t *cfg,
+                                    uint8_t channels);
+
+
+// =============================
+// File Source (CSV / Binary Recordings)
+// =============================
+//
+// CSV    : one frame per line, values separated by commas / spaces / tabs. Lines that do not
+//          start with a number (headers, '#' comments) are skipped. Missing channels repeat
+//          the last value on the line; extra columns are ignored.
+// Binary : interleaved int16_t little-endian frames, no header.
+typedef enum {
+    ADC_FILE_CSV = 0,
+    ADC_FILE_BINARY,
+} adc_file_format_t;
+
+typedef struct {
+    adc_source_t base;
+    FILE *fp;
+    adc_file_format_t format;
+    bool  owns_fp;                  // fclose() on close
+    uint32_t bad_lines;             // CSV lines skipped
+} adc_source_file_t;
+
+// Opens `path`; returns NULL if it cannot be read
+adc_source_t *adc_source_file_open(adc_source_file_t *file, const char *path, adc_file_format_t format,
+                                   uint8_t channels, float sample_rate_hz);
+
+// Wraps an already open stream (e.g., stdin); not closed by adc_source_close
+adc_source_t *adc_source_file_attach(adc_source_file_t *file, FILE *fp, adc_file_format_t format,
+                                     uint8_t channels, float sample_rate_hz);
+
+
+// =============================
+// EDF Source (EDF / EDF+ Recordings)
+// =============================
+//
+// Reads the first `channels` ordinary signals of an EDF file (EDF+ annotation signals are
+// skipped; a file with fewer signals repeats its last one, like a short CSV line). Digital
+// values are scaled to physical ones with the header's min / max and delivered in µV (the unit
+// of the blink threshold), rounded and saturated to int16_t. The selected signals must share
+// one sample rate, which becomes base.sample_rate_hz; one data record of them is buffered.
+#define ADC_EDF_MAX_CHANNELS  8
+#define ADC_EDF_MAX_RECORD    4096  // Selected samples per data record (channels x samples)
+
+typedef struct {
+    adc_source_t base;
+    FILE    *fp;
+    bool     owns_fp;
+    long     data_start;            // File offset of the first data record
+    uint32_t record_bytes;          // Size of one data record (all signals)
+    uint32_t per_record;            // Samples per record of each selected signal
+    int64_t  records;               // Data records in the file (-1 = unknown, read to EOF)
+    int64_t  record;                // Next record to load
+    uint32_t offset[ADC_EDF_MAX_CHANNELS];  // Byte offset of each channel's samples within a record
+    float    gain[ADC_EDF_MAX_CHANNELS];    // Digital -> µV: v * gain + bias
+    float    bias[ADC_EDF_MAX_CHANNELS];
+    uint32_t pos, filled;           // Frames consumed / available in the buffered record
+    char     label[ADC_EDF_MAX_CHANNELS][17];   // Signal labels, trimmed
+    int16_t  buf[ADC_EDF_MAX_RECORD];
+} adc_source_edf_t;
+
+// Opens `path` and parses the header; NULL if it cannot be read or is not a usable EDF file
+adc_source_t *adc_source_edf_open(adc_source_edf_t *edf, const char *path, uint8_t channels);
+
+// Same on an already open (seekable) stream; not closed by adc_source_close
+adc_source_t *adc_source_edf_attach(adc_source_edf_t *edf, FILE *fp, uint8_t channels);
+
+
+// =============================
+// Oneshot Driver Source (Device Only)
+// =============================
+// Reads every mapped channel once per call frame, paced at ADC_SAMPLE_PERIOD_MS. Requires
+// init_adc() in oneshot mode. Defined in adc_driver.c.
+typedef struct {
+    adc_source_t base;
+} adc_source_oneshot_t;
+
+adc_source_t *adc_source_oneshot_init(adc_source_oneshot_t *oneshot);
+
+
+// =============================
+// Pipeline Runner
+// =============================
+// Pulls frames from `src` and pushes them through adc_process_block() (bandpass -> detect)
+// as fast as the source delivers, until end of stream or `max_frames` (0 = no limit).
+// Returns the number of frames processed. Defined in adc.c.
+size_t adc_pipeline_run(adc_source_t *src, size_t max_frames);
+
+
+#endif // ADC_SOURCE_H
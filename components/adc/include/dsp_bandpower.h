@@ -0,0 +1,80 @@
+#ifndef DSP_BANDPOWER_H
+#define DSP_BANDPOWER_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+
+
+// =============================
+// Sliding Band-Power Configuration
+// =============================
+#define SLIDING_DFT_MAX_BINS  8     // Frequency bins tracked per estimator
+
+
+// =============================
+// Batch Goertzel (Reference)
+// =============================
+// Power |X(f)|^2 of `len` samples at `freq_hz` (no sqrt). O(len) per call.
+float goertzel_power(const int16_t *window, size_t len, float freq_hz, float sample_rate_hz);
+
+// Same, with the coefficient 2*cos(w) from goertzel_coeff() computed once by the caller
+float goertzel_coeff(float freq_hz, float sample_rate_hz);
+float goertzel_power_coeff(const int16_t *window, size_t len, float coeff);
+
+
+// =============================
+// Sliding Goertzel / Sliding DFT
+// =============================
+//
+// Tracks, for each bin, the DFT of the last N samples:
+//
+//      S[n] = sum_{i=0}^{N-1} x[n-N+1+i] * e^{-j w i}
+//
+// and updates it in O(1) per sample per bin:
+//
+//      S[n] = e^{jw} * (S[n-1] - x[n-N]) + x[n] * e^{-jw(N-1)}
+//
+// |S[n]|^2 equals goertzel_power() over the same window. Any frequency works (no integer-bin
+// restriction). A recursive rotation slowly accumulates float error, so a shadow accumulator
+// rebuilds the exact window sum one term per sample and replaces S every N samples: the error
+// never grows past what N updates can add, at a constant cost of one extra complex MAC.
+typedef struct {
+    float rot_re, rot_im;        // e^{jw}
+    float tail_re, tail_im;      // e^{-jw(N-1)}
+    float re, im;                // S[n]
+    float shadow_re, shadow_im;  // Exact sum over the current N-sample block
+    float phase_re, phase_im;    // e^{-jw p} for block position p
+} sliding_bin_t;
+
+typedef struct {
+    int16_t *history;            // Last N input samples (caller-provided storage)
+    uint16_t len;                // N (window length)
+    uint16_t pos;                // Oldest sample / next write position in history
+    uint32_t count;              // Samples seen so far (window is full once count >= len)
+    uint8_t  num_bins;
+    sliding_bin_t bins[SLIDING_DFT_MAX_BINS];
+} sliding_dft_t;
+
+
+// =============================
+// Sliding DFT API
+// =============================
+// `history` must hold `len` samples. Bins beyond SLIDING_DFT_MAX_BINS are ignored.
+void sliding_dft_init(sliding_dft_t *sdft, int16_t *history, uint16_t len,
+                      const float *freqs_hz, uint8_t num_bins, float sample_rate_hz);
+void sliding_dft_reset(sliding_dft_t *sdft);
+
+// Push one sample: O(num_bins)
+void sliding_dft_update(sliding_dft_t *sdft, int16_t sample);
+
+// |S|^2 for one bin, or the mean over all bins (band power)
+float sliding_dft_power(const sliding_dft_t *sdft, uint8_t bin);
+float sliding_dft_band_power(const sliding_dft_t *sdft);
+
+
+#endif // DSP_BANDPOWER_H
@@ -0,0 +1,99 @@
+#ifndef DSP_BIQUAD_H
+#define DSP_BIQUAD_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+
+
+// =============================
+// Cascaded Biquad Configuration
+// =============================
+#define BIQUAD_MAX_SECTIONS   4     // Second-order sections per cascade (8th order max)
+#define BIQUAD_BLOCK_CHUNK    32    // Samples per internal pass (sizes the on-stack scratch)
+#define BIQUAD_MAX_CHANNELS   8     // Interleaved channels per multi-channel instance
+
+
+// =============================
+// Second-Order Section (SOS) Coefficients
+// =============================
+// Normalized so a0 == 1:
+//
+//      y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+//
+// Same layout as bp_b[0..2] / bp_a[1..2] in adc.c.
+typedef struct {
+    float b0, b1, b2;
+    float a1, a2;
+} biquad_coeffs_t;
+
+
+// =============================
+// Per-Section State (Direct Form II Transposed)
+// =============================
+typedef struct {
+    float z1, z2;
+} biquad_state_t;
+
+
+// =============================
+// Filter Instance (coefficients + state, no globals)
+// =============================
+// Each instance is self-contained, so several filters (channels, bands) can run side by side.
+typedef struct {
+    uint8_t num_sections;
+    biquad_coeffs_t coeffs[BIQUAD_MAX_SECTIONS];
+    biquad_state_t state[BIQUAD_MAX_SECTIONS];
+} biquad_cascade_t;
+
+
+// =============================
+// Multi-Channel Instance (shared coefficients, interleaved frames)
+// =============================
+// Every channel runs the same cascade with its own state. Samples are interleaved frames
+// (ch0, ch1, ..., chN-1, ch0, ...), which is how adc_ring stores them, so one call filters
+// a whole drained block without de-interleaving.
+typedef struct {
+    uint8_t num_sections;
+    uint8_t num_channels;
+    biquad_coeffs_t coeffs[BIQUAD_MAX_SECTIONS];
+    biquad_state_t state[BIQUAD_MAX_SECTIONS][BIQUAD_MAX_CHANNELS];
+} biquad_multi_t;
+
+
+// =============================
+// Cascaded Biquad API
+// =============================
+// Copies `num_sections` (clamped to BIQUAD_MAX_SECTIONS) sections and clears the state.
+void biquad_cascade_init(biquad_cascade_t *filter, const biquad_coeffs_t *sos, uint8_t num_sections);
+void biquad_cascade_reset(biquad_cascade_t *filter);
+
+// One section rejecting `f0_hz` (gain 0 there, 1 at DC and Nyquist); the -3 dB width is f0 / q.
+void biquad_design_notch(biquad_coeffs_t *sos, float f0_hz, float q, float sample_rate_hz);
+
+// Filters `len` samples from `in` into `out` (in == out is allowed). Float in/out.
+void biquad_cascade_process_f32(biquad_cascade_t *filter, const float *in, float *out, size_t len);
+
+// Same, for the int16_t sample stream; outputs are saturated to the int16_t range.
+void biquad_cascade_process(biquad_cascade_t *filter, const int16_t *in, int16_t *out, size_t len);
+
+
+
+// =============================
+// Multi-Channel Biquad API
+// =============================
+// `num_channels` is clamped to 1 .. BIQUAD_MAX_CHANNELS.
+void biquad_multi_init(biquad_multi_t *filter, const biquad_coeffs_t *sos, uint8_t num_sections,
+                       uint8_t num_channels);
+void biquad_multi_reset(biquad_multi_t *filter);
+
+// Filters `frames` interleaved frames (frames * num_channels samples). in == out is allowed.
+// Channel c of the output is identical to running biquad_cascade_process on channel c alone.
+void biquad_multi_process(biquad_multi_t *filter, const int16_t *in, int16_t *out, size_t frames);
+
+
+#endif // DSP_BIQUAD_H
@@ -0,0 +1,103 @@
+#ifndef DSP_DECIM_H
+#define DSP_DECIM_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+
+
+// =============================
+// Polyphase FIR Decimator Configuration
+// =============================
+#define DECIM_MAX_STAGES     2      // Stages per chain (factor = product of the stage factors)
+#define DECIM_MAX_FACTOR     32     // Total decimation factor
+#define DECIM_MAX_TAPS       128    // FIR length per stage (all phases together)
+#define DECIM_MAX_CHANNELS   8      // Interleaved channels per chain
+#define DECIM_ATTEN_DB       60.0f  // Stopband attenuation the stages are designed for
+#define DECIM_PASS_FRAC      0.8f   // Passband edge as a fraction of the output Nyquist frequency
+
+
+// =============================
+// One Decimation Stage (Kaiser-Windowed Lowpass, Q15)
+// =============================
+//
+// A lowpass FIR of `taps` coefficients followed by keeping every `factor`-th output:
+//
+//      y[m] = sum_k h[k] * x[m*factor - k]
+//
+// Split into `factor` polyphase branches (h[p], h[p + factor], ...), each branch sees one input
+// phase at the low rate, and their sum over the last `taps` inputs is a single dot product. So
+// the stage only does work when an output is due: taps / factor MACs per input sample instead of
+// `taps`, and nothing is computed for the factor - 1 outputs a downsampler would throw away.
+//
+// Samples are int16_t, coefficients Q15 in time-reversed order, and the accumulator is exact
+// (dsp_dot_s16). Each channel's history is a ring written twice, `taps` apart, so the last
+// `taps` inputs are always one contiguous run and every output is a single vector dot product.
+typedef struct {
+    uint8_t  factor;
+    uint16_t taps;                                       // Multiple of factor
+    uint8_t  shift;                                      // Accumulator -> output (15 - gain bits)
+    uint8_t  phase;                                      // Inputs since the last output
+    uint16_t pos;                                        // Next history slot (oldest sample)
+    int16_t  coeff[DECIM_MAX_TAPS];                      // Q15, coeff[i] = h[taps - 1 - i]
+    int16_t  hist[DECIM_MAX_CHANNELS][2 * DECIM_MAX_TAPS];  // Mirrored ring
+} decim_stage_t;
+
+
+// =============================
+// Decimation Chain
+// =============================
+//
+// Large factors are cheaper in two stages: the first only has to keep its images away from the
+// final passband, so its transition band is wide and its filter short; the second runs at a low
+// rate where a sharp filter costs little. decim_chain_init() splits the factor as
+// (factor / d) x d with d the smallest of 2, 3, 5 that divides it (10 = 5 x 2, 20 = 10 x 2);
+// other factors use one stage.
+//
+// `gain_bits` scales the output by 2^gain_bits: averaging many noisy conversions gives
+// resolution below one input LSB, and the extra bits keep it (3 bits on 12-bit ADC counts
+// still fits int16_t). Outputs are saturated.
+typedef struct {
+    uint8_t  num_stages;
+    uint8_t  num_channels;
+    uint16_t factor;
+    float    in_rate_hz;
+    float    out_rate_hz;
+    decim_stage_t stage[DECIM_MAX_STAGES];
+} decim_chain_t;
+
+
+// =============================
+// Decimation Chain API
+// =============================
+// Designs the stages for `factor` (1 .. DECIM_MAX_FACTOR; 1 = pass-through with gain) at
+// `in_rate_hz` and clears the history. `num_channels` is clamped to 1 .. DECIM_MAX_CHANNELS.
+// Returns false if the factor is out of range.
+bool decim_chain_init(decim_chain_t *chain, uint16_t factor, float in_rate_hz, uint8_t num_channels,
+                      uint8_t gain_bits);
+
+// Same, with the stage split given explicitly (first stage first).
+bool decim_chain_design(decim_chain_t *chain, const uint8_t *factors, uint8_t num_stages, float in_rate_hz,
+                        uint8_t num_channels, uint8_t gain_bits);
+
+void decim_chain_reset(decim_chain_t *chain);
+
+// Pushes `frames` interleaved input frames; writes the decimated frames to `out` (room for
+// frames / factor + 1 frames) and returns how many were produced.
+size_t decim_chain_process(decim_chain_t *chain, const int16_t *in, int16_t *out, size_t frames);
+
+// Reference: every stage computes its FIR for every input and keeps every factor-th output,
+// the cost of filtering at the full rate before a plain downsampler. Bit-exact with
+// decim_chain_process (for tests and the benchmark).
+size_t decim_chain_process_fullrate(decim_chain_t *chain, const int16_t *in, int16_t *out, size_t frames);
+
+// Group delay of the chain, in input samples (linear phase: (taps - 1) / 2 per stage)
+float decim_chain_delay(const decim_chain_t *chain);
+
+
+#endif // DSP_DECIM_H
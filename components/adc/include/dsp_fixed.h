@@ -0,0 +1,166 @@
+#ifndef DSP_FIXED_H
+#define DSP_FIXED_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include "sdkconfig.h"                // CONFIG_IDF_TARGET_* (backend default)
+
+    /* --- DSP --- */
+    #include "dsp_biquad.h"               // biquad_coeffs_t, BIQUAD_MAX_*
+    #include "dsp_bandpower.h"            // SLIDING_DFT_MAX_BINS
+
+
+// =============================
+// Numeric Backend (Compile Time)
+// =============================
+//
+// The pipeline (bandpass, alpha score, alpha tracker) runs on one of two backends:
+//
+//      DSP_BACKEND_FLOAT : float kernels (dsp_biquad.c, dsp_bandpower.c); ESP32 / S3 have an FPU
+//      DSP_BACKEND_FIXED : the Q15 kernels below; integer only in the per-sample path
+//
+// FPU-less targets default to fixed point; override with -DDSP_BACKEND=... Both backends are
+// always compiled, so tests and benchmarks can compare them in one build.
+#define DSP_BACKEND_FLOAT  0
+#define DSP_BACKEND_FIXED  1
+
+#ifndef DSP_BACKEND
+#if CONFIG_IDF_TARGET_ESP32C2 || CONFIG_IDF_TARGET_ESP32C3 || CONFIG_IDF_TARGET_ESP32C6 || \
+    CONFIG_IDF_TARGET_ESP32H2 || CONFIG_IDF_TARGET_ESP32S2
+#define DSP_BACKEND  DSP_BACKEND_FIXED    // No FPU: every float op is a libgcc call
+#else
+#define DSP_BACKEND  DSP_BACKEND_FLOAT
+#endif
+#endif
+
+
+// =============================
+// Q-Format Helpers
+// =============================
+//
+//      Q15 : int16_t samples (the int16_t stream as is)
+//      Q14 : int16_t biquad coefficients, range [-2, 2)
+//      Q30 : int32_t rotations / phases, range [-2, 2)
+//      Q31 : int32_t accumulators; int64_t only where a product needs the extra bits
+//
+// Narrowing always saturates: an overflow clips to the rail instead of wrapping sign.
+static inline int16_t q15_sat(int32_t v) {
+    return (int16_t)(v > INT16_MAX ? INT16_MAX : (v < INT16_MIN ? INT16_MIN : v));
+}
+
+static inline int32_t q31_sat(int64_t v) {
+    return (int32_t)(v > INT32_MAX ? INT32_MAX : (v < INT32_MIN ? INT32_MIN : v));
+}
+
+// Round-to-nearest float -> Qn, saturated to [min, max]. Init-time only.
+int32_t dsp_to_fixed(float v, int frac_bits, int32_t min, int32_t max);
+
+
+// =============================
+// Biquad: Q15 Data, Q14 Coefficients, Q31 Accumulator
+// =============================
+//
+// Direct Form I, so the state is four int16_t samples and nothing internal can overflow:
+//
+//      acc = b0*x + b1*x1 + b2*x2 - a1*y1 - a2*y2 + e       (Q15 x Q14 -> Q29 in an int32)
+//      y   = sat16(round(acc >> 14)),  e = acc - (y << 14)
+//
+// `e` carries the residue dropped by the rounding into the next sample (first-order error
+// feedback), so truncation noise does not pile up in the feedback path near DC, where EEG
+// lives. Q14 alone is too coarse at the faster rates: the 0.5 Hz poles sit close to z = 1 and
+// b0 shrinks to ~0.08, so a DC step at 1 kHz comes out tens of LSB off. Every coefficient
+// therefore carries a second int16_t with the next 14 bits (Q28 overall), applied as
+// (b0_lo*x + ... - a2_lo*y2) >> 14. That doubles the MACs to ten per section but keeps them
+// 16x16 into int32, with no 64-bit arithmetic. biquad_q15_init() refuses sections whose
+// |b0|+|b1|+|b2|+|a1|+|a2| could overflow the accumulator (>= 4 - headroom); every stable
+// bandpass in this repo is far below that.
+#define BIQUAD_Q15_COEFF_FRAC  14
+
+typedef struct {
+    int16_t b0, b1, b2;
+    int16_t a1, a2;
+    int16_t b0_lo, b1_lo, b2_lo;      // Next 14 bits of each coefficient (Q28 overall)
+    int16_t a1_lo, a2_lo;
+} biquad_q15_coeffs_t;
+
+typedef struct {
+    int16_t x1, x2;
+    int16_t y1, y2;
+    int32_t err;                      // Residue carried to the next sample (Q29, |e| <= 2^13)
+} biquad_q15_state_t;
+
+// Multi-channel like biquad_multi_t: shared coefficients, interleaved frames, one state per channel
+typedef struct {
+    uint8_t num_sections;
+    uint8_t num_channels;
+    biquad_q15_coeffs_t coeffs[BIQUAD_MAX_SECTIONS];
+    biquad_q15_state_t state[BIQUAD_MAX_SECTIONS][BIQUAD_MAX_CHANNELS];
+} biquad_q15_t;
+
+// Quantizes `sos` (same clamping as biquad_multi_init). Returns false, leaving a pass-through
+// filter, if a section does not fit Q14 or could overflow the accumulator.
+bool biquad_q15_init(biquad_q15_t *filter, const biquad_coeffs_t *sos, uint8_t num_sections,
+                     uint8_t num_channels);
+void biquad_q15_reset(biquad_q15_t *filter);
+
+// Filters `frames` interleaved frames; in == out is allowed.
+void biquad_q15_process(biquad_q15_t *filter, const int16_t *in, int16_t *out, size_t frames);
+
+
+// =============================
+// Goertzel: Q15 Data, Q29 Coefficient, Q31 State
+// =============================
+// Coefficient 2*cos(w) is computed once (goertzel_q15_coeff) instead of per call. The state
+// keeps GOERTZEL_Q15_FRAC fractional bits, since rounding it to whole samples costs ~1% of
+// power at EEG amplitudes. A full-scale 256-sample window (one BUFFER_SIZE) stays inside int32
+// at every bin above ~2% of the sample rate; beyond that the state saturates rather than wraps.
+#define GOERTZEL_Q15_FRAC  4
+
+int32_t  goertzel_q15_coeff(float freq_hz, float sample_rate_hz);
+uint64_t goertzel_power_q15(const int16_t *window, size_t len, int32_t coeff_q29);   // |X(f)|^2, sample^2 units
+
+
+// =============================
+// Sliding DFT: Q15 Data, Q30 Rotations
+// =============================
+//
+// Same recursion and shadow re-sync as sliding_dft_t (see dsp_bandpower.h). S is kept in int32
+// with SLIDING_Q15_FRAC fractional bits, so windows up to 2^(16 - SLIDING_Q15_FRAC) samples of
+// full-scale input cannot overflow; the rotation products use int64 intermediates.
+#define SLIDING_Q15_FRAC  4
+
+typedef struct {
+    int32_t rot_re, rot_im;           // e^{jw}, Q30
+    int32_t tail_re, tail_im;         // e^{-jw(N-1)}, Q30
+    int32_t phase_re, phase_im;       // e^{-jw p}, Q30
+    int32_t re, im;                   // S, sample units << SLIDING_Q15_FRAC
+    int64_t shadow_re, shadow_im;     // Exact block sum, Q30 products left unshifted
+} sliding_bin_q15_t;
+
+typedef struct {
+    int16_t *history;                 // Last N input samples (caller-provided storage)
+    uint16_t len;
+    uint16_t pos;
+    uint32_t count;
+    uint8_t  num_bins;
+    sliding_bin_q15_t bins[SLIDING_DFT_MAX_BINS];
+} sliding_dft_q15_t;
+
+// `len` is clamped to 2^(16 - SLIDING_Q15_FRAC). Trig runs here only.
+void sliding_dft_q15_init(sliding_dft_q15_t *sdft, int16_t *history, uint16_t len,
+                          const float *freqs_hz, uint8_t num_bins, float sample_rate_hz);
+void sliding_dft_q15_reset(sliding_dft_q15_t *sdft);
+void sliding_dft_q15_update(sliding_dft_q15_t *sdft, int16_t sample);
+
+// |S|^2 for one bin / mean over all bins, in sample^2 units (comparable to goertzel_power)
+uint64_t sliding_dft_q15_power(const sliding_dft_q15_t *sdft, uint8_t bin);
+uint64_t sliding_dft_q15_band_power(const sliding_dft_q15_t *sdft);
+
+
+#endif // DSP_FIXED_H
@@ -0,0 +1,96 @@
+#ifndef DSP_GRAPH_H
+#define DSP_GRAPH_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdio.h>      // FILE (reports)
+
+
+// =============================
+// Stage Graph Configuration
+// =============================
+#define DSP_GRAPH_MAX_STAGES  8
+#define DSP_GRAPH_ALIGN       16     // Arena allocations (vector kernels load 16 bytes at a time)
+
+// Bytes an arena needs for a state of `size` bytes, padding included (sums to the arena size)
+#define DSP_GRAPH_SLOT(size)  ((((size) + DSP_GRAPH_ALIGN - 1) / DSP_GRAPH_ALIGN) * DSP_GRAPH_ALIGN)
+
+
+// =============================
+// Stage (One Block Function + Its State)
+// =============================
+//
+// A stage works on a whole block of interleaved frames in place: filters overwrite the block,
+// detectors read it. `stamps` has the acquisition time of every frame (never NULL). The graph
+// calls each stage once per block, so the per-sample loop is inside the stage with its state in
+// registers, and the only indirect call is the one per stage and block.
+//
+// Every call is timed with the benchmark cycle counter (bench_cycles(): core cycles on the
+// target, TSC on the host). The counters are written by the task that runs the graph and read
+// without a lock; a report may see one block half-counted.
+typedef void (*dsp_stage_fn)(void *state, int16_t *frames, const uint32_t *stamps, size_t count);
+
+typedef struct {
+    const char  *name;
+    dsp_stage_fn process;
+    void        *state;             // In the graph's arena (NULL for stateless stages)
+    bool         enabled;           // Disabled stages are skipped (their counters stand still)
+
+    uint64_t     cycles;            // Total, over every call since the last reset
+    uint64_t     frames;
+    uint32_t     calls;
+    uint32_t     max_cycles;        // Most expensive single call
+} dsp_stage_t;
+
+
+// =============================
+// Graph (Stages in Order + One Static Arena)
+// =============================
+//
+// The graph owns no memory: the caller hands it one static arena at init, every stage state is
+// carved out of it with dsp_graph_alloc(), and rebuilding the graph (dsp_graph_init again) just
+// rewinds the arena. Nothing is allocated after init and nothing on the heap.
+typedef struct {
+    uint8_t     *arena;
+    size_t       arena_size;
+    size_t       arena_used;
+    uint8_t      num_stages;
+    dsp_stage_t  stage[DSP_GRAPH_MAX_STAGES];
+} dsp_graph_t;
+
+
+// =============================
+// Graph API
+// =============================
+// `arena` must be DSP_GRAPH_ALIGN-aligned. Drops every stage.
+void dsp_graph_init(dsp_graph_t *graph, void *arena, size_t arena_size);
+
+// Zeroed, aligned state; NULL if the arena is full.
+void *dsp_graph_alloc(dsp_graph_t *graph, size_t size);
+
+// Appends an enabled stage. Returns its index, or -1 if the graph is full or `process` is NULL.
+int dsp_graph_add(dsp_graph_t *graph, const char *name, dsp_stage_fn process, void *state);
+
+// Stage by name; -1 if there is none
+int dsp_graph_find(const dsp_graph_t *graph, const char *name);
+
+// Runs the enabled stages from `first` to the last, in order, over `count` frames (in place).
+void dsp_graph_run_from(dsp_graph_t *graph, int first, int16_t *frames, const uint32_t *stamps, size_t count);
+
+static inline void dsp_graph_run(dsp_graph_t *graph, int16_t *frames, const uint32_t *stamps, size_t count) {
+    dsp_graph_run_from(graph, 0, frames, stamps, count);
+}
+
+void dsp_graph_reset_counters(dsp_graph_t *graph);
+
+// One line per stage: calls, frames, cycles per frame (mean), worst call, share of the total
+void dsp_graph_print(FILE *fp, const dsp_graph_t *graph);
+
+
+#endif // DSP_GRAPH_H
@@ -0,0 +1,73 @@
+#ifndef DSP_ROBUST_H
+#define DSP_ROBUST_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stdbool.h>
+
+
+// =============================
+// P² Streaming Quantile (Jain & Chlamtac)
+// =============================
+//
+// Estimates one quantile `p` of a stream without storing it: five markers hold the minimum,
+// p/2, p, (1+p)/2 quantiles and the maximum. Each sample moves the marker positions; a marker
+// that drifts one position away from where it should be is nudged back, and its height is
+// corrected by a piecewise-parabolic (P²) fit through its neighbours. O(1) memory and time.
+// With fewer than five samples the estimate is the exact quantile of what has been seen.
+typedef struct {
+    float    q[5];               // Marker heights
+    float    want[5];            // Desired marker positions
+    float    step[5];            // Desired position increment per sample
+    int32_t  pos[5];             // Actual marker positions (1-based)
+    uint32_t count;
+    float    p;
+} p2_quantile_t;
+
+void  p2_init(p2_quantile_t *est, float p);
+void  p2_add(p2_quantile_t *est, float x);
+float p2_value(const p2_quantile_t *est);      // 0 before the first sample
+
+
+// =============================
+// Running Median / MAD (Hopping P² Windows)
+// =============================
+//
+// A P² estimate never forgets, so after a gain or impedance change it would take ever longer
+// to follow the signal. The running version restarts it: two estimator sets cover `window`
+// samples each, staggered by half a window, and whichever completes publishes its median and
+// MAD (median absolute deviation from that median). A new estimate over the last `window`
+// samples appears every window / 2 samples, like the Welch hop of the spectral engine.
+//
+// The MAD estimator is fed |x - current median estimate| of the same window, so both come out
+// of one pass. Both are robust: up to half the window can be spikes without moving them.
+typedef struct {
+    p2_quantile_t median;
+    p2_quantile_t spread;        // |x - median|
+    uint32_t count;              // Samples in this window so far
+    bool     active;             // The second window starts half a window late
+} robust_window_t;
+
+typedef struct {
+    robust_window_t win[2];
+    uint16_t len;                // Samples per window
+    uint32_t seen;               // Samples since init
+    float    median;             // Last published estimate
+    float    mad;
+    uint32_t updates;            // Estimates published (0 = none yet)
+} robust_stats_t;
+
+void robust_stats_init(robust_stats_t *rs, uint16_t window);   // window >= 2
+
+// Push one sample; true when it completed a window and median / mad were refreshed
+bool robust_stats_add(robust_stats_t *rs, float x);
+
+// Scale of a Gaussian with this MAD (sigma = MAD / 0.6745)
+static inline float robust_sigma(float mad) { return mad * 1.4826f; }
+
+
+#endif // DSP_ROBUST_H
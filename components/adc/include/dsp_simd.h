@@ -0,0 +1,84 @@
+#ifndef DSP_SIMD_H
+#define DSP_SIMD_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include "sdkconfig.h"                // CONFIG_IDF_TARGET_* (PIE default)
+
+    /* --- DSP --- */
+    #include "dsp_biquad.h"               // biquad_coeffs_t, biquad_state_t
+
+
+// =============================
+// Vector Backend (Compile Time)
+// =============================
+//
+// The hot loops of block filtering get one API with a scalar reference next to every kernel:
+//
+//      DSP_SIMD_SCALAR : plain C, always available (and always compiled as the *_ref functions)
+//      DSP_SIMD_SSE    : x86 SSE2, 4 float / 8 int16 lanes (any x86-64 host)
+//      DSP_SIMD_AVX2   : x86 AVX2, 8 float / 16 int16 lanes (host built with -mavx2 / -march=native)
+//      DSP_SIMD_PIE    : ESP32-S3, loops blocked into 128-bit / 8 x int16 groups for the PIE unit
+//
+// The default follows the compiler flags; override with -DDSP_SIMD=... The float kernels do
+// the same operations in the same order as the reference, so without FMA contraction they are
+// bit-exact with it.
+//
+// PIE has no float lanes, so on the S3 the float kernels stay scalar and only the int16_t dot
+// product is blocked 8 wide (the shape of EE.VMULAS.S16.ACCX). Buffers declared DSP_SIMD_ALIGNED
+// meet the 16-byte alignment its EE.VLD.128 loads need.
+#define DSP_SIMD_SCALAR  0
+#define DSP_SIMD_SSE     1
+#define DSP_SIMD_AVX2    2
+#define DSP_SIMD_PIE     3
+
+#ifndef DSP_SIMD
+#if defined(__AVX2__)
+#define DSP_SIMD  DSP_SIMD_AVX2
+#elif defined(__SSE2__)
+#define DSP_SIMD  DSP_SIMD_SSE
+#elif CONFIG_IDF_TARGET_ESP32S3
+#define DSP_SIMD  DSP_SIMD_PIE
+#else
+#define DSP_SIMD  DSP_SIMD_SCALAR
+#endif
+#endif
+
+#define DSP_SIMD_ALIGNED  __attribute__((aligned(16)))
+
+// Name of the compiled-in backend ("scalar", "sse", "avx2", "pie"), for logs and bench reports
+const char *dsp_simd_name(void);
+
+
+// =============================
+// Biquad: One Section Across Interleaved Channels
+// =============================
+// Runs one DF2T section over `frames` interleaved float frames of `nch` channels, in place.
+// Channels are independent, so they map onto lanes: a group of 4 (SSE) or 8 (AVX2) channels
+// advances one frame per iteration with its state held in registers for the whole block.
+// Channels left over after the last full group run scalar.
+void dsp_biquad_section_multi(const biquad_coeffs_t *c, biquad_state_t *st, uint8_t nch,
+                              float *buf, size_t frames);
+void dsp_biquad_section_multi_ref(const biquad_coeffs_t *c, biquad_state_t *st, uint8_t nch,
+                                  float *buf, size_t frames);
+
+
+// =============================
+// Dot Products
+// =============================
+// Float: lanes keep partial sums, so the result differs from the reference by rounding only.
+float dsp_dot_f32(const float *a, const float *b, size_t len);
+float dsp_dot_f32_ref(const float *a, const float *b, size_t len);
+
+// int16_t x int16_t, exact in int64_t. Pairs of products are summed in int32 first (PMADDWD),
+// which wraps only if both products of a pair are INT16_MIN * INT16_MIN.
+int64_t dsp_dot_s16(const int16_t *a, const int16_t *b, size_t len);
+int64_t dsp_dot_s16_ref(const int16_t *a, const int16_t *b, size_t len);
+
+
+#endif // DSP_SIMD_H
@@ -0,0 +1,110 @@
+#ifndef DSP_SPECTRAL_H
+#define DSP_SPECTRAL_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+
+    /* --- Pipeline Rate --- */
+    #include "adc_rate.h"               // ADC_PIPELINE_RATE_HZ (FFT length follows it)
+
+
+// =============================
+// Spectral Engine Configuration
+// =============================
+// The FFT length grows with the pipeline rate so the bin width stays at or below 0.5 Hz and
+// every band keeps the same number of bins (delta ~8, theta ~8-10):
+//
+//      100 Hz ->  256 points (0.39 Hz bins, 2.56 s window)
+//      250 Hz ->  512 points (0.49 Hz bins, 2.05 s window)
+//      500 Hz -> 1024 points (0.49 Hz bins, 2.05 s window)
+//     1000 Hz -> 2048 points (0.49 Hz bins, 2.05 s window)
+//
+// dsp_spectral_tables.h holds tables for these four lengths (tools/gen_spectral_tables.py);
+// any other SPECTRAL_FFT_SIZE needs them regenerated.
+#ifndef SPECTRAL_FFT_SIZE
+#if ADC_PIPELINE_RATE_HZ <= 100
+#define SPECTRAL_FFT_SIZE        256
+#elif ADC_PIPELINE_RATE_HZ <= 250
+#define SPECTRAL_FFT_SIZE        512
+#elif ADC_PIPELINE_RATE_HZ <= 500
+#define SPECTRAL_FFT_SIZE        1024
+#else
+#define SPECTRAL_FFT_SIZE        2048
+#endif
+#endif
+#define SPECTRAL_HOP             (SPECTRAL_FFT_SIZE / 2)   // 50% overlap between Welch segments
+#define SPECTRAL_WELCH_SEGMENTS  4                         // Segments averaged per estimate
+#define SPECTRAL_NUM_BINS        (SPECTRAL_FFT_SIZE / 2 + 1)
+
+
+// =============================
+// Standard EEG Bands
+// =============================
+typedef enum {
+    EEG_BAND_DELTA = 0,     // 0.5 – 4 Hz
+    EEG_BAND_THETA,         // 4 – 8 Hz
+    EEG_BAND_ALPHA,         // 8 – 13 Hz
+    EEG_BAND_BETA,          // 13 – 30 Hz
+    EEG_BAND_GAMMA,         // 30 – 45 Hz (capped at Nyquist)
+    EEG_BAND_COUNT
+} eeg_band_t;
+
+
+// =============================
+// Band Power Output
+// =============================
+typedef struct {
+    float absolute[EEG_BAND_COUNT];   // Band power in (signal units)^2, Welch-averaged
+    float relative[EEG_BAND_COUNT];   // absolute / total, 0..1
+    float total;                      // Sum over all bands (0.5 – 45 Hz)
+    uint8_t segments;                 // Segments in the current average
+} eeg_band_powers_t;
+
+
+// =============================
+// Engine State (statically allocated by the caller, no heap)
+// =============================
+typedef struct {
+    float   sample_rate_hz;
+    uint8_t bin_band[SPECTRAL_NUM_BINS];       // FFT bin -> eeg_band_t (EEG_BAND_COUNT = unused)
+
+    int16_t  history[SPECTRAL_FFT_SIZE];       // Last N samples (ring)
+    uint16_t pos;                              // Oldest sample / next write
+    uint16_t since_hop;                        // Samples since the last segment
+    uint32_t count;                            // Samples seen
+
+    float work[SPECTRAL_FFT_SIZE];             // FFT scratch (N/2 complex values)
+    float power[SPECTRAL_NUM_BINS];            // |X[k]|^2 of the latest segment
+
+    float   seg_power[SPECTRAL_WELCH_SEGMENTS][EEG_BAND_COUNT];
+    uint8_t seg_next;
+    uint8_t seg_count;
+
+    eeg_band_powers_t result;                  // Latest Welch estimate
+} spectral_engine_t;
+
+
+// =============================
+// Spectral Engine API
+// =============================
+void spectral_init(spectral_engine_t *engine, float sample_rate_hz);
+void spectral_reset(spectral_engine_t *engine);
+
+// Push one sample. Every SPECTRAL_HOP samples (once the first window is full) a new segment is
+// transformed, the Welch average is refreshed and true is returned.
+bool spectral_push(spectral_engine_t *engine, int16_t sample);
+
+// Low-level kernel: real FFT of the N samples in `work` (overwritten), writes |X[k]|^2 for
+// k = 0 .. N/2 into `power`. Used by the engine; exposed for tests.
+void spectral_fft_power(float *work, float *power);
+
+const char *spectral_band_name(eeg_band_t band);
+
+
+#endif // DSP_SPECTRAL_H
@@ -2,8 +2,22 @@
 
 #include "unity.h"
 #include "adc.h"  // Under test
+#include "adc_frame.h"  // DMA frame decoder + mock source
+#include "dsp_biquad.h" // Cascaded biquad block filters
+#include "dsp_bandpower.h" // Goertzel + sliding band power
+#include "dsp_spectral.h"  // Multi-band FFT / Welch engine
+#include "dsp_fixed.h"     // Q15 backend (bit-accuracy vs float)
+#include "dsp_simd.h"      // Vector kernels vs their scalar references
+#include "dsp_decim.h"     // Polyphase decimation (oversampling front end)
+#include "dsp_graph.h"     // Static stage graph
+#include "bench.h"         // bench_has_cycles (stage counters)
+#include "adc_source.h"    // Synthetic / file acquisition sources
+#include "power.h"         // Demand bits + duty accounting (stage gating)
+#include "esp_timer.h"  // Benchmark timing
 #include <string.h>  // For memset
 #include <math.h>    // For sinf in mocks
+#include <stdio.h>   // For benchmark output
+#include <stdlib.h>  // For abs, qsort (exact quantiles)
 
 
 // =============================
@@ -37,7 +51,7 @@ void test_buffer_fills_and_wraps(void) {
     // Assert: Filled, wraps safe, no overflow
     TEST_ASSERT_EQUAL_INT(3, buffer_index);
     TEST_ASSERT_EQUAL_INT(1000, adc_buffer[0]);
-    TEST_ASSERT_EQUAL_INT(-1000, adc_buffer[2]);
+    TEST_ASSERT_EQUAL_INT(-1000, adc_buffer[2 * ADC_NUM_CHANNELS]);   // Frame 2, channel 0
     
     // Edge: Force wrap
     for (int i = 3; i < BUFFER_SIZE; i++) {
@@ -99,7 +113,7 @@ void test_apply_bandpass_iir_behavior(void) {
     for (int n = 0; n < N; n++) {
         float sample = A * sinf(2.0 * M_PI * f * n / fs);
         int16_t output = apply_bandpass_iir((int16_t)sample);
-        sum_abs_pass += fabsf(output);
+        sum_abs_pass += abs(output);
     }
 
     float avg_abs_pass = sum_abs_pass / N;
@@ -125,7 +139,7 @@ void test_apply_bandpass_iir_behavior(void) {
     for (int n = 0; n < N; n++) {
         float sample = A * sinf(2.0 * M_PI * f * n / fs);
         int16_t output = apply_bandpass_iir((int16_t)sample);
-        sum_abs_pass += fabsf(output);
+        sum_abs_pass += abs(output);
     }
 
     float avg_abs_stop = sum_abs_pass / N;
@@ -176,6 +190,75 @@ void test_blink_detection_increments(void) {
 
 }
 
+// =============================
+// Test: Blink Wakes the Listener Task (Event-Driven BLE Path)
+// =============================
+static volatile int64_t listener_wake_us;
+static volatile uint32_t listener_events;
+static volatile uint32_t listener_wakeups;
+
+static void event_listener_task(void *arg) {   // Stands in for ble_notifications()
+    while (1) {
+        uint32_t bits = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &bits, portMAX_DELAY);
+        listener_wake_us = esp_timer_get_time();
+        listener_events |= bits;
+        listener_wakeups++;
+    }
+}
+
+void test_event_notify_latency(void) {
+
+    enum { BLINKS = 20 };
+    TaskHandle_t listener = NULL;
+
+    // Settle detector state (previous sample, refractory) before anyone listens
+    reset_adc_state();
+    for (int i = 0; i < 2 * REFRACTORY_PERIOD_SAMPLES; i++) detect_events(0);
+
+    // Listener runs above us, like ble_notifications() above adc_filtering
+    xTaskCreate(event_listener_task, "evt listener", 2048, NULL, uxTaskPriorityGet(NULL) + 1, &listener);
+    TEST_ASSERT_NOT_NULL(listener);
+    adc_set_event_listener(listener);
+    listener_wakeups = 0;
+    listener_events = 0;
+    uint32_t blinks_before = blink_count;    // Settling may have counted a blink
+
+    // --- Case 1: No events -> no wake-ups (nothing polls) ---
+    for (int i = 0; i < 2 * ATTENTION_UPDATE_SAMPLES; i++) detect_events(0);
+    vTaskDelay(pdMS_TO_TICKS(20));
+    TEST_ASSERT_EQUAL_UINT32(0, listener_wakeups);
+
+    // --- Case 2: Every blink wakes the listener; measure detect -> wake latency ---
+    uint32_t max_us = 0;
+    uint64_t sum_us = 0;
+    for (int b = 0; b < BLINKS; b++) {
+
+        uint32_t before = listener_wakeups;
+        detect_events(100);                          // Spike: derivative 100 > 20
+
+        for (int wait = 0; wait < 10 && listener_wakeups == before; wait++) {
+            vTaskDelay(1);                           // Only reached if the listener is not yet running
+        }
+        TEST_ASSERT_TRUE(listener_wakeups > before);
+
+        uint32_t latency = (uint32_t)(listener_wake_us - blink_event_us);
+        if (latency > max_us) max_us = latency;
+        sum_us += latency;
+
+        for (int i = 0; i < REFRACTORY_PERIOD_SAMPLES + 1; i++) detect_events(0);
+    }
+
+    TEST_ASSERT_TRUE(listener_events & ADC_EVENT_BLINK);
+    TEST_ASSERT_EQUAL_UINT32(BLINKS, blink_count - blinks_before);
+    printf("blink -> listener wake: mean %.1f us, max %lu us over %d blinks\n",
+           (float)sum_us / BLINKS, (unsigned long)max_us, BLINKS);
+    TEST_ASSERT_TRUE(max_us < 10000);                // Single-digit milliseconds, worst case
+
+    adc_set_event_listener(NULL);
+    vTaskDelete(listener);
+}
+
 // =============================
 // Test: Alpha Dominance (Focus Detection)
 // =============================
@@ -220,6 +303,623 @@ void test_alpha_dominance(void) {
 }
 
 
+// =============================
+// Test: Continuous-Mode Frame Decoding (Mock DMA Source)
+// =============================
+void test_adc_frame_decode_mock(void) {
+
+    uint8_t frame[256];             // Same size as ADC_CONV_FRAME_BYTES
+    int out[128];
+    adc_frame_mock_t mock;
+    adc_frame_decoder_t dec;
+    const uint8_t ch6[] = {6};
+
+    // --- Case 1: Constant input, 4x averaging, one foreign result every 8 ---
+    adc_frame_mock_init(&mock, 6, 4000.0f, 0.0f, 0.0f, 2000.0f);
+    mock.foreign_every = 8;
+    adc_frame_decoder_init(&dec, ch6, 1, 4);
+
+    size_t len = adc_frame_mock_fill(&mock, frame, sizeof(frame));
+    size_t n = adc_frame_decode(&dec, frame, len, out, 128);
+
+    // 128 results: 16 foreign, 112 ours -> 28 averaged samples
+    TEST_ASSERT_EQUAL_UINT32(256, len);
+    TEST_ASSERT_EQUAL_UINT32(16, dec.dropped);
+    TEST_ASSERT_EQUAL_UINT32(28, n);
+    for (size_t i = 0; i < n; i++) {
+        TEST_ASSERT_EQUAL_INT(2000, out[i]);
+    }
+
+    // --- Case 2: Partial sums carry across frame boundaries ---
+    adc_frame_mock_init(&mock, 6, 3000.0f, 0.0f, 0.0f, 1234.0f);
+    adc_frame_decoder_init(&dec, ch6, 1, 3);
+
+    size_t total = 0;
+    for (int f = 0; f < 3; f++) {
+        len = adc_frame_mock_fill(&mock, frame, sizeof(frame));
+        total += adc_frame_decode(&dec, frame, len, out, 128);
+    }
+    TEST_ASSERT_EQUAL_UINT32(128, total);   // 3 x 128 results / 3 = 128, none lost at the seams
+    TEST_ASSERT_EQUAL_UINT32(0, dec.acc_count[0]);
+
+    // --- Case 3: 10 Hz sine at 1 kHz output survives averaging ---
+    adc_frame_mock_init(&mock, 6, 20000.0f, 10.0f, 1000.0f, 2048.0f);
+    adc_frame_decoder_init(&dec, ch6, 1, 20);   // 20 kHz -> 1 kHz
+
+    int min_v = 4095, max_v = 0;
+    for (int f = 0; f < 200; f++) {       // 200 frames = 25600 conversions = 1280 samples
+        len = adc_frame_mock_fill(&mock, frame, sizeof(frame));
+        n = adc_frame_decode(&dec, frame, len, out, 128);
+        for (size_t i = 0; i < n; i++) {
+            if (out[i] < min_v) min_v = out[i];
+            if (out[i] > max_v) max_v = out[i];
+        }
+    }
+    TEST_ASSERT_INT_WITHIN(10, 3048, max_v);
+    TEST_ASSERT_INT_WITHIN(10, 1048, min_v);
+
+    // --- Case 4: Output buffer full -> counted as dropped, never overrun ---
+    adc_frame_mock_init(&mock, 6, 1000.0f, 0.0f, 0.0f, 100.0f);
+    adc_frame_decoder_init(&dec, ch6, 1, 1);
+    len = adc_frame_mock_fill(&mock, frame, sizeof(frame));
+    n = adc_frame_decode(&dec, frame, len, out, 10);
+    TEST_ASSERT_EQUAL_UINT32(10, n);
+    TEST_ASSERT_EQUAL_UINT32(118, dec.dropped);
+
+    // --- Case 5: 4-channel scan pattern -> interleaved frames in slot order ---
+    const uint8_t ch4567[] = {6, 7, 4, 5};    // Slot order differs from channel order
+    adc_frame_mock_init(&mock, 4, 4000.0f, 0.0f, 0.0f, 1000.0f);
+    mock.num_channels = 4;                    // Pattern: ch4, ch5, ch6, ch7
+    mock.channel_step = 100.0f;               // ch4 = 1000, ch5 = 1100, ch6 = 1200, ch7 = 1300
+    adc_frame_decoder_init(&dec, ch4567, 4, 2);
+
+    len = adc_frame_mock_fill(&mock, frame, sizeof(frame));
+    n = adc_frame_decode(&dec, frame, len, out, 32);
+
+    TEST_ASSERT_EQUAL_UINT32(16, n);          // 128 results / 4 channels / 2x averaging
+    TEST_ASSERT_EQUAL_UINT32(0, dec.dropped);
+    for (size_t i = 0; i < n; i++) {
+        TEST_ASSERT_EQUAL_INT(1200, out[4 * i + 0]);
+        TEST_ASSERT_EQUAL_INT(1300, out[4 * i + 1]);
+        TEST_ASSERT_EQUAL_INT(1000, out[4 * i + 2]);
+        TEST_ASSERT_EQUAL_INT(1100, out[4 * i + 3]);
+    }
+}
+
+
+// =============================
+// Test: SPSC Ring Drains Everything + Reports Overruns
+// =============================
+void test_adc_ring_sequence_and_overrun(void) {
+
+    int16_t storage[16];
+    int16_t out[32];
+    adc_ring_t ring;
+    uint32_t first_seq = 0, lost = 0;
+
+    adc_ring_init(&ring, storage, 16, 1);
+
+    // --- Case 1: Every produced sample is read exactly once, in order ---
+    for (int i = 0; i < 10; i++) adc_ring_push(&ring, (int16_t)i);
+
+    size_t n = adc_ring_read(&ring, out, 4, &first_seq, &lost);   // Partial drain
+    TEST_ASSERT_EQUAL_UINT32(4, n);
+    TEST_ASSERT_EQUAL_UINT32(0, first_seq);
+    TEST_ASSERT_EQUAL_UINT32(0, lost);
+
+    n = adc_ring_read(&ring, out, 32, &first_seq, &lost);         // Rest of the backlog
+    TEST_ASSERT_EQUAL_UINT32(6, n);
+    TEST_ASSERT_EQUAL_UINT32(4, first_seq);
+    TEST_ASSERT_EQUAL_INT(4, out[0]);
+    TEST_ASSERT_EQUAL_INT(9, out[5]);
+
+    n = adc_ring_read(&ring, out, 32, &first_seq, &lost);         // Nothing new -> nothing read
+    TEST_ASSERT_EQUAL_UINT32(0, n);
+
+    // --- Case 2: Producer laps the consumer -> explicit overrun count ---
+    for (int i = 10; i < 50; i++) adc_ring_push(&ring, (int16_t)i);   // 40 new, ring holds 16
+
+    n = adc_ring_read(&ring, out, 32, &first_seq, &lost);
+    TEST_ASSERT_EQUAL_UINT32(15, n);          // size - 1 newest samples survive
+    TEST_ASSERT_EQUAL_UINT32(25, lost);
+    TEST_ASSERT_EQUAL_UINT32(35, first_seq);
+    TEST_ASSERT_EQUAL_INT(35, out[0]);
+    TEST_ASSERT_EQUAL_INT(49, out[14]);
+    TEST_ASSERT_EQUAL_UINT32(25, ring.overruns);
+
+    // --- Case 3: 32-bit sequence wrap-around is harmless ---
+    adc_ring_init(&ring, storage, 16, 1);
+    atomic_store(&ring.head, 0xFFFFFFFEu);
+    ring.tail = 0xFFFFFFFEu;
+    for (int i = 0; i < 4; i++) adc_ring_push(&ring, (int16_t)(100 + i));
+
+    n = adc_ring_read(&ring, out, 32, &first_seq, &lost);
+    TEST_ASSERT_EQUAL_UINT32(4, n);
+    TEST_ASSERT_EQUAL_UINT32(0, lost);
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFEu, first_seq);
+    TEST_ASSERT_EQUAL_INT(103, out[3]);
+    TEST_ASSERT_EQUAL_UINT32(2, ring.head);
+
+    // --- Case 4: adc_push_sample() feeds the shared ring ---
+    reset_adc_state();
+    adc_push_sample(7);
+    adc_push_sample(8);
+    n = adc_ring_read(&adc_ring, out, 32, &first_seq, &lost);
+    TEST_ASSERT_EQUAL_UINT32(2, n);
+    TEST_ASSERT_EQUAL_INT(8, out[ADC_NUM_CHANNELS]);              // Frame 1, channel 0
+    TEST_ASSERT_EQUAL_INT(2, buffer_index);
+}
+
+
+// =============================
+// Test: Block Biquad Path Matches the Single-Sample Path
+// =============================
+void test_bandpass_block_matches_single(void) {
+
+    const int N = 300;
+    const int W = ADC_NUM_CHANNELS;      // Global path filters interleaved frames
+    int16_t in[300];
+    static int16_t in_frames[300 * ADC_NUM_CHANNELS];
+    static int16_t out_block[300 * ADC_NUM_CHANNELS];
+
+    for (int n = 0; n < N; n++) {
+        // 10 Hz (passband) + 40 Hz (stopband) mix
+        in[n] = (int16_t)(1000.0f * sinf(2.0f * M_PI * 10.0f * n / SAMPLE_RATE_HZ) +
+                           500.0f * sinf(2.0f * M_PI * 40.0f * n / SAMPLE_RATE_HZ));
+        for (int c = 0; c < W; c++) in_frames[n * W + c] = in[n];
+    }
+
+    // --- Case 1: Same response as apply_bandpass_iir(), fed in uneven blocks ---
+    reset_filter_state();
+    apply_bandpass_iir_block(in_frames, out_block, 7);
+    apply_bandpass_iir_block(in_frames + 7 * W, out_block + 7 * W, 100);
+    apply_bandpass_iir_block(in_frames + 107 * W, out_block + 107 * W, N - 107);
+
+    reset_filter_state();
+    for (int n = 0; n < N; n++) {
+        int16_t single = apply_bandpass_iir(in[n]);
+        for (int c = 0; c < W; c++) {
+            TEST_ASSERT_INT16_WITHIN(1, single, out_block[n * W + c]);   // DF-I vs DF-II-T rounding only
+        }
+    }
+
+    // --- Case 2: Two-section cascade == the same section applied twice ---
+    const biquad_coeffs_t sec = { bp_b[0], bp_b[1], bp_b[2], bp_a[1], bp_a[2] };
+    const biquad_coeffs_t sos[2] = { sec, sec };
+    biquad_cascade_t cascade, once_a, once_b;
+    float xf[300], y2[300], y1[300];
+
+    for (int n = 0; n < N; n++) xf[n] = (float)in[n];
+    biquad_cascade_init(&cascade, sos, 2);
+    biquad_cascade_init(&once_a, &sec, 1);
+    biquad_cascade_init(&once_b, &sec, 1);
+
+    biquad_cascade_process_f32(&cascade, xf, y2, N);
+    biquad_cascade_process_f32(&once_a, xf, y1, N);
+    biquad_cascade_process_f32(&once_b, y1, y1, N);
+    for (int n = 0; n < N; n++) {
+        TEST_ASSERT_FLOAT_WITHIN(1e-3f, y1[n], y2[n]);
+    }
+
+    // --- Case 3: Instances are independent (no shared globals) ---
+    int16_t zeros[64] = {0};
+    int16_t out_a[64], out_b[64];
+    biquad_cascade_init(&once_a, &sec, 1);
+    biquad_cascade_init(&once_b, &sec, 1);
+    biquad_cascade_process(&once_a, in, out_a, 64);      // Filter A sees the signal
+    biquad_cascade_process(&once_b, zeros, out_b, 64);   // Filter B sees silence
+    TEST_ASSERT_EQUAL_INT16_ARRAY(zeros, out_b, 64);
+    TEST_ASSERT_TRUE(out_a[10] != 0);
+
+    // --- Case 4: Interleaved multi-channel == each channel filtered on its own ---
+    enum { NCH = 4, FRAMES = 75 };
+    int16_t frames[NCH * FRAMES], frames_out[NCH * FRAMES];
+    int16_t mono_in[FRAMES], mono_out[FRAMES];
+    biquad_multi_t multi;
+
+    for (int f = 0; f < FRAMES; f++) {
+        for (int c = 0; c < NCH; c++) frames[f * NCH + c] = (int16_t)(in[f] / (c + 1) + 100 * c);
+    }
+    biquad_multi_init(&multi, sos, 2, NCH);
+    biquad_multi_process(&multi, frames, frames_out, 13);                 // Uneven blocks
+    biquad_multi_process(&multi, frames + 13 * NCH, frames_out + 13 * NCH, FRAMES - 13);
+
+    for (int c = 0; c < NCH; c++) {
+        for (int f = 0; f < FRAMES; f++) mono_in[f] = frames[f * NCH + c];
+        biquad_cascade_init(&cascade, sos, 2);
+        biquad_cascade_process(&cascade, mono_in, mono_out, FRAMES);
+        for (int f = 0; f < FRAMES; f++) {
+            TEST_ASSERT_EQUAL_INT16(mono_out[f], frames_out[f * NCH + c]);
+        }
+    }
+}
+
+
+// =============================
+// Test: Both Bandpass Paths Saturate Near Full Scale
+// =============================
+void test_bandpass_saturates_full_scale(void) {
+
+    enum { N = 1200, SLOW = 1000 };
+    const int W = ADC_NUM_CHANNELS;
+    static int16_t in[N];
+    static int16_t in_frames[N * ADC_NUM_CHANNELS];
+    static int16_t out_block[N * ADC_NUM_CHANNELS];
+    static float ref[N];
+
+    // A 2 Hz square wave, then a 2-sample one: at any pipeline rate one of them rings past the rails
+    for (int n = 0; n < N; n++) {
+        int half_period = n < SLOW ? (int)(SAMPLE_RATE_HZ / 4) : 2;
+        in[n] = (n / half_period) % 2 ? -32000 : 32000;
+        ref[n] = (float)in[n];
+        for (int c = 0; c < W; c++) in_frames[n * W + c] = in[n];
+    }
+
+    // Unclipped float response: the edges ring past the int16_t range
+    const biquad_coeffs_t sec = { bp_b[0], bp_b[1], bp_b[2], bp_a[1], bp_a[2] };
+    biquad_cascade_t cascade;
+    biquad_cascade_init(&cascade, &sec, 1);
+    biquad_cascade_process_f32(&cascade, ref, ref, N);
+
+    reset_filter_state();
+    apply_bandpass_iir_block(in_frames, out_block, N);
+
+    reset_filter_state();
+    int clipped = 0;
+    for (int n = 0; n < N; n++) {
+        int16_t single = apply_bandpass_iir(in[n]);
+        TEST_ASSERT_INT16_WITHIN(1, single, out_block[n * W]);
+
+        // Past the rails both paths clip to the same sign instead of wrapping
+        if (ref[n] > 33000.0f) {
+            TEST_ASSERT_TRUE(single >= 32766 && out_block[n * W] >= 32766);
+            clipped++;
+        } else if (ref[n] < -33000.0f) {
+            TEST_ASSERT_TRUE(single <= -32767 && out_block[n * W] <= -32767);
+            clipped++;
+        }
+    }
+    TEST_ASSERT_TRUE(clipped > 0);
+}
+
+
+// =============================
+// Benchmark: ns/sample, Single-Sample vs Block Bandpass
+// =============================
+void test_bench_bandpass_block_vs_single(void) {
+
+    enum { BENCH_LEN = 1024, BENCH_REPS = 50 };
+    static int16_t in[BENCH_LEN];
+    static int16_t out[BENCH_LEN];
+
+    for (int n = 0; n < BENCH_LEN; n++) {
+        in[n] = (int16_t)(1000.0f * sinf(2.0f * M_PI * 10.0f * n / SAMPLE_RATE_HZ));
+    }
+
+    // --- Single-sample path (one call + global state per sample) ---
+    reset_filter_state();
+    int64_t t0 = esp_timer_get_time();
+    for (int r = 0; r < BENCH_REPS; r++) {
+        for (int n = 0; n < BENCH_LEN; n++) out[n] = apply_bandpass_iir(in[n]);
+    }
+    int64_t t_single = esp_timer_get_time() - t0;
+
+    // --- Block path ---
+    reset_filter_state();
+    t0 = esp_timer_get_time();
+    for (int r = 0; r < BENCH_REPS; r++) {
+        apply_bandpass_iir_block(in, out, BENCH_LEN / ADC_NUM_CHANNELS);   // Same sample count
+    }
+    int64_t t_block = esp_timer_get_time() - t0;
+
+    float samples = (float)BENCH_LEN * BENCH_REPS;
+    printf("bandpass single: %.1f ns/sample\n", t_single * 1000.0f / samples);
+    printf("bandpass block : %.1f ns/sample\n", t_block * 1000.0f / samples);
+    // Timing is reported, not asserted (it depends on target, clock and cache state)
+}
+
+
+// =============================
+// Benchmark: Per-Frame DSP Throughput vs Channel Count
+// =============================
+// One frame pass = bandpass over the interleaved block, then alpha tracker + spectral engine
+// for every channel (what adc_filtering does per drained block).
+void test_bench_multichannel_scaling(void) {
+
+    enum { BENCH_FRAMES = 2048, BENCH_MAX_CH = 8 };
+    static int16_t in[BENCH_FRAMES * BENCH_MAX_CH];
+    static int16_t out[BENCH_FRAMES * BENCH_MAX_CH];
+    static sliding_dft_t alpha[BENCH_MAX_CH];
+    static int16_t alpha_hist[BENCH_MAX_CH][BUFFER_SIZE];
+    static spectral_engine_t engines[BENCH_MAX_CH];
+    static const float alpha_hz[ALPHA_BAND_BINS] = {8.0f, 9.0f, 10.0f, 11.0f, 12.0f};
+    static const uint8_t channel_counts[] = {1, 2, 4, 8};
+
+    const biquad_coeffs_t sec = { bp_b[0], bp_b[1], bp_b[2], bp_a[1], bp_a[2] };
+    biquad_multi_t filter;
+
+    for (size_t k = 0; k < sizeof(channel_counts); k++) {
+
+        uint8_t nch = channel_counts[k];
+
+        // Interleave at the stride the pass reads (channel c is a (8 + c) Hz tone)
+        for (int f = 0; f < BENCH_FRAMES; f++) {
+            for (int c = 0; c < nch; c++) {
+                in[f * nch + c] = (int16_t)(1000.0f * sinf(2.0f * M_PI * (8.0f + c) * f / SAMPLE_RATE_HZ));
+            }
+        }
+
+        biquad_multi_init(&filter, &sec, 1, nch);
+        for (int c = 0; c < nch; c++) {
+            sliding_dft_init(&alpha[c], alpha_hist[c], BUFFER_SIZE, alpha_hz, ALPHA_BAND_BINS, SAMPLE_RATE_HZ);
+            spectral_init(&engines[c], SAMPLE_RATE_HZ);
+        }
+
+        int64_t t0 = esp_timer_get_time();
+        for (int f = 0; f < BENCH_FRAMES; f += ADC_DRAIN_BLOCK) {
+            biquad_multi_process(&filter, &in[f * nch], &out[f * nch], ADC_DRAIN_BLOCK);
+            for (int i = 0; i < ADC_DRAIN_BLOCK; i++) {
+                const int16_t *frame = &out[(f + i) * nch];
+                for (int c = 0; c < nch; c++) {
+                    sliding_dft_update(&alpha[c], frame[c]);
+                    spectral_push(&engines[c], frame[c]);
+                }
+            }
+        }
+        int64_t elapsed = esp_timer_get_time() - t0;
+        if (elapsed < 1) elapsed = 1;
+
+        float frames_per_s = BENCH_FRAMES * 1e6f / (float)elapsed;
+        printf("multichannel %u ch: %.0f frames/s, %.0f samples/s (%.1fx real time @ %.0f Hz)\n",
+               nch, frames_per_s, frames_per_s * nch, frames_per_s / SAMPLE_RATE_HZ, (float)SAMPLE_RATE_HZ);
+
+        TEST_ASSERT_TRUE(engines[0].result.segments > 0);   // Spectral path really ran
+    }
+    // Timing is reported, not asserted (it depends on target, clock and cache state)
+}
+
+
+// =============================
+// Test: Sliding Goertzel Tracks the Batch Goertzel
+// =============================
+void test_sliding_bandpower_matches_batch(void) {
+
+    enum { WIN = 256 };
+    static int16_t history[WIN];
+    static int16_t window[WIN];          // Last WIN inputs, oldest first (reference copy)
+    const float fs = SAMPLE_RATE_HZ;
+    const float bins_hz[4] = {8.0f, 10.0f, 11.3f, 20.0f};   // 11.3 Hz: not an integer DFT bin
+    const float tones_hz[3] = {10.0f, 11.3f, 3.0f};
+    sliding_dft_t sdft;
+
+    for (int t = 0; t < 3; t++) {
+
+        sliding_dft_init(&sdft, history, WIN, bins_hz, 4, fs);
+        memset(window, 0, sizeof(window));
+        uint32_t seed = 12345;
+
+        // Long run (~40 windows) so recursion error would show if it accumulated
+        for (int n = 0; n < 40 * WIN + 37; n++) {
+
+            seed = seed * 1664525u + 1013904223u;              // Small deterministic noise
+            float noise = (float)((int32_t)(seed >> 24) - 128) * 0.5f;
+            int16_t x = (int16_t)(800.0f * sinf(2.0f * M_PI * tones_hz[t] * n / fs) + noise);
+
+            sliding_dft_update(&sdft, x);
+            memmove(window, window + 1, (WIN - 1) * sizeof(int16_t));
+            window[WIN - 1] = x;
+
+            // Compare at a few points, including mid-block (between shadow re-syncs)
+            if (n % 97 != 0 && n != 40 * WIN + 36) continue;
+
+            for (uint8_t b = 0; b < 4; b++) {
+                float ref = goertzel_power(window, WIN, bins_hz[b], fs);
+                float got = sliding_dft_power(&sdft, b);
+                float tol = 2e-3f * ref + 2e3f;                 // 0.2 % + small absolute floor
+                TEST_ASSERT_FLOAT_WITHIN(tol, ref, got);
+            }
+        }
+    }
+
+    // --- Alpha band power dominates for a 10 Hz tone, stays low for 20 Hz ---
+    reset_adc_state();
+    for (int n = 0; n < 2 * WIN; n++) {
+        detect_events((int16_t)(200.0f * sinf(2.0f * M_PI * 10.0f * n / fs)));
+    }
+    float alpha_10 = alpha_tracker_power(0);
+
+    reset_adc_state();
+    for (int n = 0; n < 2 * WIN; n++) {
+        detect_events((int16_t)(200.0f * sinf(2.0f * M_PI * 20.0f * n / fs)));
+    }
+    float alpha_20 = alpha_tracker_power(0);
+
+    TEST_ASSERT_TRUE(alpha_10 > 20.0f * alpha_20);
+}
+
+
+// =============================
+// Test: Real FFT Matches a Direct DFT
+// =============================
+void test_spectral_fft_matches_dft(void) {
+
+    static float work[SPECTRAL_FFT_SIZE];
+    static float input[SPECTRAL_FFT_SIZE];
+    static float power[SPECTRAL_NUM_BINS];
+    uint32_t seed = 42;
+
+    for (int n = 0; n < SPECTRAL_FFT_SIZE; n++) {
+        seed = seed * 1664525u + 1013904223u;
+        input[n] = 300.0f * sinf(2.0f * M_PI * 13.0f * n / SPECTRAL_FFT_SIZE) +
+                   (float)((int32_t)(seed >> 20) - 2048) * 0.1f + 25.0f;   // Tone + noise + DC
+        work[n] = input[n];
+    }
+
+    spectral_fft_power(work, power);
+
+    for (int k = 0; k < SPECTRAL_NUM_BINS; k++) {
+        double re = 0.0, im = 0.0;
+        for (int n = 0; n < SPECTRAL_FFT_SIZE; n++) {
+            double w = 2.0 * M_PI * k * n / SPECTRAL_FFT_SIZE;
+            re += input[n] * cos(w);
+            im -= input[n] * sin(w);
+        }
+        double ref = re * re + im * im;
+        TEST_ASSERT_FLOAT_WITHIN(1e-3 * ref + 50.0, ref, power[k]);
+    }
+}
+
+
+// =============================
+// Test: Welch Band Powers Land in the Right Band
+// =============================
+void test_spectral_band_powers(void) {
+
+    static spectral_engine_t engine;
+    const float fs = SAMPLE_RATE_HZ;
+    const float tones_hz[EEG_BAND_COUNT] = {2.0f, 6.0f, 10.0f, 20.0f, 40.0f};
+    const float A = 1000.0f;
+
+    for (int band = 0; band < EEG_BAND_COUNT; band++) {
+
+        if (tones_hz[band] >= fs / 2) continue;      // Gamma tone needs fs > 80 Hz
+
+        spectral_init(&engine, fs);
+        int updates = 0;
+
+        for (int n = 0; n < SPECTRAL_FFT_SIZE + SPECTRAL_HOP * SPECTRAL_WELCH_SEGMENTS; n++) {
+            if (spectral_push(&engine, (int16_t)(A * sinf(2.0f * M_PI * tones_hz[band] * n / fs)))) updates++;
+        }
+
+        TEST_ASSERT_EQUAL_INT(SPECTRAL_WELCH_SEGMENTS + 1, updates);
+        TEST_ASSERT_EQUAL_INT(SPECTRAL_WELCH_SEGMENTS, engine.result.segments);
+
+        // Parseval: a sine of amplitude A carries A^2 / 2 of power
+        TEST_ASSERT_FLOAT_WITHIN(0.1f * A * A / 2, A * A / 2, engine.result.absolute[band]);
+        TEST_ASSERT_TRUE(engine.result.relative[band] > 0.9f);
+    }
+}
+
+
+// =============================
+// Benchmark: Spectral Update Cost (one Welch segment)
+// =============================
+void test_bench_spectral_update(void) {
+
+    static spectral_engine_t engine;
+    enum { BENCH_UPDATES = 50 };
+
+    spectral_init(&engine, SAMPLE_RATE_HZ);
+
+    int64_t busy_us = 0;
+    int updates = 0;
+    for (int n = 0; updates < BENCH_UPDATES; n++) {
+        int16_t x = (int16_t)(500.0f * sinf(2.0f * M_PI * 10.0f * n / SAMPLE_RATE_HZ));
+        int64_t t0 = esp_timer_get_time();
+        bool ready = spectral_push(&engine, x);
+        int64_t dt = esp_timer_get_time() - t0;
+        if (ready) {
+            busy_us += dt;
+            updates++;
+        }
+    }
+
+    printf("spectral update: %.1f us per segment (%d-point real FFT, %d bands)\n",
+           (float)busy_us / BENCH_UPDATES, SPECTRAL_FFT_SIZE, EEG_BAND_COUNT);
+}
+
+
+// =============================
+// Test: Synthetic Source Through the Full Pipeline (Faster Than Real Time)
+// =============================
+void test_pipeline_synthetic_source(void) {
+
+    static adc_source_synth_t synth;
+    enum { SYNTH_SECONDS = 30 };
+
+    adc_synth_config_t cfg;
+    adc_synth_default_config(&cfg, SAMPLE_RATE_HZ);
+    cfg.duration_frames = (uint64_t)(SYNTH_SECONDS * SAMPLE_RATE_HZ);
+    adc_source_t *src = adc_source_synth_init(&synth, &cfg, ADC_NUM_CHANNELS);
+
+    // Same seed -> same stream
+    static adc_source_synth_t twin;
+    int16_t a[8 * ADC_NUM_CHANNELS], b[8 * ADC_NUM_CHANNELS];
+    adc_source_synth_init(&twin, &cfg, ADC_NUM_CHANNELS);
+    adc_source_read(&twin.base, a, 8);
+    adc_source_synth_init(&twin, &cfg, ADC_NUM_CHANNELS);
+    adc_source_read(&twin.base, b, 8);
+    TEST_ASSERT_EQUAL_MEMORY(a, b, sizeof(a));
+
+    // Run to end of stream
+    uint32_t dsp_before = pipeline_latency[LATENCY_STAGE_DSP].count;
+    int64_t t0 = esp_timer_get_time();
+    size_t frames = adc_pipeline_run(src, 0);
+    int64_t wall_us = esp_timer_get_time() - t0;
+
+    TEST_ASSERT_EQUAL(cfg.duration_frames, frames);
+    TEST_ASSERT_EQUAL_UINT32(frames, pipeline_latency[LATENCY_STAGE_DSP].count - dsp_before);   // One stamp per frame
+    TEST_ASSERT_EQUAL(0, adc_source_read(src, a, 8));        // Stays at end of stream
+
+    // Every injected blink is seen; a pulse may count at most twice (onset + falling edge)
+    TEST_ASSERT_EQUAL(SYNTH_SECONDS / 3, synth.blinks);
+    TEST_ASSERT_GREATER_OR_EQUAL(synth.blinks, blink_count);
+    TEST_ASSERT_LESS_OR_EQUAL(2 * synth.blinks, blink_count);
+
+    // Faster than real time
+    double speed = (SYNTH_SECONDS * 1e6) / (double)(wall_us ? wall_us : 1);
+    printf("pipeline: %d s of %d ch EEG in %.1f ms (%.0fx real time), %lu blinks for %lu injected\n",
+           SYNTH_SECONDS, ADC_NUM_CHANNELS, wall_us / 1000.0, speed,
+           (unsigned long)blink_count, (unsigned long)synth.blinks);
+    TEST_ASSERT_TRUE(speed > 1.0);
+
+    // Channel count must match the pipeline
+    adc_source_synth_init(&twin, &cfg, ADC_NUM_CHANNELS + 1);
+    TEST_ASSERT_EQUAL(0, adc_pipeline_run(&twin.base, 16));
+}
+
+
+// =============================
+// Test: File Source Parses CSV + Binary Recordings
+// =============================
+void test_file_source_formats(void) {
+
+    static adc_source_file_t file;
+    int16_t out[4 * 2];
+
+    // --- CSV: header + comment skipped, decimals rounded, short line padded, extra column ignored ---
+    FILE *fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+    fputs("ch0,ch1\n# comment\n100,200\n-4.5 6.7\n300\n1.2,2,3\n\n", fp);
+    rewind(fp);
+
+    adc_source_t *src = adc_source_file_attach(&file, fp, ADC_FILE_CSV, 2, SAMPLE_RATE_HZ);
+    TEST_ASSERT_EQUAL(4, adc_source_read(src, out, 4));
+    const int16_t csv_expected[] = {100, 200, -5, 7, 300, 300, 1, 2};
+    TEST_ASSERT_EQUAL_INT16_ARRAY(csv_expected, out, 8);
+    TEST_ASSERT_EQUAL(0, adc_source_read(src, out, 4));
+    TEST_ASSERT_EQUAL(3, file.bad_lines);                     // Header, comment, blank line
+    adc_source_close(src);                                    // Attached: stream stays open
+
+    // --- Binary: int16 little-endian, partial trailing frame dropped ---
+    fclose(fp);
+    fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+    const uint8_t raw[] = {0x34, 0x12, 0xFF, 0xFF, 0x00, 0x80, 0x01, 0x00, 0xAA};
+    fwrite(raw, 1, sizeof(raw), fp);
+    rewind(fp);
+
+    src = adc_source_file_attach(&file, fp, ADC_FILE_BINARY, 2, SAMPLE_RATE_HZ);
+    TEST_ASSERT_EQUAL(2, adc_source_read(src, out, 4));
+    const int16_t bin_expected[] = {0x1234, -1, -32768, 1};
+    TEST_ASSERT_EQUAL_INT16_ARRAY(bin_expected, out, 4);
+    fclose(fp);
+
+    // --- Missing file ---
+    TEST_ASSERT_NULL(adc_source_file_open(&file, "/nonexistent/eeg.csv", ADC_FILE_CSV, 1, SAMPLE_RATE_HZ));
+}
+
+
 // // =============================
 // // Test: BLE Formatting Packs Bytes
 // // =============================
@@ -253,4 +953,762 @@ int main(void) {
     RUN_TEST(test_ble_formatting_packs_bytes);
     return UNITY_END();
 }
-*/
\ No newline at end of file
+*/
+
+// =============================
+// Test: Timer-Driven Sample Clock (Simulated) + Jitter Metric
+// =============================
+typedef struct {
+    adc_source_synth_t synth;
+    adc_jitter_t jitter;
+} clock_sampler_t;
+
+static bool clock_sampler_tick(void *arg, uint32_t now_us) {   // Stands in for the ISR + sampling task
+    clock_sampler_t *s = arg;
+    int16_t frame[ADC_NUM_CHANNELS];
+    adc_source_read(&s->synth.base, frame, 1);
+    adc_push_frame_at(frame, now_us);
+    adc_jitter_add(&s->jitter, now_us);
+    return false;
+}
+
+void test_sample_clock_sim_jitter(void) {
+
+    static clock_sampler_t sampler;
+    adc_synth_config_t cfg;
+    adc_synth_default_config(&cfg, SAMPLE_RATE_HZ);
+    adc_source_synth_init(&sampler.synth, &cfg, ADC_NUM_CHANNELS);
+
+    // --- Perfect clock: stamps sit on the grid, zero jitter ---
+    adc_clock_sim_t sim;
+    adc_clock_t *clk = adc_clock_sim_init(&sim, 5000, 0, 1);
+    adc_jitter_reset(&sampler.jitter);
+    TEST_ASSERT_EQUAL(ESP_OK, adc_clock_start(clk, ADC_SAMPLE_PERIOD_US, clock_sampler_tick, &sampler));
+
+    adc_clock_sim_advance(&sim, 1000000);                 // 1 s
+    TEST_ASSERT_EQUAL_UINT32(SAMPLE_RATE_HZ, sim.ticks);
+    TEST_ASSERT_EQUAL_UINT32(SAMPLE_RATE_HZ, adc_ring_pending(&adc_ring));
+    for (uint32_t k = 0; k < sim.ticks; k++) {
+        TEST_ASSERT_EQUAL_UINT32(5000 + (k + 1) * ADC_SAMPLE_PERIOD_US, adc_stamp_us[k % BUFFER_SIZE]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(SAMPLE_RATE_HZ - 1, sampler.jitter.count);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, (float)ADC_SAMPLE_PERIOD_US, sampler.jitter.mean_us);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 0.0f, adc_jitter_stddev_us(&sampler.jitter));
+
+    // Stopped clock fires nothing
+    adc_clock_stop(clk);
+    adc_clock_sim_advance(&sim, 1000000);
+    TEST_ASSERT_EQUAL_UINT32(SAMPLE_RATE_HZ, sim.ticks);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, adc_clock_start(clk, 0, clock_sampler_tick, &sampler));
+
+    // --- Jittery clock: offsets uniform in [-J, J] -> interval std dev = J * sqrt(2/3) ---
+    // (each interval is the difference of two independent offsets), no drift in the mean.
+    const uint32_t J = 500;
+    clk = adc_clock_sim_init(&sim, UINT32_MAX - 20000, J, 0xC0FFEE);   // Also crosses the 32-bit wrap
+    adc_jitter_reset(&sampler.jitter);
+    adc_clock_start(clk, ADC_SAMPLE_PERIOD_US, clock_sampler_tick, &sampler);
+    adc_clock_sim_advance(&sim, 60 * 1000000);            // 60 s
+
+    float expected = J * sqrtf(2.0f / 3.0f);
+    float stddev = adc_jitter_stddev_us(&sampler.jitter);
+    printf("sample clock: %lu ticks, mean %.1f us, jitter %.1f us (expected %.1f), min %lu / max %lu us\n",
+           (unsigned long)sim.ticks, sampler.jitter.mean_us, stddev, expected,
+           (unsigned long)sampler.jitter.min_us, (unsigned long)sampler.jitter.max_us);
+
+    TEST_ASSERT_EQUAL_UINT32(60 * SAMPLE_RATE_HZ, sim.ticks);
+    TEST_ASSERT_FLOAT_WITHIN(10.0f, (float)ADC_SAMPLE_PERIOD_US, sampler.jitter.mean_us);
+    TEST_ASSERT_FLOAT_WITHIN(0.1f * expected, expected, stddev);
+    TEST_ASSERT_GREATER_OR_EQUAL(ADC_SAMPLE_PERIOD_US - 2 * J, sampler.jitter.min_us);
+    TEST_ASSERT_LESS_OR_EQUAL(ADC_SAMPLE_PERIOD_US + 2 * J, sampler.jitter.max_us);
+    adc_clock_stop(clk);
+}
+
+
+// =============================
+// Test: Q15 Biquad Tracks the Float Reference (LSB Accuracy)
+// =============================
+void test_biquad_q15_matches_float(void) {
+
+    enum { N = 2000, NCH = 3 };
+    static int16_t in[N * NCH], out_q[N * NCH], out_split[N * NCH];
+    static int16_t mono_in[N], mono_q[N];
+    static float mono_ref[N];
+
+    // Every bandpass adc.c can be built with (100 Hz oneshot, 250 / 500 / 1000 Hz continuous),
+    // each as 1 section and as a 2-section cascade
+    const biquad_coeffs_t sets[4] = {
+        { 0.3913f, 0.0f, -0.3913f, -0.2162f, 0.2174f },
+        { 0.2799f, 0.0f, -0.2799f, -1.4331f, 0.4402f },
+        { 0.1579f, 0.0f, -0.1579f, -1.6822f, 0.6842f },
+        { 0.0850f, 0.0f, -0.0850f, -1.8294f, 0.8299f },
+    };
+    const float rates[4] = { 100.0f, 250.0f, 500.0f, 1000.0f };
+
+    for (int s = 0; s < 4; s++) {
+        for (uint8_t sections = 1; sections <= 2; sections++) {
+
+            biquad_coeffs_t sos[2] = { sets[s], sets[s] };
+            const float fs = rates[s];
+
+            // Electrode-like input: large DC offset, 10 Hz alpha, 3 Hz drift, small noise
+            uint32_t seed = 99;
+            for (int n = 0; n < N; n++) {
+                for (int c = 0; c < NCH; c++) {
+                    seed = seed * 1664525u + 1013904223u;
+                    float noise = (float)((int32_t)(seed >> 24) - 128) * 0.2f;
+                    float v = (c == 0 ? 12000.0f : c == 1 ? -5000.0f : 0.0f) +
+                              800.0f * sinf(2.0f * M_PI * 10.0f * n / fs) +
+                              (c == 1 ? 2000.0f : 300.0f) * sinf(2.0f * M_PI * 3.0f * n / fs) + noise;
+                    in[n * NCH + c] = (int16_t)v;
+                }
+            }
+
+            biquad_q15_t q;
+            TEST_ASSERT_TRUE(biquad_q15_init(&q, sos, sections, NCH));
+            biquad_q15_process(&q, in, out_q, N);
+
+            // Uneven blocks give the same bits (state carries across calls)
+            biquad_q15_reset(&q);
+            biquad_q15_process(&q, in, out_split, 13);
+            biquad_q15_process(&q, in + 13 * NCH, out_split + 13 * NCH, N - 13);
+            TEST_ASSERT_EQUAL_MEMORY(out_q, out_split, sizeof(out_q));
+
+            float max_err = 0.0f;
+            double sq_err = 0.0;
+            for (int c = 0; c < NCH; c++) {
+
+                // Float reference, one channel at a time, before the truncating int16_t narrow
+                for (int n = 0; n < N; n++) {
+                    mono_in[n] = in[n * NCH + c];
+                    mono_ref[n] = (float)mono_in[n];
+                }
+                biquad_cascade_t ref;
+                biquad_cascade_init(&ref, sos, sections);
+                biquad_cascade_process_f32(&ref, mono_ref, mono_ref, N);
+
+                // One-channel Q15 instance is bit-exact with its slot in the multi-channel one
+                biquad_q15_t mono;
+                biquad_q15_init(&mono, sos, sections, 1);
+                biquad_q15_process(&mono, mono_in, mono_q, N);
+
+                for (int n = 0; n < N; n++) {
+                    TEST_ASSERT_EQUAL_INT16(mono_q[n], out_q[n * NCH + c]);
+                    float err = fabsf((float)mono_q[n] - mono_ref[n]);
+                    if (err > max_err) max_err = err;
+                    sq_err += (double)err * err;
+                }
+            }
+
+            double rms_err = sqrt(sq_err / (N * NCH));
+            printf("biquad q15 @%4.0f Hz, %u section(s): max error %.2f LSB, rms %.2f LSB\n",
+                   fs, sections, max_err, rms_err);
+
+            // Output rounding alone is 0.29 LSB rms; the rest is the int16_t hand-off between
+            // sections, amplified by the poles (r = 0.91 at 1 kHz) through the DC step
+            TEST_ASSERT_TRUE(rms_err < 0.75);
+            TEST_ASSERT_TRUE(max_err <= 3.0f);
+        }
+    }
+
+    // --- Saturation: clips to the rail like the float path, never wraps sign ---
+    const biquad_coeffs_t gain = { 1.9f, 0.0f, 0.0f, 0.0f, 0.0f };
+    biquad_q15_t q;
+    biquad_q15_init(&q, &gain, 1, 1);
+    int16_t hi[2] = { 30000, -30000 }, y[2];
+    biquad_q15_process(&q, hi, y, 2);
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, y[0]);
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, y[1]);
+
+    // --- Coefficients that cannot be represented are refused (pass-through) ---
+    const biquad_coeffs_t too_big = { 1.0f, 0.0f, 0.0f, -2.5f, 0.9f };
+    const biquad_coeffs_t overflow = { 1.99f, 1.99f, 1.99f, -1.99f, 0.99f };
+    TEST_ASSERT_FALSE(biquad_q15_init(&q, &too_big, 1, 1));
+    TEST_ASSERT_FALSE(biquad_q15_init(&q, &overflow, 1, 1));
+    biquad_q15_process(&q, hi, y, 2);
+    TEST_ASSERT_EQUAL_INT16(hi[0], y[0]);
+}
+
+
+// =============================
+// Test: Q15 Goertzel + Sliding DFT Track the Float Reference
+// =============================
+void test_bandpower_q15_matches_float(void) {
+
+    enum { WIN = 256 };
+    static int16_t window[WIN], history[WIN], ref_window[WIN];
+    const float fs = SAMPLE_RATE_HZ;
+    const float bins_hz[4] = { 8.0f, 10.0f, 11.3f, 20.0f };
+    const float tones_hz[3] = { 10.0f, 11.3f, 3.0f };
+
+    // --- Batch Goertzel: full-scale-ish and small tones ---
+    for (int t = 0; t < 3; t++) {
+        for (int amp = 100; amp <= 20000; amp *= 10) {
+
+            for (int n = 0; n < WIN; n++) window[n] = (int16_t)(amp * sinf(2.0f * M_PI * tones_hz[t] * n / fs));
+
+            for (int b = 0; b < 4; b++) {
+                float ref = goertzel_power(window, WIN, bins_hz[b], fs);
+                float got = (float)goertzel_power_q15(window, WIN, goertzel_q15_coeff(bins_hz[b], fs));
+                float tol = 1e-3f * ref + 1e3f;                 // 0.1 % + 1 sample^2 x 1000 floor
+                TEST_ASSERT_FLOAT_WITHIN(tol, ref, got);
+            }
+        }
+    }
+
+    // --- Sliding DFT: long run, compared against the float batch Goertzel ---
+    for (int t = 0; t < 3; t++) {
+
+        sliding_dft_q15_t sdft;
+        sliding_dft_q15_init(&sdft, history, WIN, bins_hz, 4, fs);
+        memset(ref_window, 0, sizeof(ref_window));
+        uint32_t seed = 777;
+
+        for (int n = 0; n < 20 * WIN + 11; n++) {
+
+            seed = seed * 1664525u + 1013904223u;
+            float noise = (float)((int32_t)(seed >> 24) - 128) * 0.5f;
+            int16_t x = (int16_t)(800.0f * sinf(2.0f * M_PI * tones_hz[t] * n / fs) + noise);
+
+            sliding_dft_q15_update(&sdft, x);
+            memmove(ref_window, ref_window + 1, (WIN - 1) * sizeof(int16_t));
+            ref_window[WIN - 1] = x;
+
+            if (n % 89 != 0 && n != 20 * WIN + 10) continue;
+
+            for (uint8_t b = 0; b < 4; b++) {
+                float ref = goertzel_power(ref_window, WIN, bins_hz[b], fs);
+                float got = (float)sliding_dft_q15_power(&sdft, b);
+                float tol = 2e-3f * ref + 2e3f;                 // Same bound as the float sliding DFT
+                TEST_ASSERT_FLOAT_WITHIN(tol, ref, got);
+            }
+        }
+    }
+}
+
+
+// =============================
+// Test: Vector Kernels Match Their Scalar References
+// =============================
+void test_simd_kernels_match_reference(void) {
+
+    enum { FRAMES = 300, MAX_CH = BIQUAD_MAX_CHANNELS, DOT_LEN = 1024 };
+    static float ref[FRAMES * MAX_CH], vec[FRAMES * MAX_CH];
+    static float fa[DOT_LEN], fb[DOT_LEN];
+    static int16_t sa[DOT_LEN], sb[DOT_LEN];
+
+    printf("dsp_simd backend: %s\n", dsp_simd_name());
+
+    // --- Biquad section: every channel count, so full lane groups and leftovers both run ---
+    const biquad_coeffs_t sos[2] = {
+        { bp_b[0], bp_b[1], bp_b[2], bp_a[1], bp_a[2] },
+        { 0.0850f, 0.0f, -0.0850f, -1.8294f, 0.8299f },
+    };
+
+    for (uint8_t nch = 1; nch <= MAX_CH; nch++) {
+
+        biquad_state_t st_ref[2][MAX_CH], st_vec[2][MAX_CH];
+        memset(st_ref, 0, sizeof(st_ref));
+        memset(st_vec, 0, sizeof(st_vec));
+
+        uint32_t seed = 1234 + nch;
+        for (int i = 0; i < FRAMES * nch; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            ref[i] = vec[i] = (float)((int32_t)(seed >> 16) - 32768) + 3000.0f * (i % nch);
+        }
+
+        // Uneven blocks: state must carry across calls exactly as in the reference
+        const size_t blocks[3] = { 1, 37, FRAMES - 38 };
+        size_t off = 0;
+        for (int b = 0; b < 3; b++) {
+            for (int s = 0; s < 2; s++) {
+                dsp_biquad_section_multi_ref(&sos[s], st_ref[s], nch, &ref[off * nch], blocks[b]);
+                dsp_biquad_section_multi(&sos[s], st_vec[s], nch, &vec[off * nch], blocks[b]);
+            }
+            off += blocks[b];
+        }
+
+        // Same operations in the same order: equal, unless the compiler contracts one side to
+        // FMA (-march=native). Tolerance: 1e-5 of the int16_t full scale.
+        float max_diff = 0.0f;
+        for (int i = 0; i < FRAMES * nch; i++) {
+            float d = fabsf(ref[i] - vec[i]);
+            if (d > max_diff) max_diff = d;
+        }
+        for (int c = 0; c < nch; c++) {
+            float d = fabsf(st_ref[1][c].z1 - st_vec[1][c].z1);
+            if (d > max_diff) max_diff = d;
+        }
+        printf("section x %u ch: max |vector - scalar| = %g\n", nch, max_diff);
+        TEST_ASSERT_TRUE(max_diff <= 1e-5f * 32768.0f);
+    }
+
+    // --- Dot products: every tail length around the lane widths, plus one long vector ---
+    uint32_t seed = 42;
+    for (int i = 0; i < DOT_LEN; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        sa[i] = (int16_t)(seed >> 16);
+        seed = seed * 1664525u + 1013904223u;
+        sb[i] = (int16_t)(seed >> 16);
+        fa[i] = sa[i] / 32768.0f;
+        fb[i] = sb[i] / 32768.0f;
+    }
+    sa[5] = sb[5] = INT16_MIN;                       // One full-scale product (the pair stays legal)
+
+    for (size_t len = 0; len <= DOT_LEN; len = (len < 40) ? len + 1 : len * 2) {
+
+        TEST_ASSERT_TRUE(dsp_dot_s16(sa, sb, len) == dsp_dot_s16_ref(sa, sb, len));   // Exact
+
+        // Float: partial sums in lanes reorder the additions; bound by the sum of |terms|
+        float mag = 0.0f;
+        for (size_t i = 0; i < len; i++) mag += fabsf(fa[i] * fb[i]);
+        TEST_ASSERT_FLOAT_WITHIN(1e-5f * mag + 1e-7f, dsp_dot_f32_ref(fa, fb, len), dsp_dot_f32(fa, fb, len));
+    }
+}
+
+
+// =============================
+// Test: P² Quantiles + Running Median / MAD Follow Amplitude Steps
+// =============================
+static int cmp_float(const void *a, const void *b) {
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+void test_robust_stats_tracks_steps(void) {
+
+    enum { N = 4000, WIN = 200 };
+    static float data[N], sorted[N];
+
+    // --- 1. P² vs the exact quantiles (sum of uniforms ~ Gaussian, plus 2% large spikes) ---
+    uint32_t seed = 7;
+    for (int i = 0; i < N; i++) {
+        float g = 0.0f;
+        for (int k = 0; k < 4; k++) {
+            seed = seed * 1664525u + 1013904223u;
+            g += (float)(seed >> 8) / 16777216.0f - 0.5f;
+        }
+        data[i] = 100.0f * g + ((i % 50) == 0 ? 5000.0f : 0.0f);
+    }
+    memcpy(sorted, data, sizeof(sorted));
+    qsort(sorted, N, sizeof(float), cmp_float);
+
+    const float ps[] = { 0.1f, 0.5f, 0.9f };
+    for (int j = 0; j < 3; j++) {
+        p2_quantile_t est;
+        p2_init(&est, ps[j]);
+        for (int i = 0; i < N; i++) p2_add(&est, data[i]);
+        float exact = sorted[(int)(ps[j] * (N - 1))];
+        printf("P2 q%.2f: %.2f (exact %.2f)\n", ps[j], p2_value(&est), exact);
+        TEST_ASSERT_FLOAT_WITHIN(5.0f, exact, p2_value(&est));   // Within 0.05 of the spread (~58)
+    }
+
+    // Fewer than five samples: exact
+    p2_quantile_t small;
+    p2_init(&small, 0.5f);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, p2_value(&small));
+    p2_add(&small, 3.0f);
+    p2_add(&small, -1.0f);
+    p2_add(&small, 7.0f);
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, p2_value(&small));
+
+    // --- 2. Running median / MAD across a x8 step up, then a x1/32 step down, and a DC jump ---
+    robust_stats_t rs;
+    robust_stats_init(&rs, WIN);
+    const float scale[] = { 10.0f, 80.0f, 2.5f };
+    const float level[] = { 0.0f, 0.0f, 300.0f };
+    for (int seg = 0; seg < 3; seg++) {
+        for (int i = 0; i < 6 * WIN; i++) {
+            bool fresh = robust_stats_add(&rs, level[seg] + scale[seg] * data[i] / 100.0f);
+
+            // Two windows after the step, every estimate describes the new signal only
+            if (fresh && i >= 2 * WIN) {
+                float mad_true = 0.6745f * scale[seg] * 0.577f;    // Sigma of the sum of 4 uniforms
+                TEST_ASSERT_FLOAT_WITHIN(0.25f * mad_true, mad_true, rs.mad);
+                TEST_ASSERT_FLOAT_WITHIN(0.5f * mad_true, level[seg], rs.median);
+            }
+        }
+        printf("robust stats step %d: median %.2f, MAD %.2f (%lu estimates)\n",
+               seg, rs.median, rs.mad, (unsigned long)rs.updates);
+    }
+    TEST_ASSERT_EQUAL_UINT32(3 * 6 * WIN / (WIN / 2) - 1, rs.updates);   // One per half window
+}
+
+
+// =============================
+// Test: Blink Threshold Adapts to Gain Changes
+// =============================
+// Synthetic EEG with blinks, rescaled around its offset as if the amplifier gain (or the
+// electrode impedance) changed: x1, x4, x0.1. The fixed 20 µV step would fire on every alpha
+// wave at x4 and never at x0.1; the adaptive threshold must find each blink in every segment.
+void test_blink_threshold_adapts_to_gain(void) {
+
+    enum { SEG_SECONDS = 30, SETTLE_SECONDS = 3 };
+    static adc_source_synth_t synth;
+    static int16_t block[ADC_DRAIN_BLOCK * ADC_NUM_CHANNELS];
+    const float gains[] = { 1.0f, 4.0f, 0.1f };
+
+    adc_synth_config_t cfg;
+    adc_synth_default_config(&cfg, SAMPLE_RATE_HZ);
+    cfg.blink_interval_s = 2.5f;                     // Not a divisor of the window: blinks move through it
+    adc_source_synth_init(&synth, &cfg, ADC_NUM_CHANNELS);
+
+    for (int seg = 0; seg < 3; seg++) {
+
+        uint32_t blinks_at = 0, injected_at = 0;
+        size_t total = (size_t)(SEG_SECONDS * SAMPLE_RATE_HZ);
+
+        for (size_t done = 0; done < total; done += ADC_DRAIN_BLOCK) {
+
+            // Count from SETTLE_SECONDS in: one window plus one hop to adapt
+            if (done == (size_t)(SETTLE_SECONDS * SAMPLE_RATE_HZ) / ADC_DRAIN_BLOCK * ADC_DRAIN_BLOCK) {
+                blinks_at = blink_count;
+                injected_at = synth.blinks;
+            }
+
+            size_t n = adc_source_read(&synth.base, block, ADC_DRAIN_BLOCK);
+            for (size_t i = 0; i < n * ADC_NUM_CHANNELS; i++) {
+                block[i] = (int16_t)(cfg.offset + gains[seg] * ((float)block[i] - cfg.offset));
+            }
+            adc_process_block(block, NULL, n);
+        }
+
+        uint32_t detected = blink_count - blinks_at, injected = synth.blinks - injected_at;
+        printf("gain x%.1f: %lu blinks for %lu injected, threshold %.1f (median step %.2f, MAD %.2f)\n",
+               gains[seg], (unsigned long)detected, (unsigned long)injected, adc_detect_state->threshold[0],
+               adc_detect_state->stats[0].median, adc_detect_state->stats[0].mad);
+
+        // Same bound as the pipeline test: every pulse, at most onset + falling edge
+        TEST_ASSERT_GREATER_OR_EQUAL(injected, detected);
+        TEST_ASSERT_LESS_OR_EQUAL(2 * injected, detected);
+    }
+}
+
+
+// =============================
+// Test: Polyphase Decimation Matches Full-Rate Filtering
+// =============================
+void test_decim_chain_matches_fullrate(void) {
+
+    enum { FRAMES = 2400, NCH = 3 };
+    static int16_t in[FRAMES * NCH], poly[(FRAMES + 1) * NCH], full[(FRAMES + 1) * NCH];
+    static decim_chain_t a, b;
+    const uint16_t factors[] = { 2, 4, 5, 7, 10, 20, 32 };
+
+    uint32_t seed = 99;
+    for (int i = 0; i < FRAMES * NCH; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        in[i] = (int16_t)((seed >> 20) + 500 * (i % NCH)) % 4096;          // 12-bit counts
+    }
+
+    for (size_t k = 0; k < sizeof(factors) / sizeof(factors[0]); k++) {
+
+        TEST_ASSERT_TRUE(decim_chain_init(&a, factors[k], 1000.0f, NCH, 3));
+        TEST_ASSERT_TRUE(decim_chain_init(&b, factors[k], 1000.0f, NCH, 3));
+        printf("decim x%-2u: %u stage(s), %u + %u taps, delay %.1f samples\n", factors[k], a.num_stages,
+               a.stage[0].taps, a.num_stages > 1 ? a.stage[1].taps : 0, decim_chain_delay(&a));
+
+        // Uneven blocks: the phase must carry across calls
+        const size_t blocks[3] = { 1, 333, FRAMES - 334 };
+        size_t off = 0, np = 0, nf = 0;
+        for (int blk = 0; blk < 3; blk++) {
+            np += decim_chain_process(&a, &in[off * NCH], &poly[np * NCH], blocks[blk]);
+            nf += decim_chain_process_fullrate(&b, &in[off * NCH], &full[nf * NCH], blocks[blk]);
+            off += blocks[blk];
+        }
+        TEST_ASSERT_EQUAL(FRAMES / factors[k], np);
+        TEST_ASSERT_EQUAL(np, nf);
+        TEST_ASSERT_EQUAL_INT16_ARRAY(full, poly, np * NCH);
+    }
+
+    // DC passes exactly (Q15 taps sum to one), with the gain bits
+    const int16_t level[NCH] = { 0, 2048, 4095 };
+    for (int f = 0; f < FRAMES; f++) memcpy(&in[f * NCH], level, sizeof(level));
+    decim_chain_init(&a, 10, 1000.0f, NCH, 3);
+    size_t n = decim_chain_process(&a, in, poly, FRAMES);
+    for (int ch = 0; ch < NCH; ch++) TEST_ASSERT_EQUAL_INT16(level[ch] * 8, poly[(n - 1) * NCH + ch]);
+
+    TEST_ASSERT_FALSE(decim_chain_init(&a, 33, 1000.0f, 1, 3));
+}
+
+
+// =============================
+// Test: Oversampled Front End Noise Floor (Report)
+// =============================
+// What the decimator buys over taking one conversion per output sample: white converter noise
+// spread over the full oversampled band mostly lands outside the EEG band and is filtered away
+// (10 log10(factor) dB for white noise), and tones above the output Nyquist frequency no longer
+// alias into the band.
+static float decim_gauss(uint32_t *seed) {
+    *seed = *seed * 1664525u + 1013904223u;
+    float u1 = ((*seed >> 8) + 1.0f) / 16777217.0f;
+    *seed = *seed * 1664525u + 1013904223u;
+    float u2 = (*seed >> 8) / 16777216.0f;
+    return sqrtf(-2.0f * logf(u1)) * cosf(2.0f * (float)M_PI * u2);
+}
+
+// RMS left after removing DC and the `f`-cycles-per-sample tone; n covers whole periods,
+// so mean, sine and cosine are orthogonal and the fit is three sums.
+static float decim_residual_rms(const float *y, int n, float f) {
+    float mean = 0.0f, s = 0.0f, c = 0.0f;
+    for (int i = 0; i < n; i++) {
+        mean += y[i];
+        s += y[i] * sinf(2.0f * (float)M_PI * f * i);
+        c += y[i] * cosf(2.0f * (float)M_PI * f * i);
+    }
+    mean /= n; s *= 2.0f / n; c *= 2.0f / n;
+    double acc = 0.0;
+    for (int i = 0; i < n; i++) {
+        float r = y[i] - mean - s * sinf(2.0f * (float)M_PI * f * i) - c * cosf(2.0f * (float)M_PI * f * i);
+        acc += (double)r * r;
+    }
+    return (float)sqrt(acc / n);
+}
+
+void test_decim_noise_floor_report(void) {
+
+    enum { OUT = 1000, SKIP = 20, MAX_FACTOR = 20 };
+    static int16_t in[(OUT + SKIP) * MAX_FACTOR], out[OUT + SKIP + 1];
+    static float plain[OUT], decim[OUT];
+    static decim_chain_t chain;
+    const uint16_t factors[2] = { 10, 20 };
+    const float out_rate = 100.0f, tone_hz = 10.0f;
+
+    for (int k = 0; k < 2; k++) {
+
+        const uint16_t m = factors[k];
+        const float in_rate = out_rate * m;
+        const int total = (OUT + SKIP) * m;
+
+        // Case 0: 10 Hz EEG-like tone + white converter noise (4 counts rms)
+        // Case 1: 10 Hz tone + a 130 Hz interferer (aliases to 30 Hz without a filter), no noise
+        float floor_db[2], plain_rms[2], decim_rms[2];
+        for (int c = 0; c < 2; c++) {
+
+            uint32_t seed = 7;
+            for (int n = 0; n < total; n++) {
+                float x = 2048.0f + 300.0f * sinf(2.0f * (float)M_PI * tone_hz * n / in_rate);
+                x += c == 0 ? 4.0f * decim_gauss(&seed) : 300.0f * sinf(2.0f * (float)M_PI * 130.0f * n / in_rate);
+                in[n] = (int16_t)lrintf(fminf(fmaxf(x, 0.0f), 4095.0f));
+            }
+
+            // Today's front end: one conversion per output sample
+            for (int i = 0; i < OUT; i++) plain[i] = in[(i + SKIP) * m];
+
+            // Oversampled: decimation chain, outputs in counts x 8
+            TEST_ASSERT_TRUE(decim_chain_init(&chain, m, in_rate, 1, 3));
+            size_t n = decim_chain_process(&chain, in, out, (size_t)total);
+            TEST_ASSERT_EQUAL(OUT + SKIP, n);
+            for (int i = 0; i < OUT; i++) decim[i] = out[i + SKIP] / 8.0f;
+
+            plain_rms[c] = decim_residual_rms(plain, OUT, tone_hz / out_rate);
+            decim_rms[c] = decim_residual_rms(decim, OUT, tone_hz / out_rate);
+            floor_db[c] = 20.0f * log10f(plain_rms[c] / decim_rms[c]);
+        }
+
+        printf("front end x%u (%.0f Hz -> %.0f Hz): noise %.2f -> %.2f counts rms (%.1f dB), "
+               "130 Hz alias %.1f -> %.3f counts rms (%.1f dB)\n",
+               m, in_rate, out_rate, plain_rms[0], decim_rms[0], floor_db[0],
+               plain_rms[1], decim_rms[1], floor_db[1]);
+
+        // White noise: within 2 dB of 10 log10(m); the alias: the stopband design target, less margin
+        TEST_ASSERT_TRUE(floor_db[0] > 10.0f * log10f((float)m) - 2.0f);
+        TEST_ASSERT_TRUE(floor_db[1] > DECIM_ATTEN_DB - 10.0f);
+    }
+}
+
+
+// =============================
+// Test: Stage Graph Runs Its Stages in Order, Out of One Arena
+// =============================
+typedef struct { int16_t gain; } graph_test_gain_t;
+typedef struct { int64_t sum; uint32_t last_stamp; } graph_test_sum_t;
+
+static void graph_test_gain(void *state, int16_t *frames, const uint32_t *stamps, size_t count) {
+    const graph_test_gain_t *st = state;
+    for (size_t i = 0; i < count; i++) frames[i] = (int16_t)(frames[i] * st->gain);
+}
+
+static void graph_test_sum(void *state, int16_t *frames, const uint32_t *stamps, size_t count) {
+    graph_test_sum_t *st = state;
+    for (size_t i = 0; i < count; i++) st->sum += frames[i];
+    st->last_stamp = stamps[count - 1];
+}
+
+void test_dsp_graph_stages_and_counters(void) {
+
+    static uint8_t arena[2 * DSP_GRAPH_ALIGN] __attribute__((aligned(DSP_GRAPH_ALIGN)));
+    dsp_graph_t graph;
+    int16_t block[4] = { 1, 2, 3, 4 };
+    const uint32_t stamps[4] = { 10, 20, 30, 40 };
+
+    // --- 1. Arena: aligned, zeroed slots until it is full ---
+    dsp_graph_init(&graph, arena, sizeof(arena));
+    graph_test_gain_t *gain = dsp_graph_alloc(&graph, sizeof(graph_test_gain_t));
+    graph_test_sum_t *sum = dsp_graph_alloc(&graph, sizeof(graph_test_sum_t));
+    TEST_ASSERT_NOT_NULL(gain);
+    TEST_ASSERT_NOT_NULL(sum);
+    TEST_ASSERT_EQUAL(0, ((uintptr_t)sum) % DSP_GRAPH_ALIGN);
+    TEST_ASSERT_EQUAL(0, sum->sum);
+    TEST_ASSERT_NULL(dsp_graph_alloc(&graph, 1));
+    gain->gain = 3;
+
+    // --- 2. In order, in place: the sum sees the gain's output ---
+    TEST_ASSERT_EQUAL(0, dsp_graph_add(&graph, "gain", graph_test_gain, gain));
+    TEST_ASSERT_EQUAL(1, dsp_graph_add(&graph, "sum", graph_test_sum, sum));
+    TEST_ASSERT_EQUAL(-1, dsp_graph_add(&graph, "none", NULL, NULL));
+    TEST_ASSERT_EQUAL(1, dsp_graph_find(&graph, "sum"));
+    TEST_ASSERT_EQUAL(-1, dsp_graph_find(&graph, "notch"));
+
+    dsp_graph_run(&graph, block, stamps, 4);
+    TEST_ASSERT_EQUAL(30, sum->sum);
+    TEST_ASSERT_EQUAL_INT16(12, block[3]);
+    TEST_ASSERT_EQUAL_UINT32(40, sum->last_stamp);
+
+    // --- 3. Partial runs and disabled stages ---
+    dsp_graph_run_from(&graph, 1, block, stamps, 2);              // Sum alone: 3 + 6
+    TEST_ASSERT_EQUAL(39, sum->sum);
+    graph.stage[0].enabled = false;
+    dsp_graph_run(&graph, block, stamps, 1);                      // Gain skipped: + 3
+    TEST_ASSERT_EQUAL(42, sum->sum);
+
+    TEST_ASSERT_EQUAL_UINT32(1, graph.stage[0].calls);
+    TEST_ASSERT_EQUAL_UINT64(4, graph.stage[0].frames);
+    TEST_ASSERT_EQUAL_UINT32(3, graph.stage[1].calls);
+    TEST_ASSERT_EQUAL_UINT64(7, graph.stage[1].frames);
+    if (bench_has_cycles()) TEST_ASSERT_TRUE(graph.stage[1].cycles > 0);
+    dsp_graph_reset_counters(&graph);
+    TEST_ASSERT_EQUAL_UINT32(0, graph.stage[1].calls);
+
+    // --- 4. The pipeline graph: every stage sees every frame, states fit the arena ---
+    static adc_source_synth_t synth;
+    adc_synth_config_t cfg;
+    adc_synth_default_config(&cfg, SAMPLE_RATE_HZ);
+    cfg.duration_frames = (uint64_t)(20 * SAMPLE_RATE_HZ);
+
+    adc_pipeline_init();
+    TEST_ASSERT_EQUAL(ADC_NOTCH_ENABLED ? 0 : -1, dsp_graph_find(&adc_graph, "notch"));
+    TEST_ASSERT_TRUE(adc_graph.arena_used <= adc_graph.arena_size);
+    TEST_ASSERT_NOT_NULL(adc_detect_state);
+
+    size_t frames = adc_pipeline_run(adc_source_synth_init(&synth, &cfg, ADC_NUM_CHANNELS), 0);
+    TEST_ASSERT_EQUAL(cfg.duration_frames, frames);
+    for (int s = 0; s < adc_graph.num_stages; s++) {
+        TEST_ASSERT_EQUAL_UINT64(frames, adc_graph.stage[s].frames);
+        TEST_ASSERT_EQUAL_UINT32((frames + ADC_DRAIN_BLOCK - 1) / ADC_DRAIN_BLOCK, adc_graph.stage[s].calls);
+    }
+    TEST_ASSERT_TRUE(eeg_bands.segments > 0);                    // Spectral stage really ran
+
+    // Detection alone: only the detect + spectral stages move
+    int bandpass = dsp_graph_find(&adc_graph, "bandpass");
+    int detect = dsp_graph_find(&adc_graph, "detect");
+    detect_events(0);
+    TEST_ASSERT_EQUAL_UINT64(frames, adc_graph.stage[bandpass].frames);
+    TEST_ASSERT_EQUAL_UINT64(frames + 1, adc_graph.stage[detect].frames);
+
+    printf("stage graph, %d ch @ %.0f Hz:\n", ADC_NUM_CHANNELS, (float)SAMPLE_RATE_HZ);
+    dsp_graph_print(stdout, &adc_graph);
+}
+
+
+// =============================
+// Test: Stages Nobody Reads Are Skipped (power.h demand)
+// =============================
+// Same synthetic minute twice: everything demanded, then only a BLE client (no spectral
+// reader) subscribed to events and the raw stream. The gated stages must not move, the events
+// must come out the same, and the filtering busy time per simulated second is printed for both
+// so the saving can be read off the test log (on the target, multiply by the CPU slowdown; see
+// the README).
+static float gated_run(uint32_t demand, uint32_t *blinks) {
+
+    static adc_source_synth_t synth;
+    adc_synth_config_t cfg;
+    adc_synth_default_config(&cfg, SAMPLE_RATE_HZ);
+    cfg.duration_frames = (uint64_t)(60 * SAMPLE_RATE_HZ);
+
+    reset_adc_state();
+    adc_pipeline_apply_demand(demand);
+    power_duty_reset();
+
+    size_t frames = adc_pipeline_run(adc_source_synth_init(&synth, &cfg, ADC_NUM_CHANNELS), 0);
+    *blinks = blink_count;
+    return (float)power_duty_get(TASK_ROLE_FILTERING)->busy_us / ((float)frames / SAMPLE_RATE_HZ);
+}
+
+void test_pipeline_demand_gating(void) {
+
+    uint32_t blinks_all, blinks_link;
+    const uint32_t client = POWER_DEMAND_LINK | POWER_DEMAND_STREAM;
+    float busy_all = gated_run(client | POWER_DEMAND_SPECTRAL, &blinks_all);
+    TEST_ASSERT_TRUE(eeg_bands.segments > 0);
+
+    // Spectral off and back on: a fresh engine, not the stale window it left off with
+    adc_pipeline_apply_demand(client);
+    adc_pipeline_apply_demand(client | POWER_DEMAND_SPECTRAL);
+    TEST_ASSERT_EQUAL_UINT32(0, adc_spectral_state->engine[0].count);
+    TEST_ASSERT_EQUAL_UINT32(0, eeg_bands.segments);
+
+    float busy_link = gated_run(client, &blinks_link);
+    const dsp_stage_t *spectral = &adc_graph.stage[dsp_graph_find(&adc_graph, "spectral")];
+    const dsp_stage_t *publish = &adc_graph.stage[dsp_graph_find(&adc_graph, "publish")];
+    TEST_ASSERT_FALSE(spectral->enabled);
+    TEST_ASSERT_EQUAL_UINT32(0, spectral->calls);
+    TEST_ASSERT_TRUE(publish->calls > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, eeg_bands.segments);             // Nothing estimated
+    TEST_ASSERT_EQUAL_UINT32(blinks_all, blinks_link);           // Events unaffected
+
+    // Events-only subscription, then no client: publish goes too
+    adc_pipeline_apply_demand(POWER_DEMAND_LINK);
+    TEST_ASSERT_FALSE(publish->enabled);
+    adc_pipeline_apply_demand(POWER_DEMAND_STREAM);
+    TEST_ASSERT_TRUE(publish->enabled);
+    adc_pipeline_apply_demand(POWER_DEMAND_RECORD);
+    TEST_ASSERT_FALSE(publish->enabled);
+    TEST_ASSERT_FALSE(spectral->enabled);
+
+    printf("filtering busy per second of EEG @ %.0f Hz: %.1f us with spectral, %.1f us without\n",
+           (float)SAMPLE_RATE_HZ, busy_all, busy_link);
+}
+
+
+// =============================
+// Test: Mains Notch Rejects f0, Passes the EEG Band
+// =============================
+static float notch_gain(float f0, float f, float fs) {
+
+    enum { N = 4000 };
+    biquad_coeffs_t sos;
+    biquad_cascade_t notch;
+    biquad_design_notch(&sos, f0, ADC_NOTCH_Q, fs);
+    biquad_cascade_init(&notch, &sos, 1);
+
+    // RMS gain over the second half (settled: Q / (pi f0) is far shorter than N / 2 samples)
+    double in_sq = 0.0, out_sq = 0.0;
+    for (int n = 0; n < N; n++) {
+        float x = 1000.0f * sinf(2.0f * (float)M_PI * f * n / fs), y;
+        biquad_cascade_process_f32(&notch, &x, &y, 1);
+        if (n >= N / 2) {
+            in_sq += (double)x * x;
+            out_sq += (double)y * y;
+        }
+    }
+    return (float)sqrt(out_sq / in_sq);
+}
+
+void test_notch_rejects_mains(void) {
+
+    const float rates[] = { 250.0f, 500.0f, 1000.0f };
+    const float mains[] = { 50.0f, 60.0f };
+
+    for (int r = 0; r < 3; r++) {
+        for (int m = 0; m < 2; m++) {
+            float at_f0 = notch_gain(mains[m], mains[m], rates[r]);
+            float alpha = notch_gain(mains[m], 10.0f, rates[r]);
+            float beta = notch_gain(mains[m], 25.0f, rates[r]);
+            printf("notch %2.0f Hz @ %4.0f Hz: f0 %.4f, 10 Hz %.4f, 25 Hz %.4f\n",
+                   mains[m], rates[r], at_f0, alpha, beta);
+            TEST_ASSERT_TRUE(at_f0 < 0.01f);                       // -40 dB or better
+            TEST_ASSERT_FLOAT_WITHIN(0.01f, 1.0f, alpha);
+            TEST_ASSERT_FLOAT_WITHIN(0.01f, 1.0f, beta);
+        }
+    }
+}
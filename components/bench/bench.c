@@ -0,0 +1,171 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "bench.h"
+    #include "sdkconfig.h"                // CONFIG_IDF_TARGET / CONFIG_IDF_TARGET_LINUX
+
+#if CONFIG_IDF_TARGET_LINUX
+    #include <time.h>                     // clock_gettime (steady clock)
+    #if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>                // __rdtsc
+    #define BENCH_HAS_TSC 1
+    #endif
+#else
+    #include "esp_cpu.h"                  // esp_cpu_get_cycle_count
+    #include "esp_rom_sys.h"              // esp_rom_get_cpu_ticks_per_us
+    #include "esp_timer.h"
+#endif
+
+
+// =============================
+// Clocks
+// =============================
+uint64_t bench_time_ns(void) {
+#if CONFIG_IDF_TARGET_LINUX
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#else
+    return (uint64_t)esp_timer_get_time() * 1000ull;
+#endif
+}
+
+uint64_t bench_cycles(void) {
+#if !CONFIG_IDF_TARGET_LINUX
+    return (uint64_t)esp_cpu_get_cycle_count();   // 32-bit, wraps: callers subtract as uint32_t
+#elif defined(BENCH_HAS_TSC)
+    return (uint64_t)__rdtsc();
+#else
+    return 0;
+#endif
+}
+
+bool bench_has_cycles(void) {
+#if !CONFIG_IDF_TARGET_LINUX || defined(BENCH_HAS_TSC)
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char *bench_platform(void) {
+#ifdef CONFIG_IDF_TARGET
+    return CONFIG_IDF_TARGET;
+#else
+    return "linux";
+#endif
+}
+
+uint32_t bench_cpu_mhz(void) {
+#if CONFIG_IDF_TARGET_LINUX
+    return 0;
+#else
+    return esp_rom_get_cpu_ticks_per_us();
+#endif
+}
+
+
+// =============================
+// Harness: Config + Run
+// =============================
+void bench_default_config(bench_config_t *cfg) {
+    cfg->warmup_runs = BENCH_DEFAULT_WARMUP;
+    cfg->runs = BENCH_DEFAULT_RUNS;
+}
+
+// The run count bench_run actually uses (and the report states)
+static uint32_t bench_clamped_runs(const bench_config_t *cfg) {
+    if (cfg->runs < 1) return 1;
+    if (cfg->runs > BENCH_MAX_RUNS) return BENCH_MAX_RUNS;
+    return cfg->runs;
+}
+
+static void sort_u64(uint64_t *v, uint32_t n) {
+    // Insertion sort: n <= BENCH_MAX_RUNS, and no qsort callback overhead to reason about
+    for (uint32_t i = 1; i < n; i++) {
+        uint64_t x = v[i];
+        uint32_t j = i;
+        while (j > 0 && v[j - 1] > x) { v[j] = v[j - 1]; j--; }
+        v[j] = x;
+    }
+}
+
+void bench_run(const bench_case_t *bench, const bench_config_t *cfg, bench_result_t *result) {
+
+    static uint64_t ns[BENCH_MAX_RUNS];        // Static: the target bench task stack stays small
+    static uint64_t cycles[BENCH_MAX_RUNS];
+
+    uint32_t runs = bench_clamped_runs(cfg);
+
+    // --- 1. Setup + warm-up (untimed) ---
+    if (bench->setup) bench->setup(bench->ctx);
+    for (uint32_t i = 0; i < cfg->warmup_runs; i++) bench->run(bench->ctx);
+
+    // --- 2. Timed passes ---
+    for (uint32_t i = 0; i < runs; i++) {
+#if CONFIG_IDF_TARGET_LINUX
+        uint64_t c0 = bench_cycles();
+        uint64_t t0 = bench_time_ns();
+        bench->run(bench->ctx);
+        uint64_t t1 = bench_time_ns();
+        uint64_t c1 = bench_cycles();
+        ns[i] = t1 - t0;
+        cycles[i] = c1 - c0;
+#else
+        // Cycle counter only: exact, and esp_timer's 1 us resolution is too coarse for short passes
+        uint32_t c0 = (uint32_t)bench_cycles();
+        bench->run(bench->ctx);
+        uint32_t c1 = (uint32_t)bench_cycles();
+        cycles[i] = (uint32_t)(c1 - c0);
+        ns[i] = cycles[i] * 1000ull / bench_cpu_mhz();
+#endif
+    }
+
+    // --- 3. Median + min, normalized per sample ---
+    sort_u64(ns, runs);
+    sort_u64(cycles, runs);
+
+    double samples = bench->samples_per_run ? (double)bench->samples_per_run : 1.0;
+    result->name = bench->name;
+    result->samples_per_run = bench->samples_per_run;
+    result->runs = runs;
+    result->ns_per_sample = (double)ns[runs / 2] / samples;
+    result->ns_per_sample_min = (double)ns[0] / samples;
+    result->cycles_per_sample = bench_has_cycles() ? (double)cycles[runs / 2] / samples : -1.0;
+    result->samples_per_s = result->ns_per_sample > 0.0 ? 1e9 / result->ns_per_sample : 0.0;
+}
+
+
+// =============================
+// Report: JSON / CSV
+// =============================
+void bench_report(FILE *fp, bench_format_t format, const char *version, const bench_config_t *cfg,
+                  const bench_result_t *results, size_t count) {
+
+    if (format == BENCH_FORMAT_CSV) {
+        fprintf(fp, "platform,version,name,samples_per_run,runs,cycles_per_sample,ns_per_sample,ns_per_sample_min,samples_per_s\n");
+        for (size_t i = 0; i < count; i++) {
+            const bench_result_t *r = &results[i];
+            fprintf(fp, "%s,%s,%s,%lu,%lu,", bench_platform(), version, r->name,
+                    (unsigned long)r->samples_per_run, (unsigned long)r->runs);
+            if (r->cycles_per_sample >= 0.0) fprintf(fp, "%.2f", r->cycles_per_sample);
+            fprintf(fp, ",%.2f,%.2f,%.0f\n", r->ns_per_sample, r->ns_per_sample_min, r->samples_per_s);
+        }
+        return;
+    }
+
+    fprintf(fp, "{\"platform\":\"%s\",\"version\":\"%s\",\"cpu_mhz\":%lu,\"warmup\":%lu,\"runs\":%lu,\"results\":[",
+            bench_platform(), version, (unsigned long)bench_cpu_mhz(),
+            (unsigned long)cfg->warmup_runs, (unsigned long)bench_clamped_runs(cfg));
+    for (size_t i = 0; i < count; i++) {
+        const bench_result_t *r = &results[i];
+        fprintf(fp, "%s\n  {\"name\":\"%s\",\"samples_per_run\":%lu,\"cycles_per_sample\":", i ? "," : "",
+                r->name, (unsigned long)r->samples_per_run);
+        if (r->cycles_per_sample >= 0.0) fprintf(fp, "%.2f", r->cycles_per_sample);
+        else fprintf(fp, "null");
+        fprintf(fp, ",\"ns_per_sample\":%.2f,\"ns_per_sample_min\":%.2f,\"samples_per_s\":%.0f}",
+                r->ns_per_sample, r->ns_per_sample_min, r->samples_per_s);
+    }
+    fprintf(fp, "\n]}\n");
+}
@@ -0,0 +1,83 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdio.h>      // FILE (reports)
+
+
+// =============================
+// Microbenchmark Harness
+// =============================
+//
+// Times a kernel over a fixed input vector: `setup` once, `warmup_runs` untimed passes (caches,
+// branch predictors, lazy init), then `runs` timed passes. The median pass is reported (robust
+// to an interrupt or a context switch landing in one pass), the fastest pass alongside it.
+//
+// Clocks:
+//      target : esp_cpu_get_cycle_count() (exact core cycles); ns derived from the CPU clock
+//      host   : CLOCK_MONOTONIC for ns; cycles from the x86 TSC when available (reference
+//               cycles, not core cycles), otherwise reported as unavailable
+//
+// One pass must stay well under 2^32 cycles (~17 s at 240 MHz): the target counter is 32-bit.
+#define BENCH_DEFAULT_WARMUP  3
+#define BENCH_DEFAULT_RUNS    21        // Odd, so the median is a real pass
+#define BENCH_MAX_RUNS        101
+
+typedef struct {
+    const char *name;
+    void (*setup)(void *ctx);       // Optional: reset state, build inputs (not timed)
+    void (*run)(void *ctx);         // One pass over the fixed input vector (timed)
+    void *ctx;
+    uint32_t samples_per_run;       // Samples one pass consumes (per-sample figures divide by this)
+} bench_case_t;
+
+typedef struct {
+    uint32_t warmup_runs;
+    uint32_t runs;                  // Clamped to 1..BENCH_MAX_RUNS
+} bench_config_t;
+
+typedef struct {
+    const char *name;
+    uint32_t samples_per_run;
+    uint32_t runs;
+    double   ns_per_sample;         // Median pass
+    double   ns_per_sample_min;     // Fastest pass
+    double   cycles_per_sample;     // Median pass; < 0 when the platform has no cycle counter
+    double   samples_per_s;         // From the median pass
+} bench_result_t;
+
+typedef enum {
+    BENCH_FORMAT_JSON = 0,          // One object: platform info + "results" array
+    BENCH_FORMAT_CSV,               // Header line + one row per case
+} bench_format_t;
+
+
+// =============================
+// Benchmark API
+// =============================
+void bench_default_config(bench_config_t *cfg);
+void bench_run(const bench_case_t *bench, const bench_config_t *cfg, bench_result_t *result);
+
+// `version` tags the report (e.g., git describe of the firmware) so runs can be diffed
+void bench_report(FILE *fp, bench_format_t format, const char *version, const bench_config_t *cfg,
+                  const bench_result_t *results, size_t count);
+
+
+// =============================
+// Clock API (exposed for tests)
+// =============================
+uint64_t bench_time_ns(void);       // Monotonic
+uint64_t bench_cycles(void);        // Free-running cycle counter (0 if unavailable)
+bool     bench_has_cycles(void);
+const char *bench_platform(void);   // "esp32", "linux", ...
+uint32_t bench_cpu_mhz(void);       // 0 if unknown (host)
+
+
+#endif // BENCH_H
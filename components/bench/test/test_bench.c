@@ -0,0 +1,101 @@
+// test_bench.c - Unit tests for the microbenchmark harness
+
+#include "unity.h"
+#include "bench.h"   // Under test
+#include <string.h>  // For strstr
+
+
+// =============================
+// Fixtures: Counting Kernel
+// =============================
+typedef struct {
+    uint32_t setups;
+    uint32_t runs;
+    volatile uint32_t acc;
+} counting_ctx_t;
+
+static void counting_setup(void *ctx) {
+    ((counting_ctx_t *)ctx)->setups++;
+}
+
+static void counting_run(void *ctx) {
+    counting_ctx_t *c = ctx;
+    c->runs++;
+    for (uint32_t i = 0; i < 2000; i++) c->acc += i;   // Some work so the clocks move
+}
+
+
+// =============================
+// Test: Warm-up + Timed Passes, Per-Sample Figures
+// =============================
+void test_bench_run_counts_and_normalizes(void) {
+
+    counting_ctx_t ctx = {0};
+    bench_case_t bench = { "counting", counting_setup, counting_run, &ctx, 2000 };
+    bench_config_t cfg = { .warmup_runs = 2, .runs = 5 };
+    bench_result_t r;
+
+    // Clocks move forward
+    uint64_t t0 = bench_time_ns();
+    counting_run(&ctx);
+    TEST_ASSERT_TRUE(bench_time_ns() >= t0);
+    ctx.runs = 0;
+
+    bench_run(&bench, &cfg, &r);
+
+    TEST_ASSERT_EQUAL(1, ctx.setups);
+    TEST_ASSERT_EQUAL(2 + 5, ctx.runs);                 // Warm-up passes are not timed but do run
+    TEST_ASSERT_EQUAL(5, r.runs);
+    TEST_ASSERT_EQUAL(2000, r.samples_per_run);
+    TEST_ASSERT_TRUE(r.ns_per_sample > 0.0);
+    TEST_ASSERT_TRUE(r.ns_per_sample_min <= r.ns_per_sample);
+    TEST_ASSERT_TRUE(r.samples_per_s > 0.0);
+    TEST_ASSERT_TRUE(bench_has_cycles() ? r.cycles_per_sample > 0.0 : r.cycles_per_sample < 0.0);
+
+    // Run count is clamped
+    cfg.runs = 0;
+    bench_run(&bench, &cfg, &r);
+    TEST_ASSERT_EQUAL(1, r.runs);
+    cfg.runs = BENCH_MAX_RUNS + 10;
+    bench_run(&bench, &cfg, &r);
+    TEST_ASSERT_EQUAL(BENCH_MAX_RUNS, r.runs);
+}
+
+
+// =============================
+// Test: JSON + CSV Reports
+// =============================
+void test_bench_report_formats(void) {
+
+    static char buf[1024];
+    bench_config_t cfg = { .warmup_runs = 3, .runs = 21 };
+    const bench_result_t results[2] = {
+        { "kernel_a", 1024, 21, 12.5, 11.0, 30.25, 8e7 },
+        { "kernel_b", 256, 21, 100.0, 90.0, -1.0, 1e7 },   // No cycle counter
+    };
+
+    FILE *fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+    bench_report(fp, BENCH_FORMAT_JSON, "v1.2-3-gabc", &cfg, results, 2);
+    rewind(fp);
+    size_t n = fread(buf, 1, sizeof(buf) - 1, fp);
+    buf[n] = '\0';
+
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"version\":\"v1.2-3-gabc\""));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"name\":\"kernel_a\",\"samples_per_run\":1024,\"cycles_per_sample\":30.25,\"ns_per_sample\":12.50"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "\"cycles_per_sample\":null"));
+    TEST_ASSERT_EQUAL('}', buf[n - 2]);                  // Closed object, trailing newline
+    fclose(fp);
+
+    fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+    bench_report(fp, BENCH_FORMAT_CSV, "v1", &cfg, results, 2);
+    rewind(fp);
+    n = fread(buf, 1, sizeof(buf) - 1, fp);
+    buf[n] = '\0';
+
+    TEST_ASSERT_NOT_NULL(strstr(buf, "name,samples_per_run,runs,cycles_per_sample,ns_per_sample"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, ",v1,kernel_a,1024,21,30.25,12.50,11.00,80000000\n"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, ",v1,kernel_b,256,21,,100.00,90.00,10000000\n"));   // Empty cycles column
+    fclose(fp);
+}
@@ -0,0 +1,175 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "ble_pkt.h"
+
+
+// =============================
+// Helpers: Types, Little-Endian, Varints
+// =============================
+static size_t ble_pkt_payload_bytes(uint8_t type) {
+    switch (type) {
+        case BLE_PKT_TYPE_BLINK:     return 4;
+        case BLE_PKT_TYPE_ATTENTION: return 1;
+        default:                     return 0;
+    }
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static size_t varint_size(uint32_t v) {
+    size_t n = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        n++;
+    }
+    return n;
+}
+
+static size_t varint_put(uint8_t *p, uint32_t v) {
+    size_t n = 0;
+    while (v >= 0x80) {
+        p[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    p[n++] = (uint8_t)v;
+    return n;
+}
+
+// Bytes read, 0 if truncated or longer than a 32-bit value allows
+static size_t varint_get(const uint8_t *p, size_t len, uint32_t *v) {
+
+    uint32_t out = 0;
+    for (size_t n = 0; n < len && n < BLE_PKT_VARINT_MAX; n++) {
+        if (n == BLE_PKT_VARINT_MAX - 1 && p[n] > 0x0F) return 0;   // Bits past 32 / continuation
+        out |= (uint32_t)(p[n] & 0x7F) << (7 * n);
+        if ((p[n] & 0x80) == 0) {
+            *v = out;
+            return n + 1;
+        }
+    }
+    return 0;
+}
+
+
+// =============================
+// Writer
+// =============================
+bool ble_pkt_begin(ble_pkt_writer_t *w, uint8_t *buf, size_t cap, ble_pkt_type_t type, uint16_t seq,
+                   uint32_t base_us) {
+
+    size_t payload = ble_pkt_payload_bytes((uint8_t)type);
+    if (payload == 0 || cap < BLE_PKT_HEADER_BYTES + 1 + payload) return false;
+
+    buf[0] = (uint8_t)((BLE_PKT_VERSION << 4) | type);
+    buf[1] = (uint8_t)seq;
+    buf[2] = (uint8_t)(seq >> 8);
+    put_u32(&buf[3], base_us);
+
+    *w = (ble_pkt_writer_t){ .buf = buf, .cap = cap, .len = BLE_PKT_HEADER_BYTES, .type = (uint8_t)type,
+                             .count = 0, .last_us = base_us };
+    return true;
+}
+
+static bool ble_pkt_add(ble_pkt_writer_t *w, uint8_t type, uint32_t stamp_us, uint32_t value) {
+
+    if (type != w->type || w->count == UINT8_MAX) return false;
+
+    uint32_t delta = stamp_us - w->last_us;
+    size_t payload = ble_pkt_payload_bytes(type);
+    if (w->len + varint_size(delta) + payload > w->cap) return false;
+
+    uint8_t *p = &w->buf[w->len];
+    p += varint_put(p, delta);
+    if (payload == 4) {
+        put_u32(p, value);
+    } else {
+        p[0] = (uint8_t)value;
+    }
+
+    w->len += varint_size(delta) + payload;
+    w->count++;
+    w->last_us = stamp_us;
+    return true;
+}
+
+bool ble_pkt_add_blink(ble_pkt_writer_t *w, uint32_t stamp_us, uint32_t count) {
+    return ble_pkt_add(w, BLE_PKT_TYPE_BLINK, stamp_us, count);
+}
+
+bool ble_pkt_add_attention(ble_pkt_writer_t *w, uint32_t stamp_us, uint8_t level) {
+    return ble_pkt_add(w, BLE_PKT_TYPE_ATTENTION, stamp_us, level);
+}
+
+
+// =============================
+// Decoder (also used to reopen a packet)
+// =============================
+// Walks the records; `last_us` (optional) receives the stamp of the last one
+static int ble_pkt_walk(const uint8_t *buf, size_t len, ble_pkt_header_t *hdr, ble_pkt_record_t *records,
+                        size_t max, uint32_t *last_us) {
+
+    // --- 1. Header ---
+    if (len < BLE_PKT_HEADER_BYTES) return -1;
+
+    ble_pkt_header_t h = {
+        .version = (uint8_t)(buf[0] >> 4),
+        .type    = (uint8_t)(buf[0] & 0x0F),
+        .seq     = (uint16_t)(buf[1] | (buf[2] << 8)),
+        .base_us = get_u32(&buf[3]),
+    };
+    size_t payload = ble_pkt_payload_bytes(h.type);
+    if (h.version != BLE_PKT_VERSION || payload == 0) return -1;
+    if (hdr) *hdr = h;
+
+    // --- 2. Records, to the end of the notification ---
+    size_t pos = BLE_PKT_HEADER_BYTES;
+    uint32_t stamp = h.base_us;
+    int count = 0;
+    while (pos < len) {
+        uint32_t delta;
+        size_t n = varint_get(&buf[pos], len - pos, &delta);
+        if (n == 0 || pos + n + payload > len) return -1;
+        pos += n;
+
+        stamp += delta;
+        if (records) {
+            if ((size_t)count >= max) return -1;
+            records[count].stamp_us = stamp;
+            records[count].value = payload == 4 ? get_u32(&buf[pos]) : buf[pos];
+        }
+        pos += payload;
+        count++;
+    }
+
+    if (count == 0) return -1;
+    if (last_us) *last_us = stamp;
+    return count;
+}
+
+int ble_pkt_decode(const uint8_t *buf, size_t len, ble_pkt_header_t *hdr, ble_pkt_record_t *records,
+                   size_t max) {
+    return ble_pkt_walk(buf, len, hdr, records, max, NULL);
+}
+
+bool ble_pkt_resume(ble_pkt_writer_t *w, uint8_t *buf, size_t len, size_t cap) {
+
+    ble_pkt_header_t h;
+    uint32_t last_us;
+    int count = ble_pkt_walk(buf, len, &h, NULL, 0, &last_us);
+    if (count < 0 || count > UINT8_MAX || len > cap) return false;
+
+    *w = (ble_pkt_writer_t){ .buf = buf, .cap = cap, .len = len, .type = h.type,
+                             .count = (uint8_t)count, .last_us = last_us };
+    return true;
+}
@@ -0,0 +1,179 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "ble_stream.h"
+    #include <string.h>  // For memmove
+
+
+// =============================
+// Packing: 12-bit Samples, Two per Three Bytes
+// =============================
+static inline uint16_t ble_stream_to12(int16_t sample) {
+    if (sample < BLE_STREAM_SAMPLE_MIN) sample = BLE_STREAM_SAMPLE_MIN;
+    if (sample > BLE_STREAM_SAMPLE_MAX) sample = BLE_STREAM_SAMPLE_MAX;
+    return (uint16_t)sample & 0x0FFF;
+}
+
+static inline int16_t ble_stream_from12(uint16_t raw) {
+    return (int16_t)((raw & 0x800) ? (int)raw - 0x1000 : (int)raw);   // Sign-extend bit 11
+}
+
+size_t ble_stream_packed_size(size_t count) {
+    return (count * 3 + 1) / 2;
+}
+
+size_t ble_stream_pack12(const int16_t *samples, size_t count, uint8_t *out) {
+
+    size_t o = 0;
+    size_t i = 0;
+
+    // --- 1. Full pairs: 24 bits -> 3 bytes ---
+    for (; i + 1 < count; i += 2) {
+        uint16_t a = ble_stream_to12(samples[i]);
+        uint16_t b = ble_stream_to12(samples[i + 1]);
+        out[o++] = (uint8_t)(a & 0xFF);
+        out[o++] = (uint8_t)((a >> 8) | ((b & 0x0F) << 4));
+        out[o++] = (uint8_t)(b >> 4);
+    }
+
+    // --- 2. Odd tail: 12 bits -> 2 bytes (upper nibble zero) ---
+    if (i < count) {
+        uint16_t a = ble_stream_to12(samples[i]);
+        out[o++] = (uint8_t)(a & 0xFF);
+        out[o++] = (uint8_t)(a >> 8);
+    }
+
+    return o;
+}
+
+size_t ble_stream_unpack12(const uint8_t *in, size_t len, int16_t *out, size_t max) {
+
+    size_t n = 0;
+    size_t i = 0;
+
+    for (; i + 3 <= len && n + 2 <= max; i += 3) {
+        out[n++] = ble_stream_from12((uint16_t)(in[i] | ((in[i + 1] & 0x0F) << 8)));
+        out[n++] = ble_stream_from12((uint16_t)((in[i + 1] >> 4) | (in[i + 2] << 4)));
+    }
+    if (i + 2 == len && n < max) {
+        out[n++] = ble_stream_from12((uint16_t)(in[i] | ((in[i + 1] & 0x0F) << 8)));
+    }
+
+    return n;
+}
+
+
+// =============================
+// Stream: Init + Reset
+// =============================
+void ble_stream_init(ble_stream_t *stream, uint8_t channels, ble_stream_send_fn send, void *ctx) {
+
+    memset(stream, 0, sizeof(*stream));
+    stream->send = send;
+    stream->send_ctx = ctx;
+    stream->channels = channels ? channels : 1;
+    ble_stream_set_mtu(stream, BLE_STREAM_MTU_DEFAULT);
+}
+
+void ble_stream_reset(ble_stream_t *stream) {
+    stream->staged_frames = 0;
+    stream->pending_flags = 0;
+    stream->seq_valid = false;
+}
+
+
+// =============================
+// Stream: Send One Packet
+// =============================
+static void ble_stream_send_frames(ble_stream_t *stream, uint16_t frames) {
+
+    if (frames == 0) return;
+
+    size_t count = (size_t)frames * stream->channels;
+    uint8_t *p = stream->packet;
+
+    // --- 1. Header ---
+    p[0] = (uint8_t)(stream->staged_seq & 0xFF);
+    p[1] = (uint8_t)((stream->staged_seq >> 8) & 0xFF);
+    p[2] = stream->channels;
+    p[3] = stream->pending_flags;
+
+    // --- 2. Payload ---
+    size_t len = BLE_STREAM_HEADER_BYTES + ble_stream_pack12(stream->staged, count, p + BLE_STREAM_HEADER_BYTES);
+
+    if (stream->send && stream->send(stream->send_ctx, p, (uint16_t)len) == 0) {
+        stream->packets_sent++;
+        stream->samples_sent += (uint32_t)count;
+    } else {
+        stream->send_errors++;
+    }
+
+    // --- 3. Shift out what was sent (only non-zero after an MTU shrink) ---
+    stream->pending_flags = 0;
+    stream->staged_seq += frames;
+    stream->staged_frames -= frames;
+    if (stream->staged_frames) {
+        memmove(stream->staged, &stream->staged[count], stream->staged_frames * stream->channels * sizeof(int16_t));
+    }
+}
+
+
+// =============================
+// Stream: MTU Update
+// =============================
+void ble_stream_set_mtu(ble_stream_t *stream, uint16_t mtu) {
+
+    if (mtu < BLE_STREAM_MTU_DEFAULT) mtu = BLE_STREAM_MTU_DEFAULT;
+    if (mtu > BLE_STREAM_MTU_MAX) mtu = BLE_STREAM_MTU_MAX;
+
+    stream->payload_max = (uint16_t)(mtu - BLE_STREAM_ATT_OVERHEAD);
+
+    size_t samples = ((size_t)(stream->payload_max - BLE_STREAM_HEADER_BYTES) * 2) / 3;
+    stream->frames_per_packet = (uint16_t)(samples / stream->channels);
+    if (stream->frames_per_packet == 0) stream->frames_per_packet = 1;   // 8 ch still fit at MTU 23
+
+    while (stream->staged_frames >= stream->frames_per_packet) {
+        ble_stream_send_frames(stream, stream->frames_per_packet);
+    }
+}
+
+
+// =============================
+// Stream: Append Frames
+// =============================
+void ble_stream_push(ble_stream_t *stream, const int16_t *frames, size_t count, uint32_t first_seq) {
+
+    // --- 1. Sequence jump (ring overrun, reconnect): never pack across a gap ---
+    if (stream->seq_valid && first_seq != stream->next_seq) {
+        ble_stream_flush(stream);
+        stream->pending_flags |= BLE_STREAM_FLAG_GAP;
+    }
+    stream->seq_valid = true;
+    stream->next_seq = first_seq + (uint32_t)count;
+
+    // --- 2. Stage frames, sending each packet as soon as it is full ---
+    while (count) {
+
+        if (stream->staged_frames == 0) stream->staged_seq = first_seq;
+
+        size_t room = stream->frames_per_packet - stream->staged_frames;
+        size_t take = count < room ? count : room;
+        size_t values = take * stream->channels;
+
+        memcpy(&stream->staged[stream->staged_frames * stream->channels], frames, values * sizeof(int16_t));
+        stream->staged_frames += (uint16_t)take;
+
+        frames += values;
+        first_seq += (uint32_t)take;
+        count -= take;
+
+        if (stream->staged_frames == stream->frames_per_packet) {
+            ble_stream_send_frames(stream, stream->staged_frames);
+        }
+    }
+}
+
+void ble_stream_flush(ble_stream_t *stream) {
+    ble_stream_send_frames(stream, stream->staged_frames);
+}
@@ -0,0 +1,191 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "ble_txq.h"
+    #include <string.h>  // For memset / memcpy
+
+_Static_assert((BLE_TXQ_DEPTH & (BLE_TXQ_DEPTH - 1)) == 0, "BLE_TXQ_DEPTH must be a power of two");
+
+
+// =============================
+// Queue: Init + Reset
+// =============================
+void ble_txq_init(ble_txq_t *q, ble_txq_send_fn send, void *ctx) {
+    memset(q, 0, sizeof(*q));
+    q->send = send;
+    q->send_ctx = ctx;
+}
+
+void ble_txq_reset(ble_txq_t *q) {
+
+    q->stats.dropped += (uint32_t)ble_txq_depth(q);
+    q->head = 0;
+    q->count = 0;
+    for (int s = 0; s < BLE_TXQ_LATEST_SLOTS; s++) q->latest[s].pending = false;
+    q->stalled = false;
+}
+
+size_t ble_txq_depth(const ble_txq_t *q) {
+    size_t depth = q->count;
+    for (int s = 0; s < BLE_TXQ_LATEST_SLOTS; s++) depth += q->latest[s].pending;
+    return depth;
+}
+
+
+// =============================
+// Enqueue: Reserve + Commit (the caller writes the packet in place)
+// =============================
+static void ble_txq_note_depth(ble_txq_t *q) {
+    size_t depth = ble_txq_depth(q);
+    if (depth > q->stats.max_depth) q->stats.max_depth = (uint8_t)depth;
+}
+
+static ble_txq_packet_t *ble_txq_label(ble_txq_packet_t *p, uint16_t handle, uint8_t tag, int64_t event_us) {
+    p->handle = handle;
+    p->len = 0;
+    p->tag = tag;
+    p->value = 0;
+    p->event_us = event_us;
+    return p;
+}
+
+ble_txq_packet_t *ble_txq_reserve(ble_txq_t *q, uint16_t handle, uint8_t tag, int64_t event_us) {
+
+    // --- Full: the oldest goes (the newer event supersedes it) ---
+    if (q->count == BLE_TXQ_DEPTH) {
+        q->head = (uint8_t)((q->head + 1) & (BLE_TXQ_DEPTH - 1));
+        q->count--;
+        q->stats.dropped++;
+    }
+
+    return ble_txq_label(&q->fifo[(q->head + q->count) & (BLE_TXQ_DEPTH - 1)], handle, tag, event_us);
+}
+
+ble_txq_packet_t *ble_txq_reserve_latest(ble_txq_t *q, uint16_t handle, uint8_t tag, int64_t event_us) {
+
+    // Slot already holding this handle, else a free one
+    ble_txq_slot_t *slot = NULL;
+    for (int s = 0; s < BLE_TXQ_LATEST_SLOTS; s++) {
+        if (q->latest[s].pending && q->latest[s].packet.handle == handle) {
+            slot = &q->latest[s];
+            q->stats.coalesced++;
+            break;
+        }
+    }
+    for (int s = 0; s < BLE_TXQ_LATEST_SLOTS && slot == NULL; s++) {
+        if (!q->latest[s].pending) slot = &q->latest[s];
+    }
+    if (slot == NULL) return NULL;
+
+    return ble_txq_label(&slot->packet, handle, tag, event_us);
+}
+
+void ble_txq_commit(ble_txq_t *q, ble_txq_packet_t *packet) {
+
+    if (packet >= q->fifo && packet < q->fifo + BLE_TXQ_DEPTH) {
+        q->count++;                                    // Reserved at the tail
+    } else {
+        for (int s = 0; s < BLE_TXQ_LATEST_SLOTS; s++) {
+            if (packet == &q->latest[s].packet) q->latest[s].pending = true;
+        }
+    }
+    q->stats.enqueued++;
+    ble_txq_note_depth(q);
+}
+
+ble_txq_packet_t *ble_txq_tail(ble_txq_t *q, uint16_t handle) {
+
+    if (q->count == 0) return NULL;
+    ble_txq_packet_t *p = &q->fifo[(q->head + q->count - 1) & (BLE_TXQ_DEPTH - 1)];
+    return p->handle == handle ? p : NULL;
+}
+
+
+// =============================
+// Enqueue: Copying Wrappers
+// =============================
+bool ble_txq_push(ble_txq_t *q, uint16_t handle, const uint8_t *data, uint8_t len, uint8_t tag, int64_t event_us) {
+
+    if (len > BLE_TXQ_MAX_DATA) return false;
+
+    ble_txq_packet_t *p = ble_txq_reserve(q, handle, tag, event_us);
+    memcpy(p->data, data, len);
+    p->len = len;
+    ble_txq_commit(q, p);
+    return true;
+}
+
+bool ble_txq_put_latest(ble_txq_t *q, uint16_t handle, const uint8_t *data, uint8_t len, uint8_t tag,
+                        int64_t event_us) {
+
+    if (len > BLE_TXQ_MAX_DATA) return false;
+
+    ble_txq_packet_t *p = ble_txq_reserve_latest(q, handle, tag, event_us);
+    if (p == NULL) return false;
+    memcpy(p->data, data, len);
+    p->len = len;
+    ble_txq_commit(q, p);
+    return true;
+}
+
+
+// =============================
+// Congestion + Pump
+// =============================
+void ble_txq_set_congested(ble_txq_t *q, bool congested) {
+    if (congested && !q->congested) q->stats.congest_events++;
+    q->congested = congested;
+}
+
+// One send; false stops the pump (link congested or packet refused, kept for the retry)
+static bool ble_txq_send_one(ble_txq_t *q, const ble_txq_packet_t *p) {
+
+    if (q->congested) return false;
+    if (q->send == NULL || q->send(q->send_ctx, p) != 0) {
+        q->stats.refused++;
+        return false;
+    }
+    q->stats.sent++;
+    return true;
+}
+
+size_t ble_txq_pump(ble_txq_t *q, uint32_t now_us) {
+
+    size_t sent = 0;
+    bool blocked = false;
+
+    // --- 1. Ordered packets, oldest first ---
+    while (q->count > 0) {
+        if (!ble_txq_send_one(q, &q->fifo[q->head])) {
+            blocked = true;
+            break;
+        }
+        q->head = (uint8_t)((q->head + 1) & (BLE_TXQ_DEPTH - 1));
+        q->count--;
+        sent++;
+    }
+
+    // --- 2. Latest values ---
+    for (int s = 0; s < BLE_TXQ_LATEST_SLOTS && !blocked; s++) {
+        if (!q->latest[s].pending) continue;
+        if (!ble_txq_send_one(q, &q->latest[s].packet)) {
+            blocked = true;
+            break;
+        }
+        q->latest[s].pending = false;
+        sent++;
+    }
+
+    // --- 3. Stall accounting: from the first blocked pump to the one that empties the queue ---
+    if (blocked && !q->stalled) {
+        q->stalled = true;
+        q->stall_start_us = now_us;
+        q->stats.stalls++;
+    } else if (!blocked && q->stalled) {
+        q->stalled = false;
+        q->stats.stalled_us += (uint32_t)(now_us - q->stall_start_us);
+    }
+
+    return sent;
+}
@@ -0,0 +1,110 @@
+#ifndef BLE_PKT_H
+#define BLE_PKT_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+
+
+// =============================
+// Event Packets: Layout (Version 1)
+// =============================
+//
+// Blink and attention notifications carry a small versioned packet instead of a bare value, so
+// the phone can tell lost packets apart from quiet periods and put every event on a time line:
+//
+//      header  (7 bytes)
+//          [0]    version << 4 | type           (BLE_PKT_TYPE_*)
+//          [1..2] seq                           per type, little-endian, +1 per packet
+//          [3..6] base_us                       time of record 0, little-endian
+//      records (one or more, until the end of the notification)
+//          delta_us                             unsigned LEB128 varint, from the previous
+//                                               record (record 0: from base_us)
+//          payload                              fixed size per type:
+//              BLINK      4 bytes               running blink count, little-endian
+//              ATTENTION  1 byte                attention level 0..100
+//
+// Time stamps are the low 32 bits of esp_timer (adc_now_us(), wraps every ~71 min); deltas
+// and sums are modulo 2^32, so a packet straddling the wrap still decodes. A packet holds
+// more than one record only when events queued up behind a congested link: new blinks are
+// appended to the newest packet not yet sent (ble_txq_tail) rather than taking a slot of
+// their own, a few bytes each instead of a full header.
+//
+// Sequence gaps: on the blink characteristic they are packets dropped by the full queue or
+// the disconnect; on the attention characteristic they are levels replaced by a newer one
+// before they went out (only the latest level matters). Both restart at 0 on a new connection.
+//
+// The writer works in place on the caller's buffer (the queue's packet, ble_txq_reserve), so
+// nothing is staged and copied. ble_pkt_decode() is the reference decoder: plain C with no
+// ESP-IDF headers, for the phone / host side and for the tests.
+#define BLE_PKT_VERSION        1
+#define BLE_PKT_HEADER_BYTES   7
+#define BLE_PKT_VARINT_MAX     5          // LEB128 bytes for a 32-bit delta
+
+typedef enum {
+    BLE_PKT_TYPE_BLINK     = 1,
+    BLE_PKT_TYPE_ATTENTION = 2,
+} ble_pkt_type_t;
+
+// Upper bound on records in `len` bytes (smallest record: 1-byte delta + 1-byte payload)
+#define BLE_PKT_MAX_RECORDS(len)   (((len) - BLE_PKT_HEADER_BYTES) / 2)
+
+typedef struct {
+    uint8_t  version;
+    uint8_t  type;
+    uint16_t seq;
+    uint32_t base_us;
+} ble_pkt_header_t;
+
+typedef struct {
+    uint32_t stamp_us;                  // base_us + the deltas so far
+    uint32_t value;                     // Blink count or attention level
+} ble_pkt_record_t;
+
+
+// =============================
+// Writer State (on the caller's stack; the bytes live in `buf`)
+// =============================
+typedef struct {
+    uint8_t *buf;
+    size_t   cap;
+    size_t   len;                       // Bytes written: the notification length
+    uint8_t  type;
+    uint8_t  count;                     // Records written
+    uint32_t last_us;                   // Stamp of the last record (base_us before the first)
+} ble_pkt_writer_t;
+
+
+// =============================
+// Writer API
+// =============================
+// Writes the header into `buf`. False if `cap` cannot hold the header and one record, or the
+// type is unknown.
+bool ble_pkt_begin(ble_pkt_writer_t *w, uint8_t *buf, size_t cap, ble_pkt_type_t type, uint16_t seq,
+                   uint32_t base_us);
+
+// Reopens a packet already written (`len` bytes in `buf`) to append more records. False if
+// it does not decode as a version-1 packet.
+bool ble_pkt_resume(ble_pkt_writer_t *w, uint8_t *buf, size_t len, size_t cap);
+
+// Appends one record. False (nothing written) if it does not fit or the type does not match.
+bool ble_pkt_add_blink(ble_pkt_writer_t *w, uint32_t stamp_us, uint32_t count);
+bool ble_pkt_add_attention(ble_pkt_writer_t *w, uint32_t stamp_us, uint8_t level);
+
+
+// =============================
+// Reference Decoder
+// =============================
+// Decodes the header into `hdr` and up to `max` records into `records` (NULL: only count and
+// validate). Returns the record count, or -1 if the packet is truncated, has a version / type
+// this decoder does not know, an overlong varint, no records, or more than `max` records.
+int ble_pkt_decode(const uint8_t *buf, size_t len, ble_pkt_header_t *hdr, ble_pkt_record_t *records,
+                   size_t max);
+
+
+#endif // BLE_PKT_H
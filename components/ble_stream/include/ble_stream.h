@@ -0,0 +1,111 @@
+#ifndef BLE_STREAM_H
+#define BLE_STREAM_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+
+
+// =============================
+// Raw Waveform Stream: Packet Layout
+// =============================
+//
+// Filtered samples go to the phone as notifications on the raw stream characteristic.
+// No Bluetooth headers here: packing and framing are plain C so they run on a Linux host,
+// with the radio replaced by a send callback (ble.c wires it to esp_ble_gatts_send_indicate).
+//
+// Every notification is a 4-byte header followed by 12-bit samples packed two per three bytes:
+//
+//      byte 0..1 : sequence number of the first frame (low 16 bits, little-endian)
+//      byte 2    : channels per frame (samples are interleaved ch0, ch1, ...)
+//      byte 3    : flags (BLE_STREAM_FLAG_*)
+//      byte 4..  : a0[7:0] | a0[11:8] b0[3:0] << 4 | b0[11:4] | a1[7:0] | ...
+//
+// Samples are signed 12-bit (two's complement), saturated from int16_t. An odd sample count
+// ends with a 2-byte group, so the sample count follows from the length: (len - 4) * 2 / 3.
+#define BLE_STREAM_HEADER_BYTES   4
+#define BLE_STREAM_SAMPLE_MIN     (-2048)
+#define BLE_STREAM_SAMPLE_MAX     2047
+
+#define BLE_STREAM_FLAG_GAP       0x01      // Frames were lost before this packet
+
+// ATT: notification payload = MTU - 3 (opcode + handle)
+#define BLE_STREAM_MTU_DEFAULT    23        // Before the MTU exchange
+#define BLE_STREAM_MTU_MAX        517       // Largest ATT MTU we advertise (BLE 4.2+)
+#define BLE_STREAM_ATT_OVERHEAD   3
+#define BLE_STREAM_MAX_PAYLOAD    (BLE_STREAM_MTU_MAX - BLE_STREAM_ATT_OVERHEAD)
+#define BLE_STREAM_MAX_SAMPLES    (((BLE_STREAM_MAX_PAYLOAD - BLE_STREAM_HEADER_BYTES) * 2) / 3)
+
+
+// =============================
+// Transport Hook
+// =============================
+// Sends one notification. Returns 0 on success; non-zero drops the packet (counted).
+typedef int (*ble_stream_send_fn)(void *ctx, const uint8_t *data, uint16_t len);
+
+
+// =============================
+// Stream State (statically allocated by the caller, no heap)
+// =============================
+typedef struct {
+    ble_stream_send_fn send;
+    void    *send_ctx;
+
+    uint8_t  channels;                           // Values per frame
+    uint16_t payload_max;                        // Bytes per notification (MTU - 3)
+    uint16_t frames_per_packet;                  // Whole frames that fit in payload_max
+
+    int16_t  staged[BLE_STREAM_MAX_SAMPLES];     // Frames waiting for the next packet
+    uint16_t staged_frames;
+    uint32_t staged_seq;                         // Sequence of staged frame 0
+    uint32_t next_seq;                           // Sequence expected after the last staged frame
+    uint8_t  pending_flags;                      // Flags for the next packet
+    bool     seq_valid;                          // next_seq holds a real value
+
+    uint8_t  packet[BLE_STREAM_MAX_PAYLOAD];     // Packing scratch
+
+    uint32_t packets_sent;
+    uint32_t samples_sent;
+    uint32_t send_errors;                        // Packets the transport refused (dropped)
+} ble_stream_t;
+
+
+// =============================
+// Packing API (Stateless)
+// =============================
+// Bytes needed for `count` packed samples: ceil(count * 3 / 2)
+size_t ble_stream_packed_size(size_t count);
+
+// Packs `count` samples (saturated to 12 bits) into `out`; returns bytes written.
+size_t ble_stream_pack12(const int16_t *samples, size_t count, uint8_t *out);
+
+// Unpacks `len` bytes (as produced by ble_stream_pack12) into `out`; returns samples written.
+size_t ble_stream_unpack12(const uint8_t *in, size_t len, int16_t *out, size_t max);
+
+
+// =============================
+// Stream API
+// =============================
+void ble_stream_init(ble_stream_t *stream, uint8_t channels, ble_stream_send_fn send, void *ctx);
+
+// Drops staged frames and restarts sequencing (e.g., on connect / disconnect)
+void ble_stream_reset(ble_stream_t *stream);
+
+// Applies a negotiated ATT MTU (clamped to 23 .. 517). Staged frames that no longer fit
+// are sent first.
+void ble_stream_set_mtu(ble_stream_t *stream, uint16_t mtu);
+
+// Appends `count` interleaved frames whose first frame has sequence `first_seq`. Every time a
+// packet fills up it is sent. A sequence jump flushes what is staged and flags the next packet.
+void ble_stream_push(ble_stream_t *stream, const int16_t *frames, size_t count, uint32_t first_seq);
+
+// Sends whatever is staged as a short packet (no-op when empty)
+void ble_stream_flush(ble_stream_t *stream);
+
+
+#endif // BLE_STREAM_H
@@ -0,0 +1,129 @@
+#ifndef BLE_TXQ_H
+#define BLE_TXQ_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+
+
+// =============================
+// Notification Queue (Backpressure + Coalescing)
+// =============================
+//
+// Event notifications (blink, attention) go through a small bounded queue instead of straight
+// to esp_ble_gatts_send_indicate(). When Bluedroid reports ESP_GATTS_CONGEST_EVT the queue
+// stops sending and holds its packets; when the congestion clears they go out in order. A
+// packet the stack refuses stays at the head and is retried, it is never silently lost.
+//
+// Two kinds of packet:
+//      push        : one notification per event, kept in order (blinks). When the FIFO is full
+//                    the oldest is dropped: a blink notification carries the running count, so
+//                    the newer one supersedes it.
+//      put_latest  : one slot per handle holding only the newest value (attention). A value
+//                    that is replaced before it goes out is counted as coalesced, not dropped.
+//
+// Like ble_stream, no Bluetooth headers: the radio is a send callback (ble.c wires it to
+// esp_ble_gatts_send_indicate), so the queue runs and is tested on a Linux host.
+//
+// Threading: push / put_latest / pump / reset belong to one task (ble_notifications).
+// ble_txq_set_congested() is called from the GATT callback (BTC task) and only writes a flag.
+#define BLE_TXQ_DEPTH         8       // Ordered packets (power of two)
+#define BLE_TXQ_LATEST_SLOTS  2       // Handles with a latest-value slot
+#define BLE_TXQ_MAX_DATA      20      // Notification payload at the default MTU (23 - 3)
+
+typedef struct {
+    uint16_t handle;
+    uint8_t  len;
+    uint8_t  tag;                   // Caller's label, handed back to the send hook (ble.c: latency stage)
+    uint32_t value;                 // Caller's summary of the payload, so the hook need not decode it
+                                    // (ble.c: newest blink count / attention level); 0 at reserve
+    int64_t  event_us;              // Caller's timestamp, handed back too
+    uint8_t  data[BLE_TXQ_MAX_DATA];
+} ble_txq_packet_t;
+
+// Sends one notification. Returns 0 on success; non-zero = the link refused it (kept, retried).
+typedef int (*ble_txq_send_fn)(void *ctx, const ble_txq_packet_t *packet);
+
+typedef struct {
+    ble_txq_packet_t packet;
+    bool             pending;
+} ble_txq_slot_t;
+
+typedef struct {
+    uint32_t enqueued;              // Packets accepted (push + put_latest)
+    uint32_t sent;
+    uint32_t coalesced;             // Latest-value packets replaced before they went out
+    uint32_t dropped;               // FIFO overflow + packets discarded by ble_txq_reset()
+    uint32_t refused;               // Sends the link refused (each retried later)
+    uint32_t stalls;                // Times sending stopped with packets pending
+    uint32_t congest_events;        // Congestion reports from the stack
+    uint64_t stalled_us;            // Total time spent stalled with packets pending
+    uint8_t  max_depth;             // Most packets pending at once
+} ble_txq_stats_t;
+
+
+// =============================
+// Queue State (statically allocated by the caller, no heap)
+// =============================
+typedef struct {
+    ble_txq_send_fn  send;
+    void            *send_ctx;
+
+    ble_txq_packet_t fifo[BLE_TXQ_DEPTH];
+    uint8_t          head;          // Oldest packet
+    uint8_t          count;
+    ble_txq_slot_t   latest[BLE_TXQ_LATEST_SLOTS];
+
+    volatile bool    congested;     // Set / cleared by the GATT callback
+    bool             stalled;
+    uint32_t         stall_start_us;
+
+    ble_txq_stats_t  stats;
+} ble_txq_t;
+
+
+// =============================
+// Queue API
+// =============================
+void ble_txq_init(ble_txq_t *q, ble_txq_send_fn send, void *ctx);
+
+// Drops everything pending (disconnect); counted as dropped. Counters are kept.
+void ble_txq_reset(ble_txq_t *q);
+
+// Zero-copy enqueue: reserve a packet, write up to BLE_TXQ_MAX_DATA bytes into its `data`
+// and set `len`, then commit it (same task, nothing in between). reserve takes the FIFO tail,
+// dropping the oldest packet if the FIFO is full; reserve_latest takes the slot of `handle`
+// (a pending packet there is overwritten, counted as coalesced) or a free one, NULL if none.
+ble_txq_packet_t *ble_txq_reserve(ble_txq_t *q, uint16_t handle, uint8_t tag, int64_t event_us);
+ble_txq_packet_t *ble_txq_reserve_latest(ble_txq_t *q, uint16_t handle, uint8_t tag, int64_t event_us);
+void ble_txq_commit(ble_txq_t *q, ble_txq_packet_t *packet);
+
+// Newest ordered packet if it is for `handle` and still waiting, else NULL. The caller may
+// append to it in place (and grow `len`) until the next pump.
+ble_txq_packet_t *ble_txq_tail(ble_txq_t *q, uint16_t handle);
+
+// Copying forms of the above. Ordered packet: false if `len` exceeds BLE_TXQ_MAX_DATA.
+bool ble_txq_push(ble_txq_t *q, uint16_t handle, const uint8_t *data, uint8_t len, uint8_t tag, int64_t event_us);
+
+// Latest value for `handle`, replacing a pending one. False if `len` is too large or every
+// slot already belongs to another handle.
+bool ble_txq_put_latest(ble_txq_t *q, uint16_t handle, const uint8_t *data, uint8_t len, uint8_t tag,
+                        int64_t event_us);
+
+// ESP_GATTS_CONGEST_EVT: true pauses the queue, false lets the next pump resume it
+void ble_txq_set_congested(ble_txq_t *q, bool congested);
+
+// Sends pending packets (ordered ones first, then the latest-value slots) until the queue is
+// empty, the link is congested or a send is refused. `now_us` feeds the stall time. Returns
+// the packets sent.
+size_t ble_txq_pump(ble_txq_t *q, uint32_t now_us);
+
+size_t ble_txq_depth(const ble_txq_t *q);   // Packets pending (ordered + latest)
+
+
+#endif // BLE_TXQ_H
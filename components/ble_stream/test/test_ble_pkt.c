@@ -0,0 +1,280 @@
+// test_ble_pkt.c - Unit tests for the event packet format (writer, reference decoder, in-place queueing)
+
+#include "unity.h"
+#include "ble_pkt.h"     // Under test
+#include "ble_txq.h"     // Packets written straight into the queue
+#include "esp_timer.h"   // Benchmark timing
+#include <stdio.h>       // For benchmark output
+#include <string.h>      // For memset
+
+
+// =============================
+// Test: Round Trip + Byte Layout
+// =============================
+void test_ble_pkt_round_trip(void) {
+
+    uint8_t buf[BLE_TXQ_MAX_DATA];
+    ble_pkt_writer_t w;
+    ble_pkt_header_t hdr;
+    ble_pkt_record_t rec[BLE_PKT_MAX_RECORDS(sizeof(buf))];
+
+    // --- Case 1: One blink, the layout byte by byte ---
+    TEST_ASSERT_TRUE(ble_pkt_begin(&w, buf, sizeof(buf), BLE_PKT_TYPE_BLINK, 0x1234, 0xA0B0C0D0u));
+    TEST_ASSERT_TRUE(ble_pkt_add_blink(&w, 0xA0B0C0D0u, 0x01020304u));
+    TEST_ASSERT_EQUAL(BLE_PKT_HEADER_BYTES + 1 + 4, w.len);
+
+    static const uint8_t expect[] = { 0x11, 0x34, 0x12, 0xD0, 0xC0, 0xB0, 0xA0,    // Header
+                                      0x00, 0x04, 0x03, 0x02, 0x01 };               // Delta 0, count
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expect, buf, sizeof(expect));
+
+    TEST_ASSERT_EQUAL(1, ble_pkt_decode(buf, w.len, &hdr, rec, 1));
+    TEST_ASSERT_EQUAL_UINT8(BLE_PKT_VERSION, hdr.version);
+    TEST_ASSERT_EQUAL_UINT8(BLE_PKT_TYPE_BLINK, hdr.type);
+    TEST_ASSERT_EQUAL_UINT16(0x1234, hdr.seq);
+    TEST_ASSERT_EQUAL_UINT32(0xA0B0C0D0u, rec[0].stamp_us);
+    TEST_ASSERT_EQUAL_UINT32(0x01020304u, rec[0].value);
+
+    // --- Case 2: Attention records with deltas of 1, 2 and 3 varint bytes, across the 32-bit wrap ---
+    static const uint32_t stamps[] = { 0xFFFFFF00u, 0xFFFFFF10u, 0x00001000u, 0x00101000u };
+    TEST_ASSERT_TRUE(ble_pkt_begin(&w, buf, sizeof(buf), BLE_PKT_TYPE_ATTENTION, 7, stamps[0]));
+    for (int i = 0; i < 4; i++) TEST_ASSERT_TRUE(ble_pkt_add_attention(&w, stamps[i], (uint8_t)(10 * i)));
+    TEST_ASSERT_EQUAL(BLE_PKT_HEADER_BYTES + (1 + 1) + (1 + 1) + (2 + 1) + (3 + 1), w.len);
+
+    TEST_ASSERT_EQUAL(4, ble_pkt_decode(buf, w.len, &hdr, rec, 4));
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_UINT32(stamps[i], rec[i].stamp_us);
+        TEST_ASSERT_EQUAL_UINT32(10 * i, rec[i].value);
+    }
+
+    // --- Case 3: Reopen a finished packet and append (what ble.c does under congestion) ---
+    TEST_ASSERT_TRUE(ble_pkt_begin(&w, buf, sizeof(buf), BLE_PKT_TYPE_BLINK, 3, 5000));
+    TEST_ASSERT_TRUE(ble_pkt_add_blink(&w, 5000, 41));
+    size_t len = w.len;
+
+    TEST_ASSERT_TRUE(ble_pkt_resume(&w, buf, len, sizeof(buf)));
+    TEST_ASSERT_EQUAL_UINT8(1, w.count);
+    TEST_ASSERT_EQUAL_UINT32(5000, w.last_us);
+    TEST_ASSERT_TRUE(ble_pkt_add_blink(&w, 5000 + 350000, 42));                  // 3-byte delta: 19 bytes
+    TEST_ASSERT_FALSE(ble_pkt_add_blink(&w, 5000 + 700000, 43));                 // No room for a third
+    TEST_ASSERT_EQUAL(19, w.len);
+
+    TEST_ASSERT_EQUAL(2, ble_pkt_decode(buf, w.len, &hdr, rec, 2));
+    TEST_ASSERT_EQUAL_UINT16(3, hdr.seq);
+    TEST_ASSERT_EQUAL_UINT32(355000, rec[1].stamp_us);
+    TEST_ASSERT_EQUAL_UINT32(42, rec[1].value);
+}
+
+
+// =============================
+// Test: Malformed Packets + Writer Limits
+// =============================
+void test_ble_pkt_rejects_malformed(void) {
+
+    uint8_t buf[BLE_TXQ_MAX_DATA];
+    ble_pkt_writer_t w;
+    ble_pkt_record_t rec[4];
+
+    TEST_ASSERT_TRUE(ble_pkt_begin(&w, buf, sizeof(buf), BLE_PKT_TYPE_BLINK, 1, 100));
+    TEST_ASSERT_TRUE(ble_pkt_add_blink(&w, 200, 9));
+    size_t len = w.len;
+    TEST_ASSERT_EQUAL(1, ble_pkt_decode(buf, len, NULL, NULL, 0));               // Count only
+
+    // --- Decoder ---
+    TEST_ASSERT_EQUAL(-1, ble_pkt_decode(buf, BLE_PKT_HEADER_BYTES - 1, NULL, NULL, 0));   // Short header
+    TEST_ASSERT_EQUAL(-1, ble_pkt_decode(buf, BLE_PKT_HEADER_BYTES, NULL, NULL, 0));       // No records
+    TEST_ASSERT_EQUAL(-1, ble_pkt_decode(buf, len - 1, NULL, NULL, 0));                    // Truncated record
+    TEST_ASSERT_EQUAL(-1, ble_pkt_decode(buf, len, NULL, rec, 0));                         // More than max
+
+    buf[0] = (uint8_t)(((BLE_PKT_VERSION + 1) << 4) | BLE_PKT_TYPE_BLINK);
+    TEST_ASSERT_EQUAL(-1, ble_pkt_decode(buf, len, NULL, NULL, 0));                        // Newer version
+    buf[0] = (uint8_t)((BLE_PKT_VERSION << 4) | 0x0F);
+    TEST_ASSERT_EQUAL(-1, ble_pkt_decode(buf, len, NULL, NULL, 0));                        // Unknown type
+    buf[0] = (uint8_t)((BLE_PKT_VERSION << 4) | BLE_PKT_TYPE_ATTENTION);
+
+    // Varint delta: 5 bytes is the most a 32-bit value takes, and its last byte holds 4 bits
+    static const uint8_t max_delta[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x07 };
+    static const uint8_t overlong[]  = { 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x07 };
+    memcpy(&buf[BLE_PKT_HEADER_BYTES], max_delta, sizeof(max_delta));
+    TEST_ASSERT_EQUAL(1, ble_pkt_decode(buf, BLE_PKT_HEADER_BYTES + sizeof(max_delta), NULL, rec, 4));
+    TEST_ASSERT_EQUAL_UINT32(100 + 0xFFFFFFFFu, rec[0].stamp_us);
+    memcpy(&buf[BLE_PKT_HEADER_BYTES], overlong, sizeof(overlong));
+    TEST_ASSERT_EQUAL(-1, ble_pkt_decode(buf, BLE_PKT_HEADER_BYTES + sizeof(overlong), NULL, NULL, 0));
+    TEST_ASSERT_FALSE(ble_pkt_resume(&w, buf, BLE_PKT_HEADER_BYTES + sizeof(overlong), sizeof(buf)));
+
+    // --- Writer ---
+    TEST_ASSERT_FALSE(ble_pkt_begin(&w, buf, BLE_PKT_HEADER_BYTES + 4, BLE_PKT_TYPE_BLINK, 0, 0));   // No room for a record
+    TEST_ASSERT_FALSE(ble_pkt_begin(&w, buf, sizeof(buf), (ble_pkt_type_t)0, 0, 0));
+    TEST_ASSERT_TRUE(ble_pkt_begin(&w, buf, BLE_PKT_HEADER_BYTES + 5, BLE_PKT_TYPE_BLINK, 0, 0));
+    TEST_ASSERT_FALSE(ble_pkt_add_attention(&w, 0, 1));                           // Wrong type
+    TEST_ASSERT_FALSE(ble_pkt_add_blink(&w, 200, 1));                             // 2-byte delta: 1 byte short
+    TEST_ASSERT_EQUAL(BLE_PKT_HEADER_BYTES, w.len);                               // Nothing written
+    TEST_ASSERT_TRUE(ble_pkt_add_blink(&w, 100, 1));
+}
+
+
+// =============================
+// Test: Written in Place Through the Queue, Decoded on the Far Side
+// =============================
+// Mirrors ble_notifications(): each blink goes into a reserved FIFO packet, or is appended to
+// the newest one while the link holds it back; attention overwrites its slot. The "phone"
+// decodes everything and checks the sequence numbers account for what went missing.
+#define PHONE_MAX  64
+
+typedef struct {
+    uint32_t blink[PHONE_MAX];          // Blink counts, in arrival order
+    uint32_t blink_us[PHONE_MAX];
+    size_t   blinks;
+    uint16_t blink_seq_gaps;            // Packets missing by sequence number
+    int      last_blink_seq;
+    uint8_t  level;
+    uint16_t attn_seq_gaps;
+    int      last_attn_seq;
+    uint32_t bad;                       // Packets the decoder rejected
+    uint32_t value_mismatch;            // packet->value (set at queue time) != newest record
+} phone_t;
+
+static int phone_receive(void *ctx, const ble_txq_packet_t *packet) {
+
+    phone_t *ph = (phone_t *)ctx;
+    ble_pkt_header_t hdr;
+    ble_pkt_record_t rec[BLE_PKT_MAX_RECORDS(BLE_TXQ_MAX_DATA)];
+
+    int n = ble_pkt_decode(packet->data, packet->len, &hdr, rec, sizeof(rec) / sizeof(rec[0]));
+    if (n < 0) {
+        ph->bad++;
+        return 0;
+    }
+    if (n > 0 && packet->value != rec[n - 1].value) ph->value_mismatch++;
+
+    int *last_seq = hdr.type == BLE_PKT_TYPE_BLINK ? &ph->last_blink_seq : &ph->last_attn_seq;
+    uint16_t *gaps = hdr.type == BLE_PKT_TYPE_BLINK ? &ph->blink_seq_gaps : &ph->attn_seq_gaps;
+    if (*last_seq >= 0) *gaps += (uint16_t)(hdr.seq - *last_seq - 1);
+    *last_seq = hdr.seq;
+
+    for (int i = 0; i < n; i++) {
+        if (hdr.type == BLE_PKT_TYPE_BLINK && ph->blinks < PHONE_MAX) {
+            ph->blink[ph->blinks] = rec[i].value;
+            ph->blink_us[ph->blinks++] = rec[i].stamp_us;
+        } else if (hdr.type == BLE_PKT_TYPE_ATTENTION) {
+            ph->level = (uint8_t)rec[i].value;
+        }
+    }
+    return 0;
+}
+
+static void queue_blink(ble_txq_t *q, uint16_t *seq, uint32_t stamp_us, uint32_t count) {
+
+    ble_pkt_writer_t w;
+    ble_txq_packet_t *tail = ble_txq_tail(q, 0x10);
+    if (tail && ble_pkt_resume(&w, tail->data, tail->len, BLE_TXQ_MAX_DATA) &&
+        ble_pkt_add_blink(&w, stamp_us, count)) {
+        tail->len = (uint8_t)w.len;
+        tail->value = count;
+        return;
+    }
+
+    ble_txq_packet_t *p = ble_txq_reserve(q, 0x10, 0, stamp_us);
+    TEST_ASSERT_TRUE(ble_pkt_begin(&w, p->data, BLE_TXQ_MAX_DATA, BLE_PKT_TYPE_BLINK, (*seq)++, stamp_us));
+    TEST_ASSERT_TRUE(ble_pkt_add_blink(&w, stamp_us, count));
+    p->len = (uint8_t)w.len;
+    p->value = count;
+    ble_txq_commit(q, p);
+}
+
+static void queue_attention(ble_txq_t *q, uint16_t *seq, uint32_t stamp_us, uint8_t level) {
+
+    ble_pkt_writer_t w;
+    ble_txq_packet_t *p = ble_txq_reserve_latest(q, 0x20, 0, stamp_us);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_TRUE(ble_pkt_begin(&w, p->data, BLE_TXQ_MAX_DATA, BLE_PKT_TYPE_ATTENTION, (*seq)++, stamp_us));
+    TEST_ASSERT_TRUE(ble_pkt_add_attention(&w, stamp_us, level));
+    p->len = (uint8_t)w.len;
+    p->value = level;
+    ble_txq_commit(q, p);
+}
+
+void test_ble_pkt_through_queue(void) {
+
+    static ble_txq_t q;
+    static phone_t ph;
+    uint16_t blink_seq = 0, attn_seq = 0;
+
+    memset(&ph, 0, sizeof(ph));
+    ph.last_blink_seq = ph.last_attn_seq = -1;
+    ble_txq_init(&q, phone_receive, &ph);
+
+    // --- 1. Open link: one packet per event ---
+    queue_blink(&q, &blink_seq, 1000, 1);
+    queue_attention(&q, &attn_seq, 1500, 40);
+    ble_txq_pump(&q, 0);
+    TEST_ASSERT_EQUAL_UINT32(2, q.stats.sent);
+
+    // --- 2. Congested: blinks pair up in the FIFO packets (2 per 20 bytes), the FIFO overflows,
+    //        attention levels replace each other ---
+    ble_txq_set_congested(&q, true);
+    uint32_t count = 1;
+    for (int i = 0; i < 2 * BLE_TXQ_DEPTH + 6; i++) {
+        count++;
+        queue_blink(&q, &blink_seq, 1000 + 300000u * count, count);
+        queue_attention(&q, &attn_seq, 1500 + 300000u * count, (uint8_t)(40 + i));
+    }
+    TEST_ASSERT_EQUAL(BLE_TXQ_DEPTH + 1, ble_txq_depth(&q));
+    TEST_ASSERT_EQUAL_UINT32(3, q.stats.dropped);                                 // 3 packets of 2 blinks
+
+    ble_txq_set_congested(&q, false);
+    ble_txq_pump(&q, 0);
+    TEST_ASSERT_EQUAL(0, ble_txq_depth(&q));
+
+    // --- 3. What the phone decoded ---
+    TEST_ASSERT_EQUAL_UINT32(0, ph.bad);
+    TEST_ASSERT_EQUAL_UINT32(0, ph.value_mismatch);                               // The send hook can trust packet->value
+    TEST_ASSERT_EQUAL_UINT16(3, ph.blink_seq_gaps);                               // Exactly the dropped packets
+    TEST_ASSERT_EQUAL_UINT16(2 * BLE_TXQ_DEPTH + 5, ph.attn_seq_gaps);            // Every coalesced level
+    TEST_ASSERT_EQUAL_UINT8(40 + 2 * BLE_TXQ_DEPTH + 5, ph.level);
+
+    TEST_ASSERT_EQUAL(1 + 2 * BLE_TXQ_DEPTH, ph.blinks);
+    TEST_ASSERT_EQUAL_UINT32(count, ph.blink[ph.blinks - 1]);
+    for (size_t i = 1; i < ph.blinks; i++) {
+        TEST_ASSERT_TRUE(ph.blink[i] > ph.blink[i - 1]);
+        TEST_ASSERT_EQUAL_UINT32(1000 + 300000u * ph.blink[i], ph.blink_us[i]);   // Every stamp exact
+    }
+}
+
+
+// =============================
+// Benchmark: Encode + Decode Throughput
+// =============================
+void test_bench_ble_pkt_throughput(void) {
+
+    enum { BENCH_PACKETS = 20000 };
+    static uint8_t buf[BLE_TXQ_MAX_DATA];
+    ble_pkt_writer_t w;
+    ble_pkt_header_t hdr;
+    ble_pkt_record_t rec[BLE_PKT_MAX_RECORDS(BLE_TXQ_MAX_DATA)];
+    uint32_t sink = 0;
+
+    // --- 1. Encode: header + two blink records (a batched packet, 3-byte second delta) ---
+    int64_t t0 = esp_timer_get_time();
+    for (uint32_t i = 0; i < BENCH_PACKETS; i++) {
+        ble_pkt_begin(&w, buf, sizeof(buf), BLE_PKT_TYPE_BLINK, (uint16_t)i, i * 1000u);
+        ble_pkt_add_blink(&w, i * 1000u, 2 * i);
+        ble_pkt_add_blink(&w, i * 1000u + 250000u, 2 * i + 1);
+        sink += (uint32_t)w.len;
+    }
+    int64_t encode_us = esp_timer_get_time() - t0;
+    size_t len = w.len;
+
+    // --- 2. Decode the same packet ---
+    t0 = esp_timer_get_time();
+    for (uint32_t i = 0; i < BENCH_PACKETS; i++) {
+        sink += (uint32_t)ble_pkt_decode(buf, len, &hdr, rec, sizeof(rec) / sizeof(rec[0]));
+    }
+    int64_t decode_us = esp_timer_get_time() - t0;
+
+    TEST_ASSERT_EQUAL(2, ble_pkt_decode(buf, len, &hdr, rec, 2));
+    TEST_ASSERT_TRUE(sink > 0);
+
+    printf("ble pkt (%u bytes, 2 records): encode %.1f ns/packet, decode %.1f ns/packet\n", (unsigned)len,
+           encode_us * 1000.0f / BENCH_PACKETS, decode_us * 1000.0f / BENCH_PACKETS);
+    // Timing is reported, not asserted (it depends on target, clock and cache state)
+}
@@ -0,0 +1,217 @@
+#include "unity.h"
+#include "ble_stream.h"  // Under test
+#include "esp_timer.h"   // Benchmark timing
+#include <stdio.h>       // For benchmark output
+#include <string.h>      // For memcpy / memset
+
+
+// =============================
+// Loopback Transport (stands in for esp_ble_gatts_send_indicate)
+// =============================
+#define LOOPBACK_MAX_PACKETS  64
+
+typedef struct {
+    uint8_t  data[LOOPBACK_MAX_PACKETS][BLE_STREAM_MAX_PAYLOAD];
+    uint16_t len[LOOPBACK_MAX_PACKETS];
+    size_t   count;
+    int      fail;          // Non-zero: refuse every packet (simulated link error)
+} loopback_t;
+
+static int loopback_send(void *ctx, const uint8_t *data, uint16_t len) {
+    loopback_t *lb = (loopback_t *)ctx;
+    if (lb->fail || lb->count >= LOOPBACK_MAX_PACKETS) return -1;
+    memcpy(lb->data[lb->count], data, len);
+    lb->len[lb->count] = len;
+    lb->count++;
+    return 0;
+}
+
+// Phone side: header fields + samples of one captured packet
+static size_t loopback_decode(const loopback_t *lb, size_t idx, uint16_t *seq, uint8_t *channels,
+                              uint8_t *flags, int16_t *out, size_t max) {
+    const uint8_t *p = lb->data[idx];
+    *seq = (uint16_t)(p[0] | (p[1] << 8));
+    *channels = p[2];
+    *flags = p[3];
+    return ble_stream_unpack12(p + BLE_STREAM_HEADER_BYTES, lb->len[idx] - BLE_STREAM_HEADER_BYTES, out, max);
+}
+
+
+// =============================
+// Test: 12-bit Packing Round Trip
+// =============================
+void test_ble_stream_pack12_roundtrip(void) {
+
+    const int16_t in[7] = {0, 1, -1, 2047, -2048, 5000, -5000};   // Last two saturate
+    const int16_t expect[7] = {0, 1, -1, 2047, -2048, 2047, -2048};
+    uint8_t packed[16];
+    int16_t out[8];
+
+    // --- Case 1: Sizes (2 samples -> 3 bytes, odd tail -> 2 bytes) ---
+    TEST_ASSERT_EQUAL_UINT32(0, ble_stream_packed_size(0));
+    TEST_ASSERT_EQUAL_UINT32(2, ble_stream_packed_size(1));
+    TEST_ASSERT_EQUAL_UINT32(3, ble_stream_packed_size(2));
+    TEST_ASSERT_EQUAL_UINT32(11, ble_stream_packed_size(7));
+
+    // --- Case 2: Round trip with saturation ---
+    size_t len = ble_stream_pack12(in, 7, packed);
+    TEST_ASSERT_EQUAL_UINT32(11, len);
+    size_t n = ble_stream_unpack12(packed, len, out, 8);
+    TEST_ASSERT_EQUAL_UINT32(7, n);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(expect, out, 7);
+
+    // --- Case 3: Bit layout of one pair (0xABC, 0x123) ---
+    const int16_t pair[2] = {(int16_t)(0xABC - 0x1000), 0x123};
+    ble_stream_pack12(pair, 2, packed);
+    TEST_ASSERT_EQUAL_HEX8(0xBC, packed[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x3A, packed[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x12, packed[2]);
+}
+
+
+// =============================
+// Test: Packets Fill the Negotiated MTU
+// =============================
+void test_ble_stream_fills_mtu(void) {
+
+    static loopback_t lb;
+    static ble_stream_t stream;
+    static int16_t frames[4 * 1000];
+    static int16_t decoded[BLE_STREAM_MAX_SAMPLES];
+    uint16_t seq;
+    uint8_t channels, flags;
+
+    for (int i = 0; i < 4 * 1000; i++) frames[i] = (int16_t)((i * 37) % 4000 - 2000);
+
+    // --- Case 1: Default MTU (23): 20-byte payload -> 10 samples per notification ---
+    memset(&lb, 0, sizeof(lb));
+    ble_stream_init(&stream, 1, loopback_send, &lb);
+    ble_stream_push(&stream, frames, 25, 100);
+    TEST_ASSERT_EQUAL_UINT32(2, lb.count);
+    TEST_ASSERT_EQUAL_UINT16(BLE_STREAM_HEADER_BYTES + 15, lb.len[0]);   // 16 bytes hold 10 samples, not 11
+    TEST_ASSERT_EQUAL_UINT16(5, stream.staged_frames);
+
+    // --- Case 2: MTU 517: 514-byte payload -> 340 samples, packets exactly full ---
+    memset(&lb, 0, sizeof(lb));
+    ble_stream_init(&stream, 1, loopback_send, &lb);
+    ble_stream_set_mtu(&stream, 517);
+    ble_stream_push(&stream, frames, 1000, 0);
+    TEST_ASSERT_EQUAL_UINT32(2, lb.count);
+    TEST_ASSERT_EQUAL_UINT16(BLE_STREAM_MAX_PAYLOAD, lb.len[0]);
+    TEST_ASSERT_EQUAL_UINT16(BLE_STREAM_MAX_PAYLOAD, lb.len[1]);
+
+    ble_stream_flush(&stream);
+    TEST_ASSERT_EQUAL_UINT32(3, lb.count);
+    TEST_ASSERT_EQUAL_UINT32(1000, stream.samples_sent);
+
+    // Phone side: sequence numbers line up and every sample survives
+    size_t total = 0;
+    for (size_t p = 0; p < lb.count; p++) {
+        size_t n = loopback_decode(&lb, p, &seq, &channels, &flags, decoded, BLE_STREAM_MAX_SAMPLES);
+        TEST_ASSERT_EQUAL_UINT16(total, seq);
+        TEST_ASSERT_EQUAL_UINT8(1, channels);
+        TEST_ASSERT_EQUAL_UINT8(0, flags);
+        TEST_ASSERT_EQUAL_INT16_ARRAY(&frames[total], decoded, n);
+        total += n;
+    }
+    TEST_ASSERT_EQUAL_UINT32(1000, total);
+
+    // --- Case 3: 4 channels @ MTU 185: whole frames only (118 samples -> 29 frames) ---
+    memset(&lb, 0, sizeof(lb));
+    ble_stream_init(&stream, 4, loopback_send, &lb);
+    ble_stream_set_mtu(&stream, 185);
+    TEST_ASSERT_EQUAL_UINT16(29, stream.frames_per_packet);
+    ble_stream_push(&stream, frames, 100, 7);
+    TEST_ASSERT_EQUAL_UINT32(3, lb.count);
+    size_t n = loopback_decode(&lb, 1, &seq, &channels, &flags, decoded, BLE_STREAM_MAX_SAMPLES);
+    TEST_ASSERT_EQUAL_UINT32(29 * 4, n);
+    TEST_ASSERT_EQUAL_UINT16(7 + 29, seq);
+    TEST_ASSERT_EQUAL_UINT8(4, channels);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(&frames[29 * 4], decoded, n);
+
+    // --- Case 4: MTU shrink sends what no longer fits ---
+    memset(&lb, 0, sizeof(lb));
+    ble_stream_init(&stream, 1, loopback_send, &lb);
+    ble_stream_set_mtu(&stream, 517);
+    ble_stream_push(&stream, frames, 25, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, lb.count);
+    ble_stream_set_mtu(&stream, 23);
+    TEST_ASSERT_EQUAL_UINT32(2, lb.count);
+    TEST_ASSERT_EQUAL_UINT16(5, stream.staged_frames);
+}
+
+
+// =============================
+// Test: Sequence Gaps + Transport Errors
+// =============================
+void test_ble_stream_gaps_and_errors(void) {
+
+    static loopback_t lb;
+    static ble_stream_t stream;
+    int16_t frames[32] = {0};
+    int16_t decoded[32];
+    uint16_t seq;
+    uint8_t channels, flags;
+
+    // --- Case 1: A jump in sequence flushes and flags the next packet ---
+    memset(&lb, 0, sizeof(lb));
+    ble_stream_init(&stream, 1, loopback_send, &lb);
+    ble_stream_push(&stream, frames, 4, 0);
+    ble_stream_push(&stream, frames, 4, 4);      // Contiguous: stays staged
+    TEST_ASSERT_EQUAL_UINT32(0, lb.count);
+    ble_stream_push(&stream, frames, 4, 50);     // Frames 8..49 lost upstream
+    TEST_ASSERT_EQUAL_UINT32(1, lb.count);
+    ble_stream_flush(&stream);
+    TEST_ASSERT_EQUAL_UINT32(2, lb.count);
+
+    size_t n = loopback_decode(&lb, 0, &seq, &channels, &flags, decoded, 32);
+    TEST_ASSERT_EQUAL_UINT32(8, n);
+    TEST_ASSERT_EQUAL_UINT8(0, flags);
+    n = loopback_decode(&lb, 1, &seq, &channels, &flags, decoded, 32);
+    TEST_ASSERT_EQUAL_UINT32(4, n);
+    TEST_ASSERT_EQUAL_UINT16(50, seq);
+    TEST_ASSERT_EQUAL_UINT8(BLE_STREAM_FLAG_GAP, flags);
+
+    // --- Case 2: Refused packets are dropped + counted, the stream keeps going ---
+    lb.fail = 1;
+    ble_stream_push(&stream, frames, 20, 54);
+    TEST_ASSERT_EQUAL_UINT32(2, stream.send_errors);
+    lb.fail = 0;
+    ble_stream_push(&stream, frames, 10, 74);
+    TEST_ASSERT_EQUAL_UINT32(3, lb.count);
+}
+
+
+// =============================
+// Benchmark: Samples per Notification + Packing Cost
+// =============================
+void test_bench_ble_stream_packing(void) {
+
+    enum { BENCH_FRAMES = 34000 };
+    static loopback_t lb;
+    static ble_stream_t stream;
+    static int16_t frames[BENCH_FRAMES];
+    static const uint16_t mtus[] = {23, 185, 247, 517};
+
+    for (int i = 0; i < BENCH_FRAMES; i++) frames[i] = (int16_t)(i % 4096 - 2048);
+
+    for (size_t m = 0; m < sizeof(mtus) / sizeof(mtus[0]); m++) {
+
+        memset(&lb, 0, sizeof(lb));
+        lb.fail = 0;
+        ble_stream_init(&stream, 1, loopback_send, &lb);
+        ble_stream_set_mtu(&stream, mtus[m]);
+
+        // Loopback keeps 64 packets; count the rest via send_errors (still packed + framed)
+        int64_t t0 = esp_timer_get_time();
+        ble_stream_push(&stream, frames, BENCH_FRAMES, 0);
+        int64_t elapsed = esp_timer_get_time() - t0;
+
+        uint32_t packets = stream.packets_sent + stream.send_errors;
+        printf("ble stream mtu %3u: %3u samples/notification (%lu packets for %d samples), %.1f ns/sample\n",
+               mtus[m], stream.frames_per_packet, (unsigned long)packets, BENCH_FRAMES,
+               elapsed * 1000.0f / BENCH_FRAMES);
+        TEST_ASSERT_EQUAL_UINT32(BENCH_FRAMES / stream.frames_per_packet, packets);
+    }
+    // Timing is reported, not asserted (it depends on target, clock and cache state)
+}
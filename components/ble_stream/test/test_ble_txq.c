@@ -0,0 +1,203 @@
+// test_ble_txq.c - Unit tests for the notification queue (congestion backpressure, coalescing)
+
+#include "unity.h"
+#include "ble_txq.h"     // Under test
+#include <stdio.h>       // For the counter report
+#include <string.h>      // For memset
+
+#define TEST_BLINK_HANDLE   0x10
+#define TEST_ATTN_HANDLE    0x20
+#define TEST_OTHER_HANDLE   0x30
+
+
+// =============================
+// Simulated Link (stands in for Bluedroid + the controller's ACL buffers)
+// =============================
+// Every notification takes one controller buffer; the air frees `drain_per_tick` buffers per
+// tick. When the last buffer is taken the link reports congestion (like ESP_GATTS_CONGEST_EVT)
+// and it clears once half the buffers are free again. A send with no buffer left is refused.
+#define LINK_MAX_LOG  512
+
+typedef struct {
+    ble_txq_t *q;
+    int      buffers;               // Capacity
+    int      in_use;
+    int      drain_per_tick;
+    bool     congested;
+    uint32_t refused;
+    uint32_t sent_while_congested;  // Must stay 0: the queue respects the flag
+
+    uint16_t handle[LINK_MAX_LOG];  // What reached the phone, in order
+    uint32_t value[LINK_MAX_LOG];
+    size_t   count;
+} sim_link_t;
+
+static int sim_link_send(void *ctx, const ble_txq_packet_t *packet) {
+
+    sim_link_t *link = (sim_link_t *)ctx;
+
+    if (link->congested) link->sent_while_congested++;
+    if (link->in_use == link->buffers || link->count == LINK_MAX_LOG) {
+        link->refused++;
+        return -1;
+    }
+
+    uint32_t v = 0;
+    for (int i = packet->len - 1; i >= 0; i--) v = (v << 8) | packet->data[i];
+    link->handle[link->count] = packet->handle;
+    link->value[link->count] = v;
+    link->count++;
+
+    if (++link->in_use == link->buffers && !link->congested) {
+        link->congested = true;
+        ble_txq_set_congested(link->q, true);
+    }
+    return 0;
+}
+
+static void sim_link_tick(sim_link_t *link) {
+
+    link->in_use -= link->in_use < link->drain_per_tick ? link->in_use : link->drain_per_tick;
+    if (link->congested && link->in_use <= link->buffers / 2) {
+        link->congested = false;
+        ble_txq_set_congested(link->q, false);
+    }
+}
+
+static void push_blink(ble_txq_t *q, uint32_t count, int64_t stamp) {
+    uint8_t data[4] = { (uint8_t)count, (uint8_t)(count >> 8), (uint8_t)(count >> 16), (uint8_t)(count >> 24) };
+    TEST_ASSERT_TRUE(ble_txq_push(q, TEST_BLINK_HANDLE, data, sizeof(data), 1, stamp));
+}
+
+static void put_attention(ble_txq_t *q, uint8_t level, int64_t stamp) {
+    TEST_ASSERT_TRUE(ble_txq_put_latest(q, TEST_ATTN_HANDLE, &level, 1, 2, stamp));
+}
+
+
+// =============================
+// Test: Congested Link (Pause, Resume, Order, Coalescing)
+// =============================
+void test_ble_txq_congested_link(void) {
+
+    static ble_txq_t q;
+    static sim_link_t link;
+
+    memset(&link, 0, sizeof(link));
+    link.q = &q;
+    link.buffers = 4;
+    link.drain_per_tick = 1;
+    ble_txq_init(&q, sim_link_send, &link);
+
+    // --- 1. Offered load above what the air drains (one packet per tick): a blink every tick
+    //        plus a burst of 4 every 16 ticks, and a new attention level every tick ---
+    uint32_t blinks = 0;
+    uint8_t level = 0;
+    uint32_t now_us = 0;
+    for (int tick = 0; tick < 120; tick++, now_us += 10000) {
+        for (int b = 0; b < (tick % 16 == 0 ? 4 : 1); b++) push_blink(&q, ++blinks, tick);
+        put_attention(&q, ++level, tick);
+        ble_txq_pump(&q, now_us);
+        TEST_ASSERT_TRUE(ble_txq_depth(&q) <= BLE_TXQ_DEPTH + BLE_TXQ_LATEST_SLOTS);
+        sim_link_tick(&link);
+    }
+
+    // --- 2. Load stops: the queue empties as the link recovers ---
+    for (int tick = 0; tick < 100 && ble_txq_depth(&q) > 0; tick++, now_us += 10000) {
+        ble_txq_pump(&q, now_us);
+        sim_link_tick(&link);
+    }
+    TEST_ASSERT_EQUAL(0, ble_txq_depth(&q));
+    TEST_ASSERT_EQUAL_UINT32(0, link.sent_while_congested);
+
+    // --- 3. What the phone saw: blinks in order (gaps only where the FIFO overflowed),
+    //        attention only ever moving forward and ending on the last level ---
+    const ble_txq_stats_t *st = &q.stats;
+    uint32_t blinks_seen = 0, last_blink = 0, last_level = 0;
+    for (size_t i = 0; i < link.count; i++) {
+        if (link.handle[i] == TEST_BLINK_HANDLE) {
+            TEST_ASSERT_TRUE(link.value[i] > last_blink);
+            last_blink = link.value[i];
+            blinks_seen++;
+        } else {
+            TEST_ASSERT_EQUAL_UINT16(TEST_ATTN_HANDLE, link.handle[i]);
+            TEST_ASSERT_TRUE(link.value[i] > last_level);
+            last_level = link.value[i];
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(blinks, last_blink);                  // The newest blink always arrives
+    TEST_ASSERT_EQUAL_UINT32(level, last_level);                   // So does the final attention level
+    TEST_ASSERT_EQUAL_UINT32(blinks, blinks_seen + st->dropped);   // Every blink sent or counted as dropped
+
+    // Every attention update was sent or merged into a later one
+    TEST_ASSERT_EQUAL_UINT32(level, (link.count - blinks_seen) + st->coalesced);
+    TEST_ASSERT_TRUE(st->coalesced > 0);
+    TEST_ASSERT_TRUE(st->dropped > 0);                             // The load really overflowed the FIFO
+
+    TEST_ASSERT_EQUAL_UINT32(link.count, st->sent);
+    TEST_ASSERT_TRUE(st->congest_events > 0);
+    TEST_ASSERT_TRUE(st->stalls > 0);
+    TEST_ASSERT_TRUE(st->stalled_us > 0);
+    TEST_ASSERT_TRUE(st->max_depth >= BLE_TXQ_DEPTH && st->max_depth <= BLE_TXQ_DEPTH + BLE_TXQ_LATEST_SLOTS);
+    TEST_ASSERT_FALSE(q.stalled);
+
+    printf("ble txq congested link: %lu sent, %lu coalesced, %lu dropped, %lu refused, %lu stalls (%llu us), "
+           "%lu congestion events, max depth %u\n", (unsigned long)st->sent, (unsigned long)st->coalesced,
+           (unsigned long)st->dropped, (unsigned long)st->refused, (unsigned long)st->stalls,
+           (unsigned long long)st->stalled_us, (unsigned long)st->congest_events, st->max_depth);
+}
+
+
+// =============================
+// Test: Overflow, Refused Sends, Slots, Reset
+// =============================
+void test_ble_txq_overflow_and_reset(void) {
+
+    static ble_txq_t q;
+    static sim_link_t link;
+
+    memset(&link, 0, sizeof(link));
+    link.q = &q;
+    link.buffers = 64;
+    ble_txq_init(&q, sim_link_send, &link);
+
+    // --- Case 1: Congested, FIFO overflows: the oldest go, the newest stay in order ---
+    ble_txq_set_congested(&q, true);
+    for (uint32_t b = 1; b <= BLE_TXQ_DEPTH + 3; b++) push_blink(&q, b, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, ble_txq_pump(&q, 100));
+    TEST_ASSERT_EQUAL_UINT32(3, q.stats.dropped);
+    TEST_ASSERT_EQUAL(BLE_TXQ_DEPTH, ble_txq_depth(&q));
+    TEST_ASSERT_EQUAL_UINT32(1, q.stats.stalls);
+
+    ble_txq_set_congested(&q, false);
+    TEST_ASSERT_EQUAL_UINT32(BLE_TXQ_DEPTH, ble_txq_pump(&q, 600));
+    TEST_ASSERT_EQUAL_UINT32(4, link.value[0]);
+    TEST_ASSERT_EQUAL_UINT32(BLE_TXQ_DEPTH + 3, link.value[link.count - 1]);
+    TEST_ASSERT_EQUAL_UINT64(500, q.stats.stalled_us);
+
+    // --- Case 2: A refused send stays at the head and goes out on the next pump ---
+    link.in_use = link.buffers;                        // No buffer free, no congestion report
+    push_blink(&q, 100, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, ble_txq_pump(&q, 0));
+    TEST_ASSERT_EQUAL_UINT32(1, q.stats.refused);
+    link.in_use = 0;
+    TEST_ASSERT_EQUAL_UINT32(1, ble_txq_pump(&q, 0));
+    TEST_ASSERT_EQUAL_UINT32(100, link.value[link.count - 1]);
+
+    // --- Case 3: One latest-value slot per handle, oversize packets refused ---
+    uint8_t big[BLE_TXQ_MAX_DATA + 1] = {0};
+    uint8_t v = 7;
+    TEST_ASSERT_FALSE(ble_txq_push(&q, TEST_BLINK_HANDLE, big, sizeof(big), 0, 0));
+    TEST_ASSERT_TRUE(ble_txq_put_latest(&q, TEST_ATTN_HANDLE, &v, 1, 0, 0));
+    TEST_ASSERT_TRUE(ble_txq_put_latest(&q, TEST_ATTN_HANDLE, &v, 1, 0, 0));
+    TEST_ASSERT_EQUAL(1, ble_txq_depth(&q));
+    TEST_ASSERT_TRUE(ble_txq_put_latest(&q, TEST_OTHER_HANDLE, &v, 1, 0, 0));
+    TEST_ASSERT_FALSE(ble_txq_put_latest(&q, TEST_OTHER_HANDLE + 1, &v, 1, 0, 0));   // Both slots taken
+
+    // --- Case 4: Reset (disconnect) discards what is pending, counted as dropped ---
+    uint32_t dropped = q.stats.dropped;
+    push_blink(&q, 101, 0);
+    ble_txq_reset(&q);
+    TEST_ASSERT_EQUAL(0, ble_txq_depth(&q));
+    TEST_ASSERT_EQUAL_UINT32(dropped + 3, q.stats.dropped);
+    TEST_ASSERT_EQUAL_UINT32(0, ble_txq_pump(&q, 0));
+}
@@ -0,0 +1,269 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "eeg_codec.h"
+    #include <stdbool.h>
+    #include <string.h>  // For memset
+
+
+// =============================
+// CRC-16/CCITT (Nibble Table)
+// =============================
+static const uint16_t crc16_nibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+};
+
+static uint16_t crc16_update(uint16_t crc, const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        crc = (uint16_t)((crc << 4) ^ crc16_nibble[(crc >> 12) ^ (data[i] >> 4)]);
+        crc = (uint16_t)((crc << 4) ^ crc16_nibble[(crc >> 12) ^ (data[i] & 0x0F)]);
+    }
+    return crc;
+}
+
+static uint16_t block_crc(const uint8_t *block, size_t payload_len) {
+    uint16_t crc = crc16_update(0xFFFF, block, 8);
+    return crc16_update(crc, block + EEG_CODEC_HEADER_SIZE, payload_len);
+}
+
+
+// =============================
+// Fixed Predictors
+// =============================
+// Residual of sample `i` (frame index) of one channel, stride = channels
+static inline int32_t residual(const int16_t *x, size_t i, size_t stride, uint8_t order) {
+    int32_t s = x[i * stride];
+    switch (order) {
+    case 1:  return s - x[(i - 1) * stride];
+    case 2:  return s - 2 * x[(i - 1) * stride] + x[(i - 2) * stride];
+    case 3:  return s - 3 * x[(i - 1) * stride] + 3 * x[(i - 2) * stride] - x[(i - 3) * stride];
+    default: return s;
+    }
+}
+
+static inline int32_t predict(const int16_t *x, size_t i, size_t stride, uint8_t order) {
+    switch (order) {
+    case 1:  return x[(i - 1) * stride];
+    case 2:  return 2 * x[(i - 1) * stride] - x[(i - 2) * stride];
+    case 3:  return 3 * x[(i - 1) * stride] - 3 * x[(i - 2) * stride] + x[(i - 3) * stride];
+    default: return 0;
+    }
+}
+
+static inline uint32_t zigzag(int32_t v)   { return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31); }
+static inline int32_t  unzigzag(uint32_t v) { return (int32_t)(v >> 1) ^ -(int32_t)(v & 1); }
+
+// Predictor with the smallest residual magnitude over the block (and its zigzag sum)
+static uint8_t pick_order(const int16_t *x, size_t frames, size_t stride, uint64_t *zz_sum) {
+
+    uint64_t sum[EEG_CODEC_MAX_ORDER + 1] = { 0 };
+    uint8_t max_order = frames > EEG_CODEC_MAX_ORDER ? EEG_CODEC_MAX_ORDER : (uint8_t)(frames - 1);
+
+    // Compared over the same samples (from frame max_order on) so the sums are comparable
+    for (size_t i = max_order; i < frames; i++) {
+        int32_t e0 = x[i * stride];
+        int32_t e1 = max_order >= 1 ? e0 - x[(i - 1) * stride] : 0;
+        int32_t e2 = max_order >= 2 ? e1 - (x[(i - 1) * stride] - x[(i - 2) * stride]) : 0;
+        int32_t e3 = max_order >= 3 ? e2 - (x[(i - 1) * stride] - 2 * x[(i - 2) * stride] + x[(i - 3) * stride]) : 0;
+        sum[0] += zigzag(e0);
+        sum[1] += zigzag(e1);
+        sum[2] += zigzag(e2);
+        sum[3] += zigzag(e3);
+    }
+
+    uint8_t best = 0;
+    for (uint8_t o = 1; o <= max_order; o++) {
+        if (sum[o] < sum[best]) best = o;
+    }
+    *zz_sum = sum[best];
+    return best;
+}
+
+// Rice parameter: 2^k ~ mean zigzag residual
+static uint8_t pick_k(uint64_t zz_sum, size_t count) {
+    uint8_t k = 0;
+    while (k < EEG_CODEC_MAX_K && ((uint64_t)count << (k + 1)) <= zz_sum) k++;
+    return k;
+}
+
+
+// =============================
+// Bit Writer / Reader (MSB First)
+// =============================
+typedef struct {
+    uint8_t *p, *end;
+    uint32_t acc;                 // Pending bits, right-aligned
+    uint8_t  n;                   // Number of pending bits (< 8 between calls)
+    bool     overflow;
+} bit_writer_t;
+
+// Appends the low `bits` (<= 24) bits of `v`
+static inline void bw_put(bit_writer_t *bw, uint32_t v, uint8_t bits) {
+    bw->acc = (bw->acc << bits) | (v & ((1u << bits) - 1));
+    bw->n += bits;
+    while (bw->n >= 8) {
+        bw->n -= 8;
+        if (bw->p < bw->end) *bw->p++ = (uint8_t)(bw->acc >> bw->n);
+        else bw->overflow = true;
+    }
+}
+
+static inline void bw_flush(bit_writer_t *bw) {
+    if (bw->n) bw_put(bw, 0, 8 - bw->n);
+}
+
+static inline void rice_put(bit_writer_t *bw, uint32_t u, uint8_t k) {
+    uint32_t q = u >> k;
+    if (q < EEG_CODEC_ESCAPE_Q) {
+        bw_put(bw, ((1u << q) - 1) << 1, (uint8_t)(q + 1));     // q ones, then a zero
+        if (k) bw_put(bw, u, k);
+    } else {
+        bw_put(bw, (1u << EEG_CODEC_ESCAPE_Q) - 1, EEG_CODEC_ESCAPE_Q);
+        bw_put(bw, u, EEG_CODEC_RAW_BITS);
+    }
+}
+
+typedef struct {
+    const uint8_t *p, *end;
+    uint32_t acc;
+    uint8_t  n;
+    bool     underflow;
+} bit_reader_t;
+
+static inline uint32_t br_get(bit_reader_t *br, uint8_t bits) {
+    while (br->n < bits) {
+        br->acc = (br->acc << 8) | (br->p < br->end ? *br->p++ : (br->underflow = true, 0));
+        br->n += 8;
+    }
+    br->n -= bits;
+    return (br->acc >> br->n) & ((1u << bits) - 1);
+}
+
+static inline uint32_t rice_get(bit_reader_t *br, uint8_t k) {
+    uint32_t q = 0;
+    while (q < EEG_CODEC_ESCAPE_Q && br_get(br, 1)) q++;
+    if (q == EEG_CODEC_ESCAPE_Q) return br_get(br, EEG_CODEC_RAW_BITS);
+    return k ? (q << k) | br_get(br, k) : q;
+}
+
+
+// =============================
+// Encoder
+// =============================
+size_t eeg_codec_encode(const int16_t *frames, uint16_t num_frames, uint8_t channels, uint16_t seq,
+                        uint8_t *out, size_t cap) {
+
+    if (num_frames == 0 || channels == 0 || channels > EEG_CODEC_MAX_CHANNELS || cap < EEG_CODEC_HEADER_SIZE) return 0;
+
+    // Payload length is capped by its 16-bit header field
+    size_t room = cap - EEG_CODEC_HEADER_SIZE;
+    if (room > UINT16_MAX) room = UINT16_MAX;
+    bit_writer_t bw = { .p = out + EEG_CODEC_HEADER_SIZE, .end = out + EEG_CODEC_HEADER_SIZE + room };
+
+    for (uint8_t ch = 0; ch < channels; ch++) {
+
+        const int16_t *x = &frames[ch];
+
+        // --- 1. Pass one: predictor + Rice parameter ---
+        uint64_t zz_sum;
+        uint8_t order = pick_order(x, num_frames, channels, &zz_sum);
+        size_t counted = num_frames - (num_frames > EEG_CODEC_MAX_ORDER ? EEG_CODEC_MAX_ORDER : num_frames - 1);
+        uint8_t k = pick_k(zz_sum, counted);
+
+        // --- 2. Pass two: parameters, warm-up, residuals ---
+        bw_put(&bw, (uint32_t)order << 6 | (uint32_t)k << 1, 8);
+        for (uint8_t i = 0; i < order; i++) bw_put(&bw, (uint16_t)x[i * channels], 16);
+        for (size_t i = order; i < num_frames; i++) rice_put(&bw, zigzag(residual(x, i, channels, order)), k);
+
+        if (bw.overflow) return 0;
+    }
+    bw_flush(&bw);
+    if (bw.overflow) return 0;
+
+    // --- 3. Header last: it carries the payload size and the CRC ---
+    size_t payload = (size_t)(bw.p - (out + EEG_CODEC_HEADER_SIZE));
+    out[0] = EEG_CODEC_SYNC;
+    out[1] = (uint8_t)(EEG_CODEC_VERSION << 4 | (channels - 1));
+    out[2] = (uint8_t)num_frames;
+    out[3] = (uint8_t)(num_frames >> 8);
+    out[4] = (uint8_t)seq;
+    out[5] = (uint8_t)(seq >> 8);
+    out[6] = (uint8_t)payload;
+    out[7] = (uint8_t)(payload >> 8);
+    uint16_t crc = block_crc(out, payload);
+    out[8] = (uint8_t)crc;
+    out[9] = (uint8_t)(crc >> 8);
+
+    return EEG_CODEC_HEADER_SIZE + payload;
+}
+
+
+// =============================
+// Decoder
+// =============================
+// Header sanity + complete block + CRC; returns the block size or 0
+static size_t block_check(const uint8_t *in, size_t len) {
+
+    if (len < EEG_CODEC_HEADER_SIZE || in[0] != EEG_CODEC_SYNC || (in[1] >> 4) != EEG_CODEC_VERSION) return 0;
+    if ((in[1] & 0x0F) >= EEG_CODEC_MAX_CHANNELS || (in[2] | in[3]) == 0) return 0;
+
+    size_t payload = in[6] | ((size_t)in[7] << 8);
+    if (EEG_CODEC_HEADER_SIZE + payload > len) return 0;
+
+    uint16_t crc = (uint16_t)(in[8] | (in[9] << 8));
+    return crc == block_crc(in, payload) ? EEG_CODEC_HEADER_SIZE + payload : 0;
+}
+
+size_t eeg_codec_decode(const uint8_t *in, size_t len, int16_t *frames, size_t max_frames,
+                        eeg_codec_block_info_t *info) {
+
+    size_t size = block_check(in, len);
+    if (size == 0) return 0;
+
+    uint8_t channels = (uint8_t)((in[1] & 0x0F) + 1);
+    size_t num_frames = in[2] | ((size_t)in[3] << 8);
+    if (num_frames > max_frames) return 0;
+
+    if (info) {
+        memset(info, 0, sizeof(*info));
+        info->channels = channels;
+        info->frames = (uint16_t)num_frames;
+        info->seq = (uint16_t)(in[4] | (in[5] << 8));
+        info->payload_len = (uint16_t)(size - EEG_CODEC_HEADER_SIZE);
+    }
+
+    bit_reader_t br = { .p = in + EEG_CODEC_HEADER_SIZE, .end = in + size };
+
+    for (uint8_t ch = 0; ch < channels; ch++) {
+
+        int16_t *x = &frames[ch];
+        uint32_t param = br_get(&br, 8);
+        uint8_t order = (uint8_t)(param >> 6), k = (uint8_t)((param >> 1) & 0x1F);
+        if (order > EEG_CODEC_MAX_ORDER || order >= num_frames || k > EEG_CODEC_MAX_K) return 0;
+
+        for (uint8_t i = 0; i < order; i++) x[i * channels] = (int16_t)br_get(&br, 16);
+        for (size_t i = order; i < num_frames; i++) {
+            x[i * channels] = (int16_t)(predict(x, i, channels, order) + unzigzag(rice_get(&br, k)));
+        }
+
+        if (br.underflow) return 0;
+        if (info) {
+            info->order[ch] = order;
+            info->k[ch] = k;
+        }
+    }
+    return size;
+}
+
+
+// =============================
+// Resynchronisation
+// =============================
+size_t eeg_codec_resync(const uint8_t *in, size_t len) {
+    for (size_t off = 0; off + EEG_CODEC_HEADER_SIZE <= len; off++) {
+        if (in[off] == EEG_CODEC_SYNC && block_check(in + off, len - off)) return off;
+    }
+    return len;
+}
@@ -0,0 +1,81 @@
+#ifndef EEG_CODEC_H
+#define EEG_CODEC_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+
+
+// =============================
+// Lossless Block Codec (Fixed Prediction + Rice)
+// =============================
+//
+// One block = `frames` interleaved int16_t frames of 1..8 channels, coded on its own (no state
+// carries over), so any block decodes without the ones before it:
+//
+//      header  (10 bytes, byte aligned)
+//          [0]    sync 0xE5
+//          [1]    version << 4 | (channels - 1)
+//          [2..3] frames            (little-endian)
+//          [4..5] seq               block counter, tells the decoder how many blocks it missed
+//          [6..7] payload bytes
+//          [8..9] CRC-16/CCITT over bytes 0..7 and the payload
+//      payload (bit stream, MSB first, per channel)
+//          order (2 bits) | k (5 bits) | 1 spare bit
+//          `order` warm-up samples, 16 bits each
+//          frames - order residuals, Rice(k) coded
+//
+// Each channel picks the fixed polynomial predictor (order 0..3: 0, x1, 2x1 - x2,
+// 3x1 - 3x2 + x3) with the smallest residual sum. Its residuals are zigzag-mapped and Rice
+// coded with k ~ log2(mean residual). A quotient of EEG_CODEC_ESCAPE_Q or more is sent as that
+// many 1 bits followed by the raw value, which bounds the worst case (spikes, clipping, noise).
+//
+// The encoder needs no buffers (two passes over the input, a 32-bit bit accumulator) and no
+// heap, so it runs inside the DSP / recorder tasks as is. After loss or corruption,
+// eeg_codec_resync() finds the next block whose header and CRC check out.
+#define EEG_CODEC_SYNC          0xE5
+#define EEG_CODEC_VERSION       1
+#define EEG_CODEC_HEADER_SIZE   10
+#define EEG_CODEC_MAX_CHANNELS  8
+#define EEG_CODEC_MAX_ORDER     3
+#define EEG_CODEC_MAX_K         20
+#define EEG_CODEC_ESCAPE_Q      24         // Unary run that switches to a raw value
+#define EEG_CODEC_RAW_BITS      20         // Zigzag residual of order 3 fits 20 bits
+
+typedef struct {
+    uint8_t  channels;
+    uint16_t frames;
+    uint16_t seq;
+    uint16_t payload_len;
+    uint8_t  order[EEG_CODEC_MAX_CHANNELS];   // Predictor picked per channel
+    uint8_t  k[EEG_CODEC_MAX_CHANNELS];       // Rice parameter per channel
+} eeg_codec_block_info_t;
+
+// Worst-case block size (every residual escaped); a constant expression for static buffers
+#define EEG_CODEC_MAX_SIZE(frames, channels) \
+    (EEG_CODEC_HEADER_SIZE + ((size_t)(channels) * (8 + 16 * EEG_CODEC_MAX_ORDER) + \
+     (size_t)(frames) * (channels) * (EEG_CODEC_ESCAPE_Q + EEG_CODEC_RAW_BITS) + 7) / 8)
+
+
+// =============================
+// Codec API
+// =============================
+// Returns the block size in bytes, 0 if it does not fit `cap` (or 0 frames / bad channel count).
+// A `cap` of EEG_CODEC_MAX_SIZE() always fits; a smaller one is checked as the block is written.
+size_t eeg_codec_encode(const int16_t *frames, uint16_t num_frames, uint8_t channels, uint16_t seq,
+                        uint8_t *out, size_t cap);
+
+// Decodes the block at `in`; returns the bytes it occupied, 0 if it is truncated, fails its
+// CRC or holds more than `max_frames` frames. `info` (optional) receives the header fields.
+size_t eeg_codec_decode(const uint8_t *in, size_t len, int16_t *frames, size_t max_frames,
+                        eeg_codec_block_info_t *info);
+
+// Offset of the first complete, CRC-valid block in `in` (`len` if there is none).
+size_t eeg_codec_resync(const uint8_t *in, size_t len);
+
+
+#endif // EEG_CODEC_H
@@ -0,0 +1,216 @@
+// test_eeg_codec.c - Unit tests for the lossless EEG block codec
+
+#include "unity.h"
+#include "eeg_codec.h"           // Under test
+#include "adc_source.h"          // Synthetic EEG for the ratio report
+#include "esp_timer.h"           // esp_timer_get_time (throughput)
+#include <stdio.h>               // For benchmark output
+#include <string.h>              // For memcpy
+
+#define CODEC_TEST_FRAMES  256
+
+static int16_t codec_in[CODEC_TEST_FRAMES * EEG_CODEC_MAX_CHANNELS];
+static int16_t codec_out[CODEC_TEST_FRAMES * EEG_CODEC_MAX_CHANNELS];
+static uint8_t codec_buf[4 * 8192];
+
+static uint32_t codec_rng = 1;
+static int32_t codec_rand(void) {
+    codec_rng ^= codec_rng << 13;
+    codec_rng ^= codec_rng >> 17;
+    codec_rng ^= codec_rng << 5;
+    return (int32_t)codec_rng;
+}
+
+static void codec_roundtrip(uint16_t frames, uint8_t channels) {
+    size_t len = eeg_codec_encode(codec_in, frames, channels, 7, codec_buf, sizeof(codec_buf));
+    eeg_codec_block_info_t info;
+    TEST_ASSERT_TRUE(len > EEG_CODEC_HEADER_SIZE);
+    TEST_ASSERT_TRUE(len <= EEG_CODEC_MAX_SIZE(frames, channels));
+    TEST_ASSERT_EQUAL_size_t(len, eeg_codec_decode(codec_buf, len, codec_out, frames, &info));
+    TEST_ASSERT_EQUAL_UINT8(channels, info.channels);
+    TEST_ASSERT_EQUAL_UINT16(frames, info.frames);
+    TEST_ASSERT_EQUAL_UINT16(7, info.seq);
+    TEST_ASSERT_EQUAL_INT16_ARRAY(codec_in, codec_out, frames * channels);
+}
+
+
+// =============================
+// Test: Lossless on Smooth, Noisy and Extreme Input
+// =============================
+void test_eeg_codec_roundtrip(void) {
+
+    static const uint16_t sizes[] = { 1, 2, 3, 4, 5, 64, CODEC_TEST_FRAMES };
+
+    for (uint8_t nch = 1; nch <= EEG_CODEC_MAX_CHANNELS; nch++) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+            uint16_t frames = sizes[s];
+
+            // Smooth ramp + curvature (order 2 / 3 territory)
+            for (size_t i = 0; i < (size_t)frames * nch; i++) {
+                int32_t f = (int32_t)(i / nch);
+                codec_in[i] = (int16_t)(1500 + 40 * (int32_t)(i % nch) + 3 * f + (f * f) / 50);
+            }
+            codec_roundtrip(frames, nch);
+
+            // White noise over the full int16_t range: every residual escapes
+            for (size_t i = 0; i < (size_t)frames * nch; i++) codec_in[i] = (int16_t)codec_rand();
+            codec_roundtrip(frames, nch);
+
+            // Full-scale square wave: the largest order-3 residuals there are
+            for (size_t i = 0; i < (size_t)frames * nch; i++) codec_in[i] = ((i / nch) & 1) ? INT16_MAX : INT16_MIN;
+            codec_roundtrip(frames, nch);
+        }
+    }
+}
+
+
+// =============================
+// Test: Output Buffer Too Small, Corruption
+// =============================
+void test_eeg_codec_rejects_bad_input(void) {
+
+    for (size_t i = 0; i < 64; i++) codec_in[i] = (int16_t)(100 + i * 5);
+    size_t len = eeg_codec_encode(codec_in, 64, 1, 0, codec_buf, sizeof(codec_buf));
+    TEST_ASSERT_TRUE(len > 0);
+
+    // The exact size fits, one byte less does not (and nothing is written past the end)
+    static uint8_t tight[256];
+    memset(tight, 0xAA, sizeof(tight));
+    TEST_ASSERT_EQUAL_size_t(len, eeg_codec_encode(codec_in, 64, 1, 0, tight, len));
+    memset(tight, 0xAA, sizeof(tight));
+    TEST_ASSERT_EQUAL_size_t(0, eeg_codec_encode(codec_in, 64, 1, 0, tight, len - 1));
+    TEST_ASSERT_EQUAL_HEX8(0xAA, tight[len - 1]);
+
+    TEST_ASSERT_EQUAL_size_t(0, eeg_codec_encode(codec_in, 0, 1, 0, codec_buf, sizeof(codec_buf)));
+    TEST_ASSERT_EQUAL_size_t(0, eeg_codec_encode(codec_in, 64, 9, 0, codec_buf, sizeof(codec_buf)));
+
+    // Truncated, too many frames for the caller, flipped payload bit
+    TEST_ASSERT_EQUAL_size_t(0, eeg_codec_decode(codec_buf, len - 1, codec_out, 64, NULL));
+    TEST_ASSERT_EQUAL_size_t(0, eeg_codec_decode(codec_buf, len, codec_out, 63, NULL));
+    codec_buf[EEG_CODEC_HEADER_SIZE + 3] ^= 0x10;
+    TEST_ASSERT_EQUAL_size_t(0, eeg_codec_decode(codec_buf, len, codec_out, 64, NULL));
+}
+
+
+// =============================
+// Test: Resync After Loss and Corruption
+// =============================
+void test_eeg_codec_resync(void) {
+
+    static adc_source_synth_t synth;
+    adc_synth_config_t cfg;
+    adc_synth_default_config(&cfg, 100.0f);
+    adc_source_t *src = adc_source_synth_init(&synth, &cfg, 2);
+
+    // A stream of 20 blocks of 32 frames
+    size_t offsets[21] = { 0 };
+    static int16_t all[20 * 32 * 2];
+    adc_source_read(src, all, 20 * 32);
+    for (int b = 0; b < 20; b++) {
+        size_t len = eeg_codec_encode(&all[b * 32 * 2], 32, 2, (uint16_t)b, codec_buf + offsets[b],
+                                      sizeof(codec_buf) - offsets[b]);
+        TEST_ASSERT_TRUE(len > 0);
+        offsets[b + 1] = offsets[b] + len;
+    }
+    size_t total = offsets[20];
+
+    // Damage: block 3 loses its middle, block 9 gets a flipped bit, block 14 is cut short
+    // (its tail and the head of block 15 are gone, as if a packet was lost)
+    static uint8_t stream[4 * 8192];
+    size_t n = 0;
+    for (int b = 0; b < 20; b++) {
+        size_t start = offsets[b], len = offsets[b + 1] - offsets[b];
+        if (b == 3) len /= 2;
+        if (b == 15) continue;
+        memcpy(stream + n, codec_buf + start, len);
+        if (b == 9) stream[n + len - 2] ^= 0x01;
+        if (b == 14) len = 5;
+        n += len;
+    }
+    TEST_ASSERT_TRUE(n < total);
+
+    // Decode: on failure resync to the next good header; count what came through
+    int decoded = 0, expected_seq = 0, missed = 0;
+    size_t pos = 0;
+    while (pos < n) {
+        eeg_codec_block_info_t info;
+        size_t used = eeg_codec_decode(stream + pos, n - pos, codec_out, 32, &info);
+        if (used == 0) {
+            pos += 1 + eeg_codec_resync(stream + pos + 1, n - pos - 1);
+            continue;
+        }
+        missed += info.seq - expected_seq;
+        expected_seq = info.seq + 1;
+        TEST_ASSERT_EQUAL_INT16_ARRAY(&all[info.seq * 32 * 2], codec_out, 32 * 2);
+        decoded++;
+        pos += used;
+    }
+    TEST_ASSERT_EQUAL_INT(16, decoded);                     // 20 - blocks 3, 9, 14, 15
+    TEST_ASSERT_EQUAL_INT(4, missed);                       // ... and the sequence numbers show it
+    TEST_ASSERT_EQUAL_size_t(5, eeg_codec_resync(stream, 5));   // Nothing complete in 5 bytes
+}
+
+
+// =============================
+// Test: Ratio + Throughput Report
+// =============================
+// Synthetic EEG (default and noisier) plus a drift + strong alpha signal shaped like a real
+// electrode recording; prints bits/sample, ratio and encode / decode throughput. Recordings on
+// disk go through the same codec with the host runner (EEG_SOURCE=csv:... EEG_RECORD=...).
+// `max_bits` of 0 only reports: large low-frequency swings at 100 Hz leave big order-3
+// residuals, which is what a real recording with a loose electrode looks like too.
+static void codec_report(const char *name, adc_source_t *src, uint8_t nch, double max_bits) {
+
+    static int16_t signal[CODEC_TEST_FRAMES * 40 * 2];
+    size_t frames = adc_source_read(src, signal, sizeof(signal) / sizeof(signal[0]) / nch);
+    size_t blocks = frames / CODEC_TEST_FRAMES, bytes = 0;
+
+    int64_t t0 = esp_timer_get_time();
+    for (int rep = 0; rep < 10; rep++) {
+        bytes = 0;
+        for (size_t b = 0; b < blocks; b++) {
+            bytes += eeg_codec_encode(&signal[b * CODEC_TEST_FRAMES * nch], CODEC_TEST_FRAMES, nch, (uint16_t)b,
+                                      codec_buf, sizeof(codec_buf));
+        }
+    }
+    int64_t t_enc = esp_timer_get_time() - t0;
+
+    // Decode check over a fresh encode of every block
+    t0 = esp_timer_get_time();
+    for (size_t b = 0; b < blocks; b++) {
+        size_t len = eeg_codec_encode(&signal[b * CODEC_TEST_FRAMES * nch], CODEC_TEST_FRAMES, nch, 0,
+                                      codec_buf, sizeof(codec_buf));
+        TEST_ASSERT_EQUAL_size_t(len, eeg_codec_decode(codec_buf, len, codec_out, CODEC_TEST_FRAMES, NULL));
+        TEST_ASSERT_EQUAL_INT16_ARRAY(&signal[b * CODEC_TEST_FRAMES * nch], codec_out, CODEC_TEST_FRAMES * nch);
+    }
+    int64_t t_dec = esp_timer_get_time() - t0;
+
+    double samples = (double)blocks * CODEC_TEST_FRAMES * nch;
+    double bits = bytes * 8.0 / samples;
+    printf("codec %-16s %u ch: %.2f bits/sample (%.2f:1), encode %.1f Msamples/s, encode+decode %.1f Msamples/s\n",
+           name, nch, bits, 16.0 / bits, samples * 10 / (double)(t_enc > 0 ? t_enc : 1),
+           samples / (double)(t_dec > 0 ? t_dec : 1));
+
+    if (max_bits > 0) TEST_ASSERT_TRUE(bits < max_bits);
+}
+
+void test_eeg_codec_ratio_report(void) {
+
+    static adc_source_synth_t synth;
+    adc_synth_config_t cfg;
+
+    adc_synth_default_config(&cfg, 100.0f);
+    codec_report("synthetic", adc_source_synth_init(&synth, &cfg, 1), 1, 8.0);     // The point of the exercise
+    codec_report("synthetic", adc_source_synth_init(&synth, &cfg, 2), 2, 8.0);
+
+    cfg.noise_amplitude = 12.0f;
+    codec_report("synthetic-noisy", adc_source_synth_init(&synth, &cfg, 2), 2, 8.0);
+
+    // Recording-like: electrode drift, strong alpha, some beta
+    adc_synth_default_config(&cfg, 100.0f);
+    cfg.tones[0] = (adc_synth_tone_t){ .freq_hz = 0.3f, .amplitude = 400.0f };
+    cfg.tones[1] = (adc_synth_tone_t){ .freq_hz = 10.0f, .amplitude = 150.0f };
+    cfg.tones[2] = (adc_synth_tone_t){ .freq_hz = 22.0f, .amplitude = 40.0f };
+    cfg.num_tones = 3;
+    codec_report("drift+alpha", adc_source_synth_init(&synth, &cfg, 2), 2, 0);
+}
@@ -0,0 +1,21 @@
+#ifndef LATENCY_CONSOLE_H
+#define LATENCY_CONSOLE_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include "esp_err.h"
+
+
+// =============================
+// Console Command: latency
+// =============================
+//
+//      latency          per-stage count / p50 / p99 / max (us), see latency_hist.h
+//      latency reset    clear every stage histogram
+esp_err_t latency_console_register(void);
+
+
+#endif // LATENCY_CONSOLE_H
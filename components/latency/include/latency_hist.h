@@ -0,0 +1,120 @@
+#ifndef LATENCY_HIST_H
+#define LATENCY_HIST_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdio.h>       // FILE (console report)
+    #include <stdatomic.h>   // Lock-free recording from any task
+    #include "mem_budget.h"  // Static footprint table
+
+
+// =============================
+// Fixed-Bucket Latency Histogram
+// =============================
+//
+// Log-linear buckets in microseconds: 0..15 us are exact, above that every power of two is split
+// into 8 sub-buckets, so a reported percentile is within 12.5% of the true value. Values of
+// 2^22 us (~4.2 s) and more land in a single overflow bucket (max_us is still exact).
+//
+// Recording is a relaxed atomic increment plus a CAS on max_us: wait-free for the common case,
+// no locks, safe from any task on either core. Readers walk the buckets while recording goes on,
+// so a summary may miss samples recorded during the walk; it never sees torn counters.
+#define LATENCY_LINEAR_US     16                        // Exact buckets below this
+#define LATENCY_SUB_BITS      3                         // 2^3 sub-buckets per octave
+#define LATENCY_MAX_OCTAVE    22                        // First octave that overflows (2^22 us)
+#define LATENCY_BUCKETS       (LATENCY_LINEAR_US + (LATENCY_MAX_OCTAVE - 4) * (1 << LATENCY_SUB_BITS) + 1)
+
+typedef struct {
+    _Atomic uint32_t buckets[LATENCY_BUCKETS];
+    _Atomic uint32_t count;
+    _Atomic uint32_t max_us;
+} latency_hist_t;
+
+typedef struct {
+    uint32_t count;
+    uint32_t p50_us;                // Upper edge of the bucket holding the median (<= max_us)
+    uint32_t p99_us;
+    uint32_t max_us;
+} latency_summary_t;
+
+
+// =============================
+// Histogram API
+// =============================
+void latency_hist_reset(latency_hist_t *hist);
+void latency_hist_record(latency_hist_t *hist, uint32_t us);
+
+// `permille` = 500 for p50, 990 for p99. Returns 0 for an empty histogram.
+uint32_t latency_hist_percentile(const latency_hist_t *hist, uint32_t permille);
+void latency_hist_summary(const latency_hist_t *hist, latency_summary_t *summary);
+
+// Bucket helpers (exposed for tests)
+uint32_t latency_bucket_index(uint32_t us);
+uint32_t latency_bucket_upper_us(uint32_t index);
+
+
+// =============================
+// Pipeline Stages
+// =============================
+//
+// Every sample carries the esp_timer time (low 32 bits, in us) at which it was acquired. Each
+// stage records how long a sample or event took to get through that stage:
+//
+//      ACQ_QUEUE     acquired (adc_push_frame) -> picked up by the filtering task
+//      DSP           filtering task starts the block -> frame filtered + detect_events done
+//      BLINK_NOTIFY  blink detected -> blink notification handed to the BLE stack
+//      ATTN_NOTIFY   attention change posted -> attention notification handed to the BLE stack
+//      BLINK_E2E     triggering frame acquired -> blink notification handed to the BLE stack
+//      STREAM        frame acquired -> raw stream notification sent (oldest frame of each block)
+//      GATT_SEND     time spent inside esp_ble_gatts_send_indicate() (stack back-pressure)
+//
+// A slow attention update with a small DSP and large ATTN_NOTIFY / GATT_SEND points at the
+// BLE side; a large DSP or ACQ_QUEUE points at the filtering task.
+typedef enum {
+    LATENCY_STAGE_ACQ_QUEUE = 0,
+    LATENCY_STAGE_DSP,
+    LATENCY_STAGE_BLINK_NOTIFY,
+    LATENCY_STAGE_ATTN_NOTIFY,
+    LATENCY_STAGE_BLINK_E2E,
+    LATENCY_STAGE_STREAM,
+    LATENCY_STAGE_GATT_SEND,
+    LATENCY_STAGE_COUNT
+} latency_stage_t;
+
+extern latency_hist_t pipeline_latency[LATENCY_STAGE_COUNT];
+
+static inline void latency_record(latency_stage_t stage, uint32_t us) {
+    latency_hist_record(&pipeline_latency[stage], us);
+}
+
+const char *latency_stage_name(latency_stage_t stage);
+void latency_reset_all(void);
+
+extern const mem_budget_table_t latency_mem_budget;     // pipeline_latency (mem_budget.h)
+
+
+// =============================
+// Reports: GATT Stats Payload + Console Table
+// =============================
+//
+// Stats payload (little-endian), as read from the stats characteristic:
+//      [0]      format version (LATENCY_STATS_VERSION)
+//      [1]      stage count N
+//      [2 + 16 * i] stage i: count, p50_us, p99_us, max_us (uint32_t each), in latency_stage_t order
+#define LATENCY_STATS_VERSION     1
+#define LATENCY_STATS_STAGE_BYTES 16
+#define LATENCY_STATS_MAX_BYTES   (2 + LATENCY_STATS_STAGE_BYTES * LATENCY_STAGE_COUNT)
+
+// Returns bytes written (0 if `max` is too small)
+size_t latency_stats_pack(uint8_t *out, size_t max);
+
+// Human-readable table of every stage (console command)
+void latency_print(FILE *fp);
+
+
+#endif // LATENCY_HIST_H
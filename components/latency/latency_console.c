@@ -0,0 +1,44 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include <stdio.h>
+    #include <string.h>                 // For strcmp
+    #include "esp_console.h"            // Command registration
+    #include "latency_console.h"
+    #include "latency_hist.h"
+
+
+// =============================
+// Command Handler
+// =============================
+static int latency_cmd(int argc, char **argv) {
+
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        latency_reset_all();
+        printf("latency histograms cleared\n");
+        return 0;
+    }
+    if (argc > 1) {
+        printf("usage: latency [reset]\n");
+        return 1;
+    }
+
+    latency_print(stdout);
+    return 0;
+}
+
+
+// =============================
+// Registration
+// =============================
+esp_err_t latency_console_register(void) {
+
+    const esp_console_cmd_t cmd = {
+        .command = "latency",
+        .help = "Pipeline stage latencies (count, p50, p99, max in us). 'latency reset' clears them.",
+        .hint = "[reset]",
+        .func = latency_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
@@ -0,0 +1,173 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "latency_hist.h"
+
+
+// =============================
+// Pipeline Stage Histograms (Here, for Module Ownership)
+// =============================
+latency_hist_t pipeline_latency[LATENCY_STAGE_COUNT];   // Zero-initialized: empty histograms
+
+static const char *const stage_names[LATENCY_STAGE_COUNT] = {
+    [LATENCY_STAGE_ACQ_QUEUE]    = "acq_queue",
+    [LATENCY_STAGE_DSP]          = "dsp",
+    [LATENCY_STAGE_BLINK_NOTIFY] = "blink_notify",
+    [LATENCY_STAGE_ATTN_NOTIFY]  = "attn_notify",
+    [LATENCY_STAGE_BLINK_E2E]    = "blink_e2e",
+    [LATENCY_STAGE_STREAM]       = "stream",
+    [LATENCY_STAGE_GATT_SEND]    = "gatt_send",
+};
+
+static const mem_budget_item_t latency_mem_items[] = {
+    MEM_BUDGET_ITEM(pipeline_latency),
+};
+const mem_budget_table_t latency_mem_budget = MEM_BUDGET_TABLE("latency", latency_mem_items);
+
+const char *latency_stage_name(latency_stage_t stage) {
+    return stage < LATENCY_STAGE_COUNT ? stage_names[stage] : "?";
+}
+
+
+// =============================
+// Buckets: Value <-> Index
+// =============================
+uint32_t latency_bucket_index(uint32_t us) {
+
+    if (us < LATENCY_LINEAR_US) return us;
+
+    uint32_t octave = 31u - (uint32_t)__builtin_clz(us);            // >= 4
+    if (octave >= LATENCY_MAX_OCTAVE) return LATENCY_BUCKETS - 1;   // Overflow
+
+    uint32_t sub = (us >> (octave - LATENCY_SUB_BITS)) & ((1u << LATENCY_SUB_BITS) - 1);
+    return LATENCY_LINEAR_US + (octave - 4) * (1u << LATENCY_SUB_BITS) + sub;
+}
+
+uint32_t latency_bucket_upper_us(uint32_t index) {
+
+    if (index < LATENCY_LINEAR_US) return index;
+    if (index >= LATENCY_BUCKETS - 1) return UINT32_MAX;
+
+    uint32_t octave = 4 + (index - LATENCY_LINEAR_US) / (1u << LATENCY_SUB_BITS);
+    uint32_t sub = (index - LATENCY_LINEAR_US) % (1u << LATENCY_SUB_BITS);
+    uint32_t width = 1u << (octave - LATENCY_SUB_BITS);
+    return (((1u << LATENCY_SUB_BITS) + sub) << (octave - LATENCY_SUB_BITS)) + width - 1;
+}
+
+
+// =============================
+// Histogram: Reset + Record
+// =============================
+void latency_hist_reset(latency_hist_t *hist) {
+    for (uint32_t i = 0; i < LATENCY_BUCKETS; i++) {
+        atomic_store_explicit(&hist->buckets[i], 0, memory_order_relaxed);
+    }
+    atomic_store_explicit(&hist->count, 0, memory_order_relaxed);
+    atomic_store_explicit(&hist->max_us, 0, memory_order_relaxed);
+}
+
+void latency_hist_record(latency_hist_t *hist, uint32_t us) {
+
+    atomic_fetch_add_explicit(&hist->buckets[latency_bucket_index(us)], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&hist->count, 1, memory_order_relaxed);
+
+    // Max: retry only while our value is still larger (rarely more than one pass)
+    uint32_t seen = atomic_load_explicit(&hist->max_us, memory_order_relaxed);
+    while (us > seen &&
+           !atomic_compare_exchange_weak_explicit(&hist->max_us, &seen, us,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+
+// =============================
+// Histogram: Percentiles
+// =============================
+uint32_t latency_hist_percentile(const latency_hist_t *hist, uint32_t permille) {
+
+    // --- 1. Total from the buckets themselves (consistent with the walk below) ---
+    uint64_t total = 0;
+    for (uint32_t i = 0; i < LATENCY_BUCKETS; i++) {
+        total += atomic_load_explicit(&hist->buckets[i], memory_order_relaxed);
+    }
+    if (total == 0) return 0;
+
+    // --- 2. Walk to the bucket holding rank ceil(total * p) ---
+    uint64_t rank = (total * permille + 999) / 1000;
+    if (rank == 0) rank = 1;
+
+    uint32_t max_us = atomic_load_explicit(&hist->max_us, memory_order_relaxed);
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < LATENCY_BUCKETS; i++) {
+        seen += atomic_load_explicit(&hist->buckets[i], memory_order_relaxed);
+        if (seen >= rank) {
+            uint32_t upper = latency_bucket_upper_us(i);
+            return upper < max_us ? upper : max_us;
+        }
+    }
+    return max_us;   // Buckets grew during the walk
+}
+
+void latency_hist_summary(const latency_hist_t *hist, latency_summary_t *summary) {
+    summary->count = atomic_load_explicit(&hist->count, memory_order_relaxed);
+    summary->p50_us = latency_hist_percentile(hist, 500);
+    summary->p99_us = latency_hist_percentile(hist, 990);
+    summary->max_us = atomic_load_explicit(&hist->max_us, memory_order_relaxed);
+}
+
+
+// =============================
+// Pipeline Stages: Reset
+// =============================
+void latency_reset_all(void) {
+    for (int s = 0; s < LATENCY_STAGE_COUNT; s++) latency_hist_reset(&pipeline_latency[s]);
+}
+
+
+// =============================
+// Report: GATT Stats Payload
+// =============================
+static uint8_t *put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)((v >> 8) & 0xFF);
+    p[2] = (uint8_t)((v >> 16) & 0xFF);
+    p[3] = (uint8_t)((v >> 24) & 0xFF);
+    return p + 4;
+}
+
+size_t latency_stats_pack(uint8_t *out, size_t max) {
+
+    if (max < LATENCY_STATS_MAX_BYTES) return 0;
+
+    uint8_t *p = out;
+    *p++ = LATENCY_STATS_VERSION;
+    *p++ = LATENCY_STAGE_COUNT;
+
+    for (int s = 0; s < LATENCY_STAGE_COUNT; s++) {
+        latency_summary_t sum;
+        latency_hist_summary(&pipeline_latency[s], &sum);
+        p = put_u32(p, sum.count);
+        p = put_u32(p, sum.p50_us);
+        p = put_u32(p, sum.p99_us);
+        p = put_u32(p, sum.max_us);
+    }
+    return (size_t)(p - out);
+}
+
+
+// =============================
+// Report: Console Table
+// =============================
+void latency_print(FILE *fp) {
+
+    fprintf(fp, "%-14s %10s %10s %10s %10s\n", "stage", "count", "p50_us", "p99_us", "max_us");
+
+    for (int s = 0; s < LATENCY_STAGE_COUNT; s++) {
+        latency_summary_t sum;
+        latency_hist_summary(&pipeline_latency[s], &sum);
+        fprintf(fp, "%-14s %10lu %10lu %10lu %10lu\n", latency_stage_name((latency_stage_t)s),
+                (unsigned long)sum.count, (unsigned long)sum.p50_us,
+                (unsigned long)sum.p99_us, (unsigned long)sum.max_us);
+    }
+}
@@ -0,0 +1,129 @@
+// test_latency_hist.c - Unit tests for the lock-free latency histograms
+
+#include "unity.h"
+#include "latency_hist.h"        // Under test
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdio.h>               // For benchmark output
+
+
+// =============================
+// Test: Bucket Edges Stay Within 12.5%
+// =============================
+void test_latency_bucket_resolution(void) {
+
+    uint32_t prev = 0;
+    for (uint32_t us = 0; us < (1u << LATENCY_MAX_OCTAVE); us += 1 + us / 64) {
+
+        uint32_t idx = latency_bucket_index(us);
+        uint32_t upper = latency_bucket_upper_us(idx);
+
+        TEST_ASSERT_TRUE(idx < LATENCY_BUCKETS - 1);
+        TEST_ASSERT_TRUE(idx >= prev);                        // Monotonic
+        TEST_ASSERT_TRUE(upper >= us);                        // Value is inside its bucket
+        TEST_ASSERT_TRUE(upper - us <= us / 8);               // Exact below 16 us, <= 12.5% above
+        prev = idx;
+    }
+
+    // Overflow bucket
+    TEST_ASSERT_EQUAL_UINT32(LATENCY_BUCKETS - 1, latency_bucket_index(1u << LATENCY_MAX_OCTAVE));
+    TEST_ASSERT_EQUAL_UINT32(LATENCY_BUCKETS - 1, latency_bucket_index(UINT32_MAX));
+}
+
+
+// =============================
+// Test: p50 / p99 / max on a Known Distribution
+// =============================
+void test_latency_percentiles(void) {
+
+    static latency_hist_t hist;
+    latency_summary_t sum;
+
+    // --- Empty ---
+    latency_hist_reset(&hist);
+    latency_hist_summary(&hist, &sum);
+    TEST_ASSERT_EQUAL_UINT32(0, sum.count);
+    TEST_ASSERT_EQUAL_UINT32(0, sum.p50_us);
+    TEST_ASSERT_EQUAL_UINT32(0, sum.max_us);
+
+    // --- Uniform 1..1000 us ---
+    for (uint32_t us = 1; us <= 1000; us++) latency_hist_record(&hist, us);
+    latency_hist_summary(&hist, &sum);
+
+    TEST_ASSERT_EQUAL_UINT32(1000, sum.count);
+    TEST_ASSERT_EQUAL_UINT32(1000, sum.max_us);
+    TEST_ASSERT_TRUE(sum.p50_us >= 500 && sum.p50_us <= 500 + 500 / 8);
+    TEST_ASSERT_TRUE(sum.p99_us >= 990 && sum.p99_us <= 1000);   // Clamped to max
+
+    // --- One 10 s outlier: max is exact, p99 does not move ---
+    latency_hist_record(&hist, 10000000);
+    latency_hist_summary(&hist, &sum);
+    TEST_ASSERT_EQUAL_UINT32(10000000, sum.max_us);
+    TEST_ASSERT_TRUE(sum.p99_us <= 1000 + 1000 / 8);
+    TEST_ASSERT_EQUAL_UINT32(10000000, latency_hist_percentile(&hist, 1000));   // p100 = max
+}
+
+
+// =============================
+// Test: Concurrent Recorders Lose Nothing (Lock-Free)
+// =============================
+static latency_hist_t shared_hist;
+static volatile int recorders_done;
+
+static void recorder_task(void *arg) {
+    uint32_t base = (uint32_t)(uintptr_t)arg;
+    for (uint32_t i = 0; i < 20000; i++) latency_hist_record(&shared_hist, base + (i & 255));
+    recorders_done++;
+    vTaskDelete(NULL);
+}
+
+void test_latency_concurrent_record(void) {
+
+    latency_hist_reset(&shared_hist);
+    recorders_done = 0;
+
+    // Two producers at the same priority (on either core on a dual-core target)
+    xTaskCreate(recorder_task, "lat rec a", 2048, (void *)(uintptr_t)10, uxTaskPriorityGet(NULL), NULL);
+    xTaskCreate(recorder_task, "lat rec b", 2048, (void *)(uintptr_t)5000, uxTaskPriorityGet(NULL), NULL);
+    for (int wait = 0; wait < 500 && recorders_done < 2; wait++) vTaskDelay(pdMS_TO_TICKS(10));
+    TEST_ASSERT_EQUAL(2, recorders_done);
+
+    latency_summary_t sum;
+    latency_hist_summary(&shared_hist, &sum);
+    TEST_ASSERT_EQUAL_UINT32(40000, sum.count);
+    TEST_ASSERT_EQUAL_UINT32(5000 + 255, sum.max_us);
+
+    uint64_t total = 0;
+    for (int i = 0; i < LATENCY_BUCKETS; i++) total += shared_hist.buckets[i];
+    TEST_ASSERT_EQUAL_UINT32(40000, (uint32_t)total);
+}
+
+
+// =============================
+// Test: GATT Stats Payload Layout
+// =============================
+void test_latency_stats_pack(void) {
+
+    uint8_t buf[LATENCY_STATS_MAX_BYTES];
+
+    latency_reset_all();
+    for (int i = 0; i < 100; i++) latency_record(LATENCY_STAGE_DSP, 7);   // Exact bucket
+    latency_record(LATENCY_STAGE_DSP, 300);
+
+    TEST_ASSERT_EQUAL(0, latency_stats_pack(buf, sizeof(buf) - 1));       // Too small
+    TEST_ASSERT_EQUAL(LATENCY_STATS_MAX_BYTES, latency_stats_pack(buf, sizeof(buf)));
+
+    TEST_ASSERT_EQUAL_HEX8(LATENCY_STATS_VERSION, buf[0]);
+    TEST_ASSERT_EQUAL(LATENCY_STAGE_COUNT, buf[1]);
+
+    const uint8_t *dsp = &buf[2 + LATENCY_STATS_STAGE_BYTES * LATENCY_STAGE_DSP];
+    TEST_ASSERT_EQUAL_UINT32(101, dsp[0] | dsp[1] << 8 | dsp[2] << 16 | (uint32_t)dsp[3] << 24);   // count
+    TEST_ASSERT_EQUAL_UINT32(7, dsp[4] | dsp[5] << 8);                                              // p50
+    TEST_ASSERT_EQUAL_UINT32(300, dsp[12] | dsp[13] << 8);                                          // max
+
+    const uint8_t *acq = &buf[2 + LATENCY_STATS_STAGE_BYTES * LATENCY_STAGE_ACQ_QUEUE];
+    for (int i = 0; i < LATENCY_STATS_STAGE_BYTES; i++) TEST_ASSERT_EQUAL(0, acq[i]);            // Untouched stage
+
+    latency_print(stdout);
+    latency_reset_all();
+}
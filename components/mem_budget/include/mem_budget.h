@@ -0,0 +1,110 @@
+#ifndef MEM_BUDGET_H
+#define MEM_BUDGET_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdio.h>      // FILE (reports)
+
+
+// =============================
+// Static Footprint Tables
+// =============================
+//
+// Every module that owns static buffers publishes one table of them, built from sizeof() of the
+// objects themselves, so the figures follow the build configuration (channel count, rates,
+// backend) without anyone keeping numbers in sync:
+//
+//      static const mem_budget_item_t items[] = { MEM_BUDGET_ITEM(adc_buffer), ... };
+//      const mem_budget_table_t adc_mem_budget = MEM_BUDGET_TABLE("adc", items);
+//
+// Function-local statics are out of reach of sizeof() from file scope; list those with
+// MEM_BUDGET_BYTES and the expression that sizes them.
+typedef struct {
+    const char *name;
+    uint32_t    bytes;
+} mem_budget_item_t;
+
+typedef struct {
+    const char              *module;
+    const mem_budget_item_t *items;
+    uint8_t                  count;
+} mem_budget_table_t;
+
+#define MEM_BUDGET_ITEM(object)         { #object, (uint32_t)sizeof(object) }
+#define MEM_BUDGET_BYTES(name, bytes)   { name, (uint32_t)(bytes) }
+#define MEM_BUDGET_TABLE(module, items) { module, items, (uint8_t)(sizeof(items) / sizeof((items)[0])) }
+
+
+// =============================
+// Budget Limits
+// =============================
+//
+// The ESP32 has ~320 KB of internal DRAM for .data/.bss and the heap together, and Bluedroid
+// plus the BT controller take well over 100 KB of heap at init. The application keeps its own
+// static data under MEM_BUDGET_STATIC_LIMIT and wants MEM_BUDGET_HEAP_RESERVE of heap left
+// once everything has started (console, BLE connections, IDF drivers still allocate).
+#ifndef MEM_BUDGET_STATIC_LIMIT
+#define MEM_BUDGET_STATIC_LIMIT   (96 * 1024)
+#endif
+
+#ifndef MEM_BUDGET_HEAP_RESERVE
+#define MEM_BUDGET_HEAP_RESERVE   (32 * 1024)
+#endif
+
+#define MEM_BUDGET_MAX_TABLES     12
+#define MEM_BUDGET_MAX_MARKS      8
+
+
+// =============================
+// Heap Snapshots
+// =============================
+//
+// Internal 8-bit capable heap (what malloc hands out): free bytes, the lowest free figure since
+// boot, and the largest single free block. A large gap between free and largest block is
+// fragmentation: an allocation can fail with plenty of heap "free". `valid` is false on the
+// host build, which has no heap_caps.
+typedef struct {
+    const char *label;
+    bool        valid;
+    uint32_t    free_bytes;
+    uint32_t    min_free_bytes;
+    uint32_t    largest_block;
+} mem_budget_heap_t;
+
+
+// =============================
+// Memory Budget API
+// =============================
+uint32_t mem_budget_table_bytes(const mem_budget_table_t *table);
+
+// Adds a table to the report. Registering the same table twice is a no-op; false if the
+// registry is full.
+bool mem_budget_register(const mem_budget_table_t *table);
+void mem_budget_clear(void);                        // Drops every table and mark (tests)
+size_t mem_budget_table_count(void);
+uint32_t mem_budget_static_bytes(void);             // Sum over the registered tables
+
+// Current heap figures (label NULL). False on the host.
+bool mem_budget_heap_read(mem_budget_heap_t *heap);
+
+// Snapshot taken after a boot step: the report shows what each step took from the heap.
+// Marks past MEM_BUDGET_MAX_MARKS are dropped.
+void mem_budget_mark(const char *label);
+size_t mem_budget_mark_count(void);
+const mem_budget_heap_t *mem_budget_mark_get(size_t index);
+
+// True if the static data fits MEM_BUDGET_STATIC_LIMIT and (where the heap can be read) the
+// free heap is at least MEM_BUDGET_HEAP_RESERVE.
+bool mem_budget_check(void);
+
+// Per-module static footprint, then the boot marks and the current heap figures
+void mem_budget_print(FILE *fp);
+
+
+#endif // MEM_BUDGET_H
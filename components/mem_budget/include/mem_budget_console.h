@@ -0,0 +1,21 @@
+#ifndef MEM_BUDGET_CONSOLE_H
+#define MEM_BUDGET_CONSOLE_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include "esp_err.h"
+
+
+// =============================
+// Console Command: mem
+// =============================
+//
+//      mem    static footprint per module, heap per boot step, free heap / largest block and
+//             the stack high-water mark of every pipeline task (see mem_budget.h)
+esp_err_t mem_budget_console_register(void);
+
+
+#endif // MEM_BUDGET_CONSOLE_H
@@ -0,0 +1,136 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "mem_budget.h"
+    #include "sdkconfig.h"           // CONFIG_IDF_TARGET_LINUX
+#if !CONFIG_IDF_TARGET_LINUX
+    #include "esp_heap_caps.h"       // Free / minimum free / largest block
+#endif
+
+
+// =============================
+// Registry (Filled at Boot, Read by the Report)
+// =============================
+static const mem_budget_table_t *tables[MEM_BUDGET_MAX_TABLES];
+static size_t num_tables = 0;
+
+static mem_budget_heap_t marks[MEM_BUDGET_MAX_MARKS];
+static size_t num_marks = 0;
+
+uint32_t mem_budget_table_bytes(const mem_budget_table_t *table) {
+    uint32_t bytes = 0;
+    for (uint8_t i = 0; i < table->count; i++) bytes += table->items[i].bytes;
+    return bytes;
+}
+
+bool mem_budget_register(const mem_budget_table_t *table) {
+
+    for (size_t t = 0; t < num_tables; t++) {
+        if (tables[t] == table) return true;
+    }
+    if (num_tables >= MEM_BUDGET_MAX_TABLES) return false;
+
+    tables[num_tables++] = table;
+    return true;
+}
+
+void mem_budget_clear(void) {
+    num_tables = 0;
+    num_marks = 0;
+}
+
+size_t mem_budget_table_count(void) {
+    return num_tables;
+}
+
+uint32_t mem_budget_static_bytes(void) {
+    uint32_t bytes = 0;
+    for (size_t t = 0; t < num_tables; t++) bytes += mem_budget_table_bytes(tables[t]);
+    return bytes;
+}
+
+
+// =============================
+// Heap Snapshots
+// =============================
+bool mem_budget_heap_read(mem_budget_heap_t *heap) {
+
+    *heap = (mem_budget_heap_t){ 0 };
+#if CONFIG_IDF_TARGET_LINUX
+    return false;
+#else
+    heap->valid = true;
+    heap->free_bytes = (uint32_t)heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    heap->min_free_bytes = (uint32_t)heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+    heap->largest_block = (uint32_t)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    return true;
+#endif
+}
+
+void mem_budget_mark(const char *label) {
+
+    if (num_marks >= MEM_BUDGET_MAX_MARKS) return;
+
+    mem_budget_heap_read(&marks[num_marks]);
+    marks[num_marks].label = label;
+    num_marks++;
+}
+
+size_t mem_budget_mark_count(void) {
+    return num_marks;
+}
+
+const mem_budget_heap_t *mem_budget_mark_get(size_t index) {
+    return index < num_marks ? &marks[index] : NULL;
+}
+
+
+// =============================
+// Check + Report
+// =============================
+bool mem_budget_check(void) {
+
+    if (mem_budget_static_bytes() > MEM_BUDGET_STATIC_LIMIT) return false;
+
+    mem_budget_heap_t heap;
+    if (mem_budget_heap_read(&heap) && heap.free_bytes < MEM_BUDGET_HEAP_RESERVE) return false;
+    return true;
+}
+
+void mem_budget_print(FILE *fp) {
+
+    uint32_t total = mem_budget_static_bytes();
+
+    fprintf(fp, "%-12s %-26s %8s\n", "module", "static", "bytes");
+    for (size_t t = 0; t < num_tables; t++) {
+        const mem_budget_table_t *table = tables[t];
+        for (uint8_t i = 0; i < table->count; i++) {
+            fprintf(fp, "%-12s %-26s %8lu\n", i == 0 ? table->module : "", table->items[i].name,
+                    (unsigned long)table->items[i].bytes);
+        }
+        fprintf(fp, "%-12s %-26s %8lu\n", "", "(module total)", (unsigned long)mem_budget_table_bytes(table));
+    }
+    fprintf(fp, "static total: %lu of %lu bytes (%s)\n", (unsigned long)total,
+            (unsigned long)MEM_BUDGET_STATIC_LIMIT, total <= MEM_BUDGET_STATIC_LIMIT ? "ok" : "OVER");
+
+    // Boot steps: what each one took from the heap (previous mark -> this one)
+    if (num_marks > 0 && marks[0].valid) {
+        fprintf(fp, "%-12s %9s %9s %9s %9s\n", "heap after", "free", "used", "min_free", "largest");
+        for (size_t m = 0; m < num_marks; m++) {
+            long used = m > 0 ? (long)marks[m - 1].free_bytes - (long)marks[m].free_bytes : 0;
+            fprintf(fp, "%-12s %9lu %9ld %9lu %9lu\n", marks[m].label, (unsigned long)marks[m].free_bytes, used,
+                    (unsigned long)marks[m].min_free_bytes, (unsigned long)marks[m].largest_block);
+        }
+    }
+
+    mem_budget_heap_t now;
+    if (mem_budget_heap_read(&now)) {
+        fprintf(fp, "heap now: %lu free (reserve %lu: %s), %lu min free, %lu largest block\n",
+                (unsigned long)now.free_bytes, (unsigned long)MEM_BUDGET_HEAP_RESERVE,
+                now.free_bytes >= MEM_BUDGET_HEAP_RESERVE ? "ok" : "LOW",
+                (unsigned long)now.min_free_bytes, (unsigned long)now.largest_block);
+    } else {
+        fprintf(fp, "heap: n/a on this build\n");
+    }
+}
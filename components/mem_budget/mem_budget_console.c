@@ -0,0 +1,40 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include <stdio.h>
+    #include "esp_console.h"            // Command registration
+    #include "mem_budget_console.h"
+    #include "mem_budget.h"
+    #include "task_layout.h"            // Stack high-water marks of the pipeline tasks
+
+
+// =============================
+// Command Handler
+// =============================
+static int mem_cmd(int argc, char **argv) {
+
+    if (argc > 1) {
+        printf("usage: mem\n");
+        return 1;
+    }
+
+    mem_budget_print(stdout);
+    task_layout_print(stdout);
+    return 0;
+}
+
+
+// =============================
+// Registration
+// =============================
+esp_err_t mem_budget_console_register(void) {
+
+    const esp_console_cmd_t cmd = {
+        .command = "mem",
+        .help = "Memory budget: static bytes per module, heap per boot step, largest free block, task stacks.",
+        .hint = NULL,
+        .func = mem_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
@@ -0,0 +1,117 @@
+// test_mem_budget.c - Unit tests for the static footprint tables and the memory budget
+
+#include "unity.h"
+#include "mem_budget.h"          // Under test
+#include "adc.h"                 // adc_mem_budget, adc_graph (arena)
+#include "latency_hist.h"        // latency_mem_budget
+#include "recorder.h"            // recorder_mem_budget
+#include "task_layout.h"         // task_layout_mem_budget, TASK_STACK_*
+#include <stdio.h>               // For the report
+#include <string.h>              // For strcmp
+
+
+// =============================
+// Helper: One Item of a Table by Name
+// =============================
+static const mem_budget_item_t *find_item(const mem_budget_table_t *table, const char *name) {
+    for (uint8_t i = 0; i < table->count; i++) {
+        if (strcmp(table->items[i].name, name) == 0) return &table->items[i];
+    }
+    return NULL;
+}
+
+
+// =============================
+// Test: Tables, Registry, Marks
+// =============================
+void test_mem_budget_registry(void) {
+
+    static int32_t words[10];
+    static const mem_budget_item_t items[] = {
+        MEM_BUDGET_ITEM(words),
+        MEM_BUDGET_BYTES("block", 3 * 64),
+    };
+    static const mem_budget_table_t table = MEM_BUDGET_TABLE("test", items);
+
+    TEST_ASSERT_EQUAL_UINT8(2, table.count);
+    TEST_ASSERT_EQUAL_STRING("words", table.items[0].name);
+    TEST_ASSERT_EQUAL_UINT32(40 + 192, mem_budget_table_bytes(&table));
+
+    mem_budget_clear();
+    TEST_ASSERT_EQUAL_UINT32(0, mem_budget_static_bytes());
+
+    TEST_ASSERT_TRUE(mem_budget_register(&table));
+    TEST_ASSERT_TRUE(mem_budget_register(&table));                    // Twice: counted once
+    TEST_ASSERT_EQUAL(1, mem_budget_table_count());
+    TEST_ASSERT_EQUAL_UINT32(232, mem_budget_static_bytes());
+
+    // A full registry refuses more (distinct tables, same items)
+    static mem_budget_table_t extra[MEM_BUDGET_MAX_TABLES];
+    for (size_t i = 0; i < MEM_BUDGET_MAX_TABLES; i++) extra[i] = table;
+    for (size_t i = 0; i < MEM_BUDGET_MAX_TABLES - 1; i++) TEST_ASSERT_TRUE(mem_budget_register(&extra[i]));
+    TEST_ASSERT_FALSE(mem_budget_register(&extra[MEM_BUDGET_MAX_TABLES - 1]));
+    TEST_ASSERT_EQUAL_UINT32(232 * MEM_BUDGET_MAX_TABLES, mem_budget_static_bytes());
+
+    // Marks are kept in order and capped; the host build has no heap figures
+    for (int m = 0; m < MEM_BUDGET_MAX_MARKS + 2; m++) mem_budget_mark("step");
+    TEST_ASSERT_EQUAL(MEM_BUDGET_MAX_MARKS, mem_budget_mark_count());
+    TEST_ASSERT_EQUAL_STRING("step", mem_budget_mark_get(0)->label);
+    TEST_ASSERT_NULL(mem_budget_mark_get(MEM_BUDGET_MAX_MARKS));
+
+    mem_budget_heap_t heap;
+    TEST_ASSERT_FALSE(mem_budget_heap_read(&heap));
+    TEST_ASSERT_FALSE(heap.valid);
+    TEST_ASSERT_TRUE(mem_budget_check());
+
+    mem_budget_clear();
+    TEST_ASSERT_EQUAL(0, mem_budget_table_count());
+    TEST_ASSERT_EQUAL(0, mem_budget_mark_count());
+}
+
+
+// =============================
+// Test: The Application Fits Its Static Budget
+// =============================
+// Same tables app_main registers (minus the device-only driver / BLE ones, a few KB), at this
+// build's channel count. Task stacks are counted as in the static build whatever this build
+// uses, so the zero-heap configuration is what has to fit.
+void test_mem_budget_fits_static_limit(void) {
+
+    mem_budget_clear();
+    TEST_ASSERT_TRUE(mem_budget_register(&adc_mem_budget));
+    TEST_ASSERT_TRUE(mem_budget_register(&latency_mem_budget));
+    TEST_ASSERT_TRUE(mem_budget_register(&recorder_mem_budget));
+    TEST_ASSERT_TRUE(mem_budget_register(&task_layout_mem_budget));
+
+    // The tables are sizeof() of the real objects
+    TEST_ASSERT_EQUAL_UINT32(sizeof(adc_buffer), find_item(&adc_mem_budget, "adc_buffer")->bytes);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(pipeline_latency), find_item(&latency_mem_budget, "pipeline_latency")->bytes);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(recorder), find_item(&recorder_mem_budget, "recorder")->bytes);
+
+    // The graph arena is exactly what the stages take
+    const mem_budget_item_t *arena = find_item(&adc_mem_budget, "adc_graph_arena");
+    TEST_ASSERT_NOT_NULL(arena);
+    TEST_ASSERT_EQUAL_UINT32(ADC_GRAPH_ARENA_BYTES, arena->bytes);
+    adc_pipeline_init();
+    TEST_ASSERT_EQUAL_UINT32(arena->bytes, adc_graph.arena_used);
+
+    uint32_t stacks = TASK_STACK_SAMPLING + TASK_STACK_FILTERING + TASK_STACK_BLE_NOTIFY +
+                      TASK_STACK_BLE_STREAM + TASK_STACK_RECORDER;
+#if TASK_LAYOUT_STATIC
+    TEST_ASSERT_NOT_NULL(find_item(&task_layout_mem_budget, "stack_ble_notify"));
+    uint32_t total = mem_budget_static_bytes();
+#else
+    uint32_t total = mem_budget_static_bytes() + stacks;
+#endif
+    TEST_ASSERT_TRUE(total >= stacks);
+
+    printf("\n--- memory budget (%d ch, %d Hz) ---\n", ADC_NUM_CHANNELS, ADC_PIPELINE_RATE_HZ);
+    mem_budget_print(stdout);
+    printf("static total with static task stacks: %lu of %lu bytes\n",
+           (unsigned long)total, (unsigned long)MEM_BUDGET_STATIC_LIMIT);
+
+    TEST_ASSERT_TRUE(total <= MEM_BUDGET_STATIC_LIMIT);
+    TEST_ASSERT_TRUE(mem_budget_check());
+
+    mem_budget_clear();
+}
@@ -0,0 +1,120 @@
+#ifndef POWER_H
+#define POWER_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stdbool.h>
+    #include <stdio.h>                  // FILE (report)
+    #include "esp_err.h"
+    #include "esp_timer.h"              // Busy-time stamps
+
+    /* --- Task Roles --- */
+    #include "task_layout.h"            // task_role_t, task_role_name
+    #include "mem_budget.h"             // Static footprint table
+
+
+// =============================
+// Demand: Who Consumes the Pipeline
+// =============================
+//
+// The pipeline only does the work somebody reads. Consumers announce themselves with
+// power_demand_set(); the tasks look at power_demand() / power_mode() and scale down:
+//
+//      POWER_DEMAND_LINK      a BLE central subscribed to blink / attention (CCCD): events
+//      POWER_DEMAND_RECORD    a recorder session is running: raw frames + events
+//      POWER_DEMAND_SPECTRAL  something reads eeg_bands (console, host runner): spectral stage
+//      POWER_DEMAND_STREAM    a BLE central subscribed to the raw stream (CCCD): publish stage
+//
+// With no demand at all the device is in standby: the sampler stops converting, and the
+// sampling, filtering and idle tasks only poll the demand every POWER_IDLE_POLL_MS instead of
+// every few ms.
+// The graph is rebuilt when demand returns.
+//
+// The mask is written from any task (GATT callback, recorder, console) inside a short
+// critical section that also keeps the standby statistics; readers only load it.
+// power_generation() changes on every update, so a task can check for news with one load per
+// pass.
+#define POWER_DEMAND_LINK      (1u << 0)
+#define POWER_DEMAND_RECORD    (1u << 1)
+#define POWER_DEMAND_SPECTRAL  (1u << 2)
+#define POWER_DEMAND_STREAM    (1u << 3)
+
+#define POWER_IDLE_POLL_MS     100       // Poll period of tasks with nothing to do (standby / no client)
+
+typedef enum {
+    POWER_MODE_ACTIVE = 0,
+    POWER_MODE_STANDBY,
+} power_mode_t;
+
+void         power_demand_set(uint32_t bits, bool on);
+uint32_t     power_demand(void);
+power_mode_t power_mode(void);          // STANDBY when nothing is demanded
+uint32_t     power_generation(void);    // +1 on every demand change
+
+
+// =============================
+// Duty Cycle per Task
+// =============================
+//
+// Each pipeline task brackets the work of one wake-up:
+//
+//      uint32_t t0 = power_busy_begin();
+//      ... work ...
+//      power_busy_end(TASK_ROLE_FILTERING, t0);
+//
+// so busy time / elapsed time is the share of the CPU the task keeps awake, on the target and in
+// the host runner alike (there the elapsed time is the simulated EEG duration). Blocking waits
+// stay outside the bracket. Counters are written by their own task only and read without a
+// lock; a report may see one wake-up half-counted.
+typedef struct {
+    uint64_t busy_us;                   // Total inside the brackets since power_duty_reset()
+    uint32_t wakeups;                   // Brackets closed
+    uint32_t max_busy_us;               // Longest single wake-up
+} power_duty_t;
+
+typedef struct {
+    uint32_t mode_switches;             // ACTIVE <-> STANDBY transitions
+    uint64_t standby_us;                // Time spent in standby (completed periods + the current one)
+} power_stats_t;
+
+static inline uint32_t power_busy_begin(void) { return (uint32_t)esp_timer_get_time(); }
+void power_busy_end(task_role_t role, uint32_t start_us);
+
+const power_duty_t *power_duty_get(task_role_t role);
+float    power_duty_percent(task_role_t role, uint64_t window_us);   // Busy share of `window_us`
+uint64_t power_duty_window_us(void);   // Time since power_duty_reset() (or boot)
+void     power_duty_reset(void);
+
+void power_stats_get(power_stats_t *stats);
+
+// Mode, demand, standby time, then one line per task: wake-ups, busy time, duty over
+// `window_us` (0 = since the last reset), longest wake-up
+void power_print(FILE *fp, uint64_t window_us);
+
+
+// =============================
+// Light Sleep + Frequency Scaling (Target)
+// =============================
+// Configures esp_pm: the CPU runs at CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ while a PM lock asks for it
+// and drops to POWER_MIN_FREQ_MHZ otherwise; with tickless idle the chip light-sleeps when every
+// task is blocked and no driver holds a lock. ESP_ERR_NOT_SUPPORTED on the host or without
+// CONFIG_PM_ENABLE. See the README for which drivers keep it awake.
+#define POWER_MIN_FREQ_MHZ     40
+#ifndef POWER_LIGHT_SLEEP
+#define POWER_LIGHT_SLEEP      1
+#endif
+
+esp_err_t power_pm_init(void);
+
+
+// =============================
+// Static Footprint (mem_budget.h)
+// =============================
+extern const mem_budget_table_t power_mem_budget;      // Duty counters
+
+
+#endif // POWER_H
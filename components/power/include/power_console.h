@@ -0,0 +1,22 @@
+#ifndef POWER_CONSOLE_H
+#define POWER_CONSOLE_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include "esp_err.h"
+
+
+// =============================
+// Console Command: power
+// =============================
+//
+//      power                  mode, demand, standby time and CPU duty per task since the last reset
+//      power reset            restart the duty window
+//      power spectral on|off  add / remove the spectral demand (the console reading eeg_bands)
+esp_err_t power_console_register(void);
+
+
+#endif // POWER_CONSOLE_H
@@ -0,0 +1,171 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "power.h"
+    #include <stdatomic.h>           // Demand mask + generation (read lock-free every pass)
+    #include "freertos/FreeRTOS.h"   // portMUX: demand changes + standby bookkeeping
+    #include "sdkconfig.h"           // CONFIG_IDF_TARGET_LINUX, CONFIG_PM_ENABLE
+#if !CONFIG_IDF_TARGET_LINUX && CONFIG_PM_ENABLE
+    #include "esp_pm.h"              // Frequency scaling + automatic light sleep
+#endif
+
+
+// =============================
+// Demand + Mode
+// =============================
+static _Atomic uint32_t demand = 0;
+static _Atomic uint32_t generation = 0;
+
+// Standby accounting, updated by whichever caller flips the mode (power_demand_set). Callers
+// sit on different tasks and cores (console, recorder, GATT callback), so the mask change and
+// the bookkeeping happen together under power_lock; the hot-path readers only load the atomics.
+static portMUX_TYPE power_lock = portMUX_INITIALIZER_UNLOCKED;
+static power_stats_t stats = { 0 };
+static int64_t standby_since_us = 0;         // Boot: nothing is demanded yet
+
+static power_mode_t mode_of(uint32_t mask) {
+    return mask ? POWER_MODE_ACTIVE : POWER_MODE_STANDBY;
+}
+
+void power_demand_set(uint32_t bits, bool on) {
+
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&power_lock);
+    uint32_t before = atomic_load(&demand);
+    uint32_t after = on ? (before | bits) : (before & ~bits);
+    if (after != before) {
+        atomic_store(&demand, after);
+        if (mode_of(before) != mode_of(after)) {
+            if (mode_of(after) == POWER_MODE_STANDBY) {
+                standby_since_us = now;
+            } else {
+                stats.standby_us += (uint64_t)(now - standby_since_us);
+            }
+            stats.mode_switches++;
+        }
+        atomic_fetch_add(&generation, 1);
+    }
+    portEXIT_CRITICAL(&power_lock);
+}
+
+uint32_t power_demand(void) {
+    return atomic_load(&demand);
+}
+
+power_mode_t power_mode(void) {
+    return mode_of(atomic_load(&demand));
+}
+
+uint32_t power_generation(void) {
+    return atomic_load(&generation);
+}
+
+void power_stats_get(power_stats_t *out) {
+
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&power_lock);
+    *out = stats;
+    if (power_mode() == POWER_MODE_STANDBY) out->standby_us += (uint64_t)(now - standby_since_us);
+    portEXIT_CRITICAL(&power_lock);
+}
+
+
+// =============================
+// Duty Cycle per Task
+// =============================
+static power_duty_t duty[TASK_ROLE_COUNT];
+static int64_t duty_since_us = 0;
+
+void power_busy_end(task_role_t role, uint32_t start_us) {
+
+    if (role >= TASK_ROLE_COUNT) return;
+
+    uint32_t busy = (uint32_t)esp_timer_get_time() - start_us;     // Wrap-safe
+    power_duty_t *d = &duty[role];
+    d->busy_us += busy;
+    d->wakeups++;
+    if (busy > d->max_busy_us) d->max_busy_us = busy;
+}
+
+const power_duty_t *power_duty_get(task_role_t role) {
+    return role < TASK_ROLE_COUNT ? &duty[role] : NULL;
+}
+
+float power_duty_percent(task_role_t role, uint64_t window_us) {
+    if (role >= TASK_ROLE_COUNT || window_us == 0) return 0.0f;
+    return (float)(100.0 * (double)duty[role].busy_us / (double)window_us);
+}
+
+uint64_t power_duty_window_us(void) {
+    return (uint64_t)(esp_timer_get_time() - duty_since_us);
+}
+
+void power_duty_reset(void) {
+
+    for (int r = 0; r < TASK_ROLE_COUNT; r++) duty[r] = (power_duty_t){ 0 };
+    duty_since_us = esp_timer_get_time();
+
+    portENTER_CRITICAL(&power_lock);
+    stats = (power_stats_t){ 0 };
+    standby_since_us = duty_since_us;            // A standby period in progress counts from here
+    portEXIT_CRITICAL(&power_lock);
+}
+
+
+// =============================
+// Report
+// =============================
+void power_print(FILE *fp, uint64_t window_us) {
+
+    if (window_us == 0) window_us = power_duty_window_us();
+
+    power_stats_t st;
+    power_stats_get(&st);
+    uint32_t mask = power_demand();
+
+    fprintf(fp, "mode: %s, demand:%s%s%s%s%s, standby %.1f s over %u switch(es)\n",
+            power_mode() == POWER_MODE_ACTIVE ? "active" : "standby",
+            mask & POWER_DEMAND_LINK ? " link" : "", mask & POWER_DEMAND_STREAM ? " stream" : "",
+            mask & POWER_DEMAND_RECORD ? " record" : "", mask & POWER_DEMAND_SPECTRAL ? " spectral" : "",
+            mask ? "" : " none",
+            st.standby_us * 1e-6, (unsigned)st.mode_switches);
+
+    fprintf(fp, "%-18s %10s %12s %9s %10s\n", "task", "wakeups", "busy_ms", "duty", "max_us");
+    for (int r = 0; r < TASK_ROLE_COUNT; r++) {
+        const power_duty_t *d = &duty[r];
+        fprintf(fp, "%-18s %10lu %12.1f %8.3f%% %10lu\n", task_role_name((task_role_t)r), (unsigned long)d->wakeups,
+                d->busy_us * 1e-3, (double)power_duty_percent((task_role_t)r, window_us),
+                (unsigned long)d->max_busy_us);
+    }
+    fprintf(fp, "window: %.1f s\n", window_us * 1e-6);
+}
+
+
+// =============================
+// Light Sleep + Frequency Scaling
+// =============================
+esp_err_t power_pm_init(void) {
+#if !CONFIG_IDF_TARGET_LINUX && CONFIG_PM_ENABLE
+    esp_pm_config_t cfg = {
+        .max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+        .min_freq_mhz = POWER_MIN_FREQ_MHZ,
+        .light_sleep_enable = POWER_LIGHT_SLEEP,
+    };
+    return esp_pm_configure(&cfg);
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+
+// =============================
+// Static Footprint (mem_budget.h)
+// =============================
+static const mem_budget_item_t power_mem_items[] = {
+    MEM_BUDGET_ITEM(duty),
+    MEM_BUDGET_ITEM(stats),
+};
+const mem_budget_table_t power_mem_budget = MEM_BUDGET_TABLE("power", power_mem_items);
@@ -0,0 +1,54 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include <stdio.h>
+    #include <string.h>                 // For strcmp
+    #include "esp_console.h"            // Command registration
+    #include "power_console.h"
+    #include "power.h"
+
+
+// =============================
+// Command Handler
+// =============================
+static int power_cmd(int argc, char **argv) {
+
+    if (argc == 2 && strcmp(argv[1], "reset") == 0) {
+        power_duty_reset();
+        printf("duty counters cleared\n");
+        return 0;
+    }
+    if (argc == 3 && strcmp(argv[1], "spectral") == 0) {
+        bool on = strcmp(argv[2], "on") == 0;
+        if (!on && strcmp(argv[2], "off") != 0) {
+            printf("usage: power spectral on|off\n");
+            return 1;
+        }
+        power_demand_set(POWER_DEMAND_SPECTRAL, on);
+        printf("spectral stage %s\n", on ? "on" : "off");
+        return 0;
+    }
+    if (argc > 1) {
+        printf("usage: power [reset|spectral on|off]\n");
+        return 1;
+    }
+
+    power_print(stdout, 0);
+    return 0;
+}
+
+
+// =============================
+// Registration
+// =============================
+esp_err_t power_console_register(void) {
+
+    const esp_console_cmd_t cmd = {
+        .command = "power",
+        .help = "Power mode, consumer demand and CPU duty cycle per task. 'power spectral on' enables band power.",
+        .hint = "[reset|spectral on|off]",
+        .func = power_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
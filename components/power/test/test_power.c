@@ -0,0 +1,85 @@
+// test_power.c - Unit tests for consumer demand and per-task duty accounting
+
+#include "unity.h"
+#include "power.h"               // Under test
+
+
+// Spins for `us` so the duty brackets have something to measure
+static void spin_us(int64_t us) {
+    int64_t end = esp_timer_get_time() + us;
+    while (esp_timer_get_time() < end) { }
+}
+
+
+// =============================
+// Test: Demand Bits -> Mode, Generation, Standby Time
+// =============================
+void test_power_demand_and_mode(void) {
+
+    uint32_t saved = power_demand();
+    power_demand_set(saved, false);
+    power_duty_reset();
+
+    TEST_ASSERT_EQUAL(POWER_MODE_STANDBY, power_mode());
+    uint32_t gen = power_generation();
+
+    // Setting a bit already set is not news
+    power_demand_set(POWER_DEMAND_LINK, true);
+    TEST_ASSERT_EQUAL(POWER_MODE_ACTIVE, power_mode());
+    TEST_ASSERT_EQUAL_UINT32(gen + 1, power_generation());
+    power_demand_set(POWER_DEMAND_LINK, true);
+    TEST_ASSERT_EQUAL_UINT32(gen + 1, power_generation());
+
+    // A second consumer keeps the pipeline up when the first leaves
+    power_demand_set(POWER_DEMAND_RECORD, true);
+    power_demand_set(POWER_DEMAND_LINK, false);
+    TEST_ASSERT_EQUAL(POWER_MODE_ACTIVE, power_mode());
+    TEST_ASSERT_EQUAL_UINT32(POWER_DEMAND_RECORD, power_demand());
+
+    power_demand_set(POWER_DEMAND_RECORD, false);
+    TEST_ASSERT_EQUAL(POWER_MODE_STANDBY, power_mode());
+    TEST_ASSERT_EQUAL_UINT32(gen + 4, power_generation());
+
+    // Two switches (standby -> active -> standby); the current standby period counts as it runs
+    spin_us(2000);
+    power_stats_t st;
+    power_stats_get(&st);
+    TEST_ASSERT_EQUAL_UINT32(2, st.mode_switches);
+    TEST_ASSERT_TRUE(st.standby_us >= 2000);
+
+    power_demand_set(saved, true);
+}
+
+
+// =============================
+// Test: Busy Brackets Add Up per Role
+// =============================
+void test_power_duty_accounting(void) {
+
+    power_duty_reset();
+
+    for (int i = 0; i < 3; i++) {
+        uint32_t t0 = power_busy_begin();
+        spin_us(1000);
+        power_busy_end(TASK_ROLE_FILTERING, t0);
+    }
+    uint32_t t0 = power_busy_begin();
+    power_busy_end(TASK_ROLE_BLE_NOTIFY, t0);
+    power_busy_end(TASK_ROLE_COUNT, t0);                // Out of range: ignored
+
+    const power_duty_t *f = power_duty_get(TASK_ROLE_FILTERING);
+    TEST_ASSERT_EQUAL_UINT32(3, f->wakeups);
+    TEST_ASSERT_TRUE(f->busy_us >= 3000);
+    TEST_ASSERT_TRUE(f->max_busy_us >= 1000 && f->max_busy_us <= f->busy_us);
+    TEST_ASSERT_EQUAL_UINT32(1, power_duty_get(TASK_ROLE_BLE_NOTIFY)->wakeups);
+    TEST_ASSERT_EQUAL_UINT32(0, power_duty_get(TASK_ROLE_SAMPLING)->wakeups);
+    TEST_ASSERT_NULL(power_duty_get(TASK_ROLE_COUNT));
+
+    // Duty over an explicit window, and over the time since the reset (all of it spinning)
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 100.0f * f->busy_us / 1e6f, power_duty_percent(TASK_ROLE_FILTERING, 1000000));
+    TEST_ASSERT_TRUE(power_duty_window_us() >= f->busy_us);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, power_duty_percent(TASK_ROLE_FILTERING, 0));
+
+    power_duty_reset();
+    TEST_ASSERT_EQUAL_UINT32(0, power_duty_get(TASK_ROLE_FILTERING)->wakeups);
+}
@@ -0,0 +1,111 @@
+#ifndef REC_STORAGE_H
+#define REC_STORAGE_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdio.h>                    // FILE (file backend)
+    #include "esp_err.h"
+    #include "sdkconfig.h"                // CONFIG_IDF_TARGET_LINUX
+
+#if !CONFIG_IDF_TARGET_LINUX
+    /* --- Flash --- */
+    #include "esp_partition.h"            // Partition backend (device only)
+#endif
+
+
+// =============================
+// Storage Interface
+// =============================
+//
+// The recorder sees its storage as NOR flash: `size` bytes split into `erase_size` sectors.
+// Erasing sets a sector to 0xFF; a write can only clear bits, so each byte is written once per
+// erase. Every backend keeps those semantics, so host tests exercise the real flash behaviour:
+//
+//      partition : a data partition through esp_partition_*              (device only)
+//      file      : a plain file, erase = fill with 0xFF                   (host + device VFS)
+//      ram       : a caller-provided buffer                              (tests, benchmarks)
+//
+// Each backend embeds rec_storage_t as its first member (like adc_source_t), so a pointer to
+// it is a storage. Offsets and lengths of erase() must be sector-aligned.
+typedef struct rec_storage rec_storage_t;
+
+struct rec_storage {
+    const char *name;
+    uint32_t size;                  // Bytes (a whole number of sectors)
+    uint32_t erase_size;            // Sector size
+    uint32_t erases;                // Sectors erased through this handle
+    esp_err_t (*read)(rec_storage_t *st, uint32_t offset, void *buf, size_t len);
+    esp_err_t (*write)(rec_storage_t *st, uint32_t offset, const void *buf, size_t len);
+    esp_err_t (*erase)(rec_storage_t *st, uint32_t offset, size_t len);
+    void      (*close)(rec_storage_t *st);   // Optional
+};
+
+static inline esp_err_t rec_storage_read(rec_storage_t *st, uint32_t offset, void *buf, size_t len) {
+    return (offset + len <= st->size) ? st->read(st, offset, buf, len) : ESP_ERR_INVALID_SIZE;
+}
+
+static inline esp_err_t rec_storage_write(rec_storage_t *st, uint32_t offset, const void *buf, size_t len) {
+    return (offset + len <= st->size) ? st->write(st, offset, buf, len) : ESP_ERR_INVALID_SIZE;
+}
+
+static inline esp_err_t rec_storage_erase(rec_storage_t *st, uint32_t offset, size_t len) {
+    if (offset % st->erase_size || len % st->erase_size || offset + len > st->size) return ESP_ERR_INVALID_ARG;
+    esp_err_t err = st->erase(st, offset, len);
+    if (err == ESP_OK) st->erases += len / st->erase_size;
+    return err;
+}
+
+static inline void rec_storage_close(rec_storage_t *st) {
+    if (st->close) st->close(st);
+}
+
+
+// =============================
+// RAM Backend
+// =============================
+typedef struct {
+    rec_storage_t base;
+    uint8_t *mem;
+} rec_storage_ram_t;
+
+// `mem` must hold `size` bytes; it starts erased (all 0xFF)
+rec_storage_t *rec_storage_ram_init(rec_storage_ram_t *ram, uint8_t *mem, uint32_t size, uint32_t erase_size);
+
+
+// =============================
+// File Backend
+// =============================
+// The file is created (or extended) to `size` bytes of 0xFF; existing contents are kept, so a
+// second open "remounts" the same flash image.
+typedef struct {
+    rec_storage_t base;
+    FILE *fp;
+} rec_storage_file_t;
+
+// Returns NULL if the file cannot be opened
+rec_storage_t *rec_storage_file_open(rec_storage_file_t *file, const char *path, uint32_t size,
+                                     uint32_t erase_size);
+
+
+#if !CONFIG_IDF_TARGET_LINUX
+// =============================
+// Partition Backend (Device Only)
+// =============================
+// Looks up the data partition labelled `label` (partitions.csv). Writes go straight to flash;
+// the partition must not be encrypted (the recorder only ever writes whole sectors).
+typedef struct {
+    rec_storage_t base;
+    const esp_partition_t *part;
+} rec_storage_partition_t;
+
+// Returns NULL if there is no such partition
+rec_storage_t *rec_storage_partition_open(rec_storage_partition_t *p, const char *label);
+#endif
+
+
+#endif // REC_STORAGE_H
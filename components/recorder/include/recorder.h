@@ -0,0 +1,195 @@
+#ifndef RECORDER_H
+#define RECORDER_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include "esp_err.h"
+
+    /* --- Storage --- */
+    #include "rec_storage.h"              // Abstract NOR storage (partition / file / ram)
+    #include "eeg_codec.h"                // Lossless sample block codec
+
+    /* --- ADC --- */
+    #include "adc.h"                      // adc_ring_t staging, ADC_NUM_CHANNELS, ADC_EVENT_*
+
+
+// =============================
+// Application Log Tag
+// =============================
+#define REC_TAG "REC"
+
+
+// =============================
+// Log Layout (Append-Only Page Ring)
+// =============================
+//
+// The storage is a ring of RECORDER_PAGE_SIZE pages (one 4 KB flash sector each). A page is
+// filled in RAM and goes to flash as one aligned write right after its sector is erased, so
+// flash only ever sees whole-sector erase + write pairs:
+//
+//      [ page header | record | record | ... | 0xFF padding ]
+//
+// The header holds a sequence number that grows forever, the erase count of the sector, the
+// payload size, the record count and a CRC-32 of the payload. Records never straddle pages, so
+// each page decodes on its own and a torn write (power loss mid-page) costs only that page.
+//
+// Mount scans the headers: the highest valid sequence is the head and writing resumes on the
+// page after it. Wrapping overwrites the oldest page, so every sector is erased equally often.
+// The erase count travels in the header (wear stays visible across reboots), sectors that are
+// already blank are not erased again, and a page that fails read-back verification is skipped.
+#define RECORDER_PAGE_SIZE   4096
+#define RECORDER_MAGIC       0x52474545u      // "EEGR"
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint32_t seq;                 // Page sequence number (1, 2, ...)
+    uint32_t erase_count;         // Erases of this sector so far
+    uint16_t used;                // Payload bytes after the header
+    uint16_t records;
+    uint32_t crc;                 // CRC-32 of the payload
+} rec_page_header_t;
+
+#define RECORDER_PAGE_PAYLOAD  (RECORDER_PAGE_SIZE - sizeof(rec_page_header_t))
+
+
+// =============================
+// Records
+// =============================
+typedef enum {
+    REC_TYPE_SESSION = 1,         // rec_session_t: a new recording starts here
+    REC_TYPE_SAMPLES = 2,         // eeg_codec block of interleaved frames (stamp = first frame)
+    REC_TYPE_EVENT   = 3,         // rec_event_t: blink / attention as detected
+} rec_type_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t  type;                // rec_type_t
+    uint8_t  reserved;
+    uint16_t len;                 // Payload bytes
+    uint32_t stamp_us;            // Acquisition stamp (first frame of a sample block)
+} rec_header_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t session_id;          // Page sequence the session started on
+    uint32_t sample_rate_mhz;     // Nominal frame rate, milli-hertz
+    uint8_t  channels;
+    uint8_t  reserved[3];
+} rec_session_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t event;               // ADC_EVENT_*
+    uint32_t value;               // blink_count / attention_level at the time
+} rec_event_t;
+
+
+// =============================
+// Recorder State
+// =============================
+typedef struct {
+    uint32_t valid_pages;         // Pages holding data (after mount, kept up to date)
+    uint32_t corrupt_pages;       // Written but unreadable pages found at mount (torn writes)
+    uint32_t pages_written;
+    uint32_t erases;
+    uint32_t erases_skipped;      // Sector was already blank
+    uint32_t bad_pages;           // Failed read-back verification, skipped
+    uint32_t wraps;               // Times the ring went past its last page
+    uint32_t min_erase_count;     // Wear spread over the pages seen / written
+    uint32_t max_erase_count;
+    uint32_t records;
+    uint32_t frames_dropped;      // Staging overruns (the writer fell behind the pipeline)
+    uint32_t events_dropped;
+    uint64_t bytes_in;            // Raw sample bytes recorded
+    uint64_t bytes_out;           // Bytes written to storage (whole pages)
+} recorder_stats_t;
+
+typedef struct {
+    rec_storage_t *storage;
+    uint32_t num_pages;
+    uint32_t next_page;           // Page the buffer goes to
+    uint32_t next_seq;
+    size_t   fill;                // Bytes used in `page`, header included
+    uint16_t page_records;
+    uint16_t block_seq;           // eeg_codec block counter
+    recorder_stats_t stats;
+    uint8_t  page[RECORDER_PAGE_SIZE] __attribute__((aligned(4)));   // Write-ahead page buffer
+} recorder_t;
+
+// Called for every record by recorder_read(), oldest first
+typedef void (*rec_visit_fn)(const rec_header_t *hdr, const uint8_t *payload, void *ctx);
+
+
+// =============================
+// Recorder API (Log Core)
+// =============================
+// Scans `storage` and positions the writer after the newest page. ESP_ERR_INVALID_SIZE if it
+// holds fewer than two pages or its sectors do not divide RECORDER_PAGE_SIZE.
+esp_err_t recorder_mount(recorder_t *rec, rec_storage_t *storage);
+
+// Appends one record to the page buffer; full pages go to storage first.
+esp_err_t recorder_append(recorder_t *rec, rec_type_t type, uint32_t stamp_us, const void *payload, uint16_t len);
+esp_err_t recorder_append_samples(recorder_t *rec, const int16_t *frames, uint16_t num_frames, uint8_t channels,
+                                  uint32_t stamp_us);
+esp_err_t recorder_append_event(recorder_t *rec, uint32_t event, uint32_t value, uint32_t stamp_us);
+
+// Writes a partly filled page (the rest of its sector stays unused until the ring comes back).
+esp_err_t recorder_flush(recorder_t *rec);
+
+// Visits every record on storage, oldest page first; `scratch` holds RECORDER_PAGE_SIZE bytes.
+// Returns the number of records visited.
+size_t recorder_read(recorder_t *rec, uint8_t *scratch, rec_visit_fn visit, void *ctx);
+
+
+// =============================
+// Background Writer
+// =============================
+//
+// The pipeline never touches flash: the adc_tap_t hooks copy raw frames into a staging ring and
+// events into a small queue, then return. recorder_task drains them in RECORDER_BLOCK_FRAMES
+// blocks, compresses and appends. It is woken when a block is ready and at least every
+// RECORDER_WAKE_MS otherwise while a session runs. If it falls behind by more than RECORDER_STAGE_FRAMES the oldest
+// frames are dropped and counted.
+//
+// On the ESP32 a flash erase / write still pauses code running from flash on both cores while
+// it runs. The sample clock's alarm is IRAM-resident, so ticks are not lost (late samples show
+// up as jitter), and adc_ring buffers the pipeline behind the pause.
+#define RECORDER_PARTITION_LABEL  "eegrec"
+#define RECORDER_STAGE_FRAMES     512     // Power of two: 5 s @ 100 Hz of writer slack
+#define RECORDER_BLOCK_FRAMES     64      // Frames per compressed block
+#define RECORDER_EVENT_SLOTS      16      // Power of two
+#define RECORDER_WAKE_MS          1000
+
+extern recorder_t recorder;
+
+// Mounts `storage`, writes a session record and installs the adc tap. ESP_ERR_INVALID_STATE
+// while a session is already running.
+esp_err_t recorder_start(rec_storage_t *storage);
+
+// Removes the tap, writes what is staged and flushes the partial page. With recorder_task
+// running, the task does the writing and the caller blocks until it is done.
+esp_err_t recorder_stop(void);
+
+bool recorder_running(void);      // Between recorder_start() and recorder_stop()
+
+// Staged frames / events -> log. Run by recorder_task; callable directly when there is no task
+// (host runner). Returns the frames written.
+size_t recorder_drain(void);
+
+// adc_tap_t hooks (non-blocking)
+void recorder_tap_frames(const int16_t *frames, const uint32_t *stamps, size_t count);
+void recorder_tap_event(uint32_t event, uint32_t stamp_us, uint32_t value);
+
+// Writer state, staging ring and event queue, block buffer (mem_budget.h)
+extern const mem_budget_table_t recorder_mem_budget;
+
+// =============================
+// FreeRTOS Task: Recorder
+// =============================
+void recorder_task(void *arg);
+
+
+#endif // RECORDER_H
@@ -0,0 +1,26 @@
+#ifndef RECORDER_CONSOLE_H
+#define RECORDER_CONSOLE_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include "esp_err.h"
+    #include "rec_storage.h"
+
+
+// =============================
+// Console Command: rec
+// =============================
+//
+//      rec          whether a session runs, records / bytes / pages written, frames and events dropped
+//      rec start    start a session on `storage` (recording is a consumer: the pipeline leaves standby)
+//      rec stop     write what is staged, flush the page and end the session
+//
+// `storage` is what the sessions go to (main.c: the 'eegrec' partition); NULL if there is none,
+// in which case 'rec start' says so.
+esp_err_t recorder_console_register(rec_storage_t *storage);
+
+
+#endif // RECORDER_CONSOLE_H
@@ -0,0 +1,148 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "rec_storage.h"
+    #include <string.h>  // For memset / memcpy
+
+
+// =============================
+// RAM Backend
+// =============================
+static esp_err_t ram_read(rec_storage_t *st, uint32_t offset, void *buf, size_t len) {
+    memcpy(buf, ((rec_storage_ram_t *)st)->mem + offset, len);
+    return ESP_OK;
+}
+
+static esp_err_t ram_write(rec_storage_t *st, uint32_t offset, const void *buf, size_t len) {
+    uint8_t *dst = ((rec_storage_ram_t *)st)->mem + offset;
+    const uint8_t *src = buf;
+    for (size_t i = 0; i < len; i++) dst[i] &= src[i];          // NOR: bits only go 1 -> 0
+    return ESP_OK;
+}
+
+static esp_err_t ram_erase(rec_storage_t *st, uint32_t offset, size_t len) {
+    memset(((rec_storage_ram_t *)st)->mem + offset, 0xFF, len);
+    return ESP_OK;
+}
+
+rec_storage_t *rec_storage_ram_init(rec_storage_ram_t *ram, uint8_t *mem, uint32_t size, uint32_t erase_size) {
+
+    memset(ram, 0, sizeof(*ram));
+    memset(mem, 0xFF, size);
+    ram->mem = mem;
+
+    ram->base.name = "ram";
+    ram->base.size = size - size % erase_size;
+    ram->base.erase_size = erase_size;
+    ram->base.read = ram_read;
+    ram->base.write = ram_write;
+    ram->base.erase = ram_erase;
+    return &ram->base;
+}
+
+
+// =============================
+// File Backend
+// =============================
+static esp_err_t file_read(rec_storage_t *st, uint32_t offset, void *buf, size_t len) {
+    FILE *fp = ((rec_storage_file_t *)st)->fp;
+    if (fseek(fp, (long)offset, SEEK_SET) != 0 || fread(buf, 1, len, fp) != len) return ESP_FAIL;
+    return ESP_OK;
+}
+
+static esp_err_t file_write(rec_storage_t *st, uint32_t offset, const void *buf, size_t len) {
+
+    FILE *fp = ((rec_storage_file_t *)st)->fp;
+    const uint8_t *src = buf;
+    uint8_t chunk[256];
+
+    // NOR semantics: AND with what is there, so a write over unerased data shows up as corruption
+    for (size_t done = 0; done < len; ) {
+        size_t n = (len - done) < sizeof(chunk) ? (len - done) : sizeof(chunk);
+        if (fseek(fp, (long)(offset + done), SEEK_SET) != 0 || fread(chunk, 1, n, fp) != n) return ESP_FAIL;
+        for (size_t i = 0; i < n; i++) chunk[i] &= src[done + i];
+        if (fseek(fp, (long)(offset + done), SEEK_SET) != 0 || fwrite(chunk, 1, n, fp) != n) return ESP_FAIL;
+        done += n;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t file_erase(rec_storage_t *st, uint32_t offset, size_t len) {
+
+    FILE *fp = ((rec_storage_file_t *)st)->fp;
+    uint8_t blank[256];
+    memset(blank, 0xFF, sizeof(blank));
+
+    if (fseek(fp, (long)offset, SEEK_SET) != 0) return ESP_FAIL;
+    for (size_t done = 0; done < len; done += sizeof(blank)) {
+        size_t n = (len - done) < sizeof(blank) ? (len - done) : sizeof(blank);
+        if (fwrite(blank, 1, n, fp) != n) return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static void file_close(rec_storage_t *st) {
+    rec_storage_file_t *f = (rec_storage_file_t *)st;
+    if (f->fp) fclose(f->fp);
+    f->fp = NULL;
+}
+
+rec_storage_t *rec_storage_file_open(rec_storage_file_t *file, const char *path, uint32_t size,
+                                     uint32_t erase_size) {
+
+    memset(file, 0, sizeof(*file));
+
+    FILE *fp = fopen(path, "r+b");
+    if (!fp) fp = fopen(path, "w+b");
+    if (!fp) return NULL;
+
+    // Pad to `size` with erased bytes (fresh file or a smaller image from an earlier run)
+    fseek(fp, 0, SEEK_END);
+    long have = ftell(fp);
+    for (long i = have; i < (long)size; i++) fputc(0xFF, fp);
+    fflush(fp);
+
+    file->fp = fp;
+    file->base.name = "file";
+    file->base.size = size - size % erase_size;
+    file->base.erase_size = erase_size;
+    file->base.read = file_read;
+    file->base.write = file_write;
+    file->base.erase = file_erase;
+    file->base.close = file_close;
+    return &file->base;
+}
+
+
+#if !CONFIG_IDF_TARGET_LINUX
+// =============================
+// Partition Backend (Device Only)
+// =============================
+static esp_err_t part_read(rec_storage_t *st, uint32_t offset, void *buf, size_t len) {
+    return esp_partition_read(((rec_storage_partition_t *)st)->part, offset, buf, len);
+}
+
+static esp_err_t part_write(rec_storage_t *st, uint32_t offset, const void *buf, size_t len) {
+    return esp_partition_write(((rec_storage_partition_t *)st)->part, offset, buf, len);
+}
+
+static esp_err_t part_erase(rec_storage_t *st, uint32_t offset, size_t len) {
+    return esp_partition_erase_range(((rec_storage_partition_t *)st)->part, offset, len);
+}
+
+rec_storage_t *rec_storage_partition_open(rec_storage_partition_t *p, const char *label) {
+
+    memset(p, 0, sizeof(*p));
+    p->part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (p->part == NULL) return NULL;
+
+    p->base.name = label;
+    p->base.erase_size = p->part->erase_size;
+    p->base.size = p->part->size - p->part->size % p->base.erase_size;
+    p->base.read = part_read;
+    p->base.write = part_write;
+    p->base.erase = part_erase;
+    return &p->base;
+}
+#endif
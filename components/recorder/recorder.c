@@ -0,0 +1,291 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "recorder.h"
+    #include <string.h>  // For memcpy / memset / memcmp
+    #include "esp_log.h"
+
+
+// =============================
+// CRC-32 (IEEE, Nibble Table)
+// =============================
+// 16-entry table: small enough for DRAM, and a page is checksummed once per write / mount.
+static const uint32_t crc32_nibble[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+};
+
+static uint32_t rec_crc32(const uint8_t *data, size_t len) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ crc32_nibble[crc & 0x0F];
+        crc = (crc >> 4) ^ crc32_nibble[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+
+// =============================
+// Page Buffer
+// =============================
+static void page_reset(recorder_t *rec) {
+    memset(rec->page, 0xFF, sizeof(rec->page));
+    rec->fill = sizeof(rec_page_header_t);
+    rec->page_records = 0;
+}
+
+static void note_wear(recorder_t *rec, uint32_t erase_count) {
+    if (erase_count < rec->stats.min_erase_count) rec->stats.min_erase_count = erase_count;
+    if (erase_count > rec->stats.max_erase_count) rec->stats.max_erase_count = erase_count;
+}
+
+// Reads page `page` into `buf`; true if it holds a complete, checksummed page
+static bool page_load(recorder_t *rec, uint32_t page, uint8_t *buf) {
+
+    if (rec_storage_read(rec->storage, page * RECORDER_PAGE_SIZE, buf, RECORDER_PAGE_SIZE) != ESP_OK) return false;
+
+    const rec_page_header_t *hdr = (const rec_page_header_t *)buf;
+    return hdr->magic == RECORDER_MAGIC && hdr->used <= RECORDER_PAGE_PAYLOAD &&
+           hdr->crc == rec_crc32(buf + sizeof(*hdr), hdr->used);
+}
+
+static bool sector_blank(rec_storage_t *st, uint32_t offset) {
+    uint32_t chunk[64];
+    for (uint32_t done = 0; done < RECORDER_PAGE_SIZE; done += sizeof(chunk)) {
+        if (rec_storage_read(st, offset + done, chunk, sizeof(chunk)) != ESP_OK) return false;
+        for (size_t i = 0; i < 64; i++) if (chunk[i] != 0xFFFFFFFFu) return false;
+    }
+    return true;
+}
+
+static bool page_verify(rec_storage_t *st, uint32_t offset, const uint8_t *expect) {
+    uint8_t chunk[256];
+    for (uint32_t done = 0; done < RECORDER_PAGE_SIZE; done += sizeof(chunk)) {
+        if (rec_storage_read(st, offset + done, chunk, sizeof(chunk)) != ESP_OK) return false;
+        if (memcmp(chunk, expect + done, sizeof(chunk)) != 0) return false;
+    }
+    return true;
+}
+
+
+// =============================
+// Page Commit (Erase + Write + Verify)
+// =============================
+static esp_err_t page_commit(recorder_t *rec) {
+
+    if (rec->page_records == 0) return ESP_OK;
+
+    rec_page_header_t hdr = {
+        .magic = RECORDER_MAGIC,
+        .seq = rec->next_seq,
+        .used = (uint16_t)(rec->fill - sizeof(hdr)),
+        .records = rec->page_records,
+        .crc = rec_crc32(rec->page + sizeof(hdr), rec->fill - sizeof(hdr)),
+    };
+
+    // A page that does not read back is skipped; give up after one lap of the ring
+    for (uint32_t attempt = 0; attempt < rec->num_pages; attempt++) {
+
+        uint32_t offset = rec->next_page * RECORDER_PAGE_SIZE;
+        rec_page_header_t old;
+        esp_err_t err = rec_storage_read(rec->storage, offset, &old, sizeof(old));
+        if (err != ESP_OK) return err;
+
+        // --- 1. Erase (carrying the sector's wear forward), unless it is already blank ---
+        bool had_page = (old.magic == RECORDER_MAGIC);
+        uint32_t erase_count = had_page ? old.erase_count : 0;
+
+        if (!had_page && sector_blank(rec->storage, offset)) {
+            rec->stats.erases_skipped++;
+        } else {
+            err = rec_storage_erase(rec->storage, offset, RECORDER_PAGE_SIZE);
+            if (err != ESP_OK) return err;
+            erase_count++;
+            rec->stats.erases++;
+        }
+
+        // --- 2. One aligned write of the whole sector, then read it back ---
+        hdr.erase_count = erase_count;
+        memcpy(rec->page, &hdr, sizeof(hdr));
+
+        err = rec_storage_write(rec->storage, offset, rec->page, RECORDER_PAGE_SIZE);
+        bool ok = (err == ESP_OK) && page_verify(rec->storage, offset, rec->page);
+
+        rec->next_page++;
+        if (rec->next_page == rec->num_pages) {
+            rec->next_page = 0;
+            rec->stats.wraps++;
+        }
+
+        if (!ok) {
+            rec->stats.bad_pages++;
+            if (had_page && rec->stats.valid_pages) rec->stats.valid_pages--;     // Its old contents are gone as well
+            continue;
+        }
+
+        if (!had_page) rec->stats.valid_pages++;
+        note_wear(rec, erase_count);
+        rec->stats.pages_written++;
+        rec->stats.bytes_out += RECORDER_PAGE_SIZE;
+        rec->next_seq++;
+        page_reset(rec);
+        return ESP_OK;
+    }
+
+    ESP_LOGE(REC_TAG, "No writable page left in %s", rec->storage->name);
+    return ESP_FAIL;
+}
+
+
+// =============================
+// Mount
+// =============================
+esp_err_t recorder_mount(recorder_t *rec, rec_storage_t *storage) {
+
+    memset(&rec->stats, 0, sizeof(rec->stats));
+    rec->storage = storage;
+    rec->num_pages = storage->size / RECORDER_PAGE_SIZE;
+    rec->stats.min_erase_count = UINT32_MAX;
+    page_reset(rec);
+
+    if (rec->num_pages < 2 || RECORDER_PAGE_SIZE % storage->erase_size != 0) return ESP_ERR_INVALID_SIZE;
+
+    // Newest valid page = head. The page buffer doubles as scratch until the first append.
+    uint32_t head_seq = 0, head_page = 0;
+    for (uint32_t p = 0; p < rec->num_pages; p++) {
+        const rec_page_header_t *hdr = (const rec_page_header_t *)rec->page;
+        if (!page_load(rec, p, rec->page)) {
+            if (hdr->magic == RECORDER_MAGIC) {
+                rec->stats.corrupt_pages++;
+                note_wear(rec, hdr->erase_count);
+            }
+            continue;
+        }
+        rec->stats.valid_pages++;
+        note_wear(rec, hdr->erase_count);
+        if (hdr->seq > head_seq) {
+            head_seq = hdr->seq;
+            head_page = p;
+        }
+    }
+
+    if (rec->stats.min_erase_count == UINT32_MAX) rec->stats.min_erase_count = 0;
+    rec->next_seq = head_seq + 1;
+    rec->next_page = head_seq ? (head_page + 1) % rec->num_pages : 0;
+    page_reset(rec);
+
+    ESP_LOGI(REC_TAG, "Mounted %s: %lu pages, %lu in use, next seq %lu (page %lu), wear %lu..%lu",
+             storage->name, (unsigned long)rec->num_pages, (unsigned long)rec->stats.valid_pages,
+             (unsigned long)rec->next_seq, (unsigned long)rec->next_page,
+             (unsigned long)rec->stats.min_erase_count, (unsigned long)rec->stats.max_erase_count);
+    if (rec->stats.corrupt_pages) {
+        ESP_LOGW(REC_TAG, "%lu torn / corrupt pages skipped", (unsigned long)rec->stats.corrupt_pages);
+    }
+    return ESP_OK;
+}
+
+
+// =============================
+// Append
+// =============================
+// Reserves room for a record of `len` payload bytes, committing the current page first if needed
+static uint8_t *record_reserve(recorder_t *rec, size_t len, esp_err_t *err) {
+
+    *err = ESP_OK;
+    if (sizeof(rec_header_t) + len > RECORDER_PAGE_PAYLOAD) {
+        *err = ESP_ERR_INVALID_SIZE;
+        return NULL;
+    }
+    if (rec->fill + sizeof(rec_header_t) + len > RECORDER_PAGE_SIZE) {
+        *err = page_commit(rec);
+        if (*err != ESP_OK) return NULL;
+    }
+    return rec->page + rec->fill;
+}
+
+static void record_close(recorder_t *rec, uint8_t *at, rec_type_t type, uint32_t stamp_us, size_t len) {
+    rec_header_t hdr = { .type = (uint8_t)type, .reserved = 0, .len = (uint16_t)len, .stamp_us = stamp_us };
+    memcpy(at, &hdr, sizeof(hdr));
+    rec->fill += sizeof(hdr) + len;
+    rec->page_records++;
+    rec->stats.records++;
+}
+
+esp_err_t recorder_append(recorder_t *rec, rec_type_t type, uint32_t stamp_us, const void *payload, uint16_t len) {
+
+    esp_err_t err;
+    uint8_t *at = record_reserve(rec, len, &err);
+    if (!at) return err;
+
+    memcpy(at + sizeof(rec_header_t), payload, len);
+    record_close(rec, at, type, stamp_us, len);
+    return ESP_OK;
+}
+
+esp_err_t recorder_append_samples(recorder_t *rec, const int16_t *frames, uint16_t num_frames, uint8_t channels,
+                                  uint32_t stamp_us) {
+
+    if (num_frames == 0) return ESP_OK;
+
+    // Encoded straight into the page buffer. If the block does not fit what is left of the page
+    // the encoder stops, the page goes out and the block is encoded again on a fresh one.
+    for (int attempt = 0; attempt < 2; attempt++) {
+
+        uint8_t *at = rec->page + rec->fill;
+        size_t room = RECORDER_PAGE_SIZE - rec->fill;
+        size_t len = room > sizeof(rec_header_t) ?
+                     eeg_codec_encode(frames, num_frames, channels, rec->block_seq, at + sizeof(rec_header_t),
+                                      room - sizeof(rec_header_t)) : 0;
+        if (len) {
+            record_close(rec, at, REC_TYPE_SAMPLES, stamp_us, len);
+            rec->block_seq++;
+            rec->stats.bytes_in += (uint64_t)num_frames * channels * sizeof(int16_t);
+            return ESP_OK;
+        }
+        memset(at, 0xFF, room);                        // Keep the unused tail erased
+        if (rec->page_records == 0) break;             // Does not fit an empty page either
+
+        esp_err_t err = page_commit(rec);
+        if (err != ESP_OK) return err;
+    }
+    return ESP_ERR_INVALID_SIZE;
+}
+
+esp_err_t recorder_append_event(recorder_t *rec, uint32_t event, uint32_t value, uint32_t stamp_us) {
+    rec_event_t ev = { .event = event, .value = value };
+    return recorder_append(rec, REC_TYPE_EVENT, stamp_us, &ev, sizeof(ev));
+}
+
+esp_err_t recorder_flush(recorder_t *rec) {
+    return page_commit(rec);
+}
+
+
+// =============================
+// Read Back
+// =============================
+size_t recorder_read(recorder_t *rec, uint8_t *scratch, rec_visit_fn visit, void *ctx) {
+
+    size_t visited = 0;
+
+    // Ring order from the page after the head is oldest -> newest
+    for (uint32_t k = 0; k < rec->num_pages; k++) {
+        uint32_t p = (rec->next_page + k) % rec->num_pages;
+        if (!page_load(rec, p, scratch)) continue;
+
+        const rec_page_header_t *page = (const rec_page_header_t *)scratch;
+        const uint8_t *at = scratch + sizeof(*page), *end = at + page->used;
+
+        for (uint16_t r = 0; r < page->records && at + sizeof(rec_header_t) <= end; r++) {
+            rec_header_t hdr;
+            memcpy(&hdr, at, sizeof(hdr));
+            if (at + sizeof(hdr) + hdr.len > end) break;
+            visit(&hdr, at + sizeof(hdr), ctx);
+            at += sizeof(hdr) + hdr.len;
+            visited++;
+        }
+    }
+    return visited;
+}
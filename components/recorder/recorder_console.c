@@ -0,0 +1,61 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include <stdio.h>
+    #include <string.h>                 // For strcmp
+    #include "esp_console.h"            // Command registration
+    #include "recorder_console.h"
+    #include "recorder.h"
+
+
+// =============================
+// Command Handler
+// =============================
+static rec_storage_t *console_storage = NULL;
+
+static int rec_cmd(int argc, char **argv) {
+
+    if (argc == 2 && strcmp(argv[1], "start") == 0) {
+        if (console_storage == NULL) {
+            printf("no '%s' partition\n", RECORDER_PARTITION_LABEL);
+            return 1;
+        }
+        esp_err_t err = recorder_start(console_storage);
+        printf("%s\n", err == ESP_OK ? "recording" : esp_err_to_name(err));
+        return err == ESP_OK ? 0 : 1;
+    }
+    if (argc == 2 && strcmp(argv[1], "stop") == 0) {
+        esp_err_t err = recorder_stop();
+        printf("%s\n", err == ESP_OK ? "stopped" : esp_err_to_name(err));
+        return err == ESP_OK ? 0 : 1;
+    }
+    if (argc > 1) {
+        printf("usage: rec [start|stop]\n");
+        return 1;
+    }
+
+    const recorder_stats_t *s = &recorder.stats;
+    printf("recording: %s\n", recorder_running() ? "on" : "off");
+    printf("records %lu, %llu -> %llu bytes, %lu pages, %lu frames / %lu events dropped\n",
+           (unsigned long)s->records, (unsigned long long)s->bytes_in, (unsigned long long)s->bytes_out,
+           (unsigned long)s->pages_written, (unsigned long)s->frames_dropped, (unsigned long)s->events_dropped);
+    return 0;
+}
+
+
+// =============================
+// Registration
+// =============================
+esp_err_t recorder_console_register(rec_storage_t *storage) {
+
+    console_storage = storage;
+
+    const esp_console_cmd_t cmd = {
+        .command = "rec",
+        .help = "Session recorder state. 'rec start' records raw frames + events to flash, 'rec stop' ends it.",
+        .hint = "[start|stop]",
+        .func = rec_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
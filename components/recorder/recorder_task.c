@@ -0,0 +1,216 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "recorder.h"
+    #include <stdatomic.h>    // Event queue indices
+    #include "freertos/FreeRTOS.h"
+    #include "freertos/task.h"
+    #include "esp_log.h"
+    #include "power.h"        // Record demand (keeps the pipeline out of standby) + task duty
+
+
+// =============================
+// Global Variables
+// =============================
+recorder_t recorder;
+
+// Raw frames staged by the pipeline (producer: adc_filtering via the tap / consumer: recorder_task)
+static int16_t stage_buffer[RECORDER_STAGE_FRAMES * ADC_NUM_CHANNELS];
+static adc_ring_t stage_ring = ADC_RING_INIT(stage_buffer, RECORDER_STAGE_FRAMES, ADC_NUM_CHANNELS);
+static uint32_t stage_stamp_us[RECORDER_STAGE_FRAMES];    // Written before the slot is published
+
+// Detected events, same producer / consumer pair
+typedef struct {
+    uint32_t event, value, stamp_us;
+} staged_event_t;
+
+static staged_event_t event_slots[RECORDER_EVENT_SLOTS];
+static _Atomic uint32_t event_head = 0;                   // Written by the producer only
+static _Atomic uint32_t event_tail = 0;                   // Written by the consumer only
+static _Atomic uint32_t events_dropped = 0;
+
+static TaskHandle_t recorder_task_handle = NULL;
+static volatile bool recorder_active = false;
+static TaskHandle_t stop_waiter = NULL;                    // Caller of recorder_stop() waiting on the task
+static esp_err_t stop_result = ESP_OK;
+
+// A block must always fit an empty page, whatever the signal does
+_Static_assert(sizeof(rec_header_t) + EEG_CODEC_MAX_SIZE(RECORDER_BLOCK_FRAMES, ADC_NUM_CHANNELS) <= RECORDER_PAGE_PAYLOAD,
+               "RECORDER_BLOCK_FRAMES too large for a page at this channel count");
+
+static const adc_tap_t recorder_tap = {
+    .frames = recorder_tap_frames,
+    .event = recorder_tap_event,
+};
+
+
+// =============================
+// Tap Hooks (Pipeline Side)
+// =============================
+void recorder_tap_frames(const int16_t *frames, const uint32_t *stamps, size_t count) {
+
+    uint32_t now = stamps ? 0 : adc_now_us();
+
+    for (size_t i = 0; i < count; i++) {
+        uint32_t next = atomic_load_explicit(&stage_ring.head, memory_order_relaxed);
+        stage_stamp_us[next & stage_ring.mask] = stamps ? stamps[i] : now;
+        adc_ring_push_frame(&stage_ring, &frames[i * ADC_NUM_CHANNELS]);
+    }
+
+    // Wake the writer once a whole block is waiting
+    TaskHandle_t task = recorder_task_handle;
+    if (task && adc_ring_pending(&stage_ring) >= RECORDER_BLOCK_FRAMES) xTaskNotifyGive(task);
+}
+
+void recorder_tap_event(uint32_t event, uint32_t stamp_us, uint32_t value) {
+
+    uint32_t head = atomic_load_explicit(&event_head, memory_order_relaxed);
+    if (head - atomic_load_explicit(&event_tail, memory_order_acquire) >= RECORDER_EVENT_SLOTS) {
+        atomic_fetch_add_explicit(&events_dropped, 1, memory_order_relaxed);
+        return;
+    }
+
+    event_slots[head & (RECORDER_EVENT_SLOTS - 1)] = (staged_event_t){ event, value, stamp_us };
+    atomic_store_explicit(&event_head, head + 1, memory_order_release);
+}
+
+
+// =============================
+// Drain (Writer Side)
+// =============================
+size_t recorder_drain(void) {
+
+    static int16_t block[RECORDER_BLOCK_FRAMES * ADC_NUM_CHANNELS];   // Static: keeps the task stack small
+    size_t written = 0;
+
+    // --- 1. Events first: they happened during (or before) the frames still staged ---
+    uint32_t tail = atomic_load_explicit(&event_tail, memory_order_relaxed);
+    while (tail != atomic_load_explicit(&event_head, memory_order_acquire)) {
+        staged_event_t ev = event_slots[tail & (RECORDER_EVENT_SLOTS - 1)];
+        atomic_store_explicit(&event_tail, ++tail, memory_order_release);
+        if (recorder_append_event(&recorder, ev.event, ev.value, ev.stamp_us) != ESP_OK) return written;
+    }
+    recorder.stats.events_dropped = atomic_load_explicit(&events_dropped, memory_order_relaxed);
+
+    // --- 2. Frames in RECORDER_BLOCK_FRAMES blocks ---
+    for (;;) {
+        uint32_t first_seq, lost = 0;
+        size_t n = adc_ring_read(&stage_ring, block, RECORDER_BLOCK_FRAMES, &first_seq, &lost);
+        recorder.stats.frames_dropped += lost;
+        if (n == 0) break;
+
+        uint32_t stamp = stage_stamp_us[first_seq & stage_ring.mask];
+        if (recorder_append_samples(&recorder, block, (uint16_t)n, ADC_NUM_CHANNELS, stamp) != ESP_OK) break;
+        written += n;
+    }
+    return written;
+}
+
+
+// =============================
+// Start / Stop
+// =============================
+esp_err_t recorder_start(rec_storage_t *storage) {
+
+    if (recorder_active) return ESP_ERR_INVALID_STATE;     // One session at a time
+
+    esp_err_t err = recorder_mount(&recorder, storage);
+    if (err != ESP_OK) return err;
+
+    // Nothing staged before this point belongs to the new session
+    stage_ring.tail = atomic_load_explicit(&stage_ring.head, memory_order_acquire);
+    atomic_store_explicit(&event_tail, atomic_load_explicit(&event_head, memory_order_acquire), memory_order_release);
+
+    rec_session_t session = {
+        .session_id = recorder.next_seq,
+        .sample_rate_mhz = SAMPLE_RATE_HZ * 1000u,
+        .channels = ADC_NUM_CHANNELS,
+    };
+    err = recorder_append(&recorder, REC_TYPE_SESSION, adc_now_us(), &session, sizeof(session));
+    if (err != ESP_OK) return err;
+
+    recorder_active = true;
+    power_demand_set(POWER_DEMAND_RECORD, true);
+    adc_set_tap(&recorder_tap);
+    if (recorder_task_handle) xTaskNotifyGive(recorder_task_handle);    // Off its idle wait
+    ESP_LOGI(REC_TAG, "Recording session %lu to %s", (unsigned long)session.session_id, storage->name);
+    return ESP_OK;
+}
+
+// Writes what is left of the session; runs on recorder_task when there is one
+static esp_err_t recorder_finish(void) {
+
+    recorder_drain();
+    esp_err_t err = recorder_flush(&recorder);
+
+    const recorder_stats_t *s = &recorder.stats;
+    ESP_LOGI(REC_TAG, "Stopped: %lu records, %llu -> %llu bytes, %lu pages, %lu erases (%lu skipped), "
+             "%lu bad, %lu frames / %lu events dropped",
+             (unsigned long)s->records, (unsigned long long)s->bytes_in, (unsigned long long)s->bytes_out,
+             (unsigned long)s->pages_written, (unsigned long)s->erases, (unsigned long)s->erases_skipped,
+             (unsigned long)s->bad_pages, (unsigned long)s->frames_dropped, (unsigned long)s->events_dropped);
+    return err;
+}
+
+esp_err_t recorder_stop(void) {
+
+    if (!recorder_active) return ESP_OK;
+
+    adc_set_tap(NULL);
+    recorder_active = false;
+    power_demand_set(POWER_DEMAND_RECORD, false);
+
+    // recorder_task may be halfway through a block: it writes the tail itself, then wakes us
+    if (recorder_task_handle && xTaskGetCurrentTaskHandle() != recorder_task_handle) {
+        stop_waiter = xTaskGetCurrentTaskHandle();
+        xTaskNotifyGive(recorder_task_handle);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        return stop_result;
+    }
+    return recorder_finish();
+}
+
+bool recorder_running(void) {
+    return recorder_active;
+}
+
+
+// =============================
+// FreeRTOS Task: Recorder
+// =============================
+// Low priority: it only competes with the pipeline for the CPU while compressing a block, and
+// the time it spends blocked on flash is taken from nobody but itself. Between sessions it
+// sleeps until recorder_start() wakes it rather than polling an empty stage. recorder_stop()
+// from another task hands the last drain + flush to it, so the log has a single writer.
+void recorder_task(void *arg) {
+
+    recorder_task_handle = xTaskGetCurrentTaskHandle();
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, recorder_active ? pdMS_TO_TICKS(RECORDER_WAKE_MS) : portMAX_DELAY);
+        uint32_t t0 = power_busy_begin();
+        if (recorder_active) {
+            recorder_drain();
+        } else if (stop_waiter) {
+            TaskHandle_t waiter = stop_waiter;
+            stop_result = recorder_finish();
+            stop_waiter = NULL;
+            xTaskNotifyGive(waiter);
+        }
+        power_busy_end(TASK_ROLE_RECORDER, t0);
+    }
+}
+
+
+// =============================
+// Static Footprint (mem_budget.h)
+// =============================
+static const mem_budget_item_t recorder_mem_items[] = {
+    MEM_BUDGET_ITEM(recorder),
+    MEM_BUDGET_ITEM(stage_buffer),
+    MEM_BUDGET_ITEM(stage_stamp_us),
+    MEM_BUDGET_ITEM(event_slots),
+    MEM_BUDGET_BYTES("drain block", RECORDER_BLOCK_FRAMES * ADC_NUM_CHANNELS * sizeof(int16_t)),
+};
+const mem_budget_table_t recorder_mem_budget = MEM_BUDGET_TABLE("recorder", recorder_mem_items);
@@ -0,0 +1,297 @@
+// test_recorder.c - Unit tests for the flash session recorder (page ring, storage, writer)
+
+#include "unity.h"
+#include "recorder.h"            // Under test
+#include "esp_timer.h"           // esp_timer_get_time (throughput)
+#include <stdio.h>               // For benchmark output
+#include <string.h>              // For memset / memcmp
+
+#define TEST_PAGES  8
+
+static uint8_t test_flash[TEST_PAGES * RECORDER_PAGE_SIZE];
+static rec_storage_ram_t test_ram;
+static recorder_t test_rec;
+static uint8_t test_scratch[RECORDER_PAGE_SIZE];
+
+// Deterministic EEG-like signal: slow drift + a little "noise", per channel
+static int16_t test_sample(uint32_t frame, uint8_t ch) {
+    uint32_t h = (frame * 2654435761u) ^ (ch * 40503u);
+    return (int16_t)(1800 + 300 * ch + (int32_t)((frame * 7 + ch * 13) % 200) - 100 + (int32_t)(h >> 28) - 8);
+}
+
+static void test_fill(int16_t *frames, uint32_t first, uint16_t n, uint8_t nch) {
+    for (uint16_t i = 0; i < n; i++) {
+        for (uint8_t ch = 0; ch < nch; ch++) frames[i * nch + ch] = test_sample(first + i, ch);
+    }
+}
+
+
+// =============================
+// Read-Back Collector
+// =============================
+typedef struct {
+    uint32_t sessions, events, blocks;
+    uint32_t frames;              // Sample frames seen
+    uint32_t first_frame;         // Frame index of the first sample seen (from its stamp)
+    uint32_t mismatches;          // Samples that differ from test_sample()
+    uint32_t gaps;                // Blocks whose stamp does not follow the previous one
+    uint32_t next_stamp;
+    uint8_t  channels;
+} test_collect_t;
+
+// Stamps are frame indices, so every block can be checked against the signal it came from
+static void test_visit(const rec_header_t *hdr, const uint8_t *payload, void *ctx) {
+
+    test_collect_t *c = ctx;
+    static int16_t frames[RECORDER_BLOCK_FRAMES * 8];
+
+    switch (hdr->type) {
+    case REC_TYPE_SESSION: c->sessions++; break;
+    case REC_TYPE_EVENT:   c->events++;   break;
+    case REC_TYPE_SAMPLES: {
+        eeg_codec_block_info_t info;
+        TEST_ASSERT_EQUAL_size_t(hdr->len, eeg_codec_decode(payload, hdr->len, frames, RECORDER_BLOCK_FRAMES, &info));
+        size_t n = info.frames;
+        uint8_t nch = info.channels;
+        if (c->blocks == 0) c->first_frame = hdr->stamp_us;
+        else if (hdr->stamp_us != c->next_stamp) c->gaps++;
+        for (size_t i = 0; i < n * nch; i++) {
+            if (frames[i] != test_sample(hdr->stamp_us + i / nch, i % nch)) c->mismatches++;
+        }
+        c->channels = nch;
+        c->blocks++;
+        c->frames += n;
+        c->next_stamp = hdr->stamp_us + n;
+        break;
+    }
+    default: TEST_FAIL_MESSAGE("unknown record type");
+    }
+}
+
+// Writes `blocks` blocks of RECORDER_BLOCK_FRAMES frames starting at frame `first`
+static void test_write_blocks(recorder_t *rec, uint32_t first, uint32_t blocks, uint8_t nch) {
+    int16_t frames[RECORDER_BLOCK_FRAMES * 8];
+    for (uint32_t b = 0; b < blocks; b++) {
+        uint32_t at = first + b * RECORDER_BLOCK_FRAMES;
+        test_fill(frames, at, RECORDER_BLOCK_FRAMES, nch);
+        TEST_ASSERT_EQUAL(ESP_OK, recorder_append_samples(rec, frames, RECORDER_BLOCK_FRAMES, nch, at));
+    }
+}
+
+
+// =============================
+// Test: Append, Remount, Read Back
+// =============================
+void test_recorder_remount_reads_back(void) {
+
+    rec_storage_t *st = rec_storage_ram_init(&test_ram, test_flash, sizeof(test_flash), 4096);
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_mount(&test_rec, st));
+    TEST_ASSERT_EQUAL_UINT32(TEST_PAGES, test_rec.num_pages);
+    TEST_ASSERT_EQUAL_UINT32(0, test_rec.stats.valid_pages);
+
+    rec_session_t session = { .session_id = 1, .sample_rate_mhz = 100000, .channels = 4 };
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_append(&test_rec, REC_TYPE_SESSION, 0, &session, sizeof(session)));
+    test_write_blocks(&test_rec, 0, 20, 4);
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_append_event(&test_rec, ADC_EVENT_BLINK, 1, 640));
+    test_write_blocks(&test_rec, 20 * RECORDER_BLOCK_FRAMES, 20, 4);
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_flush(&test_rec));
+
+    // Fresh erased flash: nothing needed erasing
+    TEST_ASSERT_EQUAL_UINT32(0, test_rec.stats.erases);
+    TEST_ASSERT_EQUAL_UINT32(test_rec.stats.pages_written, test_rec.stats.erases_skipped);
+    TEST_ASSERT_TRUE(test_rec.stats.pages_written >= 2);
+
+    // --- Remount (as after a reboot) and resume on the next page ---
+    uint32_t written = test_rec.stats.pages_written;
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_mount(&test_rec, st));
+    TEST_ASSERT_EQUAL_UINT32(written, test_rec.stats.valid_pages);
+    TEST_ASSERT_EQUAL_UINT32(written + 1, test_rec.next_seq);
+    TEST_ASSERT_EQUAL_UINT32(written, test_rec.next_page);
+
+    test_collect_t c = { 0 };
+    TEST_ASSERT_EQUAL_size_t(42, recorder_read(&test_rec, test_scratch, test_visit, &c));
+    TEST_ASSERT_EQUAL_UINT32(1, c.sessions);
+    TEST_ASSERT_EQUAL_UINT32(1, c.events);
+    TEST_ASSERT_EQUAL_UINT32(40 * RECORDER_BLOCK_FRAMES, c.frames);
+    TEST_ASSERT_EQUAL_UINT8(4, c.channels);
+    TEST_ASSERT_EQUAL_UINT32(0, c.first_frame);
+    TEST_ASSERT_EQUAL_UINT32(0, c.mismatches);
+    TEST_ASSERT_EQUAL_UINT32(0, c.gaps);
+}
+
+
+// =============================
+// Test: Ring Wraps and Wears Sectors Evenly
+// =============================
+void test_recorder_wrap_wears_evenly(void) {
+
+    rec_storage_t *st = rec_storage_ram_init(&test_ram, test_flash, sizeof(test_flash), 4096);
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_mount(&test_rec, st));
+
+    // Several laps of the ring, remounting now and then
+    uint32_t frame = 0;
+    for (int round = 0; round < 8; round++) {
+        test_write_blocks(&test_rec, frame, 200, 2);
+        frame += 200 * RECORDER_BLOCK_FRAMES;
+        if (round % 3 == 2) {
+            TEST_ASSERT_EQUAL(ESP_OK, recorder_flush(&test_rec));
+            TEST_ASSERT_EQUAL(ESP_OK, recorder_mount(&test_rec, st));
+        }
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_flush(&test_rec));
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_mount(&test_rec, st));
+
+    // Every page holds data and the erase counts differ by at most one lap
+    TEST_ASSERT_EQUAL_UINT32(TEST_PAGES, test_rec.stats.valid_pages);
+    TEST_ASSERT_TRUE(test_rec.stats.min_erase_count >= 3);
+    TEST_ASSERT_TRUE(test_rec.stats.max_erase_count - test_rec.stats.min_erase_count <= 1);
+
+    // The newest frames survive, contiguous and intact, oldest first
+    test_collect_t c = { 0 };
+    recorder_read(&test_rec, test_scratch, test_visit, &c);
+    TEST_ASSERT_EQUAL_UINT32(0, c.mismatches);
+    TEST_ASSERT_EQUAL_UINT32(0, c.gaps);
+    TEST_ASSERT_EQUAL_UINT32(frame, c.next_stamp);
+    TEST_ASSERT_TRUE(c.first_frame > 0);
+
+    printf("recorder wrap: %u pages, %lu frames kept (%lu..%lu), wear %lu..%lu, %llu -> %llu bytes\n",
+           TEST_PAGES, (unsigned long)c.frames, (unsigned long)c.first_frame, (unsigned long)c.next_stamp,
+           (unsigned long)test_rec.stats.min_erase_count, (unsigned long)test_rec.stats.max_erase_count,
+           (unsigned long long)(c.frames * 2ull * 2), (unsigned long long)(TEST_PAGES * RECORDER_PAGE_SIZE));
+}
+
+
+// =============================
+// Test: Torn Page Is Skipped, the Rest Survives
+// =============================
+void test_recorder_torn_page_skipped(void) {
+
+    rec_storage_t *st = rec_storage_ram_init(&test_ram, test_flash, sizeof(test_flash), 4096);
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_mount(&test_rec, st));
+    test_write_blocks(&test_rec, 0, 150, 2);
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_flush(&test_rec));
+    uint32_t written = test_rec.stats.pages_written;
+    TEST_ASSERT_TRUE(written >= 4);
+
+    // Power lost mid-write on page 2: its tail never made it (NOR: bits can still be cleared)
+    static uint8_t zeros[1024];
+    TEST_ASSERT_EQUAL(ESP_OK, rec_storage_write(st, 2 * RECORDER_PAGE_SIZE + 2048, zeros, sizeof(zeros)));
+
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_mount(&test_rec, st));
+    TEST_ASSERT_EQUAL_UINT32(1, test_rec.stats.corrupt_pages);
+    TEST_ASSERT_EQUAL_UINT32(written - 1, test_rec.stats.valid_pages);
+    TEST_ASSERT_EQUAL_UINT32(written, test_rec.next_page);                  // Head unaffected
+
+    test_collect_t c = { 0 };
+    recorder_read(&test_rec, test_scratch, test_visit, &c);
+    TEST_ASSERT_EQUAL_UINT32(0, c.mismatches);
+    TEST_ASSERT_EQUAL_UINT32(1, c.gaps);                                    // Exactly the lost page
+    TEST_ASSERT_EQUAL_UINT32(150 * RECORDER_BLOCK_FRAMES, c.next_stamp);
+
+    // A corrupt sector is erased (not trusted to be blank) when the ring comes back to it
+    test_write_blocks(&test_rec, 150 * RECORDER_BLOCK_FRAMES, 300, 2);
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_flush(&test_rec));
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_mount(&test_rec, st));
+    TEST_ASSERT_EQUAL_UINT32(0, test_rec.stats.corrupt_pages);
+}
+
+
+// =============================
+// Test: File Backend Throughput (Host Stand-In for Flash)
+// =============================
+void test_recorder_file_backend_throughput(void) {
+
+    rec_storage_t *st;
+#if CONFIG_IDF_TARGET_LINUX
+    static rec_storage_file_t file;
+    const char *path = "/tmp/eeg_recorder_test.bin";
+    remove(path);
+    st = rec_storage_file_open(&file, path, 64 * RECORDER_PAGE_SIZE, 4096);
+    TEST_ASSERT_NOT_NULL(st);
+#else
+    st = rec_storage_ram_init(&test_ram, test_flash, sizeof(test_flash), 4096);
+#endif
+
+    const uint32_t blocks = 2000;            // 128 k frames: ~21 min of 1 channel at 100 Hz
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_mount(&test_rec, st));
+
+    int64_t t0 = esp_timer_get_time();
+    test_write_blocks(&test_rec, 0, blocks, 1);
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_flush(&test_rec));
+    int64_t us = esp_timer_get_time() - t0;
+    if (us < 1) us = 1;
+
+    const recorder_stats_t *s = &test_rec.stats;
+    TEST_ASSERT_EQUAL_UINT32(0, s->bad_pages);
+    TEST_ASSERT_TRUE(s->bytes_out < s->bytes_in);                             // Compression pays for the headers
+
+    printf("recorder %s: %llu raw -> %llu stored bytes (%.2f:1), %lu pages, %lu erases, %.1f MB/s raw in\n",
+           st->name, (unsigned long long)s->bytes_in, (unsigned long long)s->bytes_out,
+           (double)s->bytes_in / (double)s->bytes_out, (unsigned long)s->pages_written,
+           (unsigned long)s->erases, (double)s->bytes_in / (double)us);
+
+    // Remount the image and check the newest data
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_mount(&test_rec, st));
+    test_collect_t c = { 0 };
+    recorder_read(&test_rec, test_scratch, test_visit, &c);
+    TEST_ASSERT_EQUAL_UINT32(0, c.mismatches);
+    TEST_ASSERT_EQUAL_UINT32(blocks * RECORDER_BLOCK_FRAMES, c.next_stamp);
+
+    rec_storage_close(st);
+}
+
+
+// =============================
+// Test: Tap Stages, Writer Drains, Overrun Is Counted
+// =============================
+static uint32_t test_tap_frames(uint32_t first, size_t count) {
+    int16_t frames[RECORDER_BLOCK_FRAMES * ADC_NUM_CHANNELS];
+    uint32_t stamps[RECORDER_BLOCK_FRAMES];
+    for (size_t i = 0; i < count; i++) {
+        stamps[i] = first + i;
+        for (uint8_t ch = 0; ch < ADC_NUM_CHANNELS; ch++) frames[i * ADC_NUM_CHANNELS + ch] = test_sample(first + i, ch);
+    }
+    recorder_tap_frames(frames, stamps, count);
+    return first + count;
+}
+
+void test_recorder_tap_stages_and_drains(void) {
+
+    rec_storage_t *st = rec_storage_ram_init(&test_ram, test_flash, sizeof(test_flash), 4096);
+    TEST_ASSERT_FALSE(recorder_running());
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_start(st));
+    TEST_ASSERT_TRUE(recorder_running());
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, recorder_start(st));           // One session at a time
+
+    // --- 1. Writer keeps up: everything lands in order ---
+    uint32_t frame = 0;
+    for (int i = 0; i < 10; i++) {
+        frame = test_tap_frames(frame, 32);
+        if (i == 4) recorder_tap_event(ADC_EVENT_BLINK, frame, 1);
+        if (i % 2) recorder_drain();
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_stop());
+    TEST_ASSERT_FALSE(recorder_running());
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_stop());                               // Stopping twice is harmless
+    TEST_ASSERT_EQUAL_UINT32(0, recorder.stats.frames_dropped);
+
+    // --- 2. Writer stalls for longer than the staging ring: the oldest frames are dropped ---
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_start(st));
+    for (uint32_t n = 0; n < RECORDER_STAGE_FRAMES + 3 * RECORDER_BLOCK_FRAMES; n += RECORDER_BLOCK_FRAMES) {
+        frame = test_tap_frames(frame, RECORDER_BLOCK_FRAMES);
+    }
+    for (int i = 0; i < RECORDER_EVENT_SLOTS + 4; i++) recorder_tap_event(ADC_EVENT_ATTENTION, frame, i);
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_stop());
+    TEST_ASSERT_EQUAL_UINT32(3 * RECORDER_BLOCK_FRAMES + 1, recorder.stats.frames_dropped);    // Ring keeps size - 1
+    TEST_ASSERT_EQUAL_UINT32(4, recorder.stats.events_dropped);
+
+    // Both sessions on flash; samples intact wherever they were kept
+    TEST_ASSERT_EQUAL(ESP_OK, recorder_mount(&test_rec, st));
+    test_collect_t c = { 0 };
+    recorder_read(&test_rec, test_scratch, test_visit, &c);
+    TEST_ASSERT_EQUAL_UINT32(2, c.sessions);
+    TEST_ASSERT_EQUAL_UINT32(1 + RECORDER_EVENT_SLOTS, c.events);
+    TEST_ASSERT_EQUAL_UINT32(0, c.mismatches);
+    TEST_ASSERT_EQUAL_UINT32(1, c.gaps);
+    TEST_ASSERT_EQUAL_UINT32(frame, c.next_stamp);
+}
@@ -0,0 +1,111 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdbool.h>
+    #include <stdio.h>                  // Golden files
+
+    /* --- ADC --- */
+    #include "adc.h"                    // Pipeline, tap, ADC_EVENT_*
+    #include "adc_source.h"             // Recorded / synthetic sources
+
+
+// =============================
+// Replay Log (What the Pipeline Decided)
+// =============================
+//
+// A replay pushes a whole source through adc_process_block() (bandpass -> detect, the code the
+// device runs) from a fresh pipeline state, as fast as the CPU allows, and logs every event the
+// detector raised with the index of the frame that raised it:
+//
+//      blink      : blink_count went up
+//      attention  : attention_level changed (checked every ATTENTION_UPDATE_SAMPLES frames)
+//
+// Frame indices (not wall time) make two runs of the same file comparable on any machine.
+// The event array is the caller's; events past `cap` are counted in `dropped`.
+typedef struct {
+    uint32_t frame;                 // Frame (sample) index in the source
+    uint8_t  event;                 // ADC_EVENT_BLINK / ADC_EVENT_ATTENTION
+    uint8_t  level;                 // Attention level (attention events)
+} replay_event_t;
+
+typedef struct {
+    replay_event_t *events;
+    size_t   cap;
+    size_t   count;
+    uint32_t dropped;
+    uint64_t frames;                // Frames replayed
+    uint8_t  channels;
+    float    sample_rate_hz;
+} replay_log_t;
+
+typedef struct {
+    double   wall_s;                // Pipeline time only (source reads included)
+    double   samples_per_s;         // frames x channels / wall_s
+    double   realtime_x;            // Seconds of EEG per second of CPU
+} replay_stats_t;
+
+static inline void replay_log_init(replay_log_t *log, replay_event_t *events, size_t cap) {
+    *log = (replay_log_t){ .events = events, .cap = cap };
+}
+
+
+// =============================
+// Golden Comparison
+// =============================
+//
+// A golden file is the log of a trusted run, one line per event:
+//
+//      # eeg replay golden v1
+//      frames,<n>  channels,<n>  rate_hz,<f>     (one per line)
+//      blink,<frame>
+//      attention,<frame>,<level>
+//
+// Blinks match when they are at most `blink_frames` apart. Attention is compared as a step
+// function on every ATTENTION_UPDATE_SAMPLES tick: a tick fails when the levels differ by more
+// than `attention_level`, and up to `attention_ticks` failed ticks are allowed.
+typedef struct {
+    uint32_t blink_frames;
+    uint8_t  attention_level;
+    uint32_t attention_ticks;
+} replay_tolerance_t;
+
+#define REPLAY_TOLERANCE_DEFAULT { .blink_frames = 2, .attention_level = 2, .attention_ticks = 0 }
+
+typedef struct {
+    bool     frames_match;          // Same length, channel count and rate
+    uint32_t blinks_matched;
+    uint32_t blinks_missing;        // In the golden run, not in this one
+    uint32_t blinks_extra;          // In this run, not in the golden one
+    uint32_t blink_max_shift;       // Largest |frame difference| of a matched blink
+    uint32_t attention_ticks;       // Ticks compared
+    uint32_t attention_failed;      // Ticks beyond the level tolerance
+    uint8_t  attention_max_diff;
+} replay_diff_t;
+
+
+// =============================
+// Replay API
+// =============================
+// Resets the pipeline (filter, trackers, blink detector, counters), replays `src` to its end
+// and logs the events. Takes the recording tap for the duration of the run. Returns the number
+// of frames replayed (0 if the source does not match the pipeline's channel count).
+size_t replay_run(adc_source_t *src, replay_log_t *log, replay_stats_t *stats);
+
+// Golden file I/O; write returns false on an I/O error, read on a malformed line or if the
+// log holds fewer events than the file (the log is filled up to its cap either way).
+bool replay_golden_write(FILE *fp, const replay_log_t *log);
+bool replay_golden_read(FILE *fp, replay_log_t *log);
+
+// True if `run` is within `tol` of `golden`; `diff` (optional) receives the details.
+bool replay_compare(const replay_log_t *golden, const replay_log_t *run, const replay_tolerance_t *tol,
+                    replay_diff_t *diff);
+
+
+#endif // REPLAY_H
@@ -0,0 +1,234 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "replay.h"
+    #include <stdlib.h>      // For strtoul / strtod
+    #include <string.h>      // For strncmp
+    #include "esp_timer.h"   // Replay wall time
+
+
+// =============================
+// Event Capture (Recording Tap)
+// =============================
+// The tap hands over the acquisition stamp of the frame that fired; replay_run stamps frames
+// at their nominal sample times, so the stamp turns back into a frame index within the block.
+static replay_log_t *replay_log = NULL;
+static uint64_t replay_block_first = 0;       // Frame index of the block being processed
+static uint32_t replay_block_stamp = 0;       // Its stamp
+
+static void replay_tap_event(uint32_t event, uint32_t stamp_us, uint32_t value) {
+
+    replay_log_t *log = replay_log;
+    if (log == NULL) return;
+    if (log->count == log->cap) {
+        log->dropped++;
+        return;
+    }
+
+    uint32_t frame = (uint32_t)(replay_block_first + (stamp_us - replay_block_stamp) / ADC_SAMPLE_PERIOD_US);
+    log->events[log->count++] = (replay_event_t){
+        .frame = frame,
+        .event = (uint8_t)event,
+        .level = event == ADC_EVENT_ATTENTION ? (uint8_t)value : 0,
+    };
+}
+
+static const adc_tap_t replay_tap = {
+    .frames = NULL,
+    .event = replay_tap_event,
+};
+
+
+// =============================
+// Replay Run
+// =============================
+size_t replay_run(adc_source_t *src, replay_log_t *log, replay_stats_t *stats) {
+
+    static int16_t block[ADC_DRAIN_BLOCK * ADC_NUM_CHANNELS];
+    uint32_t stamps[ADC_DRAIN_BLOCK];
+
+    log->count = 0;
+    log->dropped = 0;
+    log->frames = 0;
+    log->channels = src->channels;
+    log->sample_rate_hz = (float)SAMPLE_RATE_HZ;
+    if (stats) *stats = (replay_stats_t){ 0 };
+    if (src->channels != ADC_NUM_CHANNELS) return 0;
+
+    // --- 1. Fresh pipeline: the same file must always give the same events ---
+    adc_pipeline_init();
+    blink_count = 0;
+    attention_level = 0;
+
+    replay_log = log;
+    adc_set_tap(&replay_tap);
+
+    // --- 2. Source -> pipeline, nominal sample times as acquisition stamps ---
+    uint64_t frames = 0;
+    int64_t t0 = esp_timer_get_time();
+    for (;;) {
+        size_t count = adc_source_read(src, block, ADC_DRAIN_BLOCK);
+        if (count == 0) break;
+
+        for (size_t i = 0; i < count; i++) stamps[i] = (uint32_t)((frames + i) * ADC_SAMPLE_PERIOD_US);
+        replay_block_first = frames;
+        replay_block_stamp = stamps[0];
+
+        adc_process_block(block, stamps, count);
+        frames += count;
+    }
+    int64_t wall_us = esp_timer_get_time() - t0;
+
+    adc_set_tap(NULL);
+    replay_log = NULL;
+    log->frames = frames;
+
+    // --- 3. Throughput ---
+    if (stats) {
+        stats->wall_s = (double)wall_us * 1e-6;
+        double wall = stats->wall_s > 0.0 ? stats->wall_s : 1e-6;
+        stats->samples_per_s = (double)frames * ADC_NUM_CHANNELS / wall;
+        stats->realtime_x = (double)frames / SAMPLE_RATE_HZ / wall;
+    }
+    return (size_t)frames;
+}
+
+
+// =============================
+// Golden File I/O
+// =============================
+bool replay_golden_write(FILE *fp, const replay_log_t *log) {
+
+    fprintf(fp, "# eeg replay golden v1\n");
+    fprintf(fp, "frames,%llu\n", (unsigned long long)log->frames);
+    fprintf(fp, "channels,%u\n", log->channels);
+    fprintf(fp, "rate_hz,%.3f\n", (double)log->sample_rate_hz);
+
+    for (size_t i = 0; i < log->count; i++) {
+        const replay_event_t *e = &log->events[i];
+        if (e->event == ADC_EVENT_BLINK) fprintf(fp, "blink,%lu\n", (unsigned long)e->frame);
+        else fprintf(fp, "attention,%lu,%u\n", (unsigned long)e->frame, e->level);
+    }
+    return fflush(fp) == 0 && !ferror(fp);
+}
+
+bool replay_golden_read(FILE *fp, replay_log_t *log) {
+
+    char line[96];
+    bool ok = true;
+    log->count = 0;
+    log->dropped = 0;
+
+    while (fgets(line, sizeof(line), fp)) {
+
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') continue;
+        char *comma = strchr(line, ',');
+        if (comma == NULL) {
+            ok = false;
+            continue;
+        }
+        char *end;
+
+        if (strncmp(line, "frames,", 7) == 0) {
+            log->frames = strtoull(comma + 1, NULL, 10);
+        } else if (strncmp(line, "channels,", 9) == 0) {
+            log->channels = (uint8_t)strtoul(comma + 1, NULL, 10);
+        } else if (strncmp(line, "rate_hz,", 8) == 0) {
+            log->sample_rate_hz = (float)strtod(comma + 1, NULL);
+        } else if (strncmp(line, "blink,", 6) == 0 || strncmp(line, "attention,", 10) == 0) {
+
+            replay_event_t e = { .event = line[0] == 'b' ? ADC_EVENT_BLINK : ADC_EVENT_ATTENTION };
+            e.frame = (uint32_t)strtoul(comma + 1, &end, 10);
+            if (end == comma + 1) {
+                ok = false;
+                continue;
+            }
+            if (e.event == ADC_EVENT_ATTENTION) {
+                if (*end != ',') {
+                    ok = false;
+                    continue;
+                }
+                e.level = (uint8_t)strtoul(end + 1, NULL, 10);
+            }
+
+            if (log->count < log->cap) log->events[log->count++] = e;
+            else log->dropped++;
+        } else {
+            ok = false;
+        }
+    }
+    return ok && log->dropped == 0;
+}
+
+
+// =============================
+// Comparison
+// =============================
+// Attention level in force at `frame` (0 before the first change); `*at` walks forward
+static uint8_t attention_at(const replay_log_t *log, uint64_t frame, size_t *at, uint8_t level) {
+    for (; *at < log->count && log->events[*at].frame <= frame; (*at)++) {
+        if (log->events[*at].event == ADC_EVENT_ATTENTION) level = log->events[*at].level;
+    }
+    return level;
+}
+
+static size_t next_blink(const replay_log_t *log, size_t i) {
+    while (i < log->count && log->events[i].event != ADC_EVENT_BLINK) i++;
+    return i;
+}
+
+bool replay_compare(const replay_log_t *golden, const replay_log_t *run, const replay_tolerance_t *tol,
+                    replay_diff_t *diff) {
+
+    replay_diff_t d = { 0 };
+    float rate_diff = golden->sample_rate_hz - run->sample_rate_hz;
+    d.frames_match = golden->frames == run->frames && golden->channels == run->channels &&
+                     rate_diff < 0.01f && rate_diff > -0.01f;
+
+    // --- 1. Blinks: both lists are in frame order; pair them up within the tolerance ---
+    size_t g = next_blink(golden, 0), r = next_blink(run, 0);
+    while (g < golden->count || r < run->count) {
+        if (g < golden->count && r < run->count) {
+            uint32_t fg = golden->events[g].frame, fr = run->events[r].frame;
+            uint32_t shift = fg > fr ? fg - fr : fr - fg;
+            if (shift <= tol->blink_frames) {
+                d.blinks_matched++;
+                if (shift > d.blink_max_shift) d.blink_max_shift = shift;
+                g = next_blink(golden, g + 1);
+                r = next_blink(run, r + 1);
+                continue;
+            }
+            if (fg < fr) {
+                d.blinks_missing++;
+                g = next_blink(golden, g + 1);
+            } else {
+                d.blinks_extra++;
+                r = next_blink(run, r + 1);
+            }
+        } else if (g < golden->count) {
+            d.blinks_missing++;
+            g = next_blink(golden, g + 1);
+        } else {
+            d.blinks_extra++;
+            r = next_blink(run, r + 1);
+        }
+    }
+
+    // --- 2. Attention: step functions sampled on every update tick ---
+    size_t ag = 0, ar = 0;
+    uint8_t lg = 0, lr = 0;
+    uint64_t frames = golden->frames < run->frames ? golden->frames : run->frames;
+    for (uint64_t t = ATTENTION_UPDATE_SAMPLES - 1; t < frames; t += ATTENTION_UPDATE_SAMPLES) {
+        lg = attention_at(golden, t, &ag, lg);
+        lr = attention_at(run, t, &ar, lr);
+        uint8_t delta = lg > lr ? lg - lr : lr - lg;
+        if (delta > d.attention_max_diff) d.attention_max_diff = delta;
+        if (delta > tol->attention_level) d.attention_failed++;
+        d.attention_ticks++;
+    }
+
+    if (diff) *diff = d;
+    return d.frames_match && d.blinks_missing == 0 && d.blinks_extra == 0 &&
+           d.attention_failed <= tol->attention_ticks && golden->dropped == 0 && run->dropped == 0;
+}
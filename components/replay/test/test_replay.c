@@ -0,0 +1,296 @@
+// test_replay.c - Unit tests for the EDF source and the golden-output replay harness
+
+#include "unity.h"
+#include "replay.h"              // Under test
+#include "adc_source.h"          // EDF / CSV / synthetic sources
+#include <stdio.h>               // tmpfile, benchmark output
+
+#define REPLAY_TEST_SECONDS  60
+#define REPLAY_TEST_EVENTS   512
+
+static replay_event_t golden_events[REPLAY_TEST_EVENTS], run_events[REPLAY_TEST_EVENTS];
+static adc_source_synth_t replay_synth;
+
+
+// =============================
+// Helpers: Synthetic Recording + EDF Writer
+// =============================
+static size_t replay_test_frames(void) {
+    return (size_t)(REPLAY_TEST_SECONDS * SAMPLE_RATE_HZ);
+}
+
+// The same deterministic minute of EEG every call (stands in for a recording on disk)
+static adc_source_t *replay_recording(void) {
+    adc_synth_config_t cfg;
+    adc_synth_default_config(&cfg, SAMPLE_RATE_HZ);
+    cfg.duration_frames = replay_test_frames();
+    return adc_source_synth_init(&replay_synth, &cfg, ADC_NUM_CHANNELS);
+}
+
+static void edf_put(FILE *fp, const char *text, int width) {
+    fprintf(fp, "%-*.*s", width, width, text);
+}
+
+// One EDF signal description
+typedef struct {
+    const char *label, *dim;
+    const char *pmin, *pmax, *dmin, *dmax;
+    int spr;
+} edf_sig_t;
+
+static void edf_write_header(FILE *fp, const edf_sig_t *sig, int ns, const char *records, const char *duration) {
+
+    char num[16];
+    edf_put(fp, "0", 8);
+    edf_put(fp, "X X X X", 80);
+    edf_put(fp, "Startdate X X X X", 80);
+    edf_put(fp, "01.01.26", 8);
+    edf_put(fp, "00.00.00", 8);
+    snprintf(num, sizeof(num), "%d", 256 * (ns + 1));
+    edf_put(fp, num, 8);
+    edf_put(fp, "EDF+C", 44);
+    edf_put(fp, records, 8);
+    edf_put(fp, duration, 8);
+    snprintf(num, sizeof(num), "%d", ns);
+    edf_put(fp, num, 4);
+
+    for (int s = 0; s < ns; s++) edf_put(fp, sig[s].label, 16);
+    for (int s = 0; s < ns; s++) edf_put(fp, "AgAgCl electrode", 80);
+    for (int s = 0; s < ns; s++) edf_put(fp, sig[s].dim, 8);
+    for (int s = 0; s < ns; s++) edf_put(fp, sig[s].pmin, 8);
+    for (int s = 0; s < ns; s++) edf_put(fp, sig[s].pmax, 8);
+    for (int s = 0; s < ns; s++) edf_put(fp, sig[s].dmin, 8);
+    for (int s = 0; s < ns; s++) edf_put(fp, sig[s].dmax, 8);
+    for (int s = 0; s < ns; s++) edf_put(fp, "HP:0.1Hz", 80);
+    for (int s = 0; s < ns; s++) {
+        snprintf(num, sizeof(num), "%d", sig[s].spr);
+        edf_put(fp, num, 8);
+    }
+    for (int s = 0; s < ns; s++) edf_put(fp, "", 32);
+}
+
+static void edf_put_sample(FILE *fp, int16_t v) {
+    fputc((uint16_t)v & 0xFF, fp);
+    fputc((uint16_t)v >> 8, fp);
+}
+
+
+// =============================
+// Test: EDF Source Scales, Skips Annotations, Stops at a Truncated Record
+// =============================
+void test_edf_source_reads_records(void) {
+
+    static adc_source_edf_t edf;
+    int16_t out[16 * 3];
+
+    // Fp1 in µV (0.1 µV per step), an EDF+ annotation signal, Fp2 in mV (1 µV per step)
+    const edf_sig_t sig[3] = {
+        { "EEG Fp1", "uV", "-3276.8", "3276.7", "-32768", "32767", 4 },
+        { "EDF Annotations", "", "-1", "1", "-32768", "32767", 3 },
+        { "EEG Fp2", "mV", "-1", "1", "-1000", "1000", 4 },
+    };
+
+    FILE *fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+    edf_write_header(fp, sig, 3, "-1", "0.5");       // Record count unknown: read to the end
+    for (int rec = 0; rec < 3; rec++) {
+        for (int i = 0; i < 4; i++) edf_put_sample(fp, (int16_t)(100 * (rec * 4 + i)));   // Fp1
+        for (int i = 0; i < 3; i++) edf_put_sample(fp, 0x2B2B);                             // Annotations
+        for (int i = 0; i < 4; i++) edf_put_sample(fp, (int16_t)(-(rec * 4 + i)));        // Fp2
+    }
+    edf_put_sample(fp, 1);                           // Torn fourth record
+    rewind(fp);
+
+    // --- 1. Two channels: annotations skipped, both scaled to µV ---
+    adc_source_t *src = adc_source_edf_attach(&edf, fp, 2);
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_EQUAL_FLOAT(8.0f, src->sample_rate_hz);     // 4 samples per 0.5 s record
+    TEST_ASSERT_EQUAL_STRING("EEG Fp2", edf.label[1]);
+
+    TEST_ASSERT_EQUAL(5, adc_source_read(src, out, 5));     // Across a record boundary
+    TEST_ASSERT_EQUAL(7, adc_source_read(src, out + 10, 16));
+    for (int i = 0; i < 12; i++) {
+        TEST_ASSERT_EQUAL_INT16(10 * i, out[2 * i]);        // 100 steps x 0.1 µV
+        TEST_ASSERT_EQUAL_INT16(-i, out[2 * i + 1]);        // 1 step x 1 µV
+    }
+    TEST_ASSERT_EQUAL(0, adc_source_read(src, out, 16));    // Truncated record = end of stream
+
+    // --- 2. Three channels from two signals: the last one repeats ---
+    src = adc_source_edf_attach(&edf, fp, 3);
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_EQUAL(4, adc_source_read(src, out, 4));
+    TEST_ASSERT_EQUAL_INT16(out[4], out[5]);
+
+    // --- 3. Not EDF, mixed rates, missing file ---
+    rewind(fp);
+    fputc('1', fp);
+    rewind(fp);
+    TEST_ASSERT_NULL(adc_source_edf_attach(&edf, fp, 1));
+    fclose(fp);
+
+    const edf_sig_t mixed[2] = {
+        { "EEG Fp1", "uV", "-100", "100", "-2048", "2047", 4 },
+        { "EEG Fp2", "uV", "-100", "100", "-2048", "2047", 8 },
+    };
+    fp = tmpfile();
+    edf_write_header(fp, mixed, 2, "1", "1");
+    rewind(fp);
+    TEST_ASSERT_NULL(adc_source_edf_attach(&edf, fp, 2));
+    TEST_ASSERT_NOT_NULL(adc_source_edf_attach(&edf, fp, 1));   // One signal alone is fine
+    fclose(fp);
+
+    TEST_ASSERT_NULL(adc_source_edf_open(&edf, "/nonexistent/eeg.edf", 1));
+}
+
+
+// =============================
+// Test: Golden Round Trip + Tolerances
+// =============================
+void test_replay_golden_compare(void) {
+
+    replay_log_t golden, run;
+    replay_diff_t diff;
+    const replay_tolerance_t tol = REPLAY_TOLERANCE_DEFAULT;
+
+    replay_log_init(&golden, golden_events, REPLAY_TEST_EVENTS);
+    replay_log_init(&run, run_events, REPLAY_TEST_EVENTS);
+
+    // --- 1. Record a golden run, write it out, read it back ---
+    TEST_ASSERT_EQUAL(replay_test_frames(), replay_run(replay_recording(), &run, NULL));
+    TEST_ASSERT_TRUE(run.count > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, run.dropped);
+
+    FILE *fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+    TEST_ASSERT_TRUE(replay_golden_write(fp, &run));
+    rewind(fp);
+    TEST_ASSERT_TRUE(replay_golden_read(fp, &golden));
+    fclose(fp);
+    TEST_ASSERT_EQUAL(run.count, golden.count);
+    TEST_ASSERT_EQUAL_MEMORY(run.events, golden.events, run.count * sizeof(replay_event_t));
+
+    // --- 2. A second run is identical (fresh pipeline state every time) ---
+    TEST_ASSERT_EQUAL(replay_test_frames(), replay_run(replay_recording(), &run, NULL));
+    TEST_ASSERT_TRUE(replay_compare(&golden, &run, &tol, &diff));
+    TEST_ASSERT_EQUAL_UINT32(0, diff.blink_max_shift);
+    TEST_ASSERT_EQUAL_UINT32(0, diff.attention_failed);
+    TEST_ASSERT_EQUAL_UINT32(replay_test_frames() / ATTENTION_UPDATE_SAMPLES, diff.attention_ticks);
+    printf("golden: %u blinks, %u attention ticks over %d s\n",
+           (unsigned)diff.blinks_matched, (unsigned)diff.attention_ticks, REPLAY_TEST_SECONDS);
+
+    // --- 3. Detection moves: within tolerance, then beyond it ---
+    size_t b = 0;
+    while (run.events[b].event != ADC_EVENT_BLINK) b++;
+    run.events[b].frame += tol.blink_frames;
+    TEST_ASSERT_TRUE(replay_compare(&golden, &run, &tol, &diff));
+    TEST_ASSERT_EQUAL_UINT32(tol.blink_frames, diff.blink_max_shift);
+
+    run.events[b].frame += 1;
+    TEST_ASSERT_FALSE(replay_compare(&golden, &run, &tol, &diff));
+    TEST_ASSERT_EQUAL_UINT32(1, diff.blinks_missing);
+    TEST_ASSERT_EQUAL_UINT32(1, diff.blinks_extra);
+    run.events[b].frame -= tol.blink_frames + 1;
+
+    size_t a = 0;
+    while (run.events[a].event != ADC_EVENT_ATTENTION) a++;
+    run.events[a].level += tol.attention_level + 1;
+    TEST_ASSERT_FALSE(replay_compare(&golden, &run, &tol, &diff));
+    TEST_ASSERT_TRUE(diff.attention_failed > 0);
+    TEST_ASSERT_EQUAL_UINT8(tol.attention_level + 1, diff.attention_max_diff);
+    run.events[a].level -= tol.attention_level + 1;
+
+    // A blink dropped, a recording cut short
+    run.events[b].event = ADC_EVENT_ATTENTION;
+    run.events[b].level = run.events[a].level;
+    TEST_ASSERT_FALSE(replay_compare(&golden, &run, &tol, &diff));
+    TEST_ASSERT_EQUAL_UINT32(1, diff.blinks_missing);
+    run.events[b].event = ADC_EVENT_BLINK;
+    run.frames--;
+    TEST_ASSERT_FALSE(replay_compare(&golden, &run, &tol, &diff));
+    TEST_ASSERT_FALSE(diff.frames_match);
+
+    // Malformed golden file
+    fp = tmpfile();
+    fputs("# eeg replay golden v1\nframes,10\nblink\n", fp);
+    rewind(fp);
+    TEST_ASSERT_FALSE(replay_golden_read(fp, &golden));
+    fclose(fp);
+}
+
+
+// =============================
+// Test: CSV + EDF Recordings Replay Like the Original, Throughput
+// =============================
+void test_replay_file_formats_throughput(void) {
+
+    static adc_source_file_t csv;
+    static adc_source_edf_t edf;
+    static int16_t block[ADC_DRAIN_BLOCK * ADC_NUM_CHANNELS];
+    replay_log_t golden, run;
+    replay_stats_t stats;
+    replay_diff_t diff;
+    const replay_tolerance_t exact = { 0 };
+    size_t n;
+
+    replay_log_init(&golden, golden_events, REPLAY_TEST_EVENTS);
+    replay_log_init(&run, run_events, REPLAY_TEST_EVENTS);
+    replay_run(replay_recording(), &golden, &stats);
+    printf("replay synthetic : %.2f Msamples/s (%.0fx real time)\n", stats.samples_per_s * 1e-6, stats.realtime_x);
+
+    // --- 1. CSV: one frame per line ---
+    FILE *fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+    fputs("# exported recording\n", fp);
+    adc_source_t *rec = replay_recording();
+    while ((n = adc_source_read(rec, block, ADC_DRAIN_BLOCK)) > 0) {
+        for (size_t i = 0; i < n * ADC_NUM_CHANNELS; i++) {
+            fprintf(fp, (i % ADC_NUM_CHANNELS) ? ",%d" : "%d", block[i]);
+            if (i % ADC_NUM_CHANNELS == ADC_NUM_CHANNELS - 1) fputc('\n', fp);
+        }
+    }
+    rewind(fp);
+    adc_source_t *src = adc_source_file_attach(&csv, fp, ADC_FILE_CSV, ADC_NUM_CHANNELS, SAMPLE_RATE_HZ);
+    TEST_ASSERT_EQUAL(replay_test_frames(), replay_run(src, &run, &stats));
+    TEST_ASSERT_TRUE(replay_compare(&golden, &run, &exact, &diff));
+    printf("replay csv       : %.2f Msamples/s (%.0fx real time)\n", stats.samples_per_s * 1e-6, stats.realtime_x);
+    fclose(fp);
+
+    // --- 2. EDF: one ADC_DRAIN_BLOCK per record, digital = µV ---
+    edf_sig_t sig[ADC_NUM_CHANNELS];
+    static char labels[ADC_NUM_CHANNELS][16];
+    for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+        snprintf(labels[ch], sizeof(labels[ch]), "EEG %d", ch);
+        sig[ch] = (edf_sig_t){ labels[ch], "uV", "-32768", "32767", "-32768", "32767", ADC_DRAIN_BLOCK };
+    }
+    char records[16], duration[16];
+    snprintf(records, sizeof(records), "%u", (unsigned)(replay_test_frames() / ADC_DRAIN_BLOCK));
+    snprintf(duration, sizeof(duration), "%g", ADC_DRAIN_BLOCK / (double)SAMPLE_RATE_HZ);
+
+    fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+    edf_write_header(fp, sig, ADC_NUM_CHANNELS, records, duration);
+    rec = replay_recording();
+    while ((n = adc_source_read(rec, block, ADC_DRAIN_BLOCK)) == ADC_DRAIN_BLOCK) {
+        for (int ch = 0; ch < ADC_NUM_CHANNELS; ch++) {
+            for (size_t i = 0; i < n; i++) edf_put_sample(fp, block[i * ADC_NUM_CHANNELS + ch]);
+        }
+    }
+    rewind(fp);
+    src = adc_source_edf_attach(&edf, fp, ADC_NUM_CHANNELS);
+    TEST_ASSERT_NOT_NULL(src);
+    TEST_ASSERT_EQUAL_FLOAT((float)SAMPLE_RATE_HZ, src->sample_rate_hz);
+
+    // Whole records only: compare against a golden run of the same length
+    size_t edf_frames = replay_test_frames() / ADC_DRAIN_BLOCK * ADC_DRAIN_BLOCK;
+    TEST_ASSERT_EQUAL(edf_frames, replay_run(src, &run, &stats));
+    if (edf_frames != replay_test_frames()) {
+        adc_synth_config_t cfg = replay_synth.cfg;
+        cfg.duration_frames = edf_frames;
+        replay_run(adc_source_synth_init(&replay_synth, &cfg, ADC_NUM_CHANNELS), &golden, NULL);
+    }
+    TEST_ASSERT_TRUE(replay_compare(&golden, &run, &exact, &diff));
+    printf("replay edf       : %.2f Msamples/s (%.0fx real time)\n", stats.samples_per_s * 1e-6, stats.realtime_x);
+    fclose(fp);
+
+    TEST_ASSERT_TRUE(stats.realtime_x > 1.0);
+}
@@ -0,0 +1,120 @@
+#ifndef TASK_LAYOUT_H
+#define TASK_LAYOUT_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdint.h>
+    #include <stddef.h>
+    #include <stdio.h>                    // FILE (console report)
+    #include "freertos/FreeRTOS.h"
+    #include "freertos/task.h"
+    #include "esp_err.h"
+    #include "mem_budget.h"               // Static footprint table
+
+
+// =============================
+// Pipeline Tasks (Roles)
+// =============================
+//
+// Every task app_main() starts gets one slot in a layout. The role fixes the task name; the
+// layout fixes where it runs (core), how urgent it is (priority) and its stack.
+typedef enum {
+    TASK_ROLE_SAMPLING = 0,     // adc_sampling
+    TASK_ROLE_FILTERING,        // adc_filtering (bandpass -> detect -> spectral)
+    TASK_ROLE_BLE_NOTIFY,       // ble_notifications
+    TASK_ROLE_BLE_STREAM,       // ble_streaming
+    TASK_ROLE_RECORDER,         // recorder_task (session log to flash)
+    TASK_ROLE_COUNT
+} task_role_t;
+
+
+// =============================
+// Task Layout Table
+// =============================
+//
+// A layout is a declarative table: one { core, priority, stack } slot per role, applied with
+// xTaskCreatePinnedToCore(). On the ESP32 Bluedroid and the BT controller already live on
+// PRO_CPU (core 0), so the presets differ mostly in what shares that core with them.
+//
+//      unpinned      : legacy layout, no affinity (the scheduler picks a core per wake-up)
+//      split         : acquisition + DSP on APP_CPU, BLE tasks on PRO_CPU next to Bluedroid
+//      pro_only      : everything on PRO_CPU (single-core baseline)
+//      acq_isolated  : sampling alone on APP_CPU, DSP shares PRO_CPU with BLE
+//
+// Pick one at build time with TASK_LAYOUT_PRESET (e.g. -DTASK_LAYOUT_PRESET=\"pro_only\").
+// Cores that do not exist on the target (single-core chips) fall back to no affinity.
+#define TASK_CORE_PRO   0
+#define TASK_CORE_APP   1
+#define TASK_CORE_ANY   (-1)
+#define TASK_LAYOUT_MAX_CORES  2
+#define TASK_LAYOUT_MIN_STACK  1024       // Bytes; below this ESP_LOG alone can overflow
+
+#ifndef TASK_LAYOUT_PRESET
+#define TASK_LAYOUT_PRESET  "split"
+#endif
+
+// Stack per role (bytes). Every preset uses these; in the static build they also size the
+// per-role stack arrays, so a slot may ask for less but never for more.
+#define TASK_STACK_SAMPLING    2048
+#define TASK_STACK_FILTERING   2048
+#define TASK_STACK_BLE_NOTIFY  4096
+#define TASK_STACK_BLE_STREAM  3072
+#define TASK_STACK_RECORDER    3072
+
+// Static build (-DTASK_LAYOUT_STATIC=1): tasks are created with xTaskCreateStaticPinnedToCore()
+// on per-role stacks and TCBs in .bss, so starting the pipeline takes nothing from the heap and
+// the whole footprint shows up in the memory budget (mem_budget.h). The storage belongs to the
+// role for good: a layout can only be applied once per boot.
+#ifndef TASK_LAYOUT_STATIC
+#define TASK_LAYOUT_STATIC  0
+#endif
+
+typedef struct {
+    int8_t   core;              // TASK_CORE_PRO / TASK_CORE_APP / TASK_CORE_ANY
+    uint8_t  priority;          // 1 .. configMAX_PRIORITIES - 1
+    uint16_t stack;             // Bytes (ESP-IDF FreeRTOS counts stack in bytes)
+} task_slot_t;
+
+typedef struct {
+    const char *name;
+    const char *summary;
+    task_slot_t task[TASK_ROLE_COUNT];
+} task_layout_t;
+
+extern const task_layout_t task_layouts[];
+extern const size_t task_layout_count;
+
+
+// =============================
+// Task Layout API
+// =============================
+const char *task_role_name(task_role_t role);     // Task name passed to FreeRTOS
+const task_layout_t *task_layout_find(const char *name);   // NULL if unknown
+
+// Stack a role may use at most (TASK_STACK_*)
+uint16_t task_role_stack_max(task_role_t role);
+
+// ESP_ERR_INVALID_ARG if any slot has a bad core, priority or stack (static build: larger than
+// task_role_stack_max()).
+esp_err_t task_layout_validate(const task_layout_t *layout);
+
+// Creates one task per role: `entry[role]` runs with a NULL argument (NULL entry = role not
+// started, e.g. no recorder partition). Nothing is created if the layout is invalid. Tasks that fail to start are logged and skipped (ESP_FAIL is returned);
+// the rest keep running. The static build refuses a second apply (ESP_ERR_INVALID_STATE).
+esp_err_t task_layout_apply(const task_layout_t *layout, const TaskFunction_t entry[TASK_ROLE_COUNT]);
+
+const task_layout_t *task_layout_active(void);    // NULL until task_layout_apply()
+TaskHandle_t task_layout_handle(task_role_t role);
+
+// Active layout: role, core, priority, stack and stack high-water mark (bytes never used).
+void task_layout_print(FILE *fp);
+
+// Task stacks + TCBs in the static build, the handle table otherwise (stacks then come from
+// the heap and show up in the heap marks instead)
+extern const mem_budget_table_t task_layout_mem_budget;
+
+
+#endif // TASK_LAYOUT_H
@@ -0,0 +1,26 @@
+#ifndef TASK_LAYOUT_CONSOLE_H
+#define TASK_LAYOUT_CONSOLE_H
+
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include "esp_err.h"
+
+
+// =============================
+// Console Command: layout
+// =============================
+//
+//      layout          active layout (core / prio / stack / stack high-water) + one 'measure'
+//                      line: sampling jitter and blink notification latency under this layout
+//      layout list     compiled-in presets
+//      layout reset    clear the latency histograms to start a fresh measurement
+//
+// The 'measure' line is key=value so runs of different presets can be collected and compared
+// (flash with -DTASK_LAYOUT_PRESET=..., 'layout reset', let it run, 'layout'). Device only.
+esp_err_t task_layout_console_register(void);
+
+
+#endif // TASK_LAYOUT_CONSOLE_H
@@ -0,0 +1,213 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include "task_layout.h"
+    #include "esp_log.h"
+    #include <string.h>                   // For strcmp
+
+static const char *TASKS_TAG = "TASKS";
+
+
+// =============================
+// Presets
+// =============================
+// Slots in task_role_t order: sampling, filtering, BLE notify, BLE stream, recorder.
+// Pinned presets put sampling above everything else on its core; where filtering shares a core
+// with ble_notifications it stays below it, so a blink preempts the filter and goes out at once.
+// The recorder sits under everything: it has seconds of staging slack and spends most of its
+// time waiting on flash.
+const task_layout_t task_layouts[] = {
+    { "unpinned",     "legacy: no affinity, scheduler picks the core", {
+        { TASK_CORE_ANY,  5, TASK_STACK_SAMPLING },
+        { TASK_CORE_ANY,  4, TASK_STACK_FILTERING },
+        { TASK_CORE_ANY,  5, TASK_STACK_BLE_NOTIFY },
+        { TASK_CORE_ANY,  3, TASK_STACK_BLE_STREAM },
+        { TASK_CORE_ANY,  2, TASK_STACK_RECORDER },
+    } },
+    { "split",        "acquisition + DSP on APP_CPU, BLE on PRO_CPU", {
+        { TASK_CORE_APP, 10, TASK_STACK_SAMPLING },
+        { TASK_CORE_APP,  8, TASK_STACK_FILTERING },
+        { TASK_CORE_PRO,  5, TASK_STACK_BLE_NOTIFY },
+        { TASK_CORE_PRO,  3, TASK_STACK_BLE_STREAM },
+        { TASK_CORE_PRO,  2, TASK_STACK_RECORDER },
+    } },
+    { "pro_only",     "everything on PRO_CPU with Bluedroid", {
+        { TASK_CORE_PRO, 10, TASK_STACK_SAMPLING },
+        { TASK_CORE_PRO,  4, TASK_STACK_FILTERING },
+        { TASK_CORE_PRO,  5, TASK_STACK_BLE_NOTIFY },
+        { TASK_CORE_PRO,  3, TASK_STACK_BLE_STREAM },
+        { TASK_CORE_PRO,  2, TASK_STACK_RECORDER },
+    } },
+    { "acq_isolated", "sampling alone on APP_CPU, DSP + BLE on PRO_CPU", {
+        { TASK_CORE_APP, 10, TASK_STACK_SAMPLING },
+        { TASK_CORE_PRO,  4, TASK_STACK_FILTERING },
+        { TASK_CORE_PRO,  5, TASK_STACK_BLE_NOTIFY },
+        { TASK_CORE_PRO,  3, TASK_STACK_BLE_STREAM },
+        { TASK_CORE_PRO,  2, TASK_STACK_RECORDER },
+    } },
+};
+const size_t task_layout_count = sizeof(task_layouts) / sizeof(task_layouts[0]);
+
+static const char *const role_names[TASK_ROLE_COUNT] = {
+    "ADC Sampling", "ADC Filtering", "BLE Notifications", "BLE Stream", "Recorder",
+};
+
+static const uint16_t role_stack_max[TASK_ROLE_COUNT] = {
+    TASK_STACK_SAMPLING, TASK_STACK_FILTERING, TASK_STACK_BLE_NOTIFY, TASK_STACK_BLE_STREAM, TASK_STACK_RECORDER,
+};
+
+static const task_layout_t *active_layout = NULL;
+static TaskHandle_t role_handles[TASK_ROLE_COUNT];
+
+
+// =============================
+// Static Build: Per-Role Stacks + TCBs
+// =============================
+#if TASK_LAYOUT_STATIC
+static StackType_t stack_sampling[TASK_STACK_SAMPLING / sizeof(StackType_t)];
+static StackType_t stack_filtering[TASK_STACK_FILTERING / sizeof(StackType_t)];
+static StackType_t stack_ble_notify[TASK_STACK_BLE_NOTIFY / sizeof(StackType_t)];
+static StackType_t stack_ble_stream[TASK_STACK_BLE_STREAM / sizeof(StackType_t)];
+static StackType_t stack_recorder[TASK_STACK_RECORDER / sizeof(StackType_t)];
+static StaticTask_t role_tcbs[TASK_ROLE_COUNT];
+
+static StackType_t *const role_stacks[TASK_ROLE_COUNT] = {
+    stack_sampling, stack_filtering, stack_ble_notify, stack_ble_stream, stack_recorder,
+};
+
+static const mem_budget_item_t task_layout_mem_items[] = {
+    MEM_BUDGET_ITEM(stack_sampling),
+    MEM_BUDGET_ITEM(stack_filtering),
+    MEM_BUDGET_ITEM(stack_ble_notify),
+    MEM_BUDGET_ITEM(stack_ble_stream),
+    MEM_BUDGET_ITEM(stack_recorder),
+    MEM_BUDGET_ITEM(role_tcbs),
+    MEM_BUDGET_ITEM(role_handles),
+};
+#else
+static const mem_budget_item_t task_layout_mem_items[] = {
+    MEM_BUDGET_ITEM(role_handles),
+};
+#endif
+const mem_budget_table_t task_layout_mem_budget = MEM_BUDGET_TABLE("tasks", task_layout_mem_items);
+
+
+// =============================
+// Lookup + Validation
+// =============================
+const char *task_role_name(task_role_t role) {
+    return role < TASK_ROLE_COUNT ? role_names[role] : "?";
+}
+
+uint16_t task_role_stack_max(task_role_t role) {
+    return role < TASK_ROLE_COUNT ? role_stack_max[role] : 0;
+}
+
+const task_layout_t *task_layout_find(const char *name) {
+    for (size_t i = 0; i < task_layout_count; i++) {
+        if (strcmp(task_layouts[i].name, name) == 0) return &task_layouts[i];
+    }
+    return NULL;
+}
+
+esp_err_t task_layout_validate(const task_layout_t *layout) {
+
+    if (layout == NULL) return ESP_ERR_INVALID_ARG;
+
+    for (int r = 0; r < TASK_ROLE_COUNT; r++) {
+        const task_slot_t *slot = &layout->task[r];
+        if (slot->core != TASK_CORE_ANY && (slot->core < 0 || slot->core >= TASK_LAYOUT_MAX_CORES)) return ESP_ERR_INVALID_ARG;
+        if (slot->priority < 1 || slot->priority >= configMAX_PRIORITIES) return ESP_ERR_INVALID_ARG;
+        if (slot->stack < TASK_LAYOUT_MIN_STACK) return ESP_ERR_INVALID_ARG;
+        if (TASK_LAYOUT_STATIC && slot->stack > role_stack_max[r]) return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+
+// =============================
+// Apply: One Pinned Task per Role
+// =============================
+// Core the task actually gets: cores the target lacks (single-core chips) become "any".
+static BaseType_t slot_core(const task_slot_t *slot) {
+    return (slot->core == TASK_CORE_ANY || slot->core >= portNUM_PROCESSORS) ? tskNO_AFFINITY : slot->core;
+}
+
+esp_err_t task_layout_apply(const task_layout_t *layout, const TaskFunction_t entry[TASK_ROLE_COUNT]) {
+
+    if (task_layout_validate(layout) != ESP_OK) {
+        ESP_LOGE(TASKS_TAG, "Invalid task layout '%s'", layout ? layout->name : "(null)");
+        return ESP_ERR_INVALID_ARG;
+    }
+
+#if TASK_LAYOUT_STATIC
+    if (active_layout != NULL) {
+        ESP_LOGE(TASKS_TAG, "Task layout already applied; static task storage is in use");
+        return ESP_ERR_INVALID_STATE;
+    }
+#endif
+
+    esp_err_t ret = ESP_OK;
+    active_layout = layout;
+    ESP_LOGI(TASKS_TAG, "Task layout '%s': %s", layout->name, layout->summary);
+
+    for (int r = 0; r < TASK_ROLE_COUNT; r++) {
+
+        const task_slot_t *slot = &layout->task[r];
+        BaseType_t core = slot_core(slot);
+
+        role_handles[r] = NULL;
+        if (entry[r] == NULL) continue;
+
+#if TASK_LAYOUT_STATIC
+        role_handles[r] = xTaskCreateStaticPinnedToCore(entry[r], role_names[r], slot->stack, NULL, slot->priority,
+                                                        role_stacks[r], &role_tcbs[r], core);
+        BaseType_t status = role_handles[r] != NULL ? pdPASS : pdFAIL;
+#else
+        BaseType_t status = xTaskCreatePinnedToCore(entry[r], role_names[r], slot->stack, NULL,
+                                                    slot->priority, &role_handles[r], core);
+#endif
+        if (status == pdPASS) {
+            ESP_LOGI(TASKS_TAG, "%s task created (core %d, prio %u, stack %u)", role_names[r],
+                     core == tskNO_AFFINITY ? -1 : (int)core, slot->priority, slot->stack);
+        } else {
+            ESP_LOGE(TASKS_TAG, "Failed to create %s task!", role_names[r]);
+            role_handles[r] = NULL;
+            ret = ESP_FAIL;
+        }
+    }
+
+    return ret;
+}
+
+const task_layout_t *task_layout_active(void) {
+    return active_layout;
+}
+
+TaskHandle_t task_layout_handle(task_role_t role) {
+    return role < TASK_ROLE_COUNT ? role_handles[role] : NULL;
+}
+
+
+// =============================
+// Console Report
+// =============================
+void task_layout_print(FILE *fp) {
+
+    if (active_layout == NULL) {
+        fprintf(fp, "no task layout applied\n");
+        return;
+    }
+
+    fprintf(fp, "layout %s (%s)\n", active_layout->name, active_layout->summary);
+    fprintf(fp, "%-18s %5s %5s %7s %9s\n", "task", "core", "prio", "stack", "free_min");   // core -1 = any
+
+    for (int r = 0; r < TASK_ROLE_COUNT; r++) {
+        const task_slot_t *slot = &active_layout->task[r];
+        unsigned long free_min = role_handles[r] ? (unsigned long)uxTaskGetStackHighWaterMark(role_handles[r]) : 0;
+        BaseType_t core = slot_core(slot);
+        fprintf(fp, "%-18s %5d %5u %7u %9lu\n", role_names[r], core == tskNO_AFFINITY ? -1 : (int)core,
+                slot->priority, slot->stack, free_min);
+    }
+}
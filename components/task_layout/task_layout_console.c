@@ -0,0 +1,77 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    #include <stdio.h>
+    #include <string.h>                 // For strcmp
+    #include "esp_console.h"            // Command registration
+    #include "task_layout_console.h"
+    #include "task_layout.h"
+    #include "latency_hist.h"           // Notification latency per stage
+    #include "adc.h"                    // Sampling jitter (adc_clock_jitter_us)
+
+
+// =============================
+// Measurement Line
+// =============================
+// Jitter comes from the last completed ADC_JITTER_WINDOW_S window; latencies from the
+// histograms since the last reset.
+static void layout_measure(FILE *fp) {
+
+    const task_layout_t *layout = task_layout_active();
+    latency_summary_t acq, notify, e2e, send;
+    latency_hist_summary(&pipeline_latency[LATENCY_STAGE_ACQ_QUEUE], &acq);
+    latency_hist_summary(&pipeline_latency[LATENCY_STAGE_BLINK_NOTIFY], &notify);
+    latency_hist_summary(&pipeline_latency[LATENCY_STAGE_BLINK_E2E], &e2e);
+    latency_hist_summary(&pipeline_latency[LATENCY_STAGE_GATT_SEND], &send);
+
+    fprintf(fp, "measure layout=%s jitter_us=%.1f interval_max_us=%lu missed=%lu "
+                "acq_queue_p99_us=%lu blink_notify_p50_us=%lu blink_notify_p99_us=%lu "
+                "blink_e2e_p99_us=%lu gatt_send_p99_us=%lu blinks=%lu\n",
+            layout ? layout->name : "none", adc_clock_jitter_us, (unsigned long)adc_clock_max_us,
+            (unsigned long)adc_timer_missed, (unsigned long)acq.p99_us,
+            (unsigned long)notify.p50_us, (unsigned long)notify.p99_us,
+            (unsigned long)e2e.p99_us, (unsigned long)send.p99_us, (unsigned long)notify.count);
+}
+
+
+// =============================
+// Command Handler
+// =============================
+static int layout_cmd(int argc, char **argv) {
+
+    if (argc > 1 && strcmp(argv[1], "list") == 0) {
+        for (size_t i = 0; i < task_layout_count; i++) {
+            fprintf(stdout, "%-14s %s\n", task_layouts[i].name, task_layouts[i].summary);
+        }
+        return 0;
+    }
+    if (argc > 1 && strcmp(argv[1], "reset") == 0) {
+        latency_reset_all();
+        printf("latency histograms cleared\n");
+        return 0;
+    }
+    if (argc > 1) {
+        printf("usage: layout [list|reset]\n");
+        return 1;
+    }
+
+    task_layout_print(stdout);
+    layout_measure(stdout);
+    return 0;
+}
+
+
+// =============================
+// Registration
+// =============================
+esp_err_t task_layout_console_register(void) {
+
+    const esp_console_cmd_t cmd = {
+        .command = "layout",
+        .help = "Task layout (core/prio/stack) with sampling jitter + notify latency. 'layout list' shows presets.",
+        .hint = "[list|reset]",
+        .func = layout_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
@@ -0,0 +1,113 @@
+// test_task_layout.c - Unit tests for the declarative task layout table
+
+#include "unity.h"
+#include "task_layout.h"         // Under test
+#include <stdatomic.h>
+#include <string.h>              // For memcpy
+
+
+// =============================
+// Test: Every Preset Is Valid + Findable
+// =============================
+void test_task_layout_presets_valid(void) {
+
+    TEST_ASSERT_TRUE(task_layout_count >= 4);
+    TEST_ASSERT_NOT_NULL(task_layout_find(TASK_LAYOUT_PRESET));     // Build-time default exists
+    TEST_ASSERT_NULL(task_layout_find("no_such_layout"));
+
+    for (size_t i = 0; i < task_layout_count; i++) {
+
+        const task_layout_t *l = &task_layouts[i];
+        TEST_ASSERT_EQUAL(ESP_OK, task_layout_validate(l));
+        TEST_ASSERT_EQUAL_PTR(l, task_layout_find(l->name));
+
+        // Every preset must also fit the static build's per-role stacks
+        for (int r = 0; r < TASK_ROLE_COUNT; r++) {
+            TEST_ASSERT_TRUE(l->task[r].stack <= task_role_stack_max((task_role_t)r));
+        }
+
+        // Sampling never runs below the filter it feeds; where the filter shares a core with
+        // the BLE notifier it stays below it (blink preempts filtering)
+        const task_slot_t *s = l->task;
+        TEST_ASSERT_TRUE(s[TASK_ROLE_SAMPLING].priority >= s[TASK_ROLE_FILTERING].priority);
+        if (s[TASK_ROLE_FILTERING].core == s[TASK_ROLE_BLE_NOTIFY].core) {
+            TEST_ASSERT_TRUE(s[TASK_ROLE_FILTERING].priority < s[TASK_ROLE_BLE_NOTIFY].priority);
+        }
+    }
+
+    // "split" is the layout the request is about: DSP on APP_CPU, BLE on PRO_CPU
+    const task_layout_t *split = task_layout_find("split");
+    TEST_ASSERT_NOT_NULL(split);
+    TEST_ASSERT_EQUAL(TASK_CORE_APP, split->task[TASK_ROLE_FILTERING].core);
+    TEST_ASSERT_EQUAL(TASK_CORE_PRO, split->task[TASK_ROLE_BLE_NOTIFY].core);
+    TEST_ASSERT_EQUAL(TASK_CORE_PRO, split->task[TASK_ROLE_BLE_STREAM].core);
+}
+
+
+// =============================
+// Test: Validation Rejects Bad Slots
+// =============================
+void test_task_layout_validate_rejects(void) {
+
+    task_layout_t bad;
+    memcpy(&bad, task_layout_find("split"), sizeof(bad));
+    TEST_ASSERT_EQUAL(ESP_OK, task_layout_validate(&bad));
+
+    bad.task[TASK_ROLE_FILTERING].core = 2;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, task_layout_validate(&bad));
+    bad.task[TASK_ROLE_FILTERING].core = TASK_CORE_ANY;
+    TEST_ASSERT_EQUAL(ESP_OK, task_layout_validate(&bad));
+
+    bad.task[TASK_ROLE_BLE_STREAM].priority = 0;                      // Idle priority
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, task_layout_validate(&bad));
+    bad.task[TASK_ROLE_BLE_STREAM].priority = configMAX_PRIORITIES;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, task_layout_validate(&bad));
+    bad.task[TASK_ROLE_BLE_STREAM].priority = 3;
+
+    bad.task[TASK_ROLE_SAMPLING].stack = TASK_LAYOUT_MIN_STACK - 1;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, task_layout_validate(&bad));
+
+    // A stack above the role's static array only fits the heap build
+    bad.task[TASK_ROLE_SAMPLING].stack = TASK_STACK_SAMPLING + 512;
+    TEST_ASSERT_EQUAL(TASK_LAYOUT_STATIC ? ESP_ERR_INVALID_ARG : ESP_OK, task_layout_validate(&bad));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, task_layout_validate(NULL));
+}
+
+
+// =============================
+// Test: Apply Starts One Task per Role
+// =============================
+static atomic_uint layout_started;
+
+static void layout_test_task(void *arg) {
+    atomic_fetch_add(&layout_started, 1);
+    while (1) vTaskDelay(pdMS_TO_TICKS(1000));
+}
+
+void test_task_layout_apply(void) {
+
+    TaskFunction_t entry[TASK_ROLE_COUNT];
+    for (int r = 0; r < TASK_ROLE_COUNT; r++) entry[r] = layout_test_task;
+
+    // Invalid layout: nothing created, nothing becomes active
+    task_layout_t bad;
+    memcpy(&bad, task_layout_find("split"), sizeof(bad));
+    bad.task[TASK_ROLE_SAMPLING].stack = 0;
+    atomic_store(&layout_started, 0);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, task_layout_apply(&bad, entry));
+    TEST_ASSERT_NULL(task_layout_active());
+
+    // Valid layout: one running task per role
+    const task_layout_t *split = task_layout_find("split");
+    TEST_ASSERT_EQUAL(ESP_OK, task_layout_apply(split, entry));
+    TEST_ASSERT_EQUAL_PTR(split, task_layout_active());
+
+    for (int wait = 0; wait < 100 && atomic_load(&layout_started) < TASK_ROLE_COUNT; wait++) vTaskDelay(1);
+    TEST_ASSERT_EQUAL_UINT32(TASK_ROLE_COUNT, atomic_load(&layout_started));
+
+    task_layout_print(stdout);
+    for (int r = 0; r < TASK_ROLE_COUNT; r++) {
+        TEST_ASSERT_NOT_NULL(task_layout_handle((task_role_t)r));
+        vTaskDelete(task_layout_handle((task_role_t)r));
+    }
+}
@@ -21,6 +21,10 @@
 
     #include "ble.h"                // Our header
     #include "adc.h"                // For shared adc_buffer/buffer_index access
+    #include "esp_timer.h"          // Notification latency timestamps
+    #include "latency_hist.h"       // Per-stage latency histograms (stats characteristic)
+    #include "power.h"              // Demand from CCCD subscriptions (standby otherwise) + task duty
+    #include <string.h>             // For memcpy
 
 
 // ==============================
@@ -29,6 +33,8 @@
 const uint16_t SERVICE_UUID              = 0x180A;  // "Eye Blink count" service
 const uint16_t CHAR_UUID_BLINK_COUNT     = 0x2A56;  // Service characteristic 1
 const uint16_t CHAR_UUID_ATTENTION_LEVEL = 0x2A57;  // Service characteristic 2
+const uint16_t CHAR_UUID_RAW_STREAM      = 0x2A58;  // Service characteristic 3
+const uint16_t CHAR_UUID_LATENCY_STATS   = 0x2A59;  // Service characteristic 4
 
 // =============================
 // Module-Private Global Handles
@@ -40,6 +46,22 @@ uint8_t service_uuid[2] = {0x0A, 0x18}; // Little-endian for 0x180A
 uint16_t conn_id = 0xFFFF;
 uint16_t blink_handle = 0;      // Blink char attr handle (set in ADD_CHAR_EVT)
 uint16_t attention_handle = 0;  // Attention char attr handle (set in ADD_CHAR_EVT)
+uint16_t stream_handle = 0;     // Raw stream char attr handle (set in ADD_CHAR_EVT)
+uint16_t stats_handle = 0;      // Latency stats char attr handle (set in ADD_CHAR_EVT)
+uint16_t blink_cccd_handle = 0;      // Client Characteristic Configuration descriptors
+uint16_t attention_cccd_handle = 0;  // (set in ADD_CHAR_DESCR_EVT)
+uint16_t stream_cccd_handle = 0;
+volatile uint8_t ble_subscribed = 0; // BLE_SUB_* bits, written in WRITE_EVT, cleared on disconnect
+volatile uint16_t ble_mtu = BLE_STREAM_MTU_DEFAULT;  // Updated in MTU_EVT, applied by ble_streaming
+
+volatile uint32_t notify_latency_us = 0;       // Last detect -> send latency
+volatile uint32_t notify_latency_max_us = 0;
+volatile uint64_t notify_latency_sum_us = 0;   // With notify_count: mean latency
+volatile uint32_t notify_count = 0;
+
+static ble_txq_t notify_txq;                   // Blink / attention notifications (ble_notifications only,
+static TaskHandle_t notify_task = NULL;        // except the congestion flag set in gatts_event_handler)
+static esp_gatt_rsp_t gatt_rsp;                // Read responses (stats, CCCDs): ~600 bytes, off the BTC task stack
 
 
 // Global adv params for restart on disconnect
@@ -86,10 +108,149 @@ void gap_event_handler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t *par
 }
 
 
+// ==============================
+// Latency Stats Characteristic: Read (long reads) + Write (reset)
+// ==============================
+// The payload (latency_stats_pack) is larger than a default-MTU read, so centrals fetch it with
+// read-blob requests. The snapshot is taken at offset 0 and reused for the follow-up offsets,
+// so one read sees one consistent set of numbers.
+static void ble_stats_read(esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param) {
+
+    static uint8_t payload[LATENCY_STATS_MAX_BYTES];
+    static size_t payload_len = 0;
+
+    uint16_t offset = param->read.offset;
+    if (offset == 0 || payload_len == 0) {
+        payload_len = latency_stats_pack(payload, sizeof(payload));
+    }
+
+    size_t chunk = offset < payload_len ? payload_len - offset : 0;
+    if (chunk > (size_t)(ble_mtu - 1)) chunk = ble_mtu - 1;   // ATT read response: MTU - 1 bytes
+
+    memset(&gatt_rsp, 0, sizeof(gatt_rsp));
+    gatt_rsp.attr_value.handle = param->read.handle;
+    gatt_rsp.attr_value.offset = offset;
+    gatt_rsp.attr_value.len = (uint16_t)chunk;
+    memcpy(gatt_rsp.attr_value.value, &payload[offset < payload_len ? offset : 0], chunk);
+
+    esp_gatt_status_t status = offset <= payload_len ? ESP_GATT_OK : ESP_GATT_INVALID_OFFSET;
+    esp_ble_gatts_send_response(gatts_if, param->read.conn_id, param->read.trans_id, status, &gatt_rsp);
+}
+
+static void ble_stats_write(esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param) {
+
+    latency_reset_all();                            // Any write clears every stage
+    ESP_LOGI(BLE_TAG, "Latency histograms cleared by central");
+
+    if (param->write.need_rsp) {
+        esp_ble_gatts_send_response(gatts_if, param->write.conn_id, param->write.trans_id, ESP_GATT_OK, NULL);
+    }
+}
+
+
+// ==============================
+// Subscriptions: Client Characteristic Configuration (0x2902)
+// ==============================
+// Each notifying characteristic has a CCCD; bit 0 of its 2-byte value is the central's
+// "notify me". What the central subscribed to, not the bare connection, decides what the
+// pipeline produces: blink / attention -> POWER_DEMAND_LINK (events), raw stream ->
+// POWER_DEMAND_STREAM (publish stage). A connected central that subscribed to nothing leaves
+// the device in standby. Responses are sent here (no auto-response), so a read always reports
+// ble_subscribed for this connection.
+static uint8_t ble_cccd_bit(uint16_t handle) {
+
+    if (handle == 0) return 0;                                  // Not added yet
+    if (handle == blink_cccd_handle) return BLE_SUB_BLINK;
+    if (handle == attention_cccd_handle) return BLE_SUB_ATTENTION;
+    if (handle == stream_cccd_handle) return BLE_SUB_STREAM;
+    return 0;
+}
+
+static void ble_set_subscribed(uint8_t subscribed) {
+
+    ble_subscribed = subscribed;
+    power_demand_set(POWER_DEMAND_LINK, (subscribed & (BLE_SUB_BLINK | BLE_SUB_ATTENTION)) != 0);
+    power_demand_set(POWER_DEMAND_STREAM, (subscribed & BLE_SUB_STREAM) != 0);
+}
+
+static void ble_cccd_read(esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param, uint8_t bit) {
+
+    memset(&gatt_rsp, 0, sizeof(gatt_rsp));
+    gatt_rsp.attr_value.handle = param->read.handle;
+    gatt_rsp.attr_value.len = 2;
+    gatt_rsp.attr_value.value[0] = (ble_subscribed & bit) ? 0x01 : 0x00;
+    esp_ble_gatts_send_response(gatts_if, param->read.conn_id, param->read.trans_id, ESP_GATT_OK, &gatt_rsp);
+}
+
+static void ble_cccd_write(esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param, uint8_t bit) {
+
+    esp_gatt_status_t status = ESP_GATT_OK;
+    if (param->write.is_prep || param->write.offset != 0 || param->write.len != 2) {
+        status = ESP_GATT_INVALID_ATTR_LEN;
+    } else {
+        bool on = (param->write.value[0] & 0x01) != 0;          // Notifications (indications unsupported)
+        ble_set_subscribed(on ? (ble_subscribed | bit) : (ble_subscribed & ~bit));
+        ESP_LOGI(BLE_TAG, "Notifications %s: 0x%02x", on ? "enabled" : "disabled", bit);
+    }
+
+    if (param->write.need_rsp) {
+        esp_ble_gatts_send_response(gatts_if, param->write.conn_id, param->write.trans_id, status, NULL);
+    }
+}
+
+
 // ==============================
 // GATT (Generic Attribute Profile) Handler
 // ==============================
-static int add_char_idx = 0;  // Temp: Track which char (0=blink, 1=attention)
+static int add_char_idx = 0;  // Temp: Track which char (0=blink, 1=attention, 2=raw stream, 3=stats)
+
+// Characteristics are added one at a time, each from the event of the one before:
+// CREATE_EVT -> char 0 -> its CCCD -> char 1 -> its CCCD -> char 2 -> its CCCD -> char 3 -> start
+#define BLE_NOTIFY_CHARS  3     // Chars 0..2 notify and carry a CCCD; the stats char does not
+
+static void ble_add_char(int idx) {
+
+    esp_bt_uuid_t char_uuid = { .len = ESP_UUID_LEN_16 };
+    esp_gatt_perm_t perm = ESP_GATT_PERM_READ;
+    esp_gatt_char_prop_t property;
+
+    switch (idx) {
+        case 0:     // Blink Count - NOTIFY enabled
+            char_uuid.uuid.uuid16 = CHAR_UUID_BLINK_COUNT;
+            property = ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_NOTIFY;
+            break;
+        case 1:     // Attention Level
+            char_uuid.uuid.uuid16 = CHAR_UUID_ATTENTION_LEVEL;
+            perm |= ESP_GATT_PERM_WRITE;
+            property = ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_WRITE | ESP_GATT_CHAR_PROP_BIT_NOTIFY;
+            break;
+        case 2:     // Raw Stream - notify-only, packed 12-bit samples
+            char_uuid.uuid.uuid16 = CHAR_UUID_RAW_STREAM;
+            property = ESP_GATT_CHAR_PROP_BIT_NOTIFY;
+            break;
+        default:    // Latency Stats - read p50/p99/max per stage, write to reset
+            char_uuid.uuid.uuid16 = CHAR_UUID_LATENCY_STATS;
+            perm |= ESP_GATT_PERM_WRITE;
+            property = ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_WRITE;
+            break;
+    }
+
+    esp_err_t ret = esp_ble_gatts_add_char(service_handle, &char_uuid, perm, property, NULL, NULL);
+    if (ret != ESP_OK)
+        ESP_LOGE(BLE_TAG, "Failed to add char %d", idx);
+}
+
+static void ble_add_cccd(void) {
+
+    esp_bt_uuid_t descr_uuid = {
+        .len = ESP_UUID_LEN_16,
+        .uuid.uuid16 = ESP_GATT_UUID_CHAR_CLIENT_CONFIG
+    };
+    esp_err_t ret = esp_ble_gatts_add_char_descr(service_handle, &descr_uuid,
+                                                 ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE, NULL, NULL);
+    if (ret != ESP_OK)
+        ESP_LOGE(BLE_TAG, "Failed to add CCCD of char %d", add_char_idx);
+}
 
 void gatts_event_handler(esp_gatts_cb_event_t event,
                          esp_gatt_if_t gatts_if,
@@ -113,8 +274,9 @@ void gatts_event_handler(esp_gatts_cb_event_t event,
             service_id.id.uuid.len = ESP_UUID_LEN_16;
             service_id.id.uuid.uuid.uuid16 = SERVICE_UUID;
 
-            // Create the service with up to 4 handles (for demo)
-            esp_ble_gatts_create_service(gatts_if, &service_id, 8);
+            // Service declaration + 2 handles (declaration + value) per characteristic + 1 per CCCD
+            // (12), with room to spare
+            esp_ble_gatts_create_service(gatts_if, &service_id, 16);
             break;
 
         // ------------------------------------------
@@ -124,19 +286,7 @@ void gatts_event_handler(esp_gatts_cb_event_t event,
             ESP_LOGI(BLE_TAG, "[GATT EVENT] Service created.");
             service_handle = param->create.service_handle;
             add_char_idx = 0;  // Reset tracker
-
-            // Add first characteristic (Blink Count) - NOTIFY enabled
-            {
-                esp_bt_uuid_t char_uuid;
-                char_uuid.len = ESP_UUID_LEN_16;
-                char_uuid.uuid.uuid16 = CHAR_UUID_BLINK_COUNT;
-
-                esp_gatt_char_prop_t property = ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_NOTIFY;
-                esp_err_t ret = esp_ble_gatts_add_char(service_handle, &char_uuid,
-                                                       ESP_GATT_PERM_READ, property, NULL, NULL);
-                if (ret != ESP_OK)
-                    ESP_LOGE(BLE_TAG, "Failed to add char 0");
-            }
+            ble_add_char(0);
             break;
 
         // ------------------------------------------
@@ -145,32 +295,33 @@ void gatts_event_handler(esp_gatts_cb_event_t event,
         case ESP_GATTS_ADD_CHAR_EVT:
             if (param->add_char.status == ESP_GATT_OK)
             {
+                uint16_t handle = param->add_char.attr_handle;
                 if (add_char_idx == 0)
                 {
-                    blink_handle = param->add_char.attr_handle;
+                    blink_handle = handle;
                     ESP_LOGI(BLE_TAG, "Blink char handle: 0x%04x", blink_handle);
-
-                    // Add second characteristic (Attention Level)
-                    esp_bt_uuid_t char_uuid = {
-                        .len = ESP_UUID_LEN_16,
-                        .uuid.uuid16 = CHAR_UUID_ATTENTION_LEVEL
-                    };
-                    esp_gatt_char_prop_t property = ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_WRITE;
-                    esp_err_t ret = esp_ble_gatts_add_char(service_handle, &char_uuid,
-                                                           ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE,
-                                                           property, NULL, NULL);
-                    if (ret != ESP_OK)
-                        ESP_LOGE(BLE_TAG, "Failed to add char 1");
                 }
-                else
+                else if (add_char_idx == 1)
                 {
-                    attention_handle = param->add_char.attr_handle;
+                    attention_handle = handle;
                     ESP_LOGI(BLE_TAG, "Attention char handle: 0x%04x", attention_handle);
+                }
+                else if (add_char_idx == 2)
+                {
+                    stream_handle = handle;
+                    ESP_LOGI(BLE_TAG, "Raw stream char handle: 0x%04x", stream_handle);
+                }
+                else
+                {
+                    stats_handle = handle;
+                    ESP_LOGI(BLE_TAG, "Latency stats char handle: 0x%04x", stats_handle);
+                }
 
-                    // All characteristics added → start service
-                    esp_ble_gatts_start_service(service_handle);
+                if (add_char_idx < BLE_NOTIFY_CHARS) {
+                    ble_add_cccd();                          // Its CCCD next (ADD_CHAR_DESCR_EVT)
+                } else {
+                    esp_ble_gatts_start_service(service_handle);   // All characteristics added → start service
                 }
-                add_char_idx++;
             }
             else
             {
@@ -178,6 +329,23 @@ void gatts_event_handler(esp_gatts_cb_event_t event,
             }
             break;
 
+        case ESP_GATTS_ADD_CHAR_DESCR_EVT:
+            if (param->add_char_descr.status == ESP_GATT_OK)
+            {
+                uint16_t handle = param->add_char_descr.attr_handle;
+                if (add_char_idx == 0) blink_cccd_handle = handle;
+                else if (add_char_idx == 1) attention_cccd_handle = handle;
+                else stream_cccd_handle = handle;
+                ESP_LOGI(BLE_TAG, "CCCD of char %d: 0x%04x", add_char_idx, handle);
+
+                ble_add_char(++add_char_idx);
+            }
+            else
+            {
+                ESP_LOGE(BLE_TAG, "Failed to add CCCD of char %d", add_char_idx);
+            }
+            break;
+
         // ------------------------------------------
         // 4. Service Started
         // ------------------------------------------
@@ -209,14 +377,50 @@ void gatts_event_handler(esp_gatts_cb_event_t event,
 
 
         case ESP_GATTS_CONNECT_EVT:
-            conn_id = param->connect.conn_id;
+            ble_mtu = BLE_STREAM_MTU_DEFAULT;   // Until the central runs the MTU exchange
+            conn_id = param->connect.conn_id;       // Demand follows the subscriptions (CCCD writes)
             ESP_LOGI(BLE_TAG, "Connected! Conn ID: %d", conn_id);
             break;
-          
+
+        case ESP_GATTS_MTU_EVT:
+            // The central starts the exchange; we answer with the local MTU set in init_ble()
+            ble_mtu = param->mtu.mtu;
+            ESP_LOGI(BLE_TAG, "MTU negotiated: %d (%d-byte notifications)",
+                     param->mtu.mtu, param->mtu.mtu - BLE_STREAM_ATT_OVERHEAD);
+            break;
             
+        case ESP_GATTS_READ_EVT:
+            if (stats_handle && param->read.handle == stats_handle && param->read.need_rsp) {
+                ble_stats_read(gatts_if, param);
+            } else if (ble_cccd_bit(param->read.handle) && param->read.need_rsp) {
+                ble_cccd_read(gatts_if, param, ble_cccd_bit(param->read.handle));
+            }
+            break;
+
+        case ESP_GATTS_WRITE_EVT:
+            if (stats_handle && param->write.handle == stats_handle) {
+                ble_stats_write(gatts_if, param);
+            } else if (ble_cccd_bit(param->write.handle)) {
+                ble_cccd_write(gatts_if, param, ble_cccd_bit(param->write.handle));
+            }
+            break;
+
+        case ESP_GATTS_CONGEST_EVT:
+            // Controller buffers full: hold notifications until it drains (see ble_txq.h)
+            ble_txq_set_congested(&notify_txq, param->congest.congested);
+            if (!param->congest.congested && notify_task) xTaskNotify(notify_task, BLE_EVENT_TX_READY, eSetBits);
+            break;
+
         case ESP_GATTS_DISCONNECT_EVT:
             conn_id = 0xFFFF;
-            ESP_LOGI(BLE_TAG, "Disconnected.");
+            ble_set_subscribed(0);                  // CCCDs are per connection (no bonding)
+            ble_mtu = BLE_STREAM_MTU_DEFAULT;
+            ble_txq_set_congested(&notify_txq, false);
+            ESP_LOGI(BLE_TAG, "Disconnected. Notify queue: %lu sent, %lu coalesced, %lu dropped, %lu stalls "
+                     "(%llu us), max depth %u", (unsigned long)notify_txq.stats.sent,
+                     (unsigned long)notify_txq.stats.coalesced, (unsigned long)notify_txq.stats.dropped,
+                     (unsigned long)notify_txq.stats.stalls, (unsigned long long)notify_txq.stats.stalled_us,
+                     notify_txq.stats.max_depth);
             // Restart adv with global params
             esp_ble_gap_start_advertising(&adv_params);  // Restart adv (add adv_params global if needed)
             break;
@@ -323,64 +527,261 @@ void init_ble(void){
     }
     ESP_LOGI(BLE_TAG, "GATT server registered successfully.");
 
+    // STEP 3C: Offer the largest ATT MTU, so the raw stream can send up to 514-byte notifications
+    ret = esp_ble_gatt_set_local_mtu(BLE_STREAM_MTU_MAX);
+    if (ret != ESP_OK) {
+        ESP_LOGW(BLE_TAG, "Failed to set local MTU %d! Error code: %d", BLE_STREAM_MTU_MAX, ret);
+    }
+
     // Note:
     // GATT setup now proceeds asynchronously:
     //  1. REG_EVT → create service
     //  2. CREATE_EVT → add chars
-    //  3. ADD_CHAR_EVT → start service
+    //  3. ADD_CHAR_EVT / ADD_CHAR_DESCR_EVT → next char or CCCD, then start service
     //  4. START_EVT → start advertising 
     // The reason why of the two Handler functions defined above.
 
 }
 
 // =============================
-// FreeRTOS Task: BLE Notifications (Stub - Expand for actual notify logic)
+// Notification Latency (detect_events -> send)
+// =============================
+static void ble_record_latency(int64_t event_us, latency_stage_t stage) {
+
+    uint32_t latency = (uint32_t)(esp_timer_get_time() - event_us);
+
+    notify_latency_us = latency;
+    if (latency > notify_latency_max_us) notify_latency_max_us = latency;
+    notify_latency_sum_us += latency;
+    notify_count++;
+    latency_record(stage, latency);
+}
+
+
+// =============================
+// Helper: One Notification, Timed (GATT_SEND stage)
 // =============================
+static esp_err_t ble_send_notify(uint16_t handle, uint16_t len, uint8_t *data) {
+
+    uint32_t t0 = adc_now_us();
+    esp_err_t ret = esp_ble_gatts_send_indicate(gatts_if_global, conn_id, handle, len, data, false);
+    latency_record(LATENCY_STAGE_GATT_SEND, adc_now_us() - t0);
+    return ret;
+}
+
+
+// =============================
+// Notification Queue: Send Hook
+// =============================
+// Packets come back tagged with their latency stage, detection time and the newest value they
+// carry (set by ble_notifications at queue time), so nothing is decoded on the send path.
+static int ble_txq_send_notify(void *ctx, const ble_txq_packet_t *packet) {
+
+    if (conn_id == 0xFFFF) return -1;
+
+    if (ble_send_notify(packet->handle, packet->len, (uint8_t *)packet->data) != ESP_OK) return -1;
+    ble_record_latency(packet->event_us, (latency_stage_t)packet->tag);
+
+    if (packet->tag == LATENCY_STAGE_BLINK_NOTIFY) {
+        // blink_sample_us belongs to the newest blink: only that one has a true end-to-end time
+        if (packet->value == blink_count && blink_sample_us) latency_record(LATENCY_STAGE_BLINK_E2E, adc_now_us() - blink_sample_us);
+        ESP_LOGD(BLE_TAG, "Notified blink: %lu (detect->send %lu us, max %lu us)",
+                 packet->value, notify_latency_us, notify_latency_max_us);
+    } else {
+        ESP_LOGD(BLE_TAG, "Notified attention: %lu", packet->value);
+    }
+    return 0;
+}
+
+const ble_txq_t *ble_notify_queue(void) {
+    return &notify_txq;
+}
+
+
+// =============================
+// FreeRTOS Task: BLE Notifications (event-driven)
+// =============================
+// Sleeps in xTaskNotifyWait() until detect_events() posts ADC_EVENT_* bits, so there are no
+// idle wake-ups and a blink goes out as soon as this task is scheduled. With packets held back
+// by congestion it also wakes on BLE_EVENT_TX_READY and every BLE_NOTIFY_RETRY_MS.
+//
+// Events are serialized as ble_pkt packets straight into the queue's packet buffers. A blink
+// that arrives while the previous blink packet is still held back is appended to it as one
+// more record; otherwise each event takes a packet (and a sequence number) of its own.
 void ble_notifications(void *arg){
 
-    static uint32_t last_blink = 0;
-    static uint8_t last_attention = 0;
-    uint8_t blink_data[4];  // uint32_t little-endian
-    uint8_t attn_data[1];   // uint8_t
+    uint32_t last_blink = 0;
+    uint8_t last_attention = 0;
+    uint16_t blink_seq = 0;
+    uint16_t attention_seq = 0;
+    ble_pkt_writer_t w;
+
+    ble_txq_init(&notify_txq, ble_txq_send_notify, NULL);
+    notify_task = xTaskGetCurrentTaskHandle();
+    adc_set_event_listener(notify_task);
 
-    // TODO: Implement logic to read filtered data (e.g., blink count) and send GATT notifications
-    // Example: esp_ble_gatts_send_indicate(gatts_if_global, ...);
     while (1) {
 
-        if (conn_id != 0xFFFF && blink_handle && attention_handle) {  // Only if Connected + handles ready
-            
-            // Check blink change
-            if (blink_count > last_blink) {
-                // Pack little-endian
-                blink_data[0] = (uint8_t)(blink_count & 0xFF);
-                blink_data[1] = (uint8_t)((blink_count >> 8) & 0xFF);
-                blink_data[2] = (uint8_t)((blink_count >> 16) & 0xFF);
-                blink_data[3] = (uint8_t)((blink_count >> 24) & 0xFF);
-                
-                esp_ble_gatts_send_indicate(gatts_if_global, conn_id, CHAR_UUID_BLINK_COUNT /* handle from add_char evt */, 
-                                            sizeof(blink_data), blink_data, false);
-                last_blink = blink_count;
-                ESP_LOGI(BLE_TAG, "Notified blink: %lu", blink_count);
+        uint32_t events = 0;
+        TickType_t wait = ble_txq_depth(&notify_txq) ? pdMS_TO_TICKS(BLE_NOTIFY_RETRY_MS) : portMAX_DELAY;
+        xTaskNotifyWait(0, UINT32_MAX, &events, wait);   // Clear all bits on exit
+        uint32_t t0 = power_busy_begin();
+
+        uint8_t subscribed = ble_subscribed;
+        if (conn_id == 0xFFFF || !(subscribed & (BLE_SUB_BLINK | BLE_SUB_ATTENTION))) {  // Connected + subscribed
+            last_blink = blink_count;
+            last_attention = attention_level;
+            blink_seq = 0;                                              // The next connection starts at 0
+            attention_seq = 0;
+            ble_txq_reset(&notify_txq);                                 // Nothing to deliver them to
+            power_busy_end(TASK_ROLE_BLE_NOTIFY, t0);
+            continue;
+        }
 
+        // An event the central did not subscribe to is not queued (nor caught up on later)
+        if (!(subscribed & BLE_SUB_BLINK)) last_blink = blink_count;
+        if (!(subscribed & BLE_SUB_ATTENTION)) last_attention = attention_level;
 
+        // Blink: count moved since the last notification (in order, appended while held back)
+        if ((events & ADC_EVENT_BLINK) && blink_count != last_blink) {
+            uint32_t count = blink_count;
+            uint32_t stamp = blink_sample_us ? blink_sample_us : (uint32_t)blink_event_us;
+
+            ble_txq_packet_t *tail = ble_txq_tail(&notify_txq, blink_handle);
+            if (tail && ble_pkt_resume(&w, tail->data, tail->len, BLE_TXQ_MAX_DATA) &&
+                ble_pkt_add_blink(&w, stamp, count)) {
+                tail->len = (uint8_t)w.len;
+                tail->value = count;
+            } else {
+                ble_txq_packet_t *p = ble_txq_reserve(&notify_txq, blink_handle, LATENCY_STAGE_BLINK_NOTIFY,
+                                                      blink_event_us);
+                ble_pkt_begin(&w, p->data, BLE_TXQ_MAX_DATA, BLE_PKT_TYPE_BLINK, blink_seq++, stamp);
+                ble_pkt_add_blink(&w, stamp, count);
+                p->len = (uint8_t)w.len;
+                p->value = count;
+                ble_txq_commit(&notify_txq, p);
             }
-            
-            // Check attention change (every update, as it's frequent)
-            if (attention_level != last_attention) {
-                attn_data[0] = attention_level;
-                esp_ble_gatts_send_indicate(gatts_if_global, conn_id, CHAR_UUID_ATTENTION_LEVEL /* handle */,
-                                            sizeof(attn_data), attn_data, false);
-                last_attention = attention_level;
-                ESP_LOGI(BLE_TAG, "Notified attention: %u", attention_level);
-            }
+            last_blink = count;
         }
 
-        vTaskDelay(pdMS_TO_TICKS(250));  // 1s delay
+        // Attention: level moved (posted at most every ATTENTION_UPDATE_SAMPLES); a level not yet
+        // sent is overwritten by the newer one, which shows up as a sequence gap on the phone
+        if ((events & ADC_EVENT_ATTENTION) && attention_level != last_attention) {
+            uint8_t level = attention_level;
+            uint32_t stamp = (uint32_t)attention_event_us;
+
+            ble_txq_packet_t *p = ble_txq_reserve_latest(&notify_txq, attention_handle, LATENCY_STAGE_ATTN_NOTIFY,
+                                                         attention_event_us);
+            if (p) {
+                ble_pkt_begin(&w, p->data, BLE_TXQ_MAX_DATA, BLE_PKT_TYPE_ATTENTION, attention_seq++, stamp);
+                ble_pkt_add_attention(&w, stamp, level);
+                p->len = (uint8_t)w.len;
+                p->value = level;
+                ble_txq_commit(&notify_txq, p);
+            }
+            last_attention = level;
+        }
 
+        // Everything pending, unless the link is congested (then on TX_READY / the retry timeout)
+        ble_txq_pump(&notify_txq, adc_now_us());
+        power_busy_end(TASK_ROLE_BLE_NOTIFY, t0);
     }
 }
 
 
+// =============================
+// Raw Stream Transport: One Notification
+// =============================
+static int ble_stream_send_notify(void *ctx, const uint8_t *data, uint16_t len) {
+
+    if (conn_id == 0xFFFF || !stream_handle) return -1;
+
+    esp_err_t ret = ble_send_notify(stream_handle, len, (uint8_t *)data);
+    return ret == ESP_OK ? 0 : -1;
+}
+
+
+// =============================
+// FreeRTOS Task: BLE Raw Waveform Streaming
+// =============================
+// Drains filtered_ring every BLE_STREAM_PERIOD_MS and packs the frames into MTU-sized
+// notifications. Stream state is only touched here: GATT events just publish conn_id / ble_mtu /
+// ble_subscribed. Until a central subscribes to the stream there is nothing to drain (the
+// publish stage is gated off, see power.h), so the task only looks every POWER_IDLE_POLL_MS.
+void ble_streaming(void *arg){
 
+    static ble_stream_t raw_stream;                                  // Static: ~1.2 KB
+    static int16_t frames[ADC_DRAIN_BLOCK * ADC_NUM_CHANNELS];
 
+    uint16_t applied_mtu = BLE_STREAM_MTU_DEFAULT;
+    uint16_t applied_conn = 0xFFFF;
+    bool streaming = false;                                          // Connected + stream CCCD on
+    TickType_t last_send = xTaskGetTickCount();
 
+    ble_stream_init(&raw_stream, ADC_NUM_CHANNELS, ble_stream_send_notify, NULL);
+
+    while (1) {
+
+        uint32_t t0 = power_busy_begin();
+
+        // --- 1. Follow connection / subscription / MTU changes ---
+        bool subscribed = conn_id != 0xFFFF && (ble_subscribed & BLE_SUB_STREAM);
+        if (conn_id != applied_conn || subscribed != streaming) {
+            applied_conn = conn_id;
+            streaming = subscribed;
+            ble_stream_reset(&raw_stream);
+        }
+        if (ble_mtu != applied_mtu) {
+            applied_mtu = ble_mtu;
+            ble_stream_set_mtu(&raw_stream, applied_mtu);
+            ESP_LOGI(BLE_TAG, "Raw stream: %u frames per notification", raw_stream.frames_per_packet);
+        }
+
+        // --- 2. Drain everything filtered since the last pass (discarded while not subscribed) ---
+        // While the link is congested the frames wait in filtered_ring: events go first, and a
+        // stall longer than the ring turns into a flagged gap rather than a blocked task.
+        uint32_t sent_before = raw_stream.packets_sent;
+        size_t count;
+        if (!notify_txq.congested) {
+            do {
+                uint32_t first_seq = 0;
+                count = adc_ring_read(&filtered_ring, frames, ADC_DRAIN_BLOCK, &first_seq, NULL);
+                if (count && streaming) {
+                    uint32_t packets = raw_stream.packets_sent;
+                    uint32_t oldest_us = filtered_stamp_us[first_seq & filtered_ring.mask];
+                    ble_stream_push(&raw_stream, frames, count, first_seq);
+                    if (raw_stream.packets_sent != packets) {
+                        latency_record(LATENCY_STAGE_STREAM, adc_now_us() - oldest_us);
+                    }
+                }
+            } while (count == ADC_DRAIN_BLOCK);
+        }
+
+        // --- 3. Bound latency at low rates: ship a short packet if samples have waited too long ---
+        TickType_t now = xTaskGetTickCount();
+        if (raw_stream.packets_sent != sent_before) {
+            last_send = now;
+        } else if (raw_stream.staged_frames && !notify_txq.congested &&
+                   (now - last_send) >= pdMS_TO_TICKS(BLE_STREAM_MAX_LATENCY_MS)) {
+            ble_stream_flush(&raw_stream);
+            last_send = now;
+        }
+
+        power_busy_end(TASK_ROLE_BLE_STREAM, t0);
+        vTaskDelay(pdMS_TO_TICKS(streaming ? BLE_STREAM_PERIOD_MS : POWER_IDLE_POLL_MS));
+    }
+}
+
+
+// =============================
+// Static Footprint (mem_budget.h)
+// =============================
+// Function-local statics (ble_stats_read, ble_streaming) are listed by the expression that sizes them.
+static const mem_budget_item_t ble_mem_items[] = {
+    MEM_BUDGET_BYTES("stats payload", LATENCY_STATS_MAX_BYTES),
+    MEM_BUDGET_ITEM(gatt_rsp),
+    MEM_BUDGET_BYTES("raw_stream", sizeof(ble_stream_t)),
+    MEM_BUDGET_ITEM(notify_txq),
+    MEM_BUDGET_BYTES("stream block", ADC_DRAIN_BLOCK * ADC_NUM_CHANNELS * sizeof(int16_t)),
+};
+const mem_budget_table_t ble_mem_budget = MEM_BUDGET_TABLE("ble", ble_mem_items);
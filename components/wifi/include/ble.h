@@ -31,6 +31,12 @@
         #include "esp_gap_ble_api.h"       // GAP callbacks, advertising params, and BLE connection event handling
         #include "esp_gatts_api.h"         // GATT server callbacks, characteristic creation, and app registration
 
+    /* --- Raw Waveform Stream --- */
+    #include "ble_stream.h"                // 12-bit packing + MTU-sized framing (host-testable)
+    #include "ble_txq.h"                   // Event notification queue (congestion backpressure)
+    #include "ble_pkt.h"                   // Versioned event packets (seq, time stamps)
+    #include "mem_budget.h"                // Static footprint table
+
 
 // =============================
 // Application Log Tag
@@ -44,6 +50,8 @@
 extern const uint16_t SERVICE_UUID;              // "Eye Blink count" service
 extern const uint16_t CHAR_UUID_BLINK_COUNT;     // Service characteristic 1
 extern const uint16_t CHAR_UUID_ATTENTION_LEVEL; // Service characteristic 2
+extern const uint16_t CHAR_UUID_RAW_STREAM;      // Service characteristic 3 (notify-only waveform)
+extern const uint16_t CHAR_UUID_LATENCY_STATS;   // Service characteristic 4 (read: latency_stats_pack, write: reset)
 
 
 // =============================
@@ -56,6 +64,25 @@ extern uint8_t service_uuid[2];  // Service UUID array (little-endian 0x180A)
 extern uint16_t conn_id;  // Active connection handle
 extern uint16_t blink_handle;    // Blink char attr handle
 extern uint16_t attention_handle; // Attention char attr handle
+extern uint16_t stream_handle;    // Raw stream char attr handle
+extern uint16_t stats_handle;     // Latency stats char attr handle
+extern uint16_t blink_cccd_handle;     // CCCD (0x2902) of the blink char
+extern uint16_t attention_cccd_handle; // CCCD of the attention char
+extern uint16_t stream_cccd_handle;    // CCCD of the raw stream char
+extern volatile uint16_t ble_mtu; // ATT MTU of the current connection (23 until exchanged)
+
+// Notifications the central enabled through the CCCDs (cleared on disconnect). They drive
+// POWER_DEMAND_LINK (blink / attention) and POWER_DEMAND_STREAM (raw stream).
+#define BLE_SUB_BLINK      (1u << 0)
+#define BLE_SUB_ATTENTION  (1u << 1)
+#define BLE_SUB_STREAM     (1u << 2)
+extern volatile uint8_t ble_subscribed;
+
+// Event -> notification latency (esp_timer at detection vs. after esp_ble_gatts_send_indicate)
+extern volatile uint32_t notify_latency_us;
+extern volatile uint32_t notify_latency_max_us;
+extern volatile uint64_t notify_latency_sum_us;
+extern volatile uint32_t notify_count;
 
 
 // =============================
@@ -84,7 +111,26 @@ void gatts_event_handler(esp_gatts_cb_event_t event,
 void init_ble(void);    // (call from app_main)
 
 
-// BLE notifications task (create via xTaskCreate)
+// BLE notifications task (create via xTaskCreate). Blocks until detect_events() posts
+// ADC_EVENT_* bits, then queues blink (one per event) / attention (latest value only)
+// notifications and sends them through notify_txq. While Bluedroid reports congestion
+// (ESP_GATTS_CONGEST_EVT) the queue holds them; BLE_EVENT_TX_READY wakes the task when it
+// clears, and a refused send is retried every BLE_NOTIFY_RETRY_MS.
+#define BLE_EVENT_TX_READY     (1u << 8)   // Congestion cleared (next to the ADC_EVENT_* bits)
+#define BLE_NOTIFY_RETRY_MS    20
 void ble_notifications(void *arg);
 
+// Queue depth, coalesced / dropped / refused packets, stalls and stall time (ble_txq.h).
+// Read without a lock: a snapshot may be one packet behind.
+const ble_txq_t *ble_notify_queue(void);
+
+// BLE raw waveform streaming task (create via xTaskCreate)
+#define BLE_STREAM_PERIOD_MS       20    // Drain period of filtered_ring
+#define BLE_STREAM_MAX_LATENCY_MS  100   // Send a short packet if samples wait longer than this
+void ble_streaming(void *arg);
+
+// Stream state, stream block and stats read buffers (mem_budget.h). Bluedroid and the controller
+// allocate on the heap: init_ble() shows up in the boot heap marks, not here.
+extern const mem_budget_table_t ble_mem_budget;
+
 #endif // BLE_H
\ No newline at end of file
@@ -0,0 +1,245 @@
+// =============================
+// Header Files (Your Toolbox)
+// =============================
+
+    /* --- General --- */
+    #include <stdio.h>
+    #include <stdlib.h>
+    #include <string.h>
+    #include <time.h>                     // Wall clock for the x-realtime figure
+
+    /* --- ADC --- */
+    #include "adc.h"
+    #include "adc_source.h"               // Synthetic / file acquisition sources
+    #include "esp_log.h"                  // Quiet per-event logs during a replay
+
+    /* --- Session Recorder --- */
+    #include "recorder.h"                 // Optional recording to a flash image file
+
+    /* --- Replay Harness --- */
+    #include "replay.h"                   // Golden-output comparison
+
+    /* --- Power --- */
+    #include "power.h"                    // Consumer demand (stage gating) + duty per task
+
+//
+// Host runner: pushes a recording (or synthetic signal) through the same bandpass -> detect
+// pipeline the device runs, as fast as the CPU allows, and prints what it found.
+//
+//      EEG_SOURCE   synthetic (default) | csv:<path> | bin:<path> | edf:<path> | csv:- (stdin)
+//      EEG_SECONDS  synthetic length in seconds (default 60)
+//      EEG_RECORD   <path>: record the session into a flash image file (same layout as the
+//                   'eegrec' partition; an existing image is appended to, like after a reboot)
+//      EEG_GOLDEN   <path>: replay mode. Compares the blink / attention events with a golden
+//                   file and exits 1 if they moved beyond the tolerances below. With
+//                   EEG_GOLDEN_UPDATE=1 the file is (re)written from this run instead.
+//      EEG_TOL_BLINK / EEG_TOL_ATTENTION / EEG_TOL_TICKS   override REPLAY_TOLERANCE_DEFAULT
+//      EEG_LINK     0: simulate no BLE subscriber (events + publish stage off); default 1
+//      EEG_SPECTRAL 0: nobody reads the band powers (spectral stage off); default 1
+//
+// The duty report divides the CPU time of each task by the simulated EEG duration, i.e. the
+// share of a core the same work takes at real time on this machine (see power.h).
+//
+#define HOST_RECORD_IMAGE_SIZE  (960 * 1024)      // Matches the eegrec partition (partitions.csv)
+#define HOST_REPLAY_EVENTS      (1 << 16)         // ~9 h of attention changes at 2 per second
+
+
+// =============================
+// Helper: Monotonic Time (s)
+// =============================
+static double host_now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+
+// =============================
+// Replay Mode: Compare With (or Update) a Golden File
+// =============================
+static int host_replay(adc_source_t *src, const char *golden_path) {
+
+    static replay_event_t run_events[HOST_REPLAY_EVENTS], golden_events[HOST_REPLAY_EVENTS];
+    replay_log_t run, golden;
+    replay_stats_t stats;
+    replay_log_init(&run, run_events, HOST_REPLAY_EVENTS);
+    replay_log_init(&golden, golden_events, HOST_REPLAY_EVENTS);
+
+    esp_log_level_set(ADC_TAG, ESP_LOG_WARN);     // One line per blink would swamp the report
+    size_t frames = replay_run(src, &run, &stats);
+    printf("replay     : %s, %zu frames (%.1f s of EEG), %zu events\n",
+           src->name, frames, frames / (double)SAMPLE_RATE_HZ, run.count);
+    printf("throughput : %.0f samples/s (%.0fx real time, %.3f s)\n",
+           stats.samples_per_s, stats.realtime_x, stats.wall_s);
+    if (frames == 0) return 1;
+    dsp_graph_print(stdout, &adc_graph);
+
+    const char *update = getenv("EEG_GOLDEN_UPDATE");
+    if (update && strcmp(update, "1") == 0) {
+        FILE *fp = fopen(golden_path, "w");
+        bool ok = fp && replay_golden_write(fp, &run);
+        if (fp) fclose(fp);
+        printf("golden     : %s %s\n", ok ? "written to" : "CANNOT WRITE", golden_path);
+        return ok ? 0 : 1;
+    }
+
+    FILE *fp = fopen(golden_path, "r");
+    if (fp == NULL || !replay_golden_read(fp, &golden)) {
+        fprintf(stderr, "Cannot read golden file '%s'\n", golden_path);
+        if (fp) fclose(fp);
+        return 1;
+    }
+    fclose(fp);
+
+    replay_tolerance_t tol = REPLAY_TOLERANCE_DEFAULT;
+    const char *env;
+    if ((env = getenv("EEG_TOL_BLINK")) != NULL) tol.blink_frames = (uint32_t)atoi(env);
+    if ((env = getenv("EEG_TOL_ATTENTION")) != NULL) tol.attention_level = (uint8_t)atoi(env);
+    if ((env = getenv("EEG_TOL_TICKS")) != NULL) tol.attention_ticks = (uint32_t)atoi(env);
+
+    replay_diff_t diff;
+    bool pass = replay_compare(&golden, &run, &tol, &diff);
+    printf("blinks     : %lu matched (max shift %lu frames, tol %lu), %lu missing, %lu extra\n",
+           (unsigned long)diff.blinks_matched, (unsigned long)diff.blink_max_shift, (unsigned long)tol.blink_frames,
+           (unsigned long)diff.blinks_missing, (unsigned long)diff.blinks_extra);
+    printf("attention  : %lu / %lu ticks off by more than %u (max diff %u, %lu allowed)\n",
+           (unsigned long)diff.attention_failed, (unsigned long)diff.attention_ticks, tol.attention_level,
+           diff.attention_max_diff, (unsigned long)tol.attention_ticks);
+    if (!diff.frames_match) {
+        printf("length     : golden %llu frames / %u ch / %.1f Hz, this run %llu / %u / %.1f\n",
+               (unsigned long long)golden.frames, golden.channels, (double)golden.sample_rate_hz,
+               (unsigned long long)run.frames, run.channels, (double)run.sample_rate_hz);
+    }
+    printf("golden     : %s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
+
+
+// =============================
+// Host Application Entry Point
+// =============================
+void app_main(void)
+{
+    static adc_source_synth_t synth;
+    static adc_source_file_t file;
+    static adc_source_edf_t edf;
+    adc_source_t *src = NULL;
+
+    // --- 1. Pick the acquisition source ---
+    const char *spec = getenv("EEG_SOURCE");
+    if (spec == NULL || strcmp(spec, "synthetic") == 0) {
+
+        const char *secs = getenv("EEG_SECONDS");
+        adc_synth_config_t cfg;
+        adc_synth_default_config(&cfg, (float)SAMPLE_RATE_HZ);
+        cfg.duration_frames = (uint64_t)((secs ? atof(secs) : 60.0) * SAMPLE_RATE_HZ);
+        src = adc_source_synth_init(&synth, &cfg, ADC_NUM_CHANNELS);
+
+    } else if (strncmp(spec, "csv:", 4) == 0 || strncmp(spec, "bin:", 4) == 0) {
+
+        adc_file_format_t format = (spec[0] == 'b') ? ADC_FILE_BINARY : ADC_FILE_CSV;
+        const char *path = spec + 4;
+        if (strcmp(path, "-") == 0) {
+            src = adc_source_file_attach(&file, stdin, format, ADC_NUM_CHANNELS, (float)SAMPLE_RATE_HZ);
+        } else {
+            src = adc_source_file_open(&file, path, format, ADC_NUM_CHANNELS, (float)SAMPLE_RATE_HZ);
+        }
+
+    } else if (strncmp(spec, "edf:", 4) == 0) {
+
+        src = adc_source_edf_open(&edf, spec + 4, ADC_NUM_CHANNELS);
+        if (src && (src->sample_rate_hz < SAMPLE_RATE_HZ - 0.01f || src->sample_rate_hz > SAMPLE_RATE_HZ + 0.01f)) {
+            fprintf(stderr, "'%s' is sampled at %.2f Hz, the pipeline is built for %.2f Hz\n",
+                    spec + 4, (double)src->sample_rate_hz, (double)SAMPLE_RATE_HZ);
+            exit(1);
+        }
+    }
+
+    if (src == NULL) {
+        fprintf(stderr, "Cannot open source '%s' (expected synthetic, csv:<path>, bin:<path> or edf:<path>)\n", spec);
+        exit(1);
+    }
+
+    const char *golden_path = getenv("EEG_GOLDEN");
+    if (golden_path) {
+        int status = host_replay(src, golden_path);
+        adc_source_close(src);
+        exit(status);
+    }
+
+    // --- 2. Fresh pipeline state, then run the source to the end ---
+    adc_pipeline_init();
+    const char *link = getenv("EEG_LINK");
+    const char *spectral = getenv("EEG_SPECTRAL");
+    power_demand_set(POWER_DEMAND_LINK | POWER_DEMAND_STREAM, link == NULL || strcmp(link, "0") != 0);
+    power_demand_set(POWER_DEMAND_SPECTRAL, spectral == NULL || strcmp(spectral, "0") != 0);
+
+    static rec_storage_file_t rec_file;
+    rec_storage_t *rec_storage = NULL;
+    const char *rec_path = getenv("EEG_RECORD");
+    if (rec_path) {
+        rec_storage = rec_storage_file_open(&rec_file, rec_path, HOST_RECORD_IMAGE_SIZE, RECORDER_PAGE_SIZE);
+        if (rec_storage == NULL || recorder_start(rec_storage) != ESP_OK) {
+            fprintf(stderr, "Cannot record to '%s'\n", rec_path);
+            exit(1);
+        }
+    }
+    adc_pipeline_apply_demand(power_demand());
+    power_duty_reset();
+
+    // No recorder task here: drain after every chunk (less than the staging ring) instead
+    double t0 = host_now_s(), rec_wall = 0.0;
+    size_t frames = 0;
+    if (rec_storage) {
+        size_t n;
+        while ((n = adc_pipeline_run(src, RECORDER_STAGE_FRAMES / 2)) > 0) {
+            frames += n;
+            double t_rec = host_now_s();
+            uint32_t busy = power_busy_begin();
+            recorder_drain();
+            power_busy_end(TASK_ROLE_RECORDER, busy);
+            rec_wall += host_now_s() - t_rec;
+        }
+        double t_rec = host_now_s();
+        recorder_stop();
+        rec_wall += host_now_s() - t_rec;
+    } else {
+        frames = adc_pipeline_run(src, 0);
+    }
+    double wall = host_now_s() - t0;
+
+    // --- 3. Report ---
+    double eeg_s = frames / (double)SAMPLE_RATE_HZ;
+    printf("source     : %s (%d ch @ %.0f Hz)\n", src->name, ADC_NUM_CHANNELS, (double)SAMPLE_RATE_HZ);
+    printf("frames     : %zu (%.1f s of EEG)\n", frames, eeg_s);
+    printf("wall time  : %.3f s (%.0fx real time, %.0f frames/s)\n",
+           wall, wall > 0 ? eeg_s / wall : 0.0, wall > 0 ? frames / wall : 0.0);
+    printf("blinks     : %lu", (unsigned long)blink_count);
+    if (src == &synth.base) printf(" (%lu injected)", (unsigned long)synth.blinks);
+    printf("\n");
+    printf("attention  : %u\n", attention_level);
+    printf("bands (rel):");
+    for (int b = 0; b < EEG_BAND_COUNT; b++) {
+        printf(" %s=%.2f", spectral_band_name((eeg_band_t)b), eeg_bands.relative[b]);
+    }
+    printf("\n");
+    printf("stage costs:\n");
+    dsp_graph_print(stdout, &adc_graph);
+    printf("power (duty over the simulated %.1f s):\n", eeg_s);
+    power_print(stdout, (uint64_t)(eeg_s * 1e6));
+    if (rec_storage) {
+        const recorder_stats_t *rs = &recorder.stats;
+        printf("recorded   : %llu -> %llu bytes (%.2f:1), %lu pages, %lu erases, wear %lu..%lu, %.1f MB/s\n",
+               (unsigned long long)rs->bytes_in, (unsigned long long)rs->bytes_out,
+               rs->bytes_out ? (double)rs->bytes_in / (double)rs->bytes_out : 0.0,
+               (unsigned long)rs->pages_written, (unsigned long)rs->erases,
+               (unsigned long)rs->min_erase_count, (unsigned long)rs->max_erase_count,
+               rec_wall > 0 ? rs->bytes_in / rec_wall * 1e-6 : 0.0);
+        rec_storage_close(rec_storage);
+    }
+    if (src == &edf.base) printf("signals    : %s .. %s\n", edf.label[0], edf.label[ADC_NUM_CHANNELS - 1]);
+    if (src == &file.base && file.bad_lines) printf("skipped    : %lu non-numeric lines\n", (unsigned long)file.bad_lines);
+
+    adc_source_close(src);
+    exit(0);
+}
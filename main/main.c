@@ -14,6 +14,25 @@
     /* --- BLE --- */
     #include "ble.h"
 
+    /* --- Diagnostics --- */
+    #include "esp_console.h"                // UART REPL
+    #include "latency_console.h"            // 'latency' command (per-stage p50/p99/max)
+    #include "adc_console.h"                // 'stages' command (DSP stage cycle counters)
+    #include "mem_budget.h"                 // Static footprint per module + heap per boot step
+    #include "mem_budget_console.h"         // 'mem' command (same report, any time)
+
+    /* --- Session Recorder --- */
+    #include "recorder.h"                   // Append-only session log on the 'eegrec' partition
+    #include "recorder_console.h"           // 'rec' command (start / stop a session)
+
+    /* --- Task Layout --- */
+    #include "task_layout.h"                // Core / priority / stack table for the pipeline tasks
+    #include "task_layout_console.h"        // 'layout' command (layout + jitter / latency)
+
+    /* --- Power --- */
+    #include "power.h"                      // Demand-driven standby, light sleep, duty per task
+    #include "power_console.h"              // 'power' command (mode + duty cycle)
+
 // =============================
 // Main Application Entry Point
 // =============================
@@ -24,21 +43,30 @@ void app_main(void)
     // ESP-IDF functon to print to serial console
     ESP_LOGI(ADC_TAG, "Starting ADC Initialization and Calibration...");
 
+    // --- Memory Budget ---
+    // Every module lists its static buffers (mem_budget.h); a heap snapshot after each boot step
+    // shows who allocates what (Bluedroid is by far the largest).
+    mem_budget_register(&adc_mem_budget);
+    mem_budget_register(&adc_driver_mem_budget);
+    mem_budget_register(&latency_mem_budget);
+    mem_budget_register(&ble_mem_budget);
+    mem_budget_register(&recorder_mem_budget);
+    mem_budget_register(&task_layout_mem_budget);
+    mem_budget_register(&power_mem_budget);
+    mem_budget_mark("boot");
+
     // --- Initialize ADC ---
-    // ESP-IDF function to Configures ADC Unit 1, Channel 6 (GPIO34) and sets up calibration
-    // Returns a handle that uniquely identifies this ADC configuration.
-    adc_handle = init_adc();
-    if (!adc_handle) {
+    // Configures ADC Unit 1, Channel 6 (GPIO34) in oneshot or continuous (DMA) mode and sets up calibration.
+    // The driver handle (adc_handle / adc_cont_handle) is stored globally by init_adc().
+    if (init_adc() != ESP_OK) {
         ESP_LOGE(ADC_TAG, "ADC initialization failed. Exiting.");
         return;
     }
+    mem_budget_mark("adc");
 
-    // --- Create Mutex for ADC Buffer ---
-    adc_mutex = xSemaphoreCreateMutex();
-    if (adc_mutex == NULL) {
-        ESP_LOGE(ADC_TAG, "Failed to create ADC mutex!");
-        return;
-    }
+    // --- ADC Buffer ---
+    // No mutex needed: adc_sampling and adc_filtering share adc_ring, a lock-free
+    // single-producer/single-consumer ring (see adc_ring.h).
 
     // --- Initialize BLE ---
     // ESP-IDF function to configure the built-in Bluetooth controller, enables the Bluedroid stack,
@@ -50,29 +78,84 @@ void app_main(void)
     // through this global controller and its protocol stack (the BLE stack).
     init_ble();
     ESP_LOGI(BLE_TAG, "BLE initialized successfully!");
-
-    BaseType_t task_status;
-
-    // --- Task for ADC Sampling ---
-    task_status = xTaskCreate(adc_sampling, "ADC Sampling", 2048, NULL, 5, NULL);
-    if (task_status == pdPASS) {
-        ESP_LOGI(ADC_TAG, "ADC Sampling task created successfully!");
-    } else {
-        ESP_LOGE(ADC_TAG, "Failed to create ADC sampling task!");
+    mem_budget_mark("ble");
+
+    // --- Session Recorder ---
+    // Raw frames and detected events go to the 'eegrec' data partition (partitions.csv) through
+    // recorder_task. Nothing is recorded at boot: a session is a consumer like a BLE subscriber
+    // and would keep the pipeline out of standby, so it runs from 'rec start' to 'rec stop' on
+    // the console. Without the partition the device simply runs without recording.
+    static rec_storage_partition_t rec_partition;
+    rec_storage_t *rec_storage = rec_storage_partition_open(&rec_partition, RECORDER_PARTITION_LABEL);
+    if (rec_storage == NULL) {
+        ESP_LOGW(REC_TAG, "No '%s' partition, session recording off", RECORDER_PARTITION_LABEL);
+    }
+    mem_budget_mark("recorder");
+
+    // --- Power Management ---
+    // Frequency scaling + automatic light sleep (see power.h). Until a BLE central subscribes or
+    // a recording is started nothing is demanded, so the pipeline tasks start in standby.
+    esp_err_t pm = power_pm_init();
+    if (pm != ESP_OK) {
+        ESP_LOGW(ADC_TAG, "Power management off (%s): standby still gates the pipeline", esp_err_to_name(pm));
     }
 
-    // --- Task for ADC Filtering ---
-    task_status = xTaskCreate(adc_filtering, "ADC Filtering", 2048, NULL, 4, NULL);
-    if (task_status == pdPASS) {
-        ESP_LOGI(ADC_TAG, "ADC Filtering task created successfully!");
+    // --- Pipeline Tasks ---
+    // Core, priority and stack of every task come from one table (see task_layout.h); the preset
+    // is picked at build time with TASK_LAYOUT_PRESET. The default pins acquisition + DSP to
+    // APP_CPU and leaves PRO_CPU to Bluedroid and the BLE tasks. ble_notifications is
+    // event-driven (sleeps until detect_events() wakes it). Built with -DTASK_LAYOUT_STATIC=1 the
+    // stacks and TCBs are static too and this step takes nothing from the heap.
+    const TaskFunction_t entry[TASK_ROLE_COUNT] = {
+        [TASK_ROLE_SAMPLING]   = adc_sampling,
+        [TASK_ROLE_FILTERING]  = adc_filtering,
+        [TASK_ROLE_BLE_NOTIFY] = ble_notifications,
+        [TASK_ROLE_BLE_STREAM] = ble_streaming,
+        [TASK_ROLE_RECORDER]   = rec_storage ? recorder_task : NULL,     // Blocked until 'rec start'
+    };
+    const task_layout_t *layout = task_layout_find(TASK_LAYOUT_PRESET);
+    if (layout == NULL) {
+        ESP_LOGW(ADC_TAG, "Unknown task layout '%s', using 'unpinned'", TASK_LAYOUT_PRESET);
+        layout = task_layout_find("unpinned");
+    }
+    task_layout_apply(layout, entry);
+    mem_budget_mark("tasks");
+
+    // --- Diagnostics Console (UART) ---
+    // 'latency' prints count / p50 / p99 / max per pipeline stage; 'latency reset' clears them.
+    // 'stages' prints what each DSP stage costs in CPU cycles; 'stages reset' clears it.
+    // 'mem' prints the memory budget report below again.
+    // 'power' prints the mode and the CPU duty cycle of every pipeline task.
+    // 'rec start' / 'rec stop' record a session to the 'eegrec' partition; 'rec' shows its state.
+    // The same numbers are readable over BLE from the latency stats characteristic.
+    // Each *_console_register() only adds its command to esp_console: the REPL is created and
+    // started here, and the commands are device-only (none of them build for the host).
+    esp_console_repl_t *repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    esp_console_dev_uart_config_t uart_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    repl_config.prompt = "eeg>";
+    if (esp_console_new_repl_uart(&uart_config, &repl_config, &repl) == ESP_OK) {
+        esp_console_register_help_command();
+        latency_console_register();
+        adc_console_register();
+        task_layout_console_register();
+        mem_budget_console_register();
+        power_console_register();
+        recorder_console_register(rec_storage);
+        esp_console_start_repl(repl);
     } else {
-        ESP_LOGE(ADC_TAG, "Failed to create ADC task!");
+        ESP_LOGW(ADC_TAG, "Console unavailable; latency stats only over BLE");
     }
-
-    // --- Task for BLE Advertising & Notifications ---
-    task_status = xTaskCreate(ble_notifications, "BLE Notifications", 4096, NULL, 3, NULL);
-    if (task_status != pdPASS){
-        ESP_LOGE(BLE_TAG, "Failed to create BLE task!");
+    mem_budget_mark("console");
+
+    // --- Memory Budget Report ---
+    // After one second of running, so the stack high-water marks have seen a few pipeline passes.
+    vTaskDelay(pdMS_TO_TICKS(1000));
+    mem_budget_print(stdout);
+    task_layout_print(stdout);
+    if (!mem_budget_check()) {
+        ESP_LOGW(ADC_TAG, "Memory budget exceeded (static > %d bytes or free heap < %d bytes)",
+                 MEM_BUDGET_STATIC_LIMIT, MEM_BUDGET_HEAP_RESERVE);
     }
 
 }
@@ -27,6 +27,65 @@ extern void test_buffer_fills_and_wraps(void);
 extern void test_apply_bandpass_iir_behavior(void);
 extern void test_blink_detection_increments(void);
 extern void test_alpha_dominance(void);
+extern void test_adc_frame_decode_mock(void);
+extern void test_adc_ring_sequence_and_overrun(void);
+extern void test_bandpass_block_matches_single(void);
+extern void test_bandpass_saturates_full_scale(void);
+extern void test_bench_bandpass_block_vs_single(void);
+extern void test_sliding_bandpower_matches_batch(void);
+extern void test_spectral_fft_matches_dft(void);
+extern void test_spectral_band_powers(void);
+extern void test_bench_spectral_update(void);
+extern void test_bench_multichannel_scaling(void);
+extern void test_ble_stream_pack12_roundtrip(void);
+extern void test_ble_stream_fills_mtu(void);
+extern void test_ble_stream_gaps_and_errors(void);
+extern void test_bench_ble_stream_packing(void);
+extern void test_ble_txq_congested_link(void);
+extern void test_ble_txq_overflow_and_reset(void);
+extern void test_ble_pkt_round_trip(void);
+extern void test_ble_pkt_rejects_malformed(void);
+extern void test_ble_pkt_through_queue(void);
+extern void test_bench_ble_pkt_throughput(void);
+extern void test_event_notify_latency(void);
+extern void test_pipeline_synthetic_source(void);
+extern void test_file_source_formats(void);
+extern void test_sample_clock_sim_jitter(void);
+extern void test_biquad_q15_matches_float(void);
+extern void test_bandpower_q15_matches_float(void);
+extern void test_simd_kernels_match_reference(void);
+extern void test_robust_stats_tracks_steps(void);
+extern void test_blink_threshold_adapts_to_gain(void);
+extern void test_decim_chain_matches_fullrate(void);
+extern void test_decim_noise_floor_report(void);
+extern void test_dsp_graph_stages_and_counters(void);
+extern void test_pipeline_demand_gating(void);
+extern void test_notch_rejects_mains(void);
+extern void test_bench_run_counts_and_normalizes(void);
+extern void test_bench_report_formats(void);
+extern void test_latency_bucket_resolution(void);
+extern void test_latency_percentiles(void);
+extern void test_latency_concurrent_record(void);
+extern void test_latency_stats_pack(void);
+extern void test_task_layout_presets_valid(void);
+extern void test_task_layout_validate_rejects(void);
+extern void test_task_layout_apply(void);
+extern void test_eeg_codec_roundtrip(void);
+extern void test_eeg_codec_rejects_bad_input(void);
+extern void test_eeg_codec_resync(void);
+extern void test_eeg_codec_ratio_report(void);
+extern void test_recorder_remount_reads_back(void);
+extern void test_recorder_wrap_wears_evenly(void);
+extern void test_recorder_torn_page_skipped(void);
+extern void test_recorder_file_backend_throughput(void);
+extern void test_recorder_tap_stages_and_drains(void);
+extern void test_edf_source_reads_records(void);
+extern void test_replay_golden_compare(void);
+extern void test_replay_file_formats_throughput(void);
+extern void test_mem_budget_registry(void);
+extern void test_mem_budget_fits_static_limit(void);
+extern void test_power_demand_and_mode(void);
+extern void test_power_duty_accounting(void);
 
 void app_main(void)
 {
@@ -71,6 +130,65 @@ void app_main(void)
     RUN_TEST(test_apply_bandpass_iir_behavior);
     RUN_TEST(test_blink_detection_increments);
     RUN_TEST(test_alpha_dominance);
+    RUN_TEST(test_adc_frame_decode_mock);
+    RUN_TEST(test_adc_ring_sequence_and_overrun);
+    RUN_TEST(test_bandpass_block_matches_single);
+    RUN_TEST(test_bandpass_saturates_full_scale);
+    RUN_TEST(test_bench_bandpass_block_vs_single);
+    RUN_TEST(test_sliding_bandpower_matches_batch);
+    RUN_TEST(test_spectral_fft_matches_dft);
+    RUN_TEST(test_spectral_band_powers);
+    RUN_TEST(test_bench_spectral_update);
+    RUN_TEST(test_bench_multichannel_scaling);
+    RUN_TEST(test_ble_stream_pack12_roundtrip);
+    RUN_TEST(test_ble_stream_fills_mtu);
+    RUN_TEST(test_ble_stream_gaps_and_errors);
+    RUN_TEST(test_bench_ble_stream_packing);
+    RUN_TEST(test_ble_txq_congested_link);
+    RUN_TEST(test_ble_txq_overflow_and_reset);
+    RUN_TEST(test_ble_pkt_round_trip);
+    RUN_TEST(test_ble_pkt_rejects_malformed);
+    RUN_TEST(test_ble_pkt_through_queue);
+    RUN_TEST(test_bench_ble_pkt_throughput);
+    RUN_TEST(test_event_notify_latency);
+    RUN_TEST(test_pipeline_synthetic_source);
+    RUN_TEST(test_file_source_formats);
+    RUN_TEST(test_sample_clock_sim_jitter);
+    RUN_TEST(test_biquad_q15_matches_float);
+    RUN_TEST(test_bandpower_q15_matches_float);
+    RUN_TEST(test_simd_kernels_match_reference);
+    RUN_TEST(test_robust_stats_tracks_steps);
+    RUN_TEST(test_blink_threshold_adapts_to_gain);
+    RUN_TEST(test_decim_chain_matches_fullrate);
+    RUN_TEST(test_decim_noise_floor_report);
+    RUN_TEST(test_dsp_graph_stages_and_counters);
+    RUN_TEST(test_pipeline_demand_gating);
+    RUN_TEST(test_notch_rejects_mains);
+    RUN_TEST(test_bench_run_counts_and_normalizes);
+    RUN_TEST(test_bench_report_formats);
+    RUN_TEST(test_latency_bucket_resolution);
+    RUN_TEST(test_latency_percentiles);
+    RUN_TEST(test_latency_concurrent_record);
+    RUN_TEST(test_latency_stats_pack);
+    RUN_TEST(test_task_layout_presets_valid);
+    RUN_TEST(test_task_layout_validate_rejects);
+    RUN_TEST(test_task_layout_apply);
+    RUN_TEST(test_eeg_codec_roundtrip);
+    RUN_TEST(test_eeg_codec_rejects_bad_input);
+    RUN_TEST(test_eeg_codec_resync);
+    RUN_TEST(test_eeg_codec_ratio_report);
+    RUN_TEST(test_recorder_remount_reads_back);
+    RUN_TEST(test_recorder_wrap_wears_evenly);
+    RUN_TEST(test_recorder_torn_page_skipped);
+    RUN_TEST(test_recorder_file_backend_throughput);
+    RUN_TEST(test_recorder_tap_stages_and_drains);
+    RUN_TEST(test_edf_source_reads_records);
+    RUN_TEST(test_replay_golden_compare);
+    RUN_TEST(test_replay_file_formats_throughput);
+    RUN_TEST(test_mem_budget_registry);
+    RUN_TEST(test_mem_budget_fits_static_limit);
+    RUN_TEST(test_power_demand_and_mode);
+    RUN_TEST(test_power_duty_accounting);
 
     // Add more tests as you create them:
     // RUN_TEST(test_another_functionality);
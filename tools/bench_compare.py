@@ -0,0 +1,47 @@
+#!/usr/bin/env python3
+"""
+Compares two JSON reports from the bench/ project (e.g., last release vs. this build)
+and flags kernels whose median cost per sample grew by more than a threshold.
+
+    python3 tools/bench_compare.py baseline.json current.json [threshold_pct]   (default 10)
+
+Cycles/sample are compared when both reports have them (device runs), ns/sample otherwise.
+Exits 1 if any kernel regressed, so it can gate CI.
+"""
+import json
+import sys
+
+if len(sys.argv) < 3:
+    sys.exit(__doc__)
+
+with open(sys.argv[1]) as f:
+    base = json.load(f)
+with open(sys.argv[2]) as f:
+    cur = json.load(f)
+threshold = float(sys.argv[3]) if len(sys.argv) > 3 else 10.0
+
+if base["platform"] != cur["platform"]:
+    print("warning: comparing %s against %s" % (base["platform"], cur["platform"]))
+
+base_by_name = {r["name"]: r for r in base["results"]}
+regressed = 0
+
+print("%-28s %12s %12s %8s   (%s -> %s)" % ("kernel", "baseline", "current", "delta", base["version"], cur["version"]))
+for r in cur["results"]:
+    b = base_by_name.get(r["name"])
+    if b is None:
+        print("%-28s %12s %12.2f %8s" % (r["name"], "-", r["ns_per_sample"], "new"))
+        continue
+
+    metric = "cycles_per_sample" if b["cycles_per_sample"] is not None and r["cycles_per_sample"] is not None \
+        else "ns_per_sample"
+    old, new = b[metric], r[metric]
+    delta = 100.0 * (new - old) / old if old else 0.0
+    flag = ""
+    if delta > threshold:
+        flag = "  REGRESSION"
+        regressed += 1
+    print("%-28s %12.2f %12.2f %+7.1f%%%s" % (r["name"], old, new, delta, flag))
+
+print("%d kernel(s) regressed by more than %.0f%%" % (regressed, threshold))
+sys.exit(1 if regressed else 0)
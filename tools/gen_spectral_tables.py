@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""
+Generates components/adc/dsp_spectral_tables.h: the constant tables behind the
+radix-2 real FFT in dsp_spectral.c (twiddles, bit-reversal, Hann window).
+
+    python3 tools/gen_spectral_tables.py [fft_size ...]   (default 256 512 1024 2048)
+
+One block per size, selected with #if on SPECTRAL_FFT_SIZE, so only the tables of
+the FFT length in use end up in flash. Re-run after changing the sizes that
+dsp_spectral.h can pick.
+"""
+import math
+import os
+import sys
+
+SIZES = [int(a) for a in sys.argv[1:]] or [256, 512, 1024, 2048]
+for N in SIZES:
+    assert N >= 8 and N & (N - 1) == 0, "FFT size must be a power of two"
+    assert N // 2 <= 65536, "spectral_bitrev is uint16_t"
+
+out_path = os.path.join(os.path.dirname(__file__), "..", "components", "adc", "dsp_spectral_tables.h")
+
+
+def floats(values, per_line=6):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + " ".join("% .9ef," % v for v in values[i:i + per_line]))
+    return "\n".join(lines)
+
+
+def ints(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + " ".join("%4d," % v for v in values[i:i + per_line]))
+    return "\n".join(lines)
+
+
+def block(N):
+    HALF = N // 2
+    BITS = HALF.bit_length() - 1
+    twiddle_re = [math.cos(2 * math.pi * k / N) for k in range(HALF)]
+    twiddle_im = [-math.sin(2 * math.pi * k / N) for k in range(HALF)]
+    bitrev = [int(format(i, "0%db" % BITS)[::-1], 2) for i in range(HALF)]
+    # Periodic Hann (the right choice for Welch overlap-add)
+    window = [0.5 - 0.5 * math.cos(2 * math.pi * n / N) for n in range(N)]
+    window_power = sum(w * w for w in window)
+    return """#if SPECTRAL_FFT_SIZE == %d
+
+#define SPECTRAL_TABLES_FFT_SIZE   %d
+#define SPECTRAL_WINDOW_POWER      %.9ef   // sum(w[n]^2)
+
+// W_N^k = e^{-j 2 pi k / N}, k = 0 .. N/2 - 1 (the N/2 complex FFT uses every other entry)
+static const float spectral_twiddle_re[%d] = {
+%s
+};
+
+static const float spectral_twiddle_im[%d] = {
+%s
+};
+
+// Bit-reversed index for the N/2-point complex FFT
+static const uint16_t spectral_bitrev[%d] = {
+%s
+};
+
+// Periodic Hann window
+static const float spectral_window[%d] = {
+%s
+};
+
+#endif // SPECTRAL_FFT_SIZE == %d
+""" % (N, N, window_power, HALF, floats(twiddle_re), HALF, floats(twiddle_im),
+       HALF, ints(bitrev), N, floats(window), N)
+
+
+with open(out_path, "w") as f:
+    f.write("""// =============================
+// Spectral Engine Tables (GENERATED - do not edit)
+// =============================
+// Produced by tools/gen_spectral_tables.py for %s-point real FFTs; the block matching
+// SPECTRAL_FFT_SIZE (dsp_spectral.h) is compiled in.
+// Included by dsp_spectral.c only; everything lives in flash (.rodata).
+
+#ifndef DSP_SPECTRAL_TABLES_H
+#define DSP_SPECTRAL_TABLES_H
+
+""" % " / ".join(str(n) for n in SIZES))
+    f.write("\n".join(block(N) for N in SIZES))
+    f.write("""
+#endif // DSP_SPECTRAL_TABLES_H
+""")
+
+print("wrote %s (N=%s)" % (os.path.normpath(out_path), ", ".join(str(n) for n in SIZES)))